@@ -192,6 +192,9 @@ Vc_INTRINSIC __m256  convert(__m256  v, ConvertTag<float , float>) { return v; }
 Vc_INTRINSIC __m128  convert(__m256d v, ConvertTag<double, float>) { return _mm256_cvtpd_ps(v); }
 Vc_INTRINSIC __m256  convert(__m256i v, ConvertTag<int   , float>) { return _mm256_cvtepi32_ps(v); }
 Vc_INTRINSIC __m256  convert(__m256i v, ConvertTag<uint  , float>) {
+#ifdef Vc_IMPL_AVX512VL
+    return _mm256_cvtepu32_ps(v);
+#else
     // this is complicated because cvtepi32_ps only supports signed input. Thus, all
     // input values with the MSB set would produce a negative result. We can reuse the
     // cvtepi32_ps instruction if we unset the MSB. But then the rounding results can be
@@ -228,6 +231,7 @@ Vc_INTRINSIC __m256  convert(__m256i v, ConvertTag<uint  , float>) {
                       _mm256_add_ps(set2power31_ps(), _mm256_cvtepi32_ps(and_si256(
                                                           v, set1_epi32(0x000001ff))))),
         _mm256_castsi256_ps(cmplt_epi32(v, _mm256_setzero_si256())));
+#endif
 }
 Vc_INTRINSIC __m256  convert(__m128i v, ConvertTag<short , float>) { return _mm256_cvtepi32_ps(convert(v, ConvertTag< short, int>())); }
 Vc_INTRINSIC __m256  convert(__m128i v, ConvertTag<ushort, float>) { return _mm256_cvtepi32_ps(convert(v, ConvertTag<ushort, int>())); }
@@ -236,26 +240,39 @@ Vc_INTRINSIC __m256d convert(__m128  v, ConvertTag<float , double>) { return _mm
 Vc_INTRINSIC __m256d convert(__m256d v, ConvertTag<double, double>) { return v; }
 Vc_INTRINSIC __m256d convert(__m128i v, ConvertTag<int   , double>) { return _mm256_cvtepi32_pd(v); }
 Vc_INTRINSIC __m256d convert(__m128i v, ConvertTag<uint  , double>) {
+#ifdef Vc_IMPL_AVX512VL
+    return _mm256_cvtepu32_pd(v);
+#else
     using namespace AVX;
     return _mm256_add_pd(
         _mm256_cvtepi32_pd(_mm_xor_si128(v, _mm_setmin_epi32())),
-        set1_pd(1u << 31)); }
+        set1_pd(1u << 31));
+#endif
+}
 Vc_INTRINSIC __m256d convert(__m128i v, ConvertTag<short , double>) { return convert(convert(v, SSE::ConvertTag< short, int>()), ConvertTag<int, double>()); }
 Vc_INTRINSIC __m256d convert(__m128i v, ConvertTag<ushort, double>) { return convert(convert(v, SSE::ConvertTag<ushort, int>()), ConvertTag<int, double>()); }
 
 Vc_INTRINSIC __m128i convert(__m256i v, ConvertTag<int   , short>) {
+#ifdef Vc_IMPL_AVX512VL
+    return _mm256_cvtepi32_epi16(v);
+#else
     const auto tmp0 = _mm_unpacklo_epi16(lo128(v), hi128(v));
     const auto tmp1 = _mm_unpackhi_epi16(lo128(v), hi128(v));
     const auto tmp2 = _mm_unpacklo_epi16(tmp0, tmp1);
     const auto tmp3 = _mm_unpackhi_epi16(tmp0, tmp1);
     return _mm_unpacklo_epi16(tmp2, tmp3);
+#endif
 }
 Vc_INTRINSIC __m128i convert(__m256i v, ConvertTag<uint  , short>) {
+#ifdef Vc_IMPL_AVX512VL
+    return _mm256_cvtepi32_epi16(v);
+#else
     const auto tmp0 = _mm_unpacklo_epi16(lo128(v), hi128(v));
     const auto tmp1 = _mm_unpackhi_epi16(lo128(v), hi128(v));
     const auto tmp2 = _mm_unpacklo_epi16(tmp0, tmp1);
     const auto tmp3 = _mm_unpackhi_epi16(tmp0, tmp1);
     return _mm_unpacklo_epi16(tmp2, tmp3);
+#endif
 }
 Vc_INTRINSIC __m128i convert(__m256  v, ConvertTag<float , short>) { return convert(convert(v, ConvertTag<float, int>()), ConvertTag<int, short>()); }
 Vc_INTRINSIC __m128i convert(__m256d v, ConvertTag<double, short>) { return convert(convert(v, ConvertTag<double, int>()), SSE::ConvertTag<int, short>()); }
@@ -263,24 +280,191 @@ Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<short , short>) { return v; }
 Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ushort, short>) { return v; }
 
 Vc_INTRINSIC __m128i convert(__m256i v, ConvertTag<int   , ushort>) {
+#ifdef Vc_IMPL_AVX512VL
+    return _mm256_cvtepi32_epi16(v);
+#else
     auto tmp0 = _mm_unpacklo_epi16(lo128(v), hi128(v));
     auto tmp1 = _mm_unpackhi_epi16(lo128(v), hi128(v));
     auto tmp2 = _mm_unpacklo_epi16(tmp0, tmp1);
     auto tmp3 = _mm_unpackhi_epi16(tmp0, tmp1);
     return _mm_unpacklo_epi16(tmp2, tmp3);
+#endif
 }
 Vc_INTRINSIC __m128i convert(__m256i v, ConvertTag<uint  , ushort>) {
+#ifdef Vc_IMPL_AVX512VL
+    return _mm256_cvtepi32_epi16(v);
+#else
     auto tmp0 = _mm_unpacklo_epi16(lo128(v), hi128(v));
     auto tmp1 = _mm_unpackhi_epi16(lo128(v), hi128(v));
     auto tmp2 = _mm_unpacklo_epi16(tmp0, tmp1);
     auto tmp3 = _mm_unpackhi_epi16(tmp0, tmp1);
     return _mm_unpacklo_epi16(tmp2, tmp3);
+#endif
 }
 Vc_INTRINSIC __m128i convert(__m256  v, ConvertTag<float , ushort>) { return convert(convert(v, ConvertTag<float, uint>()), ConvertTag<uint, ushort>()); }
 Vc_INTRINSIC __m128i convert(__m256d v, ConvertTag<double, ushort>) { return convert(convert(v, ConvertTag<double, uint>()), SSE::ConvertTag<uint, ushort>()); }
 Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<short , ushort>) { return v; }
 Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ushort, ushort>) { return v; }
 
+#ifdef Vc_IMPL_AVX2
+// 8-bit and 64-bit integers {{{1
+// These overloads take the complete source register and return a complete destination
+// register. Lanes that do not receive a converted value are zero.
+Vc_INTRINSIC __m128i cvtepi64_epi32(__m256i v)
+{
+    return lo128(Mem::permute4x64<X0, X2, X1, X3>(_mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 0, 2, 0))));
+}
+
+// from schar/uchar {{{2
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<schar , schar >) { return v; }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<uchar , schar >) { return v; }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<schar , uchar >) { return v; }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<uchar , uchar >) { return v; }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<schar , short >) { return _mm256_cvtepi8_epi16(lo128(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<uchar , short >) { return _mm256_cvtepu8_epi16(lo128(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<schar , ushort>) { return _mm256_cvtepi8_epi16(lo128(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<uchar , ushort>) { return _mm256_cvtepu8_epi16(lo128(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<schar , int   >) { return _mm256_cvtepi8_epi32(lo128(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<uchar , int   >) { return _mm256_cvtepu8_epi32(lo128(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<schar , uint  >) { return _mm256_cvtepi8_epi32(lo128(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<uchar , uint  >) { return _mm256_cvtepu8_epi32(lo128(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<schar , llong >) { return _mm256_cvtepi8_epi64(lo128(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<uchar , llong >) { return _mm256_cvtepu8_epi64(lo128(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<schar , ullong>) { return _mm256_cvtepi8_epi64(lo128(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<uchar , ullong>) { return _mm256_cvtepu8_epi64(lo128(v)); }
+Vc_INTRINSIC __m256  convert(__m256i v, ConvertTag<schar , float >) { return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(lo128(v))); }
+Vc_INTRINSIC __m256  convert(__m256i v, ConvertTag<uchar , float >) { return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(lo128(v))); }
+Vc_INTRINSIC __m256d convert(__m256i v, ConvertTag<schar , double>) { return _mm256_cvtepi32_pd(_mm_cvtepi8_epi32(lo128(v))); }
+Vc_INTRINSIC __m256d convert(__m256i v, ConvertTag<uchar , double>) { return _mm256_cvtepi32_pd(_mm_cvtepu8_epi32(lo128(v))); }
+
+// from llong/ullong {{{2
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<llong , llong >) { return v; }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ullong, llong >) { return v; }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<llong , ullong>) { return v; }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ullong, ullong>) { return v; }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<llong , int   >) { return zeroExtend(cvtepi64_epi32(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ullong, int   >) { return zeroExtend(cvtepi64_epi32(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<llong , uint  >) { return zeroExtend(cvtepi64_epi32(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ullong, uint  >) { return zeroExtend(cvtepi64_epi32(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<llong , short >) { return zeroExtend(convert(cvtepi64_epi32(v), SSE::ConvertTag<int, ushort>())); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ullong, short >) { return zeroExtend(convert(cvtepi64_epi32(v), SSE::ConvertTag<int, ushort>())); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<llong , ushort>) { return zeroExtend(convert(cvtepi64_epi32(v), SSE::ConvertTag<int, ushort>())); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ullong, ushort>) { return zeroExtend(convert(cvtepi64_epi32(v), SSE::ConvertTag<int, ushort>())); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<llong , schar >) { return zeroExtend(convert(cvtepi64_epi32(v), SSE::ConvertTag<int, schar>())); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ullong, schar >) { return zeroExtend(convert(cvtepi64_epi32(v), SSE::ConvertTag<int, schar>())); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<llong , uchar >) { return zeroExtend(convert(cvtepi64_epi32(v), SSE::ConvertTag<int, schar>())); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ullong, uchar >) { return zeroExtend(convert(cvtepi64_epi32(v), SSE::ConvertTag<int, schar>())); }
+// there is no conversion instruction between 64-bit integers and floating-point before
+// AVX-512DQ, thus reuse the scalar-based SSE conversions
+template <typename T> Vc_INTRINSIC __m256 convert64ToFloat(__m256i v)
+{
+    return zeroExtend(_mm_movelh_ps(convert(lo128(v), SSE::ConvertTag<T, float>()),
+                                    convert(hi128(v), SSE::ConvertTag<T, float>())));
+}
+template <typename T> Vc_INTRINSIC __m256d convert64ToDouble(__m256i v)
+{
+    return concat(convert(lo128(v), SSE::ConvertTag<T, double>()),
+                  convert(hi128(v), SSE::ConvertTag<T, double>()));
+}
+Vc_INTRINSIC __m256  convert(__m256i v, ConvertTag<llong , float >) { return convert64ToFloat< llong>(v); }
+Vc_INTRINSIC __m256  convert(__m256i v, ConvertTag<ullong, float >) { return convert64ToFloat<ullong>(v); }
+Vc_INTRINSIC __m256d convert(__m256i v, ConvertTag<llong , double>) { return convert64ToDouble< llong>(v); }
+Vc_INTRINSIC __m256d convert(__m256i v, ConvertTag<ullong, double>) { return convert64ToDouble<ullong>(v); }
+
+// to schar/uchar {{{2
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<short , schar >) {
+    return zeroExtend(_mm_unpacklo_epi64(convert(lo128(v), SSE::ConvertTag<short, schar>()),
+                                         convert(hi128(v), SSE::ConvertTag<short, schar>())));
+}
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<int   , schar >) {
+    return zeroExtend(_mm_unpacklo_epi32(convert(lo128(v), SSE::ConvertTag<int, schar>()),
+                                         convert(hi128(v), SSE::ConvertTag<int, schar>())));
+}
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ushort, schar >) { return convert(v, ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<uint  , schar >) { return convert(v, ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m256i convert(__m256  v, ConvertTag<float , schar >) { return convert(_mm256_cvttps_epi32(v), ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m256i convert(__m256d v, ConvertTag<double, schar >) { return zeroExtend(convert(_mm256_cvttpd_epi32(v), SSE::ConvertTag<int, schar>())); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<short , uchar >) { return convert(v, ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ushort, uchar >) { return convert(v, ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<int   , uchar >) { return convert(v, ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<uint  , uchar >) { return convert(v, ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m256i convert(__m256  v, ConvertTag<float , uchar >) { return convert(v, ConvertTag<float, schar>()); }
+Vc_INTRINSIC __m256i convert(__m256d v, ConvertTag<double, uchar >) { return convert(v, ConvertTag<double, schar>()); }
+
+// to llong/ullong {{{2
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<short , llong >) { return _mm256_cvtepi16_epi64(lo128(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ushort, llong >) { return _mm256_cvtepu16_epi64(lo128(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<int   , llong >) { return _mm256_cvtepi32_epi64(lo128(v)); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<uint  , llong >) { return _mm256_cvtepu32_epi64(lo128(v)); }
+Vc_INTRINSIC __m256i convert(__m256  v, ConvertTag<float , llong >) {
+    const __m128 tmp = lo128(v);
+    return concat(convert(tmp, SSE::ConvertTag<float, llong>()),
+                  convert(_mm_movehl_ps(tmp, tmp), SSE::ConvertTag<float, llong>()));
+}
+Vc_INTRINSIC __m256i convert(__m256d v, ConvertTag<double, llong >) {
+    return concat(convert(lo128(v), SSE::ConvertTag<double, llong>()),
+                  convert(hi128(v), SSE::ConvertTag<double, llong>()));
+}
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<short , ullong>) { return convert(v, ConvertTag<short, llong>()); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ushort, ullong>) { return convert(v, ConvertTag<ushort, llong>()); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<int   , ullong>) { return convert(v, ConvertTag<int, llong>()); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<uint  , ullong>) { return convert(v, ConvertTag<uint, llong>()); }
+Vc_INTRINSIC __m256i convert(__m256  v, ConvertTag<float , ullong>) {
+    const __m128 tmp = lo128(v);
+    return concat(convert(tmp, SSE::ConvertTag<float, ullong>()),
+                  convert(_mm_movehl_ps(tmp, tmp), SSE::ConvertTag<float, ullong>()));
+}
+Vc_INTRINSIC __m256i convert(__m256d v, ConvertTag<double, ullong>) {
+    return concat(convert(lo128(v), SSE::ConvertTag<double, ullong>()),
+                  convert(hi128(v), SSE::ConvertTag<double, ullong>()));
+}
+// }}}2
+#endif  // Vc_IMPL_AVX2
+
+// half-precision {{{2
+// The eight 16-bit values of a float16/bfloat16 vector occupy one __m128i.
+Vc_INTRINSIC __m256  convert(__m128i v, ConvertTag<float16, float>)
+{
+#ifdef Vc_IMPL_F16C
+    return _mm256_cvtph_ps(v);
+#else
+    return concat(SSE::convert(v, SSE::ConvertTag<float16, float>()),
+                  SSE::convert(_mm_unpackhi_epi64(v, v), SSE::ConvertTag<float16, float>()));
+#endif
+}
+Vc_INTRINSIC __m128i convert(__m256  v, ConvertTag<float, float16>)
+{
+#ifdef Vc_IMPL_F16C
+    return _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT);
+#else
+    return _mm_unpacklo_epi64(SSE::convert(lo128(v), SSE::ConvertTag<float, float16>()),
+                              SSE::convert(hi128(v), SSE::ConvertTag<float, float16>()));
+#endif
+}
+Vc_INTRINSIC __m256  convert(__m128i v, ConvertTag<bfloat16, float>)
+{
+    return concat(_mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), v)),
+                  _mm_castsi128_ps(_mm_unpackhi_epi16(_mm_setzero_si128(), v)));
+}
+Vc_INTRINSIC __m128i convert(__m256  v, ConvertTag<float, bfloat16>)
+{
+#ifdef Vc_IMPL_AVX2
+    // same algorithm as Detail::floatToBfloat16
+    const __m256i f = _mm256_castps_si256(v);
+    const __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(f, 16), _mm256_set1_epi32(1));
+    __m256i o = _mm256_srli_epi32(
+        _mm256_add_epi32(_mm256_add_epi32(f, _mm256_set1_epi32(0x7fff)), lsb), 16);
+    o = _mm256_blendv_epi8(
+        o, _mm256_or_si256(_mm256_srli_epi32(f, 16), _mm256_set1_epi32(0x40)),
+        _mm256_castps_si256(_mm256_cmp_ps(v, v, _CMP_UNORD_Q)));
+    return lo128(Mem::permute4x64<X0, X2, X1, X3>(_mm256_packus_epi32(o, o)));
+#else
+    return _mm_unpacklo_epi64(SSE::convert(lo128(v), SSE::ConvertTag<float, bfloat16>()),
+                              SSE::convert(hi128(v), SSE::ConvertTag<float, bfloat16>()));
+#endif
+}
+// }}}2
+
 template <typename From, typename To>
 Vc_INTRINSIC auto convert(
     typename std::conditional<(sizeof(From) < sizeof(To)),
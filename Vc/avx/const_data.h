@@ -38,7 +38,7 @@ namespace AVX
 
 alignas(64) extern const unsigned int   _IndexesFromZero32[ 8];
 alignas(16) extern const unsigned short _IndexesFromZero16[16];
-alignas(16) extern const unsigned char  _IndexesFromZero8 [32];
+alignas(32) extern const unsigned char  _IndexesFromZero8 [32];
 
 struct alignas(64) c_general
 {
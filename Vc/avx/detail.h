@@ -431,6 +431,18 @@ Vc_INTRINSIC __m256 load(const short *mem, Flags f, LoadTag<__m256, float>)
 {
     return AVX::convert<short, float>(load16(mem, f));
 }
+template <typename Flags>
+Vc_INTRINSIC __m256 load(const float16 *mem, Flags f, LoadTag<__m256, float>)
+{
+    return AVX::convert(load16(reinterpret_cast<const ushort *>(mem), f),
+                        AVX::ConvertTag<float16, float>());
+}
+template <typename Flags>
+Vc_INTRINSIC __m256 load(const bfloat16 *mem, Flags f, LoadTag<__m256, float>)
+{
+    return AVX::convert(load16(reinterpret_cast<const ushort *>(mem), f),
+                        AVX::ConvertTag<bfloat16, float>());
+}
 /*
 template<typename Flags> struct LoadHelper<float, unsigned char, Flags> {
     static __m256 load(const unsigned char *mem, Flags)
@@ -583,6 +595,42 @@ template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<16, 4, __m256>(__m256i k)
     return _mm256_castsi256_ps(AVX::concat(_mm_unpacklo_epi32(tmp, tmp), _mm_unpackhi_epi32(tmp, tmp)));
 }
 
+#ifdef Vc_IMPL_AVX2
+// 32 -> 4, 8, 16
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<32, 4, __m256>(__m256i k)
+{
+    return _mm256_castsi256_ps(_mm256_cvtepi8_epi64(AVX::lo128(k)));
+}
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<32, 8, __m256>(__m256i k)
+{
+    return _mm256_castsi256_ps(_mm256_cvtepi8_epi32(AVX::lo128(k)));
+}
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<32, 16, __m256>(__m256i k)
+{
+    return _mm256_castsi256_ps(_mm256_cvtepi8_epi16(AVX::lo128(k)));
+}
+
+// 4, 8, 16 -> 32
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<4, 32, __m256>(__m256i k)
+{
+    // aaaaaaaa bbbbbbbb cccccccc dddddddd -> abcd 0000 0000 0000 0000 0000 0000 0000
+    return AVX::zeroExtend(AVX::avx_cast<__m128>(_mm_packs_epi16(
+        AVX::avx_cast<__m128i>(mask_cast<4, 8, __m128>(k)), _mm_setzero_si128())));
+}
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<8, 32, __m256>(__m256i k)
+{
+    // aaaa bbbb cccc dddd eeee ffff gggg hhhh -> abcd efgh 0000 0000 0000 0000 0000 0000
+    return AVX::zeroExtend(AVX::avx_cast<__m128>(_mm_packs_epi16(
+        AVX::avx_cast<__m128i>(mask_cast<8, 8, __m128>(k)), _mm_setzero_si128())));
+}
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<16, 32, __m256>(__m256i k)
+{
+    // aabb ccdd ... -> abcd ... 0000 ...
+    return AVX::zeroExtend(
+        AVX::avx_cast<__m128>(_mm_packs_epi16(AVX::lo128(k), AVX::hi128(k))));
+}
+#endif
+
 // allone{{{1
 template<> Vc_INTRINSIC Vc_CONST __m256  allone<__m256 >() { return AVX::setallone_ps(); }
 template<> Vc_INTRINSIC Vc_CONST __m256i allone<__m256i>() { return AVX::setallone_si256(); }
@@ -602,6 +650,8 @@ Vc_INTRINSIC Vc_CONST __m256i one( short) { return AVX::setone_epi16(); }
 Vc_INTRINSIC Vc_CONST __m256i one(ushort) { return AVX::setone_epu16(); }
 Vc_INTRINSIC Vc_CONST __m256i one( schar) { return AVX::setone_epi8 (); }
 Vc_INTRINSIC Vc_CONST __m256i one( uchar) { return AVX::setone_epu8 (); }
+Vc_INTRINSIC Vc_CONST __m256i one( llong) { return AVX::setone_epi64(); }
+Vc_INTRINSIC Vc_CONST __m256i one(ullong) { return AVX::setone_epu64(); }
 
 // negate{{{1
 Vc_ALWAYS_INLINE Vc_CONST __m256 negate(__m256 v, std::integral_constant<std::size_t, 4>)
@@ -620,6 +670,14 @@ Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::
 {
     return AVX::sign_epi16(v, Detail::allone<__m256i>());
 }
+Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 1>)
+{
+    return AVX::sign_epi8(v, Detail::allone<__m256i>());
+}
+Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 8>)
+{
+    return AVX::sub_epi64(_mm256_setzero_si256(), v);
+}
 
 // xor_{{{1
 Vc_INTRINSIC __m256 xor_(__m256 a, __m256 b) { return _mm256_xor_ps(a, b); }
@@ -691,6 +749,12 @@ Vc_INTRINSIC __m256i abs(__m256i a,  short) { return AVX::abs_epi16(a); }
 Vc_INTRINSIC __m256i abs(__m256i a, ushort) { return a; }
 Vc_INTRINSIC __m256i abs(__m256i a,  schar) { return AVX::abs_epi8 (a); }
 Vc_INTRINSIC __m256i abs(__m256i a,  uchar) { return a; }
+Vc_INTRINSIC __m256i abs(__m256i a,  llong)
+{
+    const __m256i sign = AVX::cmpgt_epi64(_mm256_setzero_si256(), a);
+    return AVX::sub_epi64(xor_(a, sign), sign);
+}
+Vc_INTRINSIC __m256i abs(__m256i a, ullong) { return a; }
 
 // add{{{1
 Vc_INTRINSIC __m256  add(__m256  a, __m256  b,  float) { return _mm256_add_ps(a, b); }
@@ -699,6 +763,10 @@ Vc_INTRINSIC __m256i add(__m256i a, __m256i b,    int) { return AVX::add_epi32(a
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b,   uint) { return AVX::add_epi32(a, b); }
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  short) { return AVX::add_epi16(a, b); }
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b, ushort) { return AVX::add_epi16(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  schar) { return AVX::add_epi8 (a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  uchar) { return AVX::add_epi8 (a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  llong) { return AVX::add_epi64(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b, ullong) { return AVX::add_epi64(a, b); }
 
 // sub{{{1
 Vc_INTRINSIC __m256  sub(__m256  a, __m256  b,  float) { return _mm256_sub_ps(a, b); }
@@ -707,6 +775,10 @@ Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,    int) { return AVX::sub_epi32(a
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,   uint) { return AVX::sub_epi32(a, b); }
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  short) { return AVX::sub_epi16(a, b); }
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b, ushort) { return AVX::sub_epi16(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  schar) { return AVX::sub_epi8 (a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  uchar) { return AVX::sub_epi8 (a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  llong) { return AVX::sub_epi64(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b, ullong) { return AVX::sub_epi64(a, b); }
 
 // mul{{{1
 Vc_INTRINSIC __m256  mul(__m256  a, __m256  b,  float) { return _mm256_mul_ps(a, b); }
@@ -715,6 +787,25 @@ Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,    int) { return AVX::mullo_epi32
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,   uint) { return AVX::mullo_epi32(a, b); }
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  short) { return AVX::mullo_epi16(a, b); }
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b, ushort) { return AVX::mullo_epi16(a, b); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  uchar)
+{
+    // there is no 8-bit multiplication: multiply the even and odd bytes as 16-bit values
+    using namespace AVX;
+    const __m256i lowByte = _mm256_set1_epi16(0x00ff);
+    const __m256i even = and_(mullo_epi16(a, b), lowByte);
+    const __m256i odd = slli_epi16<8>(mullo_epi16(srli_epi16<8>(a), srli_epi16<8>(b)));
+    return or_(even, odd);
+}
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  schar) { return mul(a, b, uchar()); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b, ullong)
+{
+    // lo(a) * lo(b) + ((hi(a) * lo(b) + lo(a) * hi(b)) << 32)
+    using namespace AVX;
+    const __m256i cross = add_epi64(mul_epu32(srli_epi64<32>(a), b),
+                                    mul_epu32(a, srli_epi64<32>(b)));
+    return add_epi64(mul_epu32(a, b), slli_epi64<32>(cross));
+}
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  llong) { return mul(a, b, ullong()); }
 
 // mul{{{1
 Vc_INTRINSIC __m256  div(__m256  a, __m256  b,  float) { return _mm256_div_ps(a, b); }
@@ -890,30 +981,67 @@ template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,    int) { return
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,   uint) { return AVX::srli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  short) { return AVX::srai_epi16<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a, ushort) { return AVX::srli_epi16<shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  schar) { return AVX::srai_epi8 <shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  uchar) { return AVX::srli_epi8 <shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a, ullong) { return AVX::srli_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  llong)
+{
+    // there is no 64-bit arithmetic shift before AVX-512: ((a ^ s) >> shift) ^ s
+    const __m256i sign = AVX::cmpgt_epi64(_mm256_setzero_si256(), a);
+    return xor_(AVX::srli_epi64<shift>(xor_(a, sign)), sign);
+}
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  uchar) { return and_(AVX::srli_epi16<shift>(a), _mm256_set1_epi8(static_cast<char>(0xff >> shift))); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  schar)
+{
+    // there are no 8-bit shifts: shift the even bytes in the high half of 16-bit lanes
+    const __m256i even = AVX::srai_epi16<shift + 8>(AVX::slli_epi16<8>(a));
+    const __m256i odd = AVX::srai_epi16<shift>(a);
+    return or_(and_(even, _mm256_set1_epi16(0x00ff)), andnot_(_mm256_set1_epi16(0x00ff), odd));
+}
 
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,    int) { return AVX::sra_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,   uint) { return AVX::srl_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  short) { return AVX::sra_epi16(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift, ushort) { return AVX::srl_epi16(a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  schar) { return AVX::sra_epi8 (a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  uchar) { return AVX::srl_epi8 (a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift, ullong) { return AVX::srl_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  llong)
+{
+    const __m256i sign = AVX::cmpgt_epi64(_mm256_setzero_si256(), a);
+    return xor_(AVX::srl_epi64(xor_(a, sign), _mm_cvtsi32_si128(shift)), sign);
+}
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  uchar)
+{
+    return and_(AVX::srl_epi16(a, _mm_cvtsi32_si128(shift)),
+                _mm256_set1_epi8(static_cast<char>(0xff >> shift)));
+}
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  schar)
+{
+    const __m256i even =
+        AVX::sra_epi16(AVX::slli_epi16<8>(a), _mm_cvtsi32_si128(shift + 8));
+    const __m256i odd = AVX::sra_epi16(a, _mm_cvtsi32_si128(shift));
+    return or_(and_(even, _mm256_set1_epi16(0x00ff)), andnot_(_mm256_set1_epi16(0x00ff), odd));
+}
 
 // shiftLeft{{{1
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,    int) { return AVX::slli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,   uint) { return AVX::slli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  short) { return AVX::slli_epi16<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a, ushort) { return AVX::slli_epi16<shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  schar) { return AVX::slli_epi8 <shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  uchar) { return AVX::slli_epi8 <shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  llong) { return AVX::slli_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a, ullong) { return AVX::slli_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  schar) { return and_(AVX::slli_epi16<shift>(a), _mm256_set1_epi8(static_cast<char>(0xff << shift))); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  uchar) { return and_(AVX::slli_epi16<shift>(a), _mm256_set1_epi8(static_cast<char>(0xff << shift))); }
 
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,    int) { return AVX::sll_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,   uint) { return AVX::sll_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  short) { return AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift, ushort) { return AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  schar) { return AVX::sll_epi8 (a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  uchar) { return AVX::sll_epi8 (a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  llong) { return AVX::sll_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift, ullong) { return AVX::sll_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  uchar)
+{
+    return and_(AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)),
+                _mm256_set1_epi8(static_cast<char>(0xff << shift)));
+}
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  schar) { return shiftLeft(a, shift, uchar()); }
 
 // zeroExtendIfNeeded{{{1
 Vc_INTRINSIC __m256  zeroExtendIfNeeded(__m256  x) { return x; }
@@ -933,6 +1061,8 @@ Vc_INTRINSIC __m256i avx_broadcast(ushort x) { return _mm256_set1_epi16(x); }
 Vc_INTRINSIC __m256i avx_broadcast(  char x) { return _mm256_set1_epi8(x); }
 Vc_INTRINSIC __m256i avx_broadcast( schar x) { return _mm256_set1_epi8(x); }
 Vc_INTRINSIC __m256i avx_broadcast( uchar x) { return _mm256_set1_epi8(x); }
+Vc_INTRINSIC __m256i avx_broadcast( llong x) { return _mm256_set1_epi64x(x); }
+Vc_INTRINSIC __m256i avx_broadcast(ullong x) { return _mm256_set1_epi64x(x); }
 
 // sorted{{{1
 template <Vc::Implementation Impl, typename T,
@@ -1169,6 +1299,32 @@ static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 32 && N == 16), V> rotated(
     }
     return avx_cast<V>(_mm256_setzero_ps());
 }
+
+template <typename T, size_t N, typename V>
+static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 32 && N == 32), V> rotated(
+    V v, int amount)
+{
+    using namespace AVX;
+    amount = static_cast<unsigned int>(amount) % N;
+    __m256i lo = avx_cast<__m256i>(v);
+    __m256i hi = Mem::permute128<X1, X0>(lo);
+    if (amount >= 16) {
+        std::swap(lo, hi);
+        amount -= 16;
+    }
+    switch (amount) {
+#define Vc_CASE_(n_)                                                                     \
+    case n_:                                                                             \
+        return avx_cast<V>(_mm256_alignr_epi8(hi, lo, n_))
+    case 0:
+        return avx_cast<V>(lo);
+    Vc_CASE_(1); Vc_CASE_(2); Vc_CASE_(3); Vc_CASE_(4); Vc_CASE_(5);
+    Vc_CASE_(6); Vc_CASE_(7); Vc_CASE_(8); Vc_CASE_(9); Vc_CASE_(10);
+    Vc_CASE_(11); Vc_CASE_(12); Vc_CASE_(13); Vc_CASE_(14); Vc_CASE_(15);
+#undef Vc_CASE_
+    }
+    return avx_cast<V>(_mm256_setzero_ps());
+}
 #endif  // Vc_IMPL_AVX2
 
 // testc{{{1
@@ -1322,6 +1478,11 @@ template <> Vc_INTRINSIC Vc_CONST int mask_to_int<16>(__m256i k)
 {
     return _pext_u32(movemask(k), 0x55555555u);
 }
+#else
+template <> Vc_INTRINSIC Vc_CONST int mask_to_int<16>(__m256i k)
+{
+    return _mm_movemask_epi8(_mm_packs_epi16(AVX::lo128(k), AVX::hi128(k)));
+}
 #endif
 template <> Vc_INTRINSIC Vc_CONST int mask_to_int<32>(__m256i k)
 {
@@ -2163,6 +2324,96 @@ template<typename V> struct InterleaveImpl<V, 4, 32> {
         deinterleave(data + 6, i, v6, v7);
     }/*}}}*/
 };
+
+// compress/expand{{{1
+/**\internal
+ * Moves the \p N lanes of \p v where \p bits is set to the front, preserving their
+ * order, and zeroes the remaining lanes.
+ *
+ * The generic implementation compresses both 128-bit halves and then shifts the high
+ * result into place.
+ */
+template <std::size_t N> Vc_INTRINSIC __m256i compress(__m256i v, unsigned int bits)
+{
+    constexpr std::size_t H = N / 2;
+    const unsigned int lo = bits & ((1u << H) - 1);
+    const int loBytes = popcnt32(lo) * (32 / N);
+    const __m128i a = compress<H>(AVX::lo128(v), lo);
+    const __m128i b = compress<H>(AVX::hi128(v), bits >> H);
+    return AVX::concat(_mm_or_si128(a, shifted_bytes(b, -loBytes)),
+                       shifted_bytes(b, 16 - loBytes));
+}
+
+/**\internal
+ * The inverse of compress: distributes the leading lanes of \p v, in order, to the lanes
+ * where \p bits is set and zeroes the remaining lanes.
+ */
+template <std::size_t N> Vc_INTRINSIC __m256i expand(__m256i v, unsigned int bits)
+{
+    constexpr std::size_t H = N / 2;
+    const unsigned int lo = bits & ((1u << H) - 1);
+    const int loBytes = popcnt32(lo) * (32 / N);
+    const __m128i a = AVX::lo128(v);
+    const __m128i b = AVX::hi128(v);
+    // the high half continues with the lane after the last one the low half used
+    const __m128i next =
+        _mm_or_si128(shifted_bytes(a, loBytes), shifted_bytes(b, loBytes - 16));
+    return AVX::concat(expand<H>(a, lo), expand<H>(next, bits >> H));
+}
+
+#ifdef Vc_IMPL_AVX2
+// 32- and 64-bit lanes can be permuted across the 128-bit halves directly
+template <> Vc_INTRINSIC __m256i compress<8>(__m256i v, unsigned int bits)
+{
+#ifdef Vc_IMPL_AVX512VL
+    return _mm256_maskz_compress_epi32(bits, v);
+#else
+    const __m256i idx = _mm256_cvtepu8_epi32(compress_row(bits));
+    return _mm256_andnot_si256(_mm256_cmpgt_epi32(idx, _mm256_set1_epi32(7)),
+                               _mm256_permutevar8x32_epi32(v, idx));
+#endif
+}
+template <> Vc_INTRINSIC __m256i expand<8>(__m256i v, unsigned int bits)
+{
+#ifdef Vc_IMPL_AVX512VL
+    return _mm256_maskz_expand_epi32(bits, v);
+#else
+    const __m256i idx = _mm256_cvtepu8_epi32(expand_row(bits));
+    return _mm256_andnot_si256(_mm256_cmpgt_epi32(idx, _mm256_set1_epi32(7)),
+                               _mm256_permutevar8x32_epi32(v, idx));
+#endif
+}
+
+/**\internal
+ * Turns the 64-bit lane indices in \p idx into a permutevar8x32 control and permutes \p
+ * v. Lanes with an index larger than 3 are zeroed.
+ */
+Vc_INTRINSIC __m256i permute_epi64_or_zero(__m256i v, __m256i idx)
+{
+    const __m256i lo = _mm256_add_epi64(idx, idx);
+    const __m256i ctrl = _mm256_or_si256(
+        lo, _mm256_slli_epi64(_mm256_add_epi64(lo, _mm256_set1_epi64x(1)), 32));
+    return _mm256_andnot_si256(_mm256_cmpgt_epi64(idx, _mm256_set1_epi64x(3)),
+                               _mm256_permutevar8x32_epi32(v, ctrl));
+}
+template <> Vc_INTRINSIC __m256i compress<4>(__m256i v, unsigned int bits)
+{
+#ifdef Vc_IMPL_AVX512VL
+    return _mm256_maskz_compress_epi64(bits, v);
+#else
+    return permute_epi64_or_zero(v, _mm256_cvtepu8_epi64(compress_row(bits)));
+#endif
+}
+template <> Vc_INTRINSIC __m256i expand<4>(__m256i v, unsigned int bits)
+{
+#ifdef Vc_IMPL_AVX512VL
+    return _mm256_maskz_expand_epi64(bits, v);
+#else
+    return permute_epi64_or_zero(v, _mm256_cvtepu8_epi64(expand_row(bits)));
+#endif
+}
+#endif  // Vc_IMPL_AVX2
+
 //}}}1
 }  // namespace Detail
 }  // namespace Vc
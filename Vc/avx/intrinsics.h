@@ -130,6 +130,8 @@ namespace AvxIntrinsics
     static Vc_INTRINSIC m256i Vc_CONST setone_epu16()  { return setone_epi16(); }
     static Vc_INTRINSIC m256i Vc_CONST setone_epi32()  { return _mm256_castps_si256(_mm256_broadcast_ss(reinterpret_cast<const float *>(&_IndexesFromZero32[1]))); }
     static Vc_INTRINSIC m256i Vc_CONST setone_epu32()  { return setone_epi32(); }
+    static Vc_INTRINSIC m256i Vc_CONST setone_epi64()  { return _mm256_set1_epi64x(1); }
+    static Vc_INTRINSIC m256i Vc_CONST setone_epu64()  { return setone_epi64(); }
 
     static Vc_INTRINSIC m256  Vc_CONST setone_ps()     { return _mm256_broadcast_ss(&c_general::oneFloat); }
     static Vc_INTRINSIC m256d Vc_CONST setone_pd()     { return _mm256_broadcast_sd(&c_general::oneDouble); }
@@ -149,6 +151,7 @@ namespace AvxIntrinsics
     static Vc_INTRINSIC m128i Vc_CONST _mm_setmin_epi32() { return _mm_castps_si128(_mm_broadcast_ss(reinterpret_cast<const float *>(&c_general::signMaskFloat[1]))); }
     static Vc_INTRINSIC m256i Vc_CONST setmin_epi16() { return _mm256_castps_si256(_mm256_broadcast_ss(reinterpret_cast<const float *>(c_general::minShort))); }
     static Vc_INTRINSIC m256i Vc_CONST setmin_epi32() { return _mm256_castps_si256(_mm256_broadcast_ss(reinterpret_cast<const float *>(&c_general::signMaskFloat[1]))); }
+    static Vc_INTRINSIC m256i Vc_CONST setmin_epi64() { return _mm256_castpd_si256(_mm256_broadcast_sd(reinterpret_cast<const double *>(&c_general::signMaskFloat[0]))); }
 
     template <int i>
     static Vc_INTRINSIC Vc_CONST unsigned char extract_epu8(__m128i x)
@@ -480,7 +483,12 @@ namespace AvxIntrinsics
         m128i a1 = extract128<1>(a0);
         m128i b1 = extract128<1>(b0);
         m128i m1 = extract128<1>(m0);
-        m128i r0 = _mm_blendv_epi8(_mm256_castsi256_si128(a0), _mm256_castsi256_si128(b0), _mm256_castsi256_si128(m0));
+        m128i m = _mm256_castsi256_si128(m0);
+#if defined Vc_GCC && defined __AVX512VL__
+        // see blendv_epi8 in sse/intrinsics.h: keeps GCC from dropping the inversion of a negated mask
+        asm("" : "+x"(m), "+x"(m1));
+#endif
+        m128i r0 = _mm_blendv_epi8(_mm256_castsi256_si128(a0), _mm256_castsi256_si128(b0), m);
         m128i r1 = _mm_blendv_epi8(a1, b1, m1);
         return insert128<1>(_mm256_castsi128_si256(r0), r1);
     }
@@ -508,6 +516,10 @@ template <int i> Vc_INTRINSIC Vc_CONST __m256i slli_si256(__m256i a0)
 /////////////////////////////////////////////////////////////////////////
 Vc_INTRINSIC Vc_CONST m256i blendv_epi8(__m256i a0, __m256i b0, __m256i m0)
 {
+#if defined Vc_GCC && defined __AVX512VL__
+    // see blendv_epi8 in sse/intrinsics.h: keeps GCC from dropping the inversion of a negated mask
+    asm("" : "+x"(m0));
+#endif
     return _mm256_blendv_epi8(a0, b0, m0);
 }
 Vc_INTRINSIC Vc_CONST int movemask_epi8(__m256i a0)
@@ -540,7 +552,18 @@ static Vc_INTRINSIC m256i cmplt_epu8(__m256i a, __m256i b) {
 static Vc_INTRINSIC m256i cmpgt_epu8(__m256i a, __m256i b) {
     return cmpgt_epi8(xor_si256(a, setmin_epi8()), xor_si256(b, setmin_epi8()));
 }
-#if defined(Vc_IMPL_XOP)
+static Vc_INTRINSIC m256i cmplt_epu64(__m256i a, __m256i b) {
+    return cmplt_epi64(xor_si256(a, setmin_epi64()), xor_si256(b, setmin_epi64()));
+}
+static Vc_INTRINSIC m256i cmpgt_epu64(__m256i a, __m256i b) {
+    return cmpgt_epi64(xor_si256(a, setmin_epi64()), xor_si256(b, setmin_epi64()));
+}
+#if defined(Vc_IMPL_AVX512VL)
+    static Vc_INTRINSIC m256i Vc_CONST cmplt_epu32(__m256i a, __m256i b) { return _mm256_movm_epi32(_mm256_cmplt_epu32_mask(a, b)); }
+    static Vc_INTRINSIC m256i Vc_CONST cmpgt_epu32(__m256i a, __m256i b) { return _mm256_movm_epi32(_mm256_cmpgt_epu32_mask(a, b)); }
+    static Vc_INTRINSIC m256i Vc_CONST cmplt_epu16(__m256i a, __m256i b) { return _mm256_movm_epi16(_mm256_cmplt_epu16_mask(a, b)); }
+    static Vc_INTRINSIC m256i Vc_CONST cmpgt_epu16(__m256i a, __m256i b) { return _mm256_movm_epi16(_mm256_cmpgt_epu16_mask(a, b)); }
+#elif defined(Vc_IMPL_XOP)
     Vc_AVX_TO_SSE_2_NEW(comlt_epu32)
     Vc_AVX_TO_SSE_2_NEW(comgt_epu32)
     Vc_AVX_TO_SSE_2_NEW(comlt_epu16)
@@ -589,13 +612,40 @@ static Vc_INTRINSIC void _mm256_maskstore(unsigned int *mem, const __m256i mask,
     _mm256_maskstore(reinterpret_cast<int *>(mem), mask, v);
 }
 static Vc_INTRINSIC void _mm256_maskstore(short *mem, const __m256i mask, const __m256i v) {
+#ifdef Vc_IMPL_AVX512VL
+    // AVX512BW+VL write-masking avoids the non-temporal maskmovdqu
+    _mm256_mask_storeu_epi16(mem, _mm256_movepi16_mask(mask), v);
+#else
     using namespace AVX;
     _mm_maskmoveu_si128(_mm256_castsi256_si128(v), _mm256_castsi256_si128(mask), reinterpret_cast<char *>(&mem[0]));
     _mm_maskmoveu_si128(extract128<1>(v), extract128<1>(mask), reinterpret_cast<char *>(&mem[8]));
+#endif
 }
 static Vc_INTRINSIC void _mm256_maskstore(unsigned short *mem, const __m256i mask, const __m256i v) {
     _mm256_maskstore(reinterpret_cast<short *>(mem), mask, v);
 }
+static Vc_INTRINSIC void _mm256_maskstore(signed char *mem, const __m256i mask, const __m256i v) {
+#ifdef Vc_IMPL_AVX512VL
+    _mm256_mask_storeu_epi8(mem, _mm256_movepi8_mask(mask), v);
+#else
+    using namespace AVX;
+    _mm_maskmoveu_si128(_mm256_castsi256_si128(v), _mm256_castsi256_si128(mask), reinterpret_cast<char *>(&mem[0]));
+    _mm_maskmoveu_si128(extract128<1>(v), extract128<1>(mask), reinterpret_cast<char *>(&mem[16]));
+#endif
+}
+static Vc_INTRINSIC void _mm256_maskstore(unsigned char *mem, const __m256i mask, const __m256i v) {
+    _mm256_maskstore(reinterpret_cast<signed char *>(mem), mask, v);
+}
+static Vc_INTRINSIC void _mm256_maskstore(long long *mem, const __m256i mask, const __m256i v) {
+#ifdef Vc_IMPL_AVX2
+    _mm256_maskstore_epi64(mem, mask, v);
+#else
+    _mm256_maskstore_pd(reinterpret_cast<double *>(mem), mask, _mm256_castsi256_pd(v));
+#endif
+}
+static Vc_INTRINSIC void _mm256_maskstore(unsigned long long *mem, const __m256i mask, const __m256i v) {
+    _mm256_maskstore(reinterpret_cast<long long *>(mem), mask, v);
+}
 
 #undef Vc_AVX_TO_SSE_1
 #undef Vc_AVX_TO_SSE_1_128
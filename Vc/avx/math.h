@@ -44,6 +44,42 @@ Vc_ALWAYS_INLINE AVX2::int_v    max(const AVX2::int_v    &x, const AVX2::int_v
 Vc_ALWAYS_INLINE AVX2::uint_v   max(const AVX2::uint_v   &x, const AVX2::uint_v   &y) { return _mm256_max_epu32(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::short_v  max(const AVX2::short_v  &x, const AVX2::short_v  &y) { return _mm256_max_epi16(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::ushort_v max(const AVX2::ushort_v &x, const AVX2::ushort_v &y) { return _mm256_max_epu16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::schar_v  min(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_min_epi8(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  min(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_min_epu8(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::schar_v  max(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_max_epi8(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  max(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_max_epu8(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::llong_v  min(const AVX2::llong_v  &x, const AVX2::llong_v  &y) { return _mm256_blendv_epi8(x.data(), y.data(), AVX::cmpgt_epi64(x.data(), y.data())); }
+Vc_ALWAYS_INLINE AVX2::ullong_v min(const AVX2::ullong_v &x, const AVX2::ullong_v &y) { return _mm256_blendv_epi8(x.data(), y.data(), AVX::cmpgt_epu64(x.data(), y.data())); }
+Vc_ALWAYS_INLINE AVX2::llong_v  max(const AVX2::llong_v  &x, const AVX2::llong_v  &y) { return _mm256_blendv_epi8(y.data(), x.data(), AVX::cmpgt_epi64(x.data(), y.data())); }
+Vc_ALWAYS_INLINE AVX2::ullong_v max(const AVX2::ullong_v &x, const AVX2::ullong_v &y) { return _mm256_blendv_epi8(y.data(), x.data(), AVX::cmpgt_epu64(x.data(), y.data())); }
+#endif
+
+// saturating arithmetic {{{1
+#ifdef Vc_IMPL_AVX2
+Vc_ALWAYS_INLINE AVX2::schar_v  add_sat(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_adds_epi8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  add_sat(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_adds_epu8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::short_v  add_sat(const AVX2::short_v  &x, const AVX2::short_v  &y) { return _mm256_adds_epi16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::ushort_v add_sat(const AVX2::ushort_v &x, const AVX2::ushort_v &y) { return _mm256_adds_epu16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::schar_v  sub_sat(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_subs_epi8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  sub_sat(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_subs_epu8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::short_v  sub_sat(const AVX2::short_v  &x, const AVX2::short_v  &y) { return _mm256_subs_epi16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::ushort_v sub_sat(const AVX2::ushort_v &x, const AVX2::ushort_v &y) { return _mm256_subs_epu16(x.data(), y.data()); }
+
+// byte shuffle {{{1
+Vc_ALWAYS_INLINE AVX2::uchar_v shuffle(const AVX2::uchar_v &x, const AVX2::uchar_v &indexes)
+{
+    // pshufb only permutes within 128-bit lanes: look up both halves of x and blend on
+    // bit 4 of the index. Indexes >= 32 get their most significant bit set, which makes
+    // pshufb return 0.
+    const __m256i idx = _mm256_adds_epu8(indexes.data(), _mm256_set1_epi8(0x60));
+    const __m256i fromLo = _mm256_shuffle_epi8(Mem::permute128<X0, X0>(x.data()), idx);
+    const __m256i fromHi = _mm256_shuffle_epi8(Mem::permute128<X1, X1>(x.data()), idx);
+    return _mm256_blendv_epi8(fromLo, fromHi, _mm256_slli_epi16(indexes.data(), 3));
+}
+Vc_ALWAYS_INLINE AVX2::schar_v shuffle(const AVX2::schar_v &x, const AVX2::uchar_v &indexes)
+{
+    return shuffle(AVX2::uchar_v(x.data()), indexes).data();
+}
 #endif
 Vc_ALWAYS_INLINE AVX2::float_v  min(const AVX2::float_v  &x, const AVX2::float_v  &y) { return _mm256_min_ps(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::double_v min(const AVX2::double_v &x, const AVX2::double_v &y) { return _mm256_min_pd(x.data(), y.data()); }
@@ -96,6 +132,14 @@ Vc_INTRINSIC Vc_CONST AVX2::short_v abs(AVX2::short_v x)
 {
     return _mm256_abs_epi16(x.data());
 }
+Vc_INTRINSIC Vc_CONST AVX2::schar_v abs(AVX2::schar_v x)
+{
+    return _mm256_abs_epi8(x.data());
+}
+Vc_INTRINSIC Vc_CONST AVX2::llong_v abs(AVX2::llong_v x)
+{
+    return Detail::abs(x.data(), llong());
+}
 #endif
 
 // isfinite {{{1
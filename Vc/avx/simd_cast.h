@@ -197,6 +197,102 @@ Vc_SIMD_CAST_AVX_2(   int_v, ushort_v);
 Vc_SIMD_CAST_AVX_2(  uint_v, ushort_v);
 Vc_SIMD_CAST_AVX_3(double_v, ushort_v);
 Vc_SIMD_CAST_AVX_4(double_v, ushort_v);
+
+// 8-bit and 64-bit integer AVX2::Vector {{{3
+Vc_SIMD_CAST_AVX_1( schar_v, double_v);
+Vc_SIMD_CAST_AVX_1( uchar_v, double_v);
+Vc_SIMD_CAST_AVX_1( llong_v, double_v);
+Vc_SIMD_CAST_AVX_1(ullong_v, double_v);
+Vc_SIMD_CAST_AVX_1( schar_v,  float_v);
+Vc_SIMD_CAST_AVX_1( uchar_v,  float_v);
+Vc_SIMD_CAST_AVX_1( llong_v,  float_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,  float_v);
+Vc_SIMD_CAST_AVX_1( schar_v,    int_v);
+Vc_SIMD_CAST_AVX_1( uchar_v,    int_v);
+Vc_SIMD_CAST_AVX_1( llong_v,    int_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,    int_v);
+Vc_SIMD_CAST_AVX_1( schar_v,   uint_v);
+Vc_SIMD_CAST_AVX_1( uchar_v,   uint_v);
+Vc_SIMD_CAST_AVX_1( llong_v,   uint_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,   uint_v);
+Vc_SIMD_CAST_AVX_1( schar_v,  short_v);
+Vc_SIMD_CAST_AVX_1( uchar_v,  short_v);
+Vc_SIMD_CAST_AVX_1( llong_v,  short_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,  short_v);
+Vc_SIMD_CAST_AVX_1( schar_v, ushort_v);
+Vc_SIMD_CAST_AVX_1( uchar_v, ushort_v);
+Vc_SIMD_CAST_AVX_1( llong_v, ushort_v);
+Vc_SIMD_CAST_AVX_1(ullong_v, ushort_v);
+Vc_SIMD_CAST_AVX_1(double_v,  schar_v);
+Vc_SIMD_CAST_AVX_1( float_v,  schar_v);
+Vc_SIMD_CAST_AVX_1(   int_v,  schar_v);
+Vc_SIMD_CAST_AVX_1(  uint_v,  schar_v);
+Vc_SIMD_CAST_AVX_1( short_v,  schar_v);
+Vc_SIMD_CAST_AVX_1(ushort_v,  schar_v);
+Vc_SIMD_CAST_AVX_1( uchar_v,  schar_v);
+Vc_SIMD_CAST_AVX_1( llong_v,  schar_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,  schar_v);
+Vc_SIMD_CAST_AVX_1(double_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1( float_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1(   int_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1(  uint_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1( short_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1(ushort_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1( schar_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1( llong_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1(double_v,  llong_v);
+Vc_SIMD_CAST_AVX_1( float_v,  llong_v);
+Vc_SIMD_CAST_AVX_1(   int_v,  llong_v);
+Vc_SIMD_CAST_AVX_1(  uint_v,  llong_v);
+Vc_SIMD_CAST_AVX_1( short_v,  llong_v);
+Vc_SIMD_CAST_AVX_1(ushort_v,  llong_v);
+Vc_SIMD_CAST_AVX_1( schar_v,  llong_v);
+Vc_SIMD_CAST_AVX_1( uchar_v,  llong_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,  llong_v);
+Vc_SIMD_CAST_AVX_1(double_v, ullong_v);
+Vc_SIMD_CAST_AVX_1( float_v, ullong_v);
+Vc_SIMD_CAST_AVX_1(   int_v, ullong_v);
+Vc_SIMD_CAST_AVX_1(  uint_v, ullong_v);
+Vc_SIMD_CAST_AVX_1( short_v, ullong_v);
+Vc_SIMD_CAST_AVX_1(ushort_v, ullong_v);
+Vc_SIMD_CAST_AVX_1( schar_v, ullong_v);
+Vc_SIMD_CAST_AVX_1( uchar_v, ullong_v);
+Vc_SIMD_CAST_AVX_1( llong_v, ullong_v);
+
+namespace Detail
+{
+template <typename T, typename U>
+using has_int8_or_int64 = std::integral_constant<
+    bool, (std::is_integral<T>::value && (sizeof(T) == 1 || sizeof(T) == 8)) ||
+              (std::is_integral<U>::value && (sizeof(U) == 1 || sizeof(U) == 8))>;
+}  // namespace Detail
+
+// 2, 4, and 8 AVX2::Vector to 1 8-bit or 64-bit integer AVX2::Vector {{{3
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1,
+          enable_if<(AVX2::is_vector<Return>::value &&
+                     Detail::has_int8_or_int64<typename Return::EntryType,
+                                               typename Return::EntryType>::value)> =
+              nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2,
+          AVX2::Vector<T> x3,
+          enable_if<(AVX2::is_vector<Return>::value &&
+                     Detail::has_int8_or_int64<typename Return::EntryType,
+                                               typename Return::EntryType>::value)> =
+              nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2,
+          AVX2::Vector<T> x3, AVX2::Vector<T> x4, AVX2::Vector<T> x5,
+          AVX2::Vector<T> x6, AVX2::Vector<T> x7,
+          enable_if<(AVX2::is_vector<Return>::value &&
+                     Detail::has_int8_or_int64<typename Return::EntryType,
+                                               typename Return::EntryType>::value)> =
+              nullarg);
 #endif
 
 // 1 SSE::Vector to 1 AVX2::Vector {{{2
@@ -214,6 +310,15 @@ Vc_SIMD_CAST_1(SSE::  uint_v, AVX2:: float_v);
 Vc_SIMD_CAST_1(SSE:: short_v, AVX2:: float_v);
 Vc_SIMD_CAST_1(SSE::ushort_v, AVX2:: float_v);
 
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::double_v);
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::double_v);
+Vc_SIMD_CAST_1(SSE:: llong_v, AVX2::double_v);
+Vc_SIMD_CAST_1(SSE::ullong_v, AVX2::double_v);
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2:: float_v);
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2:: float_v);
+Vc_SIMD_CAST_1(SSE:: llong_v, AVX2:: float_v);
+Vc_SIMD_CAST_1(SSE::ullong_v, AVX2:: float_v);
+
 #ifdef Vc_IMPL_AVX2
 Vc_SIMD_CAST_1(SSE::double_v, AVX2::   int_v);
 Vc_SIMD_CAST_1(SSE::double_v, AVX2::  uint_v);
@@ -359,6 +464,15 @@ Vc_SIMD_CAST_1(AVX2:: float_v, SSE::  uint_v);
 Vc_SIMD_CAST_1(AVX2:: float_v, SSE:: short_v);
 Vc_SIMD_CAST_1(AVX2:: float_v, SSE::ushort_v);
 
+Vc_SIMD_CAST_1(AVX2::double_v, SSE:: schar_v);
+Vc_SIMD_CAST_1(AVX2::double_v, SSE:: uchar_v);
+Vc_SIMD_CAST_1(AVX2::double_v, SSE:: llong_v);
+Vc_SIMD_CAST_1(AVX2::double_v, SSE::ullong_v);
+Vc_SIMD_CAST_1(AVX2:: float_v, SSE:: schar_v);
+Vc_SIMD_CAST_1(AVX2:: float_v, SSE:: uchar_v);
+Vc_SIMD_CAST_1(AVX2:: float_v, SSE:: llong_v);
+Vc_SIMD_CAST_1(AVX2:: float_v, SSE::ullong_v);
+
 #ifdef Vc_IMPL_AVX2
 Vc_SIMD_CAST_1(AVX2::   int_v, SSE::double_v);
 Vc_SIMD_CAST_1(AVX2::   int_v, SSE:: float_v);
@@ -392,6 +506,32 @@ Vc_SIMD_CAST_1(AVX2::ushort_v, SSE::ushort_v);
 // 2 AVX2::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_2(AVX2::double_v, SSE:: short_v);
 Vc_SIMD_CAST_2(AVX2::double_v, SSE::ushort_v);
+Vc_SIMD_CAST_2(AVX2::double_v, SSE:: schar_v);
+Vc_SIMD_CAST_2(AVX2::double_v, SSE:: uchar_v);
+Vc_SIMD_CAST_2(AVX2:: float_v, SSE:: schar_v);
+Vc_SIMD_CAST_2(AVX2:: float_v, SSE:: uchar_v);
+
+// 4 AVX2::Vector to 1 SSE::Vector {{{2
+Vc_SIMD_CAST_4(AVX2::double_v, SSE:: schar_v);
+Vc_SIMD_CAST_4(AVX2::double_v, SSE:: uchar_v);
+
+#ifdef Vc_IMPL_AVX2
+// 1 AVX2::Vector to/from 1 SSE::Vector with 8-bit or 64-bit integers {{{2
+// the casts from/to double_v and float_v are declared above
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Vector<T> x,
+          enable_if<(SSE::is_vector<Return>::value && std::is_integral<T>::value &&
+                     Detail::has_int8_or_int64<T, typename Return::EntryType>::value)> =
+              nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(SSE::Vector<T> x,
+          enable_if<(AVX2::is_vector<Return>::value &&
+                     std::is_integral<typename Return::EntryType>::value &&
+                     Detail::has_int8_or_int64<T, typename Return::EntryType>::value)> =
+              nullarg);
+#endif
 
 // 1 Scalar::Vector to 1 AVX2::Vector {{{2
 template <typename Return, typename T>
@@ -419,6 +559,15 @@ template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x,
           enable_if<std::is_same<Return, AVX2::ushort_v>::value> = nullarg);
+// the 8-bit and 64-bit integer vectors are built in SSE registers
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<(AVX2::is_vector<Return>::value &&
+                     std::is_integral<typename Return::EntryType>::value &&
+                     Detail::has_int8_or_int64<typename Return::EntryType,
+                                               typename Return::EntryType>::value)> =
+              nullarg);
 #endif
 
 // 2 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -447,6 +596,15 @@ template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
           enable_if<std::is_same<Return, AVX2::ushort_v>::value> = nullarg);
+// the 8-bit and 64-bit integer vectors are built in SSE registers
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<(AVX2::is_vector<Return>::value &&
+                     std::is_integral<typename Return::EntryType>::value &&
+                     Detail::has_int8_or_int64<typename Return::EntryType,
+                                               typename Return::EntryType>::value)> =
+              nullarg);
 #endif
 
 // 3 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -509,6 +667,23 @@ Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
           Scalar::Vector<T> x3,
           enable_if<std::is_same<Return, AVX2::ushort_v>::value> = nullarg);
+// the 8-bit and 64-bit integer vectors are built in SSE registers
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          Scalar::Vector<T> x3,
+          enable_if<(AVX2::is_vector<Return>::value &&
+                     std::is_integral<typename Return::EntryType>::value &&
+                     sizeof(typename Return::EntryType) == 1)> =
+              nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          Scalar::Vector<T> x3,
+          enable_if<(AVX2::is_vector<Return>::value &&
+                     std::is_integral<typename Return::EntryType>::value &&
+                     sizeof(typename Return::EntryType) == 8)> =
+              nullarg);
 #endif
 
 // 5 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -816,12 +991,40 @@ Vc_SIMD_CAST_AVX_2(   int_m, ushort_m);
 
 Vc_SIMD_CAST_AVX_2(  uint_m,  short_m);
 Vc_SIMD_CAST_AVX_2(  uint_m, ushort_m);
+
+Vc_SIMD_CAST_AVX_2(double_m,  schar_m);
+Vc_SIMD_CAST_AVX_2(double_m,  uchar_m);
+Vc_SIMD_CAST_AVX_2( float_m,  schar_m);
+Vc_SIMD_CAST_AVX_2( float_m,  uchar_m);
+Vc_SIMD_CAST_AVX_2(   int_m,  schar_m);
+Vc_SIMD_CAST_AVX_2(   int_m,  uchar_m);
+Vc_SIMD_CAST_AVX_2(  uint_m,  schar_m);
+Vc_SIMD_CAST_AVX_2(  uint_m,  uchar_m);
+Vc_SIMD_CAST_AVX_2( short_m,  schar_m);
+Vc_SIMD_CAST_AVX_2( short_m,  uchar_m);
+Vc_SIMD_CAST_AVX_2(ushort_m,  schar_m);
+Vc_SIMD_CAST_AVX_2(ushort_m,  uchar_m);
 #endif
 
 // 4 AVX2::Mask to 1 AVX2::Mask {{{2
 #ifdef Vc_IMPL_AVX2
 Vc_SIMD_CAST_AVX_4(double_m,  short_m);
 Vc_SIMD_CAST_AVX_4(double_m, ushort_m);
+
+Vc_SIMD_CAST_AVX_4(double_m,  schar_m);
+Vc_SIMD_CAST_AVX_4(double_m,  uchar_m);
+Vc_SIMD_CAST_AVX_4( float_m,  schar_m);
+Vc_SIMD_CAST_AVX_4( float_m,  uchar_m);
+Vc_SIMD_CAST_AVX_4(   int_m,  schar_m);
+Vc_SIMD_CAST_AVX_4(   int_m,  uchar_m);
+Vc_SIMD_CAST_AVX_4(  uint_m,  schar_m);
+Vc_SIMD_CAST_AVX_4(  uint_m,  uchar_m);
+#endif
+
+// 8 AVX2::Mask to 1 AVX2::Mask {{{2
+#ifdef Vc_IMPL_AVX2
+Vc_SIMD_CAST_8(AVX2::double_m, AVX2:: schar_m);
+Vc_SIMD_CAST_8(AVX2::double_m, AVX2:: uchar_m);
 #endif
 
 // 1 SSE::Mask to 1 AVX2::Mask {{{2
@@ -871,6 +1074,26 @@ Vc_SIMD_CAST_1(SSE::ushort_m, AVX2::   int_m);
 Vc_SIMD_CAST_1(SSE::ushort_m, AVX2::  uint_m);
 #endif
 
+Vc_SIMD_CAST_1(SSE:: schar_m, AVX2::double_m);
+Vc_SIMD_CAST_1(SSE:: uchar_m, AVX2::double_m);
+Vc_SIMD_CAST_1(SSE:: llong_m, AVX2::double_m);
+Vc_SIMD_CAST_1(SSE::ullong_m, AVX2::double_m);
+Vc_SIMD_CAST_1(SSE:: schar_m, AVX2:: float_m);
+Vc_SIMD_CAST_1(SSE:: uchar_m, AVX2:: float_m);
+Vc_SIMD_CAST_1(SSE:: llong_m, AVX2:: float_m);
+Vc_SIMD_CAST_1(SSE::ullong_m, AVX2:: float_m);
+
+#ifdef Vc_IMPL_AVX2
+// the remaining casts with 8-bit or 64-bit integers on either side
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(SSE::Mask<T> k,
+          enable_if<(AVX2::is_mask<Return>::value &&
+                     std::is_integral<typename Return::Vector::EntryType>::value &&
+                     Detail::has_int8_or_int64<
+                         T, typename Return::Vector::EntryType>::value)> = nullarg);
+#endif
+
 // 2 SSE::Mask to 1 AVX2::Mask {{{2
 Vc_SIMD_CAST_2(SSE::double_m, AVX2::double_m);
 Vc_SIMD_CAST_2(SSE::double_m, AVX2:: float_m);
@@ -999,9 +1222,36 @@ Vc_SIMD_CAST_1(AVX2::ushort_m, SSE:: short_m);
 Vc_SIMD_CAST_1(AVX2::ushort_m, SSE::ushort_m);
 #endif
 
+Vc_SIMD_CAST_1(AVX2::double_m, SSE:: schar_m);
+Vc_SIMD_CAST_1(AVX2::double_m, SSE:: uchar_m);
+Vc_SIMD_CAST_1(AVX2::double_m, SSE:: llong_m);
+Vc_SIMD_CAST_1(AVX2::double_m, SSE::ullong_m);
+Vc_SIMD_CAST_1(AVX2:: float_m, SSE:: schar_m);
+Vc_SIMD_CAST_1(AVX2:: float_m, SSE:: uchar_m);
+Vc_SIMD_CAST_1(AVX2:: float_m, SSE:: llong_m);
+Vc_SIMD_CAST_1(AVX2:: float_m, SSE::ullong_m);
+
+#ifdef Vc_IMPL_AVX2
+// the remaining casts with 8-bit or 64-bit integers on either side
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(const AVX2::Mask<T> &k,
+          enable_if<(SSE::is_mask<Return>::value && std::is_integral<T>::value &&
+                     Detail::has_int8_or_int64<
+                         T, typename Return::Vector::EntryType>::value)> = nullarg);
+#endif
+
 // 2 AVX2::Mask to 1 SSE::Mask {{{2
 Vc_SIMD_CAST_2(AVX2::double_m, SSE:: short_m);
 Vc_SIMD_CAST_2(AVX2::double_m, SSE::ushort_m);
+Vc_SIMD_CAST_2(AVX2::double_m, SSE:: schar_m);
+Vc_SIMD_CAST_2(AVX2::double_m, SSE:: uchar_m);
+Vc_SIMD_CAST_2(AVX2:: float_m, SSE:: schar_m);
+Vc_SIMD_CAST_2(AVX2:: float_m, SSE:: uchar_m);
+
+// 4 AVX2::Mask to 1 SSE::Mask {{{2
+Vc_SIMD_CAST_4(AVX2::double_m, SSE:: schar_m);
+Vc_SIMD_CAST_4(AVX2::double_m, SSE:: uchar_m);
 
 // 1 AVX2::Mask to 1 Scalar::Mask {{{2
 template <typename To, typename FromT>
@@ -1048,6 +1298,11 @@ simd_cast(AVX2::Vector<T> x);
 // SSE to AVX2 {{{2
 Vc_SIMD_CAST_OFFSET(SSE:: short_v, AVX2::double_v, 1);
 Vc_SIMD_CAST_OFFSET(SSE::ushort_v, AVX2::double_v, 1);
+template <typename Return, int offset, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(SSE::Vector<T> x,
+          enable_if<(offset != 0 && AVX2::is_vector<Return>::value && sizeof(T) == 1)> =
+              nullarg);
 
 // Declarations: Mask casts with offset {{{1
 // 1 AVX2::Mask to N AVX2::Mask {{{2
@@ -1078,6 +1333,11 @@ simd_cast(const AVX2::Mask<T> &k,
 // 1 SSE::Mask to N AVX2(2)::Mask {{{2
 Vc_SIMD_CAST_OFFSET(SSE:: short_m, AVX2::double_m, 1);
 Vc_SIMD_CAST_OFFSET(SSE::ushort_m, AVX2::double_m, 1);
+template <typename Return, int offset, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(SSE::Mask<T> k,
+          enable_if<(offset != 0 && AVX2::is_mask<Return>::value && sizeof(T) == 1)> =
+              nullarg);
 
 // AVX2 to SSE (Mask<T>) {{{2
 template <typename Return, int offset, typename T>
@@ -1415,6 +1675,107 @@ Vc_SIMD_CAST_AVX_4(double_v, ushort_v) {
 }
 #endif
 
+// 1: 8-bit and 64-bit integer AVX2::Vector {{{3
+#ifdef Vc_IMPL_AVX2
+Vc_SIMD_CAST_AVX_1( schar_v, double_v) { return AVX::convert(x.data(), AVX::ConvertTag< schar, double>()); }
+Vc_SIMD_CAST_AVX_1( uchar_v, double_v) { return AVX::convert(x.data(), AVX::ConvertTag< uchar, double>()); }
+Vc_SIMD_CAST_AVX_1( llong_v, double_v) { return AVX::convert(x.data(), AVX::ConvertTag< llong, double>()); }
+Vc_SIMD_CAST_AVX_1(ullong_v, double_v) { return AVX::convert(x.data(), AVX::ConvertTag<ullong, double>()); }
+Vc_SIMD_CAST_AVX_1( schar_v,  float_v) { return AVX::convert(x.data(), AVX::ConvertTag< schar,  float>()); }
+Vc_SIMD_CAST_AVX_1( uchar_v,  float_v) { return AVX::convert(x.data(), AVX::ConvertTag< uchar,  float>()); }
+Vc_SIMD_CAST_AVX_1( llong_v,  float_v) { return AVX::convert(x.data(), AVX::ConvertTag< llong,  float>()); }
+Vc_SIMD_CAST_AVX_1(ullong_v,  float_v) { return AVX::convert(x.data(), AVX::ConvertTag<ullong,  float>()); }
+Vc_SIMD_CAST_AVX_1( schar_v,    int_v) { return AVX::convert(x.data(), AVX::ConvertTag< schar,    int>()); }
+Vc_SIMD_CAST_AVX_1( uchar_v,    int_v) { return AVX::convert(x.data(), AVX::ConvertTag< uchar,    int>()); }
+Vc_SIMD_CAST_AVX_1( llong_v,    int_v) { return AVX::convert(x.data(), AVX::ConvertTag< llong,    int>()); }
+Vc_SIMD_CAST_AVX_1(ullong_v,    int_v) { return AVX::convert(x.data(), AVX::ConvertTag<ullong,    int>()); }
+Vc_SIMD_CAST_AVX_1( schar_v,   uint_v) { return AVX::convert(x.data(), AVX::ConvertTag< schar,   uint>()); }
+Vc_SIMD_CAST_AVX_1( uchar_v,   uint_v) { return AVX::convert(x.data(), AVX::ConvertTag< uchar,   uint>()); }
+Vc_SIMD_CAST_AVX_1( llong_v,   uint_v) { return AVX::convert(x.data(), AVX::ConvertTag< llong,   uint>()); }
+Vc_SIMD_CAST_AVX_1(ullong_v,   uint_v) { return AVX::convert(x.data(), AVX::ConvertTag<ullong,   uint>()); }
+Vc_SIMD_CAST_AVX_1( schar_v,  short_v) { return AVX::convert(x.data(), AVX::ConvertTag< schar,  short>()); }
+Vc_SIMD_CAST_AVX_1( uchar_v,  short_v) { return AVX::convert(x.data(), AVX::ConvertTag< uchar,  short>()); }
+Vc_SIMD_CAST_AVX_1( llong_v,  short_v) { return AVX::convert(x.data(), AVX::ConvertTag< llong,  short>()); }
+Vc_SIMD_CAST_AVX_1(ullong_v,  short_v) { return AVX::convert(x.data(), AVX::ConvertTag<ullong,  short>()); }
+Vc_SIMD_CAST_AVX_1( schar_v, ushort_v) { return AVX::convert(x.data(), AVX::ConvertTag< schar, ushort>()); }
+Vc_SIMD_CAST_AVX_1( uchar_v, ushort_v) { return AVX::convert(x.data(), AVX::ConvertTag< uchar, ushort>()); }
+Vc_SIMD_CAST_AVX_1( llong_v, ushort_v) { return AVX::convert(x.data(), AVX::ConvertTag< llong, ushort>()); }
+Vc_SIMD_CAST_AVX_1(ullong_v, ushort_v) { return AVX::convert(x.data(), AVX::ConvertTag<ullong, ushort>()); }
+Vc_SIMD_CAST_AVX_1(double_v,  schar_v) { return AVX::convert(x.data(), AVX::ConvertTag<double,  schar>()); }
+Vc_SIMD_CAST_AVX_1( float_v,  schar_v) { return AVX::convert(x.data(), AVX::ConvertTag< float,  schar>()); }
+Vc_SIMD_CAST_AVX_1(   int_v,  schar_v) { return AVX::convert(x.data(), AVX::ConvertTag<   int,  schar>()); }
+Vc_SIMD_CAST_AVX_1(  uint_v,  schar_v) { return AVX::convert(x.data(), AVX::ConvertTag<  uint,  schar>()); }
+Vc_SIMD_CAST_AVX_1( short_v,  schar_v) { return AVX::convert(x.data(), AVX::ConvertTag< short,  schar>()); }
+Vc_SIMD_CAST_AVX_1(ushort_v,  schar_v) { return AVX::convert(x.data(), AVX::ConvertTag<ushort,  schar>()); }
+Vc_SIMD_CAST_AVX_1( uchar_v,  schar_v) { return AVX::convert(x.data(), AVX::ConvertTag< uchar,  schar>()); }
+Vc_SIMD_CAST_AVX_1( llong_v,  schar_v) { return AVX::convert(x.data(), AVX::ConvertTag< llong,  schar>()); }
+Vc_SIMD_CAST_AVX_1(ullong_v,  schar_v) { return AVX::convert(x.data(), AVX::ConvertTag<ullong,  schar>()); }
+Vc_SIMD_CAST_AVX_1(double_v,  uchar_v) { return AVX::convert(x.data(), AVX::ConvertTag<double,  uchar>()); }
+Vc_SIMD_CAST_AVX_1( float_v,  uchar_v) { return AVX::convert(x.data(), AVX::ConvertTag< float,  uchar>()); }
+Vc_SIMD_CAST_AVX_1(   int_v,  uchar_v) { return AVX::convert(x.data(), AVX::ConvertTag<   int,  uchar>()); }
+Vc_SIMD_CAST_AVX_1(  uint_v,  uchar_v) { return AVX::convert(x.data(), AVX::ConvertTag<  uint,  uchar>()); }
+Vc_SIMD_CAST_AVX_1( short_v,  uchar_v) { return AVX::convert(x.data(), AVX::ConvertTag< short,  uchar>()); }
+Vc_SIMD_CAST_AVX_1(ushort_v,  uchar_v) { return AVX::convert(x.data(), AVX::ConvertTag<ushort,  uchar>()); }
+Vc_SIMD_CAST_AVX_1( schar_v,  uchar_v) { return AVX::convert(x.data(), AVX::ConvertTag< schar,  uchar>()); }
+Vc_SIMD_CAST_AVX_1( llong_v,  uchar_v) { return AVX::convert(x.data(), AVX::ConvertTag< llong,  uchar>()); }
+Vc_SIMD_CAST_AVX_1(ullong_v,  uchar_v) { return AVX::convert(x.data(), AVX::ConvertTag<ullong,  uchar>()); }
+Vc_SIMD_CAST_AVX_1(double_v,  llong_v) { return AVX::convert(x.data(), AVX::ConvertTag<double,  llong>()); }
+Vc_SIMD_CAST_AVX_1( float_v,  llong_v) { return AVX::convert(x.data(), AVX::ConvertTag< float,  llong>()); }
+Vc_SIMD_CAST_AVX_1(   int_v,  llong_v) { return AVX::convert(x.data(), AVX::ConvertTag<   int,  llong>()); }
+Vc_SIMD_CAST_AVX_1(  uint_v,  llong_v) { return AVX::convert(x.data(), AVX::ConvertTag<  uint,  llong>()); }
+Vc_SIMD_CAST_AVX_1( short_v,  llong_v) { return AVX::convert(x.data(), AVX::ConvertTag< short,  llong>()); }
+Vc_SIMD_CAST_AVX_1(ushort_v,  llong_v) { return AVX::convert(x.data(), AVX::ConvertTag<ushort,  llong>()); }
+Vc_SIMD_CAST_AVX_1( schar_v,  llong_v) { return AVX::convert(x.data(), AVX::ConvertTag< schar,  llong>()); }
+Vc_SIMD_CAST_AVX_1( uchar_v,  llong_v) { return AVX::convert(x.data(), AVX::ConvertTag< uchar,  llong>()); }
+Vc_SIMD_CAST_AVX_1(ullong_v,  llong_v) { return AVX::convert(x.data(), AVX::ConvertTag<ullong,  llong>()); }
+Vc_SIMD_CAST_AVX_1(double_v, ullong_v) { return AVX::convert(x.data(), AVX::ConvertTag<double, ullong>()); }
+Vc_SIMD_CAST_AVX_1( float_v, ullong_v) { return AVX::convert(x.data(), AVX::ConvertTag< float, ullong>()); }
+Vc_SIMD_CAST_AVX_1(   int_v, ullong_v) { return AVX::convert(x.data(), AVX::ConvertTag<   int, ullong>()); }
+Vc_SIMD_CAST_AVX_1(  uint_v, ullong_v) { return AVX::convert(x.data(), AVX::ConvertTag<  uint, ullong>()); }
+Vc_SIMD_CAST_AVX_1( short_v, ullong_v) { return AVX::convert(x.data(), AVX::ConvertTag< short, ullong>()); }
+Vc_SIMD_CAST_AVX_1(ushort_v, ullong_v) { return AVX::convert(x.data(), AVX::ConvertTag<ushort, ullong>()); }
+Vc_SIMD_CAST_AVX_1( schar_v, ullong_v) { return AVX::convert(x.data(), AVX::ConvertTag< schar, ullong>()); }
+Vc_SIMD_CAST_AVX_1( uchar_v, ullong_v) { return AVX::convert(x.data(), AVX::ConvertTag< uchar, ullong>()); }
+Vc_SIMD_CAST_AVX_1( llong_v, ullong_v) { return AVX::convert(x.data(), AVX::ConvertTag< llong, ullong>()); }
+
+// 2, 4, and 8 AVX2::Vector to 1 8-bit or 64-bit integer AVX2::Vector {{{3
+// every input converts to the low entries of Return; shift them into place and merge
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1,
+          enable_if<(AVX2::is_vector<Return>::value &&
+                     Detail::has_int8_or_int64<typename Return::EntryType,
+                                               typename Return::EntryType>::value)>)
+{
+    constexpr int N = AVX2::Vector<T>::Size;
+    return simd_cast<Return>(x0) | simd_cast<Return>(x1).shifted(-N);
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2,
+          AVX2::Vector<T> x3,
+          enable_if<(AVX2::is_vector<Return>::value &&
+                     Detail::has_int8_or_int64<typename Return::EntryType,
+                                               typename Return::EntryType>::value)>)
+{
+    constexpr int N = AVX2::Vector<T>::Size;
+    return simd_cast<Return>(x0, x1) | simd_cast<Return>(x2, x3).shifted(-2 * N);
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2,
+          AVX2::Vector<T> x3, AVX2::Vector<T> x4, AVX2::Vector<T> x5,
+          AVX2::Vector<T> x6, AVX2::Vector<T> x7,
+          enable_if<(AVX2::is_vector<Return>::value &&
+                     Detail::has_int8_or_int64<typename Return::EntryType,
+                                               typename Return::EntryType>::value)>)
+{
+    constexpr int N = AVX2::Vector<T>::Size;
+    return simd_cast<Return>(x0, x1, x2, x3) |
+           simd_cast<Return>(x4, x5, x6, x7).shifted(-4 * N);
+}
+#endif
+
 // 1 SSE::Vector to 1 AVX2::Vector {{{2
 Vc_SIMD_CAST_1(SSE::double_v, AVX2::double_v) { return AVX::zeroExtend(x.data()); }
 Vc_SIMD_CAST_1(SSE:: float_v, AVX2::double_v) { return _mm256_cvtps_pd(x.data()); }
@@ -1430,6 +1791,15 @@ Vc_SIMD_CAST_1(SSE::  uint_v, AVX2:: float_v) { return AVX::zeroExtend(simd_cast
 Vc_SIMD_CAST_1(SSE:: short_v, AVX2:: float_v) { return AVX::convert< short, float>(x.data()); }
 Vc_SIMD_CAST_1(SSE::ushort_v, AVX2:: float_v) { return AVX::convert<ushort, float>(x.data()); }
 
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::double_v) { return simd_cast<AVX2::double_v>(simd_cast<SSE::int_v>(x)); }
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::double_v) { return simd_cast<AVX2::double_v>(simd_cast<SSE::int_v>(x)); }
+Vc_SIMD_CAST_1(SSE:: llong_v, AVX2::double_v) { return AVX::zeroExtend(simd_cast<SSE::double_v>(x).data()); }
+Vc_SIMD_CAST_1(SSE::ullong_v, AVX2::double_v) { return AVX::zeroExtend(simd_cast<SSE::double_v>(x).data()); }
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2:: float_v) { return AVX::concat(SSE::convert<schar, float>(x.data()), SSE::convert<schar, float>(_mm_srli_si128(x.data(), 4))); }
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2:: float_v) { return AVX::concat(SSE::convert<uchar, float>(x.data()), SSE::convert<uchar, float>(_mm_srli_si128(x.data(), 4))); }
+Vc_SIMD_CAST_1(SSE:: llong_v, AVX2:: float_v) { return AVX::zeroExtend(simd_cast<SSE::float_v>(x).data()); }
+Vc_SIMD_CAST_1(SSE::ullong_v, AVX2:: float_v) { return AVX::zeroExtend(simd_cast<SSE::float_v>(x).data()); }
+
 #ifdef Vc_IMPL_AVX2
 Vc_SIMD_CAST_1(SSE::double_v, AVX2::   int_v) { return AVX::zeroExtend(simd_cast<SSE::   int_v>(x).data()); }
 Vc_SIMD_CAST_1(SSE::double_v, AVX2::  uint_v) { return AVX::zeroExtend(simd_cast<SSE::  uint_v>(x).data()); }
@@ -1581,6 +1951,19 @@ Vc_SIMD_CAST_1(AVX2:: float_v, SSE::  uint_v) { return simd_cast<SSE::  uint_v>(
 Vc_SIMD_CAST_1(AVX2:: float_v, SSE:: short_v) { return AVX::convert<float, short>(x.data()); }
 Vc_SIMD_CAST_1(AVX2:: float_v, SSE::ushort_v) { return AVX::convert<float, unsigned short>(x.data()); }
 
+Vc_SIMD_CAST_1(AVX2::double_v, SSE:: schar_v) { return simd_cast<SSE:: schar_v>(simd_cast<SSE::   int_v>(x)); }
+Vc_SIMD_CAST_1(AVX2::double_v, SSE:: uchar_v) { return simd_cast<SSE:: uchar_v>(simd_cast<SSE::   int_v>(x)); }
+Vc_SIMD_CAST_1(AVX2::double_v, SSE:: llong_v) { return simd_cast<SSE:: llong_v>(simd_cast<SSE::double_v>(x)); }
+Vc_SIMD_CAST_1(AVX2::double_v, SSE::ullong_v) { return simd_cast<SSE::ullong_v>(simd_cast<SSE::double_v>(x)); }
+Vc_SIMD_CAST_1(AVX2:: float_v, SSE:: schar_v) {
+    const auto tmp = _mm256_cvttps_epi32(x.data());
+    return _mm_unpacklo_epi32(SSE::convert<int, schar>(AVX::lo128(tmp)),
+                              SSE::convert<int, schar>(AVX::hi128(tmp)));
+}
+Vc_SIMD_CAST_1(AVX2:: float_v, SSE:: uchar_v) { return simd_cast<SSE::uchar_v>(simd_cast<SSE::schar_v>(x)); }
+Vc_SIMD_CAST_1(AVX2:: float_v, SSE:: llong_v) { return simd_cast<SSE:: llong_v>(simd_cast<SSE:: float_v>(x)); }
+Vc_SIMD_CAST_1(AVX2:: float_v, SSE::ullong_v) { return simd_cast<SSE::ullong_v>(simd_cast<SSE:: float_v>(x)); }
+
 #ifdef Vc_IMPL_AVX2
 Vc_SIMD_CAST_1(AVX2::   int_v, SSE::double_v) { return SSE::convert<int, double>(AVX::lo128(x.data())); }
 Vc_SIMD_CAST_1(AVX2::   int_v, SSE:: float_v) { return SSE::convert<int, float>(AVX::lo128(x.data())); }
@@ -1618,6 +2001,37 @@ Vc_SIMD_CAST_2(AVX2::double_v, SSE::ushort_v) {
     const auto tmp1 = _mm256_cvttpd_epi32(x1.data());
     return _mm_packs_epi32(tmp0, tmp1);
 }
+Vc_SIMD_CAST_2(AVX2::double_v, SSE:: schar_v) { return simd_cast<SSE:: schar_v>(simd_cast<SSE::short_v>(x0, x1)); }
+Vc_SIMD_CAST_2(AVX2::double_v, SSE:: uchar_v) { return simd_cast<SSE:: uchar_v>(simd_cast<SSE::short_v>(x0, x1)); }
+Vc_SIMD_CAST_2(AVX2:: float_v, SSE:: schar_v) { return simd_cast<SSE:: schar_v>(simd_cast<SSE::short_v>(x0), simd_cast<SSE::short_v>(x1)); }
+Vc_SIMD_CAST_2(AVX2:: float_v, SSE:: uchar_v) { return simd_cast<SSE:: uchar_v>(simd_cast<SSE::short_v>(x0), simd_cast<SSE::short_v>(x1)); }
+
+// 4 AVX2::Vector to 1 SSE::Vector {{{2
+Vc_SIMD_CAST_4(AVX2::double_v, SSE:: schar_v) { return simd_cast<SSE:: schar_v>(simd_cast<SSE::short_v>(x0, x1), simd_cast<SSE::short_v>(x2, x3)); }
+Vc_SIMD_CAST_4(AVX2::double_v, SSE:: uchar_v) { return simd_cast<SSE:: uchar_v>(simd_cast<SSE::short_v>(x0, x1), simd_cast<SSE::short_v>(x2, x3)); }
+
+#ifdef Vc_IMPL_AVX2
+// 1 AVX2::Vector to/from 1 SSE::Vector with 8-bit or 64-bit integers {{{2
+// convert in AVX2 registers, where all casts exist, and then split or extend
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Vector<T> x,
+          enable_if<(SSE::is_vector<Return>::value && std::is_integral<T>::value &&
+                     Detail::has_int8_or_int64<T, typename Return::EntryType>::value)>)
+{
+    using To = AVX2::Vector<typename Return::EntryType>;
+    return Return(AVX::lo128(simd_cast<To>(x).data()));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(SSE::Vector<T> x,
+          enable_if<(AVX2::is_vector<Return>::value &&
+                     std::is_integral<typename Return::EntryType>::value &&
+                     Detail::has_int8_or_int64<T, typename Return::EntryType>::value)>)
+{
+    return simd_cast<Return>(AVX2::Vector<T>(AVX::zeroExtend(x.data())));
+}
+#endif
 
 // 1 Scalar::Vector to 1 AVX2::Vector {{{2
 template <typename Return, typename T>
@@ -1663,6 +2077,17 @@ simd_cast(Scalar::Vector<T> x,
 {
     return _mm256_setr_epi16(x.data(), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
 }
+// the 8-bit and 64-bit integer vectors are built in SSE registers
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<(AVX2::is_vector<Return>::value &&
+                     std::is_integral<typename Return::EntryType>::value &&
+                     Detail::has_int8_or_int64<typename Return::EntryType,
+                                               typename Return::EntryType>::value)>)
+{
+    return simd_cast<Return>(simd_cast<SSE::Vector<typename Return::EntryType>>(x));
+}
 #endif
 
 // 2 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -1709,6 +2134,17 @@ simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
 {
     return _mm256_setr_epi16(x0.data(), x1.data(), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
 }
+// the 8-bit and 64-bit integer vectors are built in SSE registers
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<(AVX2::is_vector<Return>::value &&
+                     std::is_integral<typename Return::EntryType>::value &&
+                     Detail::has_int8_or_int64<typename Return::EntryType,
+                                               typename Return::EntryType>::value)>)
+{
+    return simd_cast<Return>(simd_cast<SSE::Vector<typename Return::EntryType>>(x0, x1));
+}
 #endif
 
 // 3 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -1809,6 +2245,30 @@ simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
 {
     return _mm256_setr_epi16(x0.data(), x1.data(), x2.data(), x3.data(), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
 }
+// the 8-bit and 64-bit integer vectors are built in SSE registers
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          Scalar::Vector<T> x3,
+          enable_if<(AVX2::is_vector<Return>::value &&
+                     std::is_integral<typename Return::EntryType>::value &&
+                     sizeof(typename Return::EntryType) == 1)>)
+{
+    return simd_cast<Return>(
+        simd_cast<SSE::Vector<typename Return::EntryType>>(x0, x1, x2, x3));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          Scalar::Vector<T> x3,
+          enable_if<(AVX2::is_vector<Return>::value &&
+                     std::is_integral<typename Return::EntryType>::value &&
+                     sizeof(typename Return::EntryType) == 8)>)
+{
+    using SSEVector = SSE::Vector<typename Return::EntryType>;
+    return AVX::concat(simd_cast<SSEVector>(x0, x1).data(),
+                       simd_cast<SSEVector>(x2, x3).data());
+}
 #endif
 
 // 5 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -2279,6 +2739,19 @@ Vc_SIMD_CAST_AVX_2(   int_m, ushort_m) { return Mem::permute4x64<X0, X2, X1, X3>
 
 Vc_SIMD_CAST_AVX_2(  uint_m,  short_m) { return Mem::permute4x64<X0, X2, X1, X3>(_mm256_packs_epi16(x0.dataI(), x1.dataI())); }
 Vc_SIMD_CAST_AVX_2(  uint_m, ushort_m) { return Mem::permute4x64<X0, X2, X1, X3>(_mm256_packs_epi16(x0.dataI(), x1.dataI())); }
+
+Vc_SIMD_CAST_AVX_2(double_m,  schar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1)); }
+Vc_SIMD_CAST_AVX_2(double_m,  uchar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1)).data(); }
+Vc_SIMD_CAST_AVX_2( float_m,  schar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1)); }
+Vc_SIMD_CAST_AVX_2( float_m,  uchar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1)).data(); }
+Vc_SIMD_CAST_AVX_2(   int_m,  schar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1)); }
+Vc_SIMD_CAST_AVX_2(   int_m,  uchar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1)).data(); }
+Vc_SIMD_CAST_AVX_2(  uint_m,  schar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1)); }
+Vc_SIMD_CAST_AVX_2(  uint_m,  uchar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1)).data(); }
+Vc_SIMD_CAST_AVX_2( short_m,  schar_m) { return Mem::permute4x64<X0, X2, X1, X3>(_mm256_packs_epi16(x0.dataI(), x1.dataI())); }
+Vc_SIMD_CAST_AVX_2( short_m,  uchar_m) { return Mem::permute4x64<X0, X2, X1, X3>(_mm256_packs_epi16(x0.dataI(), x1.dataI())); }
+Vc_SIMD_CAST_AVX_2(ushort_m,  schar_m) { return Mem::permute4x64<X0, X2, X1, X3>(_mm256_packs_epi16(x0.dataI(), x1.dataI())); }
+Vc_SIMD_CAST_AVX_2(ushort_m,  uchar_m) { return Mem::permute4x64<X0, X2, X1, X3>(_mm256_packs_epi16(x0.dataI(), x1.dataI())); }
 #endif
 
 // 4 AVX2::Mask to 1 AVX2::Mask {{{2
@@ -2295,6 +2768,21 @@ Vc_SIMD_CAST_AVX_4(double_m, short_m)
                   _mm_unpackhi_epi32(lo128(tmp), hi128(tmp)));  // c0 c1 c2 c3 d0 d1 d2 d3
 }
 Vc_SIMD_CAST_AVX_4(double_m, ushort_m) { return simd_cast<AVX2::short_m>(x0, x1, x2, x3).data(); }
+
+Vc_SIMD_CAST_AVX_4(double_m,  schar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1, x2, x3)); }
+Vc_SIMD_CAST_AVX_4(double_m,  uchar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1, x2, x3)).data(); }
+Vc_SIMD_CAST_AVX_4( float_m,  schar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1), simd_cast<AVX2::short_m>(x2, x3)); }
+Vc_SIMD_CAST_AVX_4( float_m,  uchar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1), simd_cast<AVX2::short_m>(x2, x3)).data(); }
+Vc_SIMD_CAST_AVX_4(   int_m,  schar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1), simd_cast<AVX2::short_m>(x2, x3)); }
+Vc_SIMD_CAST_AVX_4(   int_m,  uchar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1), simd_cast<AVX2::short_m>(x2, x3)).data(); }
+Vc_SIMD_CAST_AVX_4(  uint_m,  schar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1), simd_cast<AVX2::short_m>(x2, x3)); }
+Vc_SIMD_CAST_AVX_4(  uint_m,  uchar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1), simd_cast<AVX2::short_m>(x2, x3)).data(); }
+#endif
+
+// 8 AVX2::Mask to 1 AVX2::Mask {{{2
+#ifdef Vc_IMPL_AVX2
+Vc_SIMD_CAST_8(AVX2::double_m, AVX2:: schar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1, x2, x3), simd_cast<AVX2::short_m>(x4, x5, x6, x7)); }
+Vc_SIMD_CAST_8(AVX2::double_m, AVX2:: uchar_m) { return simd_cast<AVX2::schar_m>(simd_cast<AVX2::short_m>(x0, x1, x2, x3), simd_cast<AVX2::short_m>(x4, x5, x6, x7)).data(); }
 #endif
 
 // 1 SSE::Mask to 1 AVX2::Mask {{{2
@@ -2345,6 +2833,28 @@ Vc_SIMD_CAST_1(SSE::ushort_m, AVX2::   int_m) { const auto v = Mem::permute4x64<
 Vc_SIMD_CAST_1(SSE::ushort_m, AVX2::  uint_m) { const auto v = Mem::permute4x64<X0, X2, X1, X3>(AVX::avx_cast<__m256i>(x.data())); return _mm256_unpacklo_epi16(v, v); }
 #endif
 
+Vc_SIMD_CAST_1(SSE:: schar_m, AVX2::double_m) { return simd_cast<AVX2::double_m>(simd_cast<SSE::short_m>(x)); }
+Vc_SIMD_CAST_1(SSE:: uchar_m, AVX2::double_m) { return simd_cast<AVX2::double_m>(simd_cast<SSE::short_m>(x)); }
+Vc_SIMD_CAST_1(SSE:: llong_m, AVX2::double_m) { return AVX::zeroExtend(x.dataD()); }
+Vc_SIMD_CAST_1(SSE::ullong_m, AVX2::double_m) { return AVX::zeroExtend(x.dataD()); }
+Vc_SIMD_CAST_1(SSE:: schar_m, AVX2:: float_m) { return simd_cast<AVX2:: float_m>(simd_cast<SSE::short_m>(x)); }
+Vc_SIMD_CAST_1(SSE:: uchar_m, AVX2:: float_m) { return simd_cast<AVX2:: float_m>(simd_cast<SSE::short_m>(x)); }
+Vc_SIMD_CAST_1(SSE:: llong_m, AVX2:: float_m) { return simd_cast<AVX2:: float_m>(SSE::double_m(x.dataD())); }
+Vc_SIMD_CAST_1(SSE::ullong_m, AVX2:: float_m) { return simd_cast<AVX2:: float_m>(SSE::double_m(x.dataD())); }
+
+#ifdef Vc_IMPL_AVX2
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(SSE::Mask<T> k,
+          enable_if<(AVX2::is_mask<Return>::value &&
+                     std::is_integral<typename Return::Vector::EntryType>::value &&
+                     Detail::has_int8_or_int64<
+                         T, typename Return::Vector::EntryType>::value)>)
+{
+    return simd_cast<Return>(AVX2::Mask<T>(AVX::zeroExtend(k.dataI())));
+}
+#endif
+
 // 2 SSE::Mask to 1 AVX2::Mask {{{2
 Vc_SIMD_CAST_2(SSE::double_m, AVX2::double_m) { return AVX::concat(x0.data(), x1.data()); }
 Vc_SIMD_CAST_2(SSE::double_m, AVX2:: float_m) { return AVX::zeroExtend(_mm_packs_epi32(x0.dataI(), x1.dataI())); }
@@ -2524,9 +3034,39 @@ Vc_SIMD_CAST_1(AVX2::ushort_m, SSE:: short_m) { return simd_cast<SSE:: short_m>(
 Vc_SIMD_CAST_1(AVX2::ushort_m, SSE::ushort_m) { return simd_cast<SSE::ushort_m>(SSE::ushort_m(AVX::lo128(x.data()))); }
 #endif
 
+Vc_SIMD_CAST_1(AVX2::double_m, SSE:: schar_m) { return simd_cast<SSE:: schar_m>(simd_cast<SSE::short_m>(x)); }
+Vc_SIMD_CAST_1(AVX2::double_m, SSE:: uchar_m) { return simd_cast<SSE:: uchar_m>(simd_cast<SSE::short_m>(x)); }
+Vc_SIMD_CAST_1(AVX2::double_m, SSE:: llong_m) { return AVX::lo128(x.data()); }
+Vc_SIMD_CAST_1(AVX2::double_m, SSE::ullong_m) { return AVX::lo128(x.data()); }
+Vc_SIMD_CAST_1(AVX2:: float_m, SSE:: schar_m) { return simd_cast<SSE:: schar_m>(simd_cast<SSE::short_m>(x)); }
+Vc_SIMD_CAST_1(AVX2:: float_m, SSE:: uchar_m) { return simd_cast<SSE:: uchar_m>(simd_cast<SSE::short_m>(x)); }
+Vc_SIMD_CAST_1(AVX2:: float_m, SSE:: llong_m) { return simd_cast<SSE:: llong_m>(simd_cast<SSE::double_m>(x)); }
+Vc_SIMD_CAST_1(AVX2:: float_m, SSE::ullong_m) { return simd_cast<SSE::ullong_m>(simd_cast<SSE::double_m>(x)); }
+
+#ifdef Vc_IMPL_AVX2
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(const AVX2::Mask<T> &k,
+          enable_if<(SSE::is_mask<Return>::value && std::is_integral<T>::value &&
+                     Detail::has_int8_or_int64<
+                         T, typename Return::Vector::EntryType>::value)>)
+{
+    using To = AVX2::Mask<typename Return::Vector::EntryType>;
+    return Return(AVX::lo128(simd_cast<To>(k).dataI()));
+}
+#endif
+
 // 2 AVX2::Mask to 1 SSE::Mask {{{2
 Vc_SIMD_CAST_2(AVX2::double_m, SSE:: short_m) { return _mm_packs_epi16(_mm_packs_epi32(AVX::lo128(x0.dataI()), AVX::hi128(x0.dataI())), _mm_packs_epi32(AVX::lo128(x1.dataI()), AVX::hi128(x1.dataI()))); }
 Vc_SIMD_CAST_2(AVX2::double_m, SSE::ushort_m) { return _mm_packs_epi16(_mm_packs_epi32(AVX::lo128(x0.dataI()), AVX::hi128(x0.dataI())), _mm_packs_epi32(AVX::lo128(x1.dataI()), AVX::hi128(x1.dataI()))); }
+Vc_SIMD_CAST_2(AVX2::double_m, SSE:: schar_m) { return simd_cast<SSE:: schar_m>(simd_cast<SSE::short_m>(x0, x1)); }
+Vc_SIMD_CAST_2(AVX2::double_m, SSE:: uchar_m) { return simd_cast<SSE:: uchar_m>(simd_cast<SSE::short_m>(x0, x1)); }
+Vc_SIMD_CAST_2(AVX2:: float_m, SSE:: schar_m) { return simd_cast<SSE:: schar_m>(simd_cast<SSE::short_m>(x0), simd_cast<SSE::short_m>(x1)); }
+Vc_SIMD_CAST_2(AVX2:: float_m, SSE:: uchar_m) { return simd_cast<SSE:: uchar_m>(simd_cast<SSE::short_m>(x0), simd_cast<SSE::short_m>(x1)); }
+
+// 4 AVX2::Mask to 1 SSE::Mask {{{2
+Vc_SIMD_CAST_4(AVX2::double_m, SSE:: schar_m) { return simd_cast<SSE:: schar_m>(simd_cast<SSE::short_m>(x0, x1), simd_cast<SSE::short_m>(x2, x3)); }
+Vc_SIMD_CAST_4(AVX2::double_m, SSE:: uchar_m) { return simd_cast<SSE:: uchar_m>(simd_cast<SSE::short_m>(x0, x1), simd_cast<SSE::short_m>(x2, x3)); }
 
 // 1 AVX2::Mask to 1 Scalar::Mask {{{2
 template <typename To, typename FromT>
@@ -2629,6 +3169,14 @@ Vc_INTRINSIC Vc_CONST enable_if<(offset != 0 && SSE::is_vector<Return>::value &&
 // SSE to AVX2 {{{2
 Vc_SIMD_CAST_OFFSET(SSE:: short_v, AVX2::double_v, 1) { return simd_cast<AVX2::double_v>(simd_cast<SSE::int_v, 1>(x)); }
 Vc_SIMD_CAST_OFFSET(SSE::ushort_v, AVX2::double_v, 1) { return simd_cast<AVX2::double_v>(simd_cast<SSE::int_v, 1>(x)); }
+template <typename Return, int offset, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(SSE::Vector<T> x,
+          enable_if<(offset != 0 && AVX2::is_vector<Return>::value && sizeof(T) == 1)>)
+{
+    return simd_cast<Return>(
+        SSE::Vector<T>(_mm_srli_si128(x.data(), offset * Return::Size)));
+}
 
 // Mask casts with offset {{{1
 // 1 AVX2::Mask to N AVX2::Mask {{{2
@@ -2676,10 +3224,28 @@ simd_cast(const AVX2::Mask<T> &k,
     tmp = _mm_unpackhi_epi8(tmp, tmp);
     return AVX::concat(_mm_unpacklo_epi16(tmp, tmp), _mm_unpackhi_epi16(tmp, tmp));
 }
+// - 32 -> 4 (8-bit to 64-bit entries) has offsets 1 to 7
+template <typename Return, int offset, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(const AVX2::Mask<T> &k,
+          enable_if<(AVX2::is_mask<Return>::value && offset != 0 &&
+                     AVX2::Mask<T>::Size == Return::Size * 8)> = nullarg)
+{
+    const auto tmp = AVX2::Vector<T>(k.dataI()).shifted(offset * Return::Size);
+    return simd_cast<Return>(AVX2::Mask<T>(tmp.data()));
+}
 
 // 1 SSE::Mask to N AVX2::Mask {{{2
 Vc_SIMD_CAST_OFFSET(SSE:: short_m, AVX2::double_m, 1) { auto tmp = _mm_unpackhi_epi16(x.dataI(), x.dataI()); return AVX::concat(_mm_unpacklo_epi32(tmp, tmp), _mm_unpackhi_epi32(tmp, tmp)); }
 Vc_SIMD_CAST_OFFSET(SSE::ushort_m, AVX2::double_m, 1) { auto tmp = _mm_unpackhi_epi16(x.dataI(), x.dataI()); return AVX::concat(_mm_unpacklo_epi32(tmp, tmp), _mm_unpackhi_epi32(tmp, tmp)); }
+template <typename Return, int offset, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(SSE::Mask<T> k,
+          enable_if<(offset != 0 && AVX2::is_mask<Return>::value && sizeof(T) == 1)>)
+{
+    return simd_cast<Return>(
+        SSE::Mask<T>(_mm_srli_si128(k.dataI(), offset * Return::Size)));
+}
 
 // AVX2 to SSE (Mask<T>) {{{2
 template <typename Return, int offset, typename T>
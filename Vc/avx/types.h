@@ -39,6 +39,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define Vc_UINT_V_SIZE 8
 #define Vc_SHORT_V_SIZE 16
 #define Vc_USHORT_V_SIZE 16
+#define Vc_SCHAR_V_SIZE 32
+#define Vc_UCHAR_V_SIZE 32
+#define Vc_LLONG_V_SIZE 4
+#define Vc_ULLONG_V_SIZE 4
 #elif defined Vc_DEFAULT_IMPL_AVX
 #define Vc_DOUBLE_V_SIZE 4
 #define Vc_FLOAT_V_SIZE 8
@@ -46,6 +50,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define Vc_UINT_V_SIZE 4
 #define Vc_SHORT_V_SIZE 8
 #define Vc_USHORT_V_SIZE 8
+#define Vc_SCHAR_V_SIZE 16
+#define Vc_UCHAR_V_SIZE 16
+#define Vc_LLONG_V_SIZE 2
+#define Vc_ULLONG_V_SIZE 2
 #endif
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -85,6 +93,10 @@ using    int_v = Vector<   int>;
 using   uint_v = Vector<  uint>;
 using  short_v = Vector< short>;
 using ushort_v = Vector<ushort>;
+using  schar_v = Vector< schar>;
+using  uchar_v = Vector< uchar>;
+using  llong_v = Vector< llong>;
+using ullong_v = Vector<ullong>;
 
 template <typename T> using Mask = Vc::Mask<T, VectorAbi::Avx>;
 using double_m = Mask<double>;
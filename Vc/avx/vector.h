@@ -381,6 +381,9 @@ public:
         Vc_INTRINSIC_L Vc_PURE_L Vector reversed() const Vc_INTRINSIC_R Vc_PURE_R;
         Vc_ALWAYS_INLINE_L Vc_PURE_L Vector sorted() const Vc_ALWAYS_INLINE_R Vc_PURE_R;
 
+        Vc_INTRINSIC_L Vector compress(MaskArgument k) const Vc_INTRINSIC_R;
+        Vc_INTRINSIC_L Vector expand(MaskArgument k) const Vc_INTRINSIC_R;
+
         template <typename F> void callWithValuesSorted(F &&f)
         {
             EntryType value = d.m(0);
@@ -44,6 +44,10 @@ Vc_INTRINSIC AVX2::   int_m operator==(AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator==(AVX2::  uint_v a, AVX2::  uint_v b) { return AVX::cmpeq_epi32(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: short_m operator==(AVX2:: short_v a, AVX2:: short_v b) { return AVX::cmpeq_epi16(a.data(), b.data()); }
 Vc_INTRINSIC AVX2::ushort_m operator==(AVX2::ushort_v a, AVX2::ushort_v b) { return AVX::cmpeq_epi16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator==(AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator==(AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: llong_m operator==(AVX2:: llong_v a, AVX2:: llong_v b) { return AVX::cmpeq_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ullong_m operator==(AVX2::ullong_v a, AVX2::ullong_v b) { return AVX::cmpeq_epi64(a.data(), b.data()); }
 
 Vc_INTRINSIC AVX2::double_m operator!=(AVX2::double_v a, AVX2::double_v b) { return AVX::cmpneq_pd(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: float_m operator!=(AVX2:: float_v a, AVX2:: float_v b) { return AVX::cmpneq_ps(a.data(), b.data()); }
@@ -51,6 +55,10 @@ Vc_INTRINSIC AVX2::   int_m operator!=(AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator!=(AVX2::  uint_v a, AVX2::  uint_v b) { return not_(AVX::cmpeq_epi32(a.data(), b.data())); }
 Vc_INTRINSIC AVX2:: short_m operator!=(AVX2:: short_v a, AVX2:: short_v b) { return not_(AVX::cmpeq_epi16(a.data(), b.data())); }
 Vc_INTRINSIC AVX2::ushort_m operator!=(AVX2::ushort_v a, AVX2::ushort_v b) { return not_(AVX::cmpeq_epi16(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator!=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator!=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: llong_m operator!=(AVX2:: llong_v a, AVX2:: llong_v b) { return not_(AVX::cmpeq_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2::ullong_m operator!=(AVX2::ullong_v a, AVX2::ullong_v b) { return not_(AVX::cmpeq_epi64(a.data(), b.data())); }
 
 Vc_INTRINSIC AVX2::double_m operator>=(AVX2::double_v a, AVX2::double_v b) { return AVX::cmpnlt_pd(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: float_m operator>=(AVX2:: float_v a, AVX2:: float_v b) { return AVX::cmpnlt_ps(a.data(), b.data()); }
@@ -58,6 +66,10 @@ Vc_INTRINSIC AVX2::   int_m operator>=(AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator>=(AVX2::  uint_v a, AVX2::  uint_v b) { return not_(AVX::cmplt_epu32(a.data(), b.data())); }
 Vc_INTRINSIC AVX2:: short_m operator>=(AVX2:: short_v a, AVX2:: short_v b) { return not_(AVX::cmplt_epi16(a.data(), b.data())); }
 Vc_INTRINSIC AVX2::ushort_m operator>=(AVX2::ushort_v a, AVX2::ushort_v b) { return not_(AVX::cmplt_epu16(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator>=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmplt_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator>=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmplt_epu8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: llong_m operator>=(AVX2:: llong_v a, AVX2:: llong_v b) { return not_(AVX::cmplt_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2::ullong_m operator>=(AVX2::ullong_v a, AVX2::ullong_v b) { return not_(AVX::cmplt_epu64(a.data(), b.data())); }
 
 Vc_INTRINSIC AVX2::double_m operator<=(AVX2::double_v a, AVX2::double_v b) { return AVX::cmple_pd(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: float_m operator<=(AVX2:: float_v a, AVX2:: float_v b) { return AVX::cmple_ps(a.data(), b.data()); }
@@ -65,6 +77,10 @@ Vc_INTRINSIC AVX2::   int_m operator<=(AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator<=(AVX2::  uint_v a, AVX2::  uint_v b) { return not_(AVX::cmpgt_epu32(a.data(), b.data())); }
 Vc_INTRINSIC AVX2:: short_m operator<=(AVX2:: short_v a, AVX2:: short_v b) { return not_(AVX::cmpgt_epi16(a.data(), b.data())); }
 Vc_INTRINSIC AVX2::ushort_m operator<=(AVX2::ushort_v a, AVX2::ushort_v b) { return not_(AVX::cmpgt_epu16(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator<=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmpgt_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator<=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmpgt_epu8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: llong_m operator<=(AVX2:: llong_v a, AVX2:: llong_v b) { return not_(AVX::cmpgt_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2::ullong_m operator<=(AVX2::ullong_v a, AVX2::ullong_v b) { return not_(AVX::cmpgt_epu64(a.data(), b.data())); }
 
 Vc_INTRINSIC AVX2::double_m operator> (AVX2::double_v a, AVX2::double_v b) { return AVX::cmpgt_pd(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: float_m operator> (AVX2:: float_v a, AVX2:: float_v b) { return AVX::cmpgt_ps(a.data(), b.data()); }
@@ -72,6 +88,10 @@ Vc_INTRINSIC AVX2::   int_m operator> (AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator> (AVX2::  uint_v a, AVX2::  uint_v b) { return AVX::cmpgt_epu32(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: short_m operator> (AVX2:: short_v a, AVX2:: short_v b) { return AVX::cmpgt_epi16(a.data(), b.data()); }
 Vc_INTRINSIC AVX2::ushort_m operator> (AVX2::ushort_v a, AVX2::ushort_v b) { return AVX::cmpgt_epu16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator> (AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmpgt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator> (AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpgt_epu8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: llong_m operator> (AVX2:: llong_v a, AVX2:: llong_v b) { return AVX::cmpgt_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ullong_m operator> (AVX2::ullong_v a, AVX2::ullong_v b) { return AVX::cmpgt_epu64(a.data(), b.data()); }
 
 Vc_INTRINSIC AVX2::double_m operator< (AVX2::double_v a, AVX2::double_v b) { return AVX::cmplt_pd(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: float_m operator< (AVX2:: float_v a, AVX2:: float_v b) { return AVX::cmplt_ps(a.data(), b.data()); }
@@ -79,6 +99,10 @@ Vc_INTRINSIC AVX2::   int_m operator< (AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator< (AVX2::  uint_v a, AVX2::  uint_v b) { return AVX::cmplt_epu32(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: short_m operator< (AVX2:: short_v a, AVX2:: short_v b) { return AVX::cmplt_epi16(a.data(), b.data()); }
 Vc_INTRINSIC AVX2::ushort_m operator< (AVX2::ushort_v a, AVX2::ushort_v b) { return AVX::cmplt_epu16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator< (AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmplt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator< (AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmplt_epu8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: llong_m operator< (AVX2:: llong_v a, AVX2:: llong_v b) { return AVX::cmplt_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ullong_m operator< (AVX2::ullong_v a, AVX2::ullong_v b) { return AVX::cmplt_epu64(a.data(), b.data()); }
 
 // bitwise operators {{{1
 template <typename T>
@@ -114,10 +138,19 @@ Vc_INTRINSIC AVX2::Vector<T> operator*(AVX2::Vector<T> a, AVX2::Vector<T> b)
     return mul(a.data(), b.data(), T());
 }
 template <typename T>
-Vc_INTRINSIC AVX2::Vector<T> operator/(AVX2::Vector<T> a, AVX2::Vector<T> b)
+Vc_INTRINSIC enable_if<!(std::is_integral<T>::value && (sizeof(T) == 1 || sizeof(T) == 8)),
+                       AVX2::Vector<T>>
+operator/(AVX2::Vector<T> a, AVX2::Vector<T> b)
 {
     return div(a.data(), b.data(), T());
 }
+template <typename T>
+Vc_INTRINSIC enable_if<(std::is_integral<T>::value && (sizeof(T) == 1 || sizeof(T) == 8)),
+                       AVX2::Vector<T>>
+operator/(AVX2::Vector<T> a, AVX2::Vector<T> b)
+{
+    return AVX2::Vector<T>::generate([&](int i) { return a[i] / b[i]; });
+}
 Vc_INTRINSIC AVX2::Vector<ushort> operator/(AVX2::Vector<ushort> a,
                                             AVX2::Vector<ushort> b)
 {
@@ -231,6 +264,100 @@ template <> template <typename G> Vc_INTRINSIC AVX2::ushort_v AVX2::ushort_v::ge
     const auto tmp15 = gen(15);
     return _mm256_setr_epi16(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15);
 }
+template <> template <typename G> Vc_INTRINSIC AVX2::schar_v AVX2::schar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    const auto tmp16 = gen(16);
+    const auto tmp17 = gen(17);
+    const auto tmp18 = gen(18);
+    const auto tmp19 = gen(19);
+    const auto tmp20 = gen(20);
+    const auto tmp21 = gen(21);
+    const auto tmp22 = gen(22);
+    const auto tmp23 = gen(23);
+    const auto tmp24 = gen(24);
+    const auto tmp25 = gen(25);
+    const auto tmp26 = gen(26);
+    const auto tmp27 = gen(27);
+    const auto tmp28 = gen(28);
+    const auto tmp29 = gen(29);
+    const auto tmp30 = gen(30);
+    const auto tmp31 = gen(31);
+    return _mm256_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7,
+                            tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15,
+                            tmp16, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23,
+                            tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30, tmp31);
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::uchar_v AVX2::uchar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    const auto tmp16 = gen(16);
+    const auto tmp17 = gen(17);
+    const auto tmp18 = gen(18);
+    const auto tmp19 = gen(19);
+    const auto tmp20 = gen(20);
+    const auto tmp21 = gen(21);
+    const auto tmp22 = gen(22);
+    const auto tmp23 = gen(23);
+    const auto tmp24 = gen(24);
+    const auto tmp25 = gen(25);
+    const auto tmp26 = gen(26);
+    const auto tmp27 = gen(27);
+    const auto tmp28 = gen(28);
+    const auto tmp29 = gen(29);
+    const auto tmp30 = gen(30);
+    const auto tmp31 = gen(31);
+    return _mm256_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7,
+                            tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15,
+                            tmp16, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23,
+                            tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30, tmp31);
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::llong_v AVX2::llong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    return _mm256_setr_epi64x(tmp0, tmp1, tmp2, tmp3);
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::ullong_v AVX2::ullong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    return _mm256_setr_epi64x(tmp0, tmp1, tmp2, tmp3);
+}
 #endif
 
 // constants {{{1
@@ -245,6 +372,8 @@ template <> Vc_INTRINSIC Vector< short, VectorAbi::Avx>::Vector(VectorSpecialIni
 template <> Vc_INTRINSIC Vector<ushort, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epu16()) {}
 template <> Vc_INTRINSIC Vector< schar, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epi8()) {}
 template <> Vc_INTRINSIC Vector< uchar, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epu8()) {}
+template <> Vc_INTRINSIC Vector< llong, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epi64()) {}
+template <> Vc_INTRINSIC Vector<ullong, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epu64()) {}
 #endif
 
 template <typename T>
@@ -264,6 +393,16 @@ Vc_ALWAYS_INLINE Vector<double, VectorAbi::Avx>::Vector(VectorSpecialInitializer
     : Vector(AVX::IndexesFromZeroData<int>::address(), Vc::Aligned)
 {
 }
+template <>
+Vc_ALWAYS_INLINE Vector<llong, VectorAbi::Avx>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm256_setr_epi64x(0, 1, 2, 3))
+{
+}
+template <>
+Vc_ALWAYS_INLINE Vector<ullong, VectorAbi::Avx>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm256_setr_epi64x(0, 1, 2, 3))
+{
+}
 
 ///////////////////////////////////////////////////////////////////////////////////////////
 // load member functions {{{1
@@ -345,6 +484,14 @@ template <> Vc_ALWAYS_INLINE AVX2::Vector< short> Vector< short, VectorAbi::Avx>
 template <> Vc_ALWAYS_INLINE AVX2::Vector<ushort> Vector<ushort, VectorAbi::Avx>::operator<<(AsArg x) const { return generate([&](int i) { return get(*this, i) << get(x, i); }); }
 template <> Vc_ALWAYS_INLINE AVX2::Vector< short> Vector< short, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
 template <> Vc_ALWAYS_INLINE AVX2::Vector<ushort> Vector<ushort, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< llong> Vector< llong, VectorAbi::Avx>::operator<<(AsArg x) const { return _mm256_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector<ullong> Vector<ullong, VectorAbi::Avx>::operator<<(AsArg x) const { return _mm256_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< llong> Vector< llong, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector<ullong> Vector<ullong, VectorAbi::Avx>::operator>>(AsArg x) const { return _mm256_srlv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< schar> Vector< schar, VectorAbi::Avx>::operator<<(AsArg x) const { return generate([&](int i) { return get(*this, i) << get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< uchar> Vector< uchar, VectorAbi::Avx>::operator<<(AsArg x) const { return generate([&](int i) { return get(*this, i) << get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< schar> Vector< schar, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< uchar> Vector< uchar, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
 template <typename T>
 Vc_ALWAYS_INLINE AVX2::Vector<T> &Vector<T, VectorAbi::Avx>::operator<<=(AsArg x)
 {
@@ -440,6 +587,21 @@ Vc_INTRINSIC void AVX2::uint_v::gatherImplementation(const uint *mem,
     d.v() = _mm256_i32gather_epi32(reinterpret_cast<const MayAlias<int> *>(mem), indexes.data(),
                                    sizeof(unsigned));
 }
+
+template <>
+Vc_INTRINSIC void AVX2::llong_v::gatherImplementation(const llong *mem,
+                                                      SSE::int_v indexes)
+{
+    d.v() = _mm256_i32gather_epi64(mem, indexes.data(), sizeof(llong));
+}
+
+template <>
+Vc_INTRINSIC void AVX2::ullong_v::gatherImplementation(const ullong *mem,
+                                                       SSE::int_v indexes)
+{
+    d.v() = _mm256_i32gather_epi64(reinterpret_cast<const MayAlias<llong> *>(mem),
+                                   indexes.data(), sizeof(ullong));
+}
 #endif  // !Vc_MSVC
 
 template <>
@@ -483,8 +645,197 @@ inline void AVX2::ushort_v::gatherImplementation(const MT *mem, const IT &indexe
                               mem[indexes[12]], mem[indexes[13]], mem[indexes[14]],
                               mem[indexes[15]]);
 }
+
+template <>
+template <typename MT, typename IT>
+inline void AVX2::schar_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm256_setr_epi8(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]], mem[indexes[3]],
+                             mem[indexes[4]], mem[indexes[5]], mem[indexes[6]], mem[indexes[7]],
+                             mem[indexes[8]], mem[indexes[9]], mem[indexes[10]], mem[indexes[11]],
+                             mem[indexes[12]], mem[indexes[13]], mem[indexes[14]], mem[indexes[15]],
+                             mem[indexes[16]], mem[indexes[17]], mem[indexes[18]], mem[indexes[19]],
+                             mem[indexes[20]], mem[indexes[21]], mem[indexes[22]], mem[indexes[23]],
+                             mem[indexes[24]], mem[indexes[25]], mem[indexes[26]], mem[indexes[27]],
+                             mem[indexes[28]], mem[indexes[29]], mem[indexes[30]], mem[indexes[31]]);
+}
+
+template <>
+template <typename MT, typename IT>
+inline void AVX2::uchar_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm256_setr_epi8(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]], mem[indexes[3]],
+                             mem[indexes[4]], mem[indexes[5]], mem[indexes[6]], mem[indexes[7]],
+                             mem[indexes[8]], mem[indexes[9]], mem[indexes[10]], mem[indexes[11]],
+                             mem[indexes[12]], mem[indexes[13]], mem[indexes[14]], mem[indexes[15]],
+                             mem[indexes[16]], mem[indexes[17]], mem[indexes[18]], mem[indexes[19]],
+                             mem[indexes[20]], mem[indexes[21]], mem[indexes[22]], mem[indexes[23]],
+                             mem[indexes[24]], mem[indexes[25]], mem[indexes[26]], mem[indexes[27]],
+                             mem[indexes[28]], mem[indexes[29]], mem[indexes[30]], mem[indexes[31]]);
+}
+
+template <>
+template <typename MT, typename IT>
+inline void AVX2::llong_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm256_setr_epi64x(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]],
+                               mem[indexes[3]]);
+}
+
+template <>
+template <typename MT, typename IT>
+inline void AVX2::ullong_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm256_setr_epi64x(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]],
+                               mem[indexes[3]]);
+}
 #endif
 
+#ifdef Vc_IMPL_AVX2
+// masked hardware gathers {{{1
+namespace Detail
+{
+// is_hardware_gatherable {{{2
+/**\internal
+ * The size of an index that the AVX2 gather instructions can use directly: 4 for vectors
+ * of \c int and pointers to signed 32-bit integers, 8 for pointers to 64-bit integers, and
+ * 0 for anything else.
+ */
+template <typename IT, bool = Traits::is_simd_vector<IT>::value>
+struct hardware_gather_index_size : public std::integral_constant<std::size_t, 0> {
+};
+template <typename IT>
+struct hardware_gather_index_size<IT, true>
+    : public std::integral_constant<
+          std::size_t, std::is_same<typename IT::EntryType, int>::value ? 4 : 0> {
+};
+template <typename I>
+struct hardware_gather_index_size<I *, false>
+    : public std::integral_constant<
+          std::size_t,
+          !std::is_integral<I>::value
+              ? 0
+              : sizeof(I) == 8 ? 8 : (sizeof(I) == 4 && std::is_signed<I>::value) ? 4 : 0> {
+};
+
+/**\internal
+ * Whether a masked gather into \p V from \p MT with index type \p IT maps to a gather
+ * instruction. The memory type must equal the entry type because the instructions do not
+ * convert.
+ */
+template <typename V, typename MT, typename IT>
+struct is_hardware_gatherable
+    : public std::integral_constant<bool, std::is_same<MT, typename V::EntryType>::value &&
+                                              (sizeof(MT) == 4 || sizeof(MT) == 8) &&
+                                              hardware_gather_index_size<IT>::value != 0> {
+};
+
+// maskedGather {{{2
+// Masked-off entries keep the value of src and their memory is not accessed. Index arrays
+// are read with maskload so that entries past the end of a short array are not touched
+// either.
+//
+// 8 entries of 32 bits; floats are gathered through the integer instruction.
+template <typename IT>
+Vc_INTRINSIC enable_if<Traits::is_simd_vector<IT>::value, __m256i> maskedGather(
+    __m256i src, const MayAlias<int> *mem, const IT &indexes, __m256i k)
+{
+    return _mm256_mask_i32gather_epi32(src, mem, simd_cast<AVX2::int_v>(indexes).data(),
+                                       k, sizeof(int));
+}
+
+template <typename I>
+Vc_INTRINSIC enable_if<sizeof(I) == 4, __m256i> maskedGather(__m256i src,
+                                                             const MayAlias<int> *mem,
+                                                             const I *indexes, __m256i k)
+{
+    const __m256i idx =
+        _mm256_maskload_epi32(reinterpret_cast<const MayAlias<int> *>(indexes), k);
+    return _mm256_mask_i32gather_epi32(src, mem, idx, k, sizeof(int));
+}
+
+template <typename I>
+Vc_INTRINSIC enable_if<sizeof(I) == 8, __m256i> maskedGather(__m256i src,
+                                                             const MayAlias<int> *mem,
+                                                             const I *indexes, __m256i k)
+{
+    const auto idx = reinterpret_cast<const MayAlias<long long> *>(indexes);
+    const __m256i idx0 = _mm256_maskload_epi64(idx, _mm256_cvtepi32_epi64(AVX::lo128(k)));
+    const __m256i idx1 =
+        _mm256_maskload_epi64(idx + 4, _mm256_cvtepi32_epi64(AVX::hi128(k)));
+    return AVX::concat(_mm256_mask_i64gather_epi32(AVX::lo128(src), mem, idx0,
+                                                   AVX::lo128(k), sizeof(int)),
+                       _mm256_mask_i64gather_epi32(AVX::hi128(src), mem, idx1,
+                                                   AVX::hi128(k), sizeof(int)));
+}
+
+// 4 entries of 64 bits
+template <typename IT>
+Vc_INTRINSIC enable_if<Traits::is_simd_vector<IT>::value, __m256d> maskedGather(
+    __m256d src, const double *mem, const IT &indexes, __m256d k)
+{
+    return _mm256_mask_i32gather_pd(src, mem, simd_cast<SSE::int_v>(indexes).data(), k,
+                                    sizeof(double));
+}
+
+template <typename I>
+Vc_INTRINSIC enable_if<sizeof(I) == 4, __m256d> maskedGather(__m256d src,
+                                                             const double *mem,
+                                                             const I *indexes, __m256d k)
+{
+    const __m256i ki = AVX::avx_cast<__m256i>(k);
+    const __m128i idx = _mm_maskload_epi32(reinterpret_cast<const MayAlias<int> *>(indexes),
+                                           _mm_packs_epi32(AVX::lo128(ki), AVX::hi128(ki)));
+    return _mm256_mask_i32gather_pd(src, mem, idx, k, sizeof(double));
+}
+
+template <typename I>
+Vc_INTRINSIC enable_if<sizeof(I) == 8, __m256d> maskedGather(__m256d src,
+                                                             const double *mem,
+                                                             const I *indexes, __m256d k)
+{
+    const __m256i idx = _mm256_maskload_epi64(
+        reinterpret_cast<const MayAlias<long long> *>(indexes), AVX::avx_cast<__m256i>(k));
+    return _mm256_mask_i64gather_pd(src, mem, idx, k, sizeof(double));
+}
+//}}}2
+}  // namespace Detail
+
+namespace Common
+{
+template <typename T, typename IT>
+Vc_INTRINSIC enable_if<sizeof(T) == 4, void> executeGather(HardwareGatherT,
+                                                           AVX2::Vector<T> &v,
+                                                           const T *mem,
+                                                           const IT &indexes,
+                                                           const AVX2::Mask<T> &mask)
+{
+    v.data() = AVX::avx_cast<typename AVX2::Vector<T>::VectorType>(Vc::Detail::maskedGather(
+        AVX::avx_cast<__m256i>(v.data()), reinterpret_cast<const MayAlias<int> *>(mem),
+        indexes, mask.dataI()));
+}
+
+template <typename IT>
+Vc_INTRINSIC void executeGather(HardwareGatherT, AVX2::double_v &v, const double *mem,
+                                const IT &indexes, const AVX2::double_m &mask)
+{
+    v.data() = Vc::Detail::maskedGather(v.data(), mem, indexes, mask.dataD());
+}
+
+// 64-bit integers use the same instructions as double
+template <typename T, typename IT>
+Vc_INTRINSIC enable_if<(std::is_integral<T>::value && sizeof(T) == 8), void>
+executeGather(HardwareGatherT, AVX2::Vector<T> &v, const T *mem, const IT &indexes,
+              const AVX2::Mask<T> &mask)
+{
+    v.data() = AVX::avx_cast<__m256i>(Vc::Detail::maskedGather(
+        AVX::avx_cast<__m256d>(v.data()), reinterpret_cast<const double *>(mem), indexes,
+        mask.dataD()));
+}
+}  // namespace Common
+#endif  // Vc_IMPL_AVX2
+
+// masked gathers and scatters {{{1
 template <typename T>
 template <typename MT, typename IT>
 inline void Vector<T, VectorAbi::Avx>::gatherImplementation(const MT *mem, const IT &indexes, MaskArgument mask)
@@ -497,6 +848,10 @@ inline void Vector<T, VectorAbi::Avx>::gatherImplementation(const MT *mem, const
                                             Common::GatherScatterImplementation::BitScanLoop
 #elif defined Vc_USE_POPCNT_BSF_GATHERS
               Common::GatherScatterImplementation::PopcntSwitch
+#elif defined Vc_IMPL_AVX2 && !defined Vc_USE_LOOP_GATHERS
+              Detail::is_hardware_gatherable<Vector, MT, IT>::value
+                  ? Common::GatherScatterImplementation::HardwareGather
+                  : Common::GatherScatterImplementation::SimpleLoop
 #else
               Common::GatherScatterImplementation::SimpleLoop
 #endif
@@ -715,31 +1070,32 @@ static Vc_ALWAYS_INLINE __m256i _doRandomStep()
 {
     using Detail::operator*;
     using Detail::operator+;
+    unsigned int *const randomState = Common::randomState();
 #ifdef Vc_IMPL_AVX2
     using AVX2::uint_v;
-    uint_v state0(&Common::RandomState[0]);
-    uint_v state1(&Common::RandomState[uint_v::Size]);
-    (state1 * uint_v(0xdeece66du) + uint_v(11)).store(&Common::RandomState[uint_v::Size]);
+    uint_v state0(&randomState[0]);
+    uint_v state1(&randomState[uint_v::Size]);
+    (state1 * uint_v(0xdeece66du) + uint_v(11)).store(&randomState[uint_v::Size]);
     uint_v(Detail::xor_((state0 * uint_v(0xdeece66du) + uint_v(11)).data(),
                         _mm256_srli_epi32(state1.data(), 16)))
-        .store(&Common::RandomState[0]);
+        .store(&randomState[0]);
     return state0.data();
 #else
     using SSE::uint_v;
-    uint_v state0(&Common::RandomState[0]);
-    uint_v state1(&Common::RandomState[uint_v::Size]);
-    uint_v state2(&Common::RandomState[2 * uint_v::Size]);
-    uint_v state3(&Common::RandomState[3 * uint_v::Size]);
+    uint_v state0(&randomState[0]);
+    uint_v state1(&randomState[uint_v::Size]);
+    uint_v state2(&randomState[2 * uint_v::Size]);
+    uint_v state3(&randomState[3 * uint_v::Size]);
     (state2 * uint_v(0xdeece66du) + uint_v(11))
-        .store(&Common::RandomState[2 * uint_v::Size]);
+        .store(&randomState[2 * uint_v::Size]);
     (state3 * uint_v(0xdeece66du) + uint_v(11))
-        .store(&Common::RandomState[3 * uint_v::Size]);
+        .store(&randomState[3 * uint_v::Size]);
     uint_v(Detail::xor_((state0 * uint_v(0xdeece66du) + uint_v(11)).data(),
                         _mm_srli_epi32(state2.data(), 16)))
-        .store(&Common::RandomState[0]);
+        .store(&randomState[0]);
     uint_v(Detail::xor_((state1 * uint_v(0xdeece66du) + uint_v(11)).data(),
                         _mm_srli_epi32(state3.data(), 16)))
-        .store(&Common::RandomState[uint_v::Size]);
+        .store(&randomState[uint_v::Size]);
     return AVX::concat(state0.data(), state1.data());
 #endif
 }
@@ -759,12 +1115,13 @@ template <> Vc_ALWAYS_INLINE AVX2::float_v AVX2::float_v::Random()
 
 template<> Vc_ALWAYS_INLINE AVX2::double_v AVX2::double_v::Random()
 {
-    const __m256i state = Detail::load(&Common::RandomState[0], Vc::Aligned,
+    unsigned int *const randomState = Common::randomState();
+    const __m256i state = Detail::load(&randomState[0], Vc::Aligned,
                                        Detail::LoadTag<__m256i, int>());
     for (size_t k = 0; k < 8; k += 2) {
         typedef unsigned long long uint64 Vc_MAY_ALIAS;
-        const uint64 stateX = *reinterpret_cast<const uint64 *>(&Common::RandomState[k]);
-        *reinterpret_cast<uint64 *>(&Common::RandomState[k]) = (stateX * 0x5deece66dull + 11);
+        const uint64 stateX = *reinterpret_cast<const uint64 *>(&randomState[k]);
+        *reinterpret_cast<uint64 *>(&randomState[k]) = (stateX * 0x5deece66dull + 11);
     }
     return HT::sub(Detail::or_(_cast(AVX::srli_epi64<12>(state)), HT::one()), HT::one());
 }
@@ -786,56 +1143,69 @@ Vc_INTRINSIC Vc_CONST VectorType shifted_shortcut(VectorType left, VectorType ri
     return Mem::shuffle128<X1, Y0>(left, right);
 }
 
+namespace Detail
+{
+/**\internal
+ * Returns the 32 Bytes starting at Byte \p Bytes of the 64 Byte concatenation [\p a \p b]
+ * (\p a in the low half), i.e. palignr across the full width. Requires 0 < Bytes < 32.
+ */
+template <int Bytes> Vc_INTRINSIC __m256i shifted_concat(__m256i a, __m256i b)
+{
+#if defined Vc_IMPL_AVX512VL
+    if (Bytes % 4 == 0) {
+        return _mm256_alignr_epi32(b, a, (Bytes / 4) % 8);
+    }
+#endif
+#ifdef Vc_IMPL_AVX2
+    const __m256i mid = _mm256_permute2x128_si256(a, b, 0x21);
+    return Bytes < 16 ? _mm256_alignr_epi8(mid, a, Bytes % 16)
+                      : _mm256_alignr_epi8(b, mid, Bytes % 16);
+#else   // Vc_IMPL_AVX2
+    using AVX::lo128;
+    using AVX::hi128;
+    return Bytes < 16 ? AVX::concat(_mm_alignr_epi8(hi128(a), lo128(a), Bytes % 16),
+                                    _mm_alignr_epi8(lo128(b), hi128(a), Bytes % 16))
+                      : AVX::concat(_mm_alignr_epi8(lo128(b), hi128(a), Bytes % 16),
+                                    _mm_alignr_epi8(hi128(b), lo128(b), Bytes % 16));
+#endif  // Vc_IMPL_AVX2
+}
+
+/**\internal
+ * Dispatches the runtime (but, after inlining, usually constant) \p amount in [K, N) to
+ * shifted_concat.
+ */
+template <typename T, int K, int N> struct ShiftedConcat {
+    static Vc_INTRINSIC __m256i apply(int amount, __m256i a, __m256i b)
+    {
+        return amount == K ? shifted_concat<K * sizeof(T)>(a, b)
+                           : ShiftedConcat<T, K + 1, N>::apply(amount, a, b);
+    }
+};
+template <typename T, int N> struct ShiftedConcat<T, N, N> {
+    static Vc_INTRINSIC __m256i apply(int, __m256i a, __m256i) { return a; }
+};
+}  // namespace Detail
+
 template<typename T> Vc_INTRINSIC AVX2::Vector<T> Vector<T, VectorAbi::Avx>::shifted(int amount, Vector shiftIn) const
 {
 #ifdef __GNUC__
     if (__builtin_constant_p(amount)) {
-        const __m256i a = AVX::avx_cast<__m256i>(d.v());
-        const __m256i b = AVX::avx_cast<__m256i>(shiftIn.d.v());
         if (amount * 2 == int(Size)) {
             return shifted_shortcut(d.v(), shiftIn.d.v(), WidthT());
         }
         if (amount * 2 == -int(Size)) {
             return shifted_shortcut(shiftIn.d.v(), d.v(), WidthT());
         }
-        switch (amount) {
-        case 1:
+        const __m256i a = AVX::avx_cast<__m256i>(d.v());
+        const __m256i b = AVX::avx_cast<__m256i>(shiftIn.d.v());
+        if (amount > 0 && amount < int(Size)) {
             return AVX::avx_cast<VectorType>(
-#ifdef Vc_IMPL_AVX2
-                _mm256_alignr_epi8(_mm256_permute2x128_si256(a, b, 0x21), a,
-                                   sizeof(EntryType))
-#else  // Vc_IMPL_AVX2
-                AVX::concat(
-                    _mm_alignr_epi8(AVX::hi128(a), AVX::lo128(a), sizeof(EntryType)),
-                    _mm_alignr_epi8(AVX::lo128(b), AVX::hi128(a), sizeof(EntryType)))
-#endif  // Vc_IMPL_AVX2
-                    );
-        case 2:
+                Detail::ShiftedConcat<EntryType, 1, Size>::apply(amount, a, b));
+        }
+        if (amount < 0 && amount > -int(Size)) {
+            // [shiftIn *this] shifted by Size + amount
             return AVX::avx_cast<VectorType>(
-#ifdef Vc_IMPL_AVX2
-                _mm256_alignr_epi8(_mm256_permute2x128_si256(a, b, 0x21), a,
-                                   2 * sizeof(EntryType))
-#else  // Vc_IMPL_AVX2
-                AVX::concat(
-                    _mm_alignr_epi8(AVX::hi128(a), AVX::lo128(a), 2 * sizeof(EntryType)),
-                    _mm_alignr_epi8(AVX::lo128(b), AVX::hi128(a), 2 * sizeof(EntryType)))
-#endif  // Vc_IMPL_AVX2
-                    );
-        case 3:
-            if (6u < Size) {
-                return AVX::avx_cast<VectorType>(
-#ifdef Vc_IMPL_AVX2
-                    _mm256_alignr_epi8(_mm256_permute2x128_si256(a, b, 0x21), a,
-                                       3 * sizeof(EntryType))
-#else   // Vc_IMPL_AVX2
-                    AVX::concat(_mm_alignr_epi8(AVX::hi128(a), AVX::lo128(a),
-                                                3 * sizeof(EntryType)),
-                                _mm_alignr_epi8(AVX::lo128(b), AVX::hi128(a),
-                                                3 * sizeof(EntryType)))
-#endif  // Vc_IMPL_AVX2
-                        );
-            // TODO: } else {
-            }
+                Detail::ShiftedConcat<EntryType, 1, Size>::apply(int(Size) + amount, b, a));
         }
     }
 #endif
@@ -849,12 +1219,43 @@ template<typename T> Vc_INTRINSIC AVX2::Vector<T> Vector<T, VectorAbi::Avx>::rot
     return Detail::rotated<EntryType, size()>(d.v(), amount);
 }
 // sorted {{{1
+#ifdef Vc_IMPL_AVX2
+namespace Detail
+{
+template <typename V> inline V sortedInMemory(V x)
+{
+    alignas(32) typename V::EntryType mem[V::Size];
+    x.store(mem, Vc::Aligned);
+    std::sort(mem, mem + V::Size);
+    return V(mem, Vc::Aligned);
+}
+inline AVX2:: schar_v sorted(AVX2:: schar_v x) { return sortedInMemory(x); }
+inline AVX2:: uchar_v sorted(AVX2:: uchar_v x) { return sortedInMemory(x); }
+inline AVX2:: llong_v sorted(AVX2:: llong_v x) { return sortedInMemory(x); }
+inline AVX2::ullong_v sorted(AVX2::ullong_v x) { return sortedInMemory(x); }
+}  // namespace Detail
+#endif
 template <typename T>
 Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Avx> Vector<T, VectorAbi::Avx>::sorted()
     const
 {
     return Detail::sorted(*this);
 }
+// compress / expand {{{1
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx> Vector<T, VectorAbi::Avx>::compress(
+    MaskArgument k) const
+{
+    return AVX::avx_cast<VectorType>(
+        Detail::compress<Size>(AVX::avx_cast<__m256i>(d.v()), k.toInt()));
+}
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx> Vector<T, VectorAbi::Avx>::expand(
+    MaskArgument k) const
+{
+    return AVX::avx_cast<VectorType>(
+        Detail::expand<Size>(AVX::avx_cast<__m256i>(d.v()), k.toInt()));
+}
 // interleaveLow/-High {{{1
 template <> Vc_INTRINSIC AVX2::double_v AVX2::double_v::interleaveLow(AVX2::double_v x) const
 {
@@ -909,6 +1310,38 @@ template <> Vc_INTRINSIC AVX2::ushort_v AVX2::ushort_v::interleaveHigh(AVX2::ush
     return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi16(data(), x.data()),
                                    _mm256_unpackhi_epi16(data(), x.data()));
 }
+template <> Vc_INTRINSIC  AVX2::schar_v  AVX2::schar_v::interleaveLow ( AVX2::schar_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::schar_v  AVX2::schar_v::interleaveHigh( AVX2::schar_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::uchar_v  AVX2::uchar_v::interleaveLow ( AVX2::uchar_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::uchar_v  AVX2::uchar_v::interleaveHigh( AVX2::uchar_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::llong_v  AVX2::llong_v::interleaveLow ( AVX2::llong_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::llong_v  AVX2::llong_v::interleaveHigh( AVX2::llong_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC AVX2::ullong_v AVX2::ullong_v::interleaveLow (AVX2::ullong_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC AVX2::ullong_v AVX2::ullong_v::interleaveHigh(AVX2::ullong_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
 #endif
 // permutation via operator[] {{{1
 template <> Vc_INTRINSIC Vc_PURE AVX2::double_v AVX2::double_v::operator[](Permutation::ReversedTag) const
@@ -946,6 +1379,30 @@ Vc_INTRINSIC Vc_PURE AVX2::ushort_v AVX2::ushort_v::operator[](
         AVX::avx_cast<__m256d>(Mem::permuteHi<X7, X6, X5, X4>(d.v())),
         AVX::avx_cast<__m256d>(Mem::permuteLo<X3, X2, X1, X0>(d.v())))));
 }
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::schar_v AVX2::schar_v::operator[](Permutation::ReversedTag) const
+{
+    const __m256i reverseInLane = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                                   15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    return Mem::permute128<X1, X0>(_mm256_shuffle_epi8(d.v(), reverseInLane));
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::uchar_v AVX2::uchar_v::operator[](Permutation::ReversedTag) const
+{
+    const __m256i reverseInLane = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                                   15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    return Mem::permute128<X1, X0>(_mm256_shuffle_epi8(d.v(), reverseInLane));
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::llong_v AVX2::llong_v::operator[](Permutation::ReversedTag) const
+{
+    return Mem::permute4x64<X3, X2, X1, X0>(d.v());
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::ullong_v AVX2::ullong_v::operator[](Permutation::ReversedTag) const
+{
+    return Mem::permute4x64<X3, X2, X1, X0>(d.v());
+}
 #endif
 template <> Vc_INTRINSIC AVX2::float_v Vector<float, VectorAbi::Avx>::operator[](const IndexType &/*perm*/) const
 {
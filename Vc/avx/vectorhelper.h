@@ -51,6 +51,14 @@ namespace AVX
 
             template<typename Flags> static Vc_ALWAYS_INLINE void store(float *mem, VTArg x, VTArg m, typename std::enable_if<!Flags::IsStreaming, void *>::type = nullptr) { _mm256_maskstore(mem, m, x); }
             template<typename Flags> static Vc_ALWAYS_INLINE void store(float *mem, VTArg x, VTArg m, typename std::enable_if< Flags::IsStreaming, void *>::type = nullptr) { AvxIntrinsics::stream_store(mem, x, m); }
+
+            // float16/bfloat16 stores convert to 16 bits per entry and thus write 16 Bytes
+            template<typename Flags, typename H> static Vc_ALWAYS_INLINE enable_if<Traits::is_half_float<H>::value, void> store(H *mem, VTArg x) { SSE::VectorHelper<__m128i>::store<Flags>(mem, convert(x, ConvertTag<float, H>())); }
+#ifdef Vc_IMPL_AVX512VL
+            template<typename Flags, typename H> static Vc_ALWAYS_INLINE enable_if<Traits::is_half_float<H>::value, void> store(H *mem, VTArg x, VTArg m) { _mm_mask_storeu_epi16(mem, _mm256_movepi32_mask(_mm256_castps_si256(m)), convert(x, ConvertTag<float, H>())); }
+#else
+            template<typename Flags, typename H> static Vc_ALWAYS_INLINE enable_if<Traits::is_half_float<H>::value, void> store(H *mem, VTArg x, VTArg m) { _mm_maskmoveu_si128(convert(x, ConvertTag<float, H>()), _mm_packs_epi32(lo128(_mm256_castps_si256(m)), hi128(_mm256_castps_si256(m))), reinterpret_cast<char *>(mem)); }
+#endif
         };
 
         template<> struct VectorHelper<__m256d>
@@ -28,6 +28,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef VC_COMMON_ALGORITHMS_H_
 #define VC_COMMON_ALGORITHMS_H_
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include "prefetch.h"
+#include "streaming.h"
+#ifdef Vc_IMPL_SSE
+#include "x86_prefetches.h"
+#endif
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -261,6 +270,1240 @@ simd_for_each_n(InputIt first, std::size_t count, UnaryFunction f)
 #endif
 #endif
 
+// Detail helpers for the contiguous range algorithms {{{1
+namespace Detail
+{
+/**\internal
+ * Returns the number of elements at \p p that need to be processed with scalar code
+ * before \p p is aligned for aligned loads of \p V, but at most \p n.
+ */
+template <typename V, typename T>
+Vc_INTRINSIC std::size_t unalignedHead(const T *p, std::size_t n)
+{
+    const std::size_t misalignment =
+        reinterpret_cast<std::uintptr_t>(p) & (V::MemoryAlignment - 1);
+    if (misalignment == 0) {
+        return 0;
+    }
+    const std::size_t head = (V::MemoryAlignment - misalignment) / sizeof(T);
+    return head < n ? head : n;
+}
+
+/**\internal
+ * Generic (transparent) function objects, usable with scalars and Vc vectors alike. They
+ * are the defaults of the reduction algorithms, since std::plus<T> only accepts T.
+ */
+struct plus {
+    template <typename T, typename U>
+    Vc_INTRINSIC auto operator()(const T &a, const U &b) const -> decltype(a + b)
+    {
+        return a + b;
+    }
+};
+struct multiplies {
+    template <typename T, typename U>
+    Vc_INTRINSIC auto operator()(const T &a, const U &b) const -> decltype(a * b)
+    {
+        return a * b;
+    }
+};
+
+/**\internal
+ * Identity transformation for simd_reduce.
+ */
+struct identity {
+    template <typename T> Vc_INTRINSIC const T &operator()(const T &x) const { return x; }
+};
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Function object returning the smaller of its two arguments. For vectors the minimum is
+ * determined component-wise. Use it as reduction operation for simd_reduce and
+ * simd_transform_reduce, which then use Vector::min() for the horizontal reduction.
+ */
+struct minimum {
+    template <typename T>
+    Vc_INTRINSIC T operator()(const T &a, const T &b) const
+    {
+        using std::min;
+        return min(a, b);
+    }
+};
+
+/**
+ * \ingroup Utilities
+ *
+ * Function object returning the larger of its two arguments. For vectors the maximum is
+ * determined component-wise. Use it as reduction operation for simd_reduce and
+ * simd_transform_reduce, which then use Vector::max() for the horizontal reduction.
+ */
+struct maximum {
+    template <typename T>
+    Vc_INTRINSIC T operator()(const T &a, const T &b) const
+    {
+        using std::max;
+        return max(a, b);
+    }
+};
+
+namespace Detail
+{
+/**\internal
+ * Reduces the entries of \p v to a single value using \p op. The known operations map to
+ * the horizontal reductions of the vector types, everything else is reduced entry by
+ * entry.
+ */
+template <typename V, typename BinaryOp>
+Vc_INTRINSIC typename V::EntryType reduceHorizontal(const V &v, BinaryOp op)
+{
+    typename V::EntryType r = v[0];
+    for (std::size_t i = 1; i < V::Size; ++i) {
+        r = op(r, typename V::EntryType(v[i]));
+    }
+    return r;
+}
+template <typename V> Vc_INTRINSIC typename V::EntryType reduceHorizontal(const V &v, plus)
+{
+    return v.sum();
+}
+template <typename V>
+Vc_INTRINSIC typename V::EntryType reduceHorizontal(const V &v, multiplies)
+{
+    return v.product();
+}
+template <typename V>
+Vc_INTRINSIC typename V::EntryType reduceHorizontal(const V &v, Vc::minimum)
+{
+    return v.min();
+}
+template <typename V>
+Vc_INTRINSIC typename V::EntryType reduceHorizontal(const V &v, Vc::maximum)
+{
+    return v.max();
+}
+#ifdef Vc_CXX14
+template <typename V>
+Vc_INTRINSIC typename V::EntryType reduceHorizontal(const V &v, std::plus<>)
+{
+    return v.sum();
+}
+template <typename V>
+Vc_INTRINSIC typename V::EntryType reduceHorizontal(const V &v, std::multiplies<>)
+{
+    return v.product();
+}
+#endif  // Vc_CXX14
+
+template <typename V> Vc_INTRINSIC typename V::EntryType firstEntry(const V &v)
+{
+    return v[0];
+}
+
+template <typename It>
+using is_arithmetic_iterator =
+    std::is_arithmetic<typename std::iterator_traits<It>::value_type>;
+}  // namespace Detail
+
+// simd_transform {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the unary `std::transform` algorithm for contiguous ranges.
+ *
+ * Calls \p op with `Vc::Vector<` *value type of InputIt* `, ` *unspecified* `>` objects
+ * covering the range [\p first, \p last) and stores the returned vectors to the range
+ * starting at \p d_first. As with simd_for_each, the beginning and end of the range are
+ * processed with one-element vectors, such that all full-width loads from the input are
+ * aligned. The output range does not need to be aligned and may be equal to the input
+ * range. The value type of \p d_first must be the entry type of the vectors returned
+ * by \p op.
+ *
+ * \code
+ * Vc::simd_transform(in.begin(), in.end(), out.begin(), [](auto v) { return v * v; });
+ * \endcode
+ *
+ * \return The iterator one past the last element written.
+ */
+template <typename InputIt, typename OutputIt, typename UnaryOperation>
+inline enable_if<Detail::is_arithmetic_iterator<InputIt>::value, OutputIt> simd_transform(
+    InputIt first, InputIt last, OutputIt d_first, UnaryOperation op)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return d_first;
+    }
+    const T *in = std::addressof(*first);
+    auto *out = std::addressof(*d_first);
+    std::size_t i = 0;
+    for (const std::size_t head = Detail::unalignedHead<V>(in, n); i < head; ++i) {
+        op(V1(in + i, Vc::Aligned)).store(out + i, Vc::Unaligned);
+    }
+    for (; i + V::Size <= n; i += V::Size) {
+        op(V(in + i, Vc::Aligned)).store(out + i, Vc::Unaligned);
+    }
+    for (; i < n; ++i) {
+        op(V1(in + i, Vc::Aligned)).store(out + i, Vc::Unaligned);
+    }
+    return d_first + n;
+}
+
+template <typename InputIt, typename OutputIt, typename UnaryOperation>
+inline enable_if<!Detail::is_arithmetic_iterator<InputIt>::value, OutputIt>
+simd_transform(InputIt first, InputIt last, OutputIt d_first, UnaryOperation op)
+{
+    return std::transform(first, last, d_first, std::move(op));
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the binary `std::transform` algorithm for contiguous ranges.
+ *
+ * Calls \p op with two vectors loaded from [\p first1, \p last1) and the range starting at
+ * \p first2 and stores the result to the range starting at \p d_first. Both input ranges
+ * must have the same value type. Only the loads from the first range are aligned.
+ *
+ * \return The iterator one past the last element written.
+ */
+template <typename InputIt1, typename InputIt2, typename OutputIt, typename BinaryOperation>
+inline enable_if<Detail::is_arithmetic_iterator<InputIt1>::value, OutputIt> simd_transform(
+    InputIt1 first1, InputIt1 last1, InputIt2 first2, OutputIt d_first, BinaryOperation op)
+{
+    typedef typename std::iterator_traits<InputIt1>::value_type T;
+    static_assert(
+        std::is_same<T, typename std::iterator_traits<InputIt2>::value_type>::value,
+        "simd_transform requires both input ranges to have the same value type");
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    const std::size_t n = std::distance(first1, last1);
+    if (n == 0) {
+        return d_first;
+    }
+    const T *in1 = std::addressof(*first1);
+    const T *in2 = std::addressof(*first2);
+    auto *out = std::addressof(*d_first);
+    std::size_t i = 0;
+    for (const std::size_t head = Detail::unalignedHead<V>(in1, n); i < head; ++i) {
+        op(V1(in1 + i, Vc::Aligned), V1(in2 + i, Vc::Aligned))
+            .store(out + i, Vc::Unaligned);
+    }
+    for (; i + V::Size <= n; i += V::Size) {
+        op(V(in1 + i, Vc::Aligned), V(in2 + i, Vc::Unaligned))
+            .store(out + i, Vc::Unaligned);
+    }
+    for (; i < n; ++i) {
+        op(V1(in1 + i, Vc::Aligned), V1(in2 + i, Vc::Aligned))
+            .store(out + i, Vc::Unaligned);
+    }
+    return d_first + n;
+}
+
+template <typename InputIt1, typename InputIt2, typename OutputIt, typename BinaryOperation>
+inline enable_if<!Detail::is_arithmetic_iterator<InputIt1>::value, OutputIt>
+simd_transform(InputIt1 first1, InputIt1 last1, InputIt2 first2, OutputIt d_first,
+               BinaryOperation op)
+{
+    return std::transform(first1, last1, first2, d_first, std::move(op));
+}
+
+// simd_transform_streaming / simd_for_each_streaming {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Variant of the unary simd_transform for large outputs that are not read again soon.
+ *
+ * If the output range occupies at least streaming_store_threshold() bytes, the results
+ * are written with non-temporal stores (Vc::Streaming), which bypass the caches. To this
+ * end the range is split such that all full-width stores to \p d_first are aligned; the
+ * loads from [\p first, \p last) are unaligned. Before returning, streaming_fence() makes
+ * the stores visible to other threads. Smaller ranges are simply passed to
+ * simd_transform.
+ *
+ * \code
+ * std::vector<float> out(in.size());  // much larger than the last level cache
+ * Vc::simd_transform_streaming(in.begin(), in.end(), out.begin(),
+ *                              [](Vc::float_v x) { return x * x; });
+ * \endcode
+ *
+ * \return The iterator one past the last element written.
+ */
+template <typename InputIt, typename OutputIt, typename UnaryOperation>
+inline enable_if<Detail::is_arithmetic_iterator<InputIt>::value, OutputIt>
+simd_transform_streaming(InputIt first, InputIt last, OutputIt d_first,
+                         UnaryOperation op)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    typedef typename std::iterator_traits<OutputIt>::value_type U;
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    const std::size_t n = std::distance(first, last);
+    if (!Detail::useStreamingStores(n * sizeof(U))) {
+        return simd_transform(first, last, d_first, std::move(op));
+    }
+    const T *in = std::addressof(*first);
+    U *out = std::addressof(*d_first);
+    std::size_t i = 0;
+    for (const std::size_t head = Detail::unalignedHead<Vector<U>>(out, n); i < head;
+         ++i) {
+        op(V1(in + i, Vc::Aligned)).store(out + i, Vc::Aligned);
+    }
+    for (; i + V::Size <= n; i += V::Size) {
+        op(V(in + i, Vc::Unaligned)).store(out + i, Vc::Aligned | Vc::Streaming);
+    }
+    for (; i < n; ++i) {
+        op(V1(in + i, Vc::Aligned)).store(out + i, Vc::Aligned);
+    }
+    streaming_fence();
+    return d_first + n;
+}
+
+template <typename InputIt, typename OutputIt, typename UnaryOperation>
+inline enable_if<!Detail::is_arithmetic_iterator<InputIt>::value, OutputIt>
+simd_transform_streaming(InputIt first, InputIt last, OutputIt d_first,
+                         UnaryOperation op)
+{
+    return std::transform(first, last, d_first, std::move(op));
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Variant of the binary simd_transform that writes outputs of at least
+ * streaming_store_threshold() bytes with non-temporal stores. See the unary
+ * simd_transform_streaming for details.
+ *
+ * \return The iterator one past the last element written.
+ */
+template <typename InputIt1, typename InputIt2, typename OutputIt, typename BinaryOperation>
+inline enable_if<Detail::is_arithmetic_iterator<InputIt1>::value, OutputIt>
+simd_transform_streaming(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+                         OutputIt d_first, BinaryOperation op)
+{
+    typedef typename std::iterator_traits<InputIt1>::value_type T;
+    typedef typename std::iterator_traits<OutputIt>::value_type U;
+    static_assert(
+        std::is_same<T, typename std::iterator_traits<InputIt2>::value_type>::value,
+        "simd_transform_streaming requires both input ranges to have the same value type");
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    const std::size_t n = std::distance(first1, last1);
+    if (!Detail::useStreamingStores(n * sizeof(U))) {
+        return simd_transform(first1, last1, first2, d_first, std::move(op));
+    }
+    const T *in1 = std::addressof(*first1);
+    const T *in2 = std::addressof(*first2);
+    U *out = std::addressof(*d_first);
+    std::size_t i = 0;
+    for (const std::size_t head = Detail::unalignedHead<Vector<U>>(out, n); i < head;
+         ++i) {
+        op(V1(in1 + i, Vc::Aligned), V1(in2 + i, Vc::Aligned)).store(out + i, Vc::Aligned);
+    }
+    for (; i + V::Size <= n; i += V::Size) {
+        op(V(in1 + i, Vc::Unaligned), V(in2 + i, Vc::Unaligned))
+            .store(out + i, Vc::Aligned | Vc::Streaming);
+    }
+    for (; i < n; ++i) {
+        op(V1(in1 + i, Vc::Aligned), V1(in2 + i, Vc::Aligned)).store(out + i, Vc::Aligned);
+    }
+    streaming_fence();
+    return d_first + n;
+}
+
+template <typename InputIt1, typename InputIt2, typename OutputIt, typename BinaryOperation>
+inline enable_if<!Detail::is_arithmetic_iterator<InputIt1>::value, OutputIt>
+simd_transform_streaming(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+                         OutputIt d_first, BinaryOperation op)
+{
+    return std::transform(first1, last1, first2, d_first, std::move(op));
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Variant of simd_for_each for functors that modify their argument: if the range
+ * occupies at least streaming_store_threshold() bytes, the modified vectors are written
+ * back with non-temporal stores, followed by streaming_fence(). This keeps a single pass
+ * over a huge array from evicting the rest of the working set.
+ *
+ * Functors taking their argument by value or const reference do not write to the range
+ * and are passed to simd_for_each.
+ */
+template <typename InputIt, typename UnaryFunction>
+inline enable_if<
+    std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value &&
+        !Traits::is_functor_argument_immutable<
+            UnaryFunction,
+            Vector<typename std::iterator_traits<InputIt>::value_type>>::value,
+    UnaryFunction>
+simd_for_each_streaming(InputIt first, InputIt last, UnaryFunction f)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    if (!Detail::useStreamingStores(std::distance(first, last) * sizeof(T))) {
+        return simd_for_each(first, last, std::move(f));
+    }
+    for (; reinterpret_cast<std::uintptr_t>(std::addressof(*first)) &
+                   (V::MemoryAlignment - 1) &&
+               first != last;
+         ++first) {
+        V1 tmp(std::addressof(*first), Vc::Aligned);
+        f(tmp);
+        tmp.store(std::addressof(*first), Vc::Aligned);
+    }
+    const auto lastV = last - V::Size + 1;
+    for (; first < lastV; first += V::Size) {
+        V tmp(std::addressof(*first), Vc::Aligned);
+        f(tmp);
+        tmp.store(std::addressof(*first), Vc::Aligned | Vc::Streaming);
+    }
+    for (; first != last; ++first) {
+        V1 tmp(std::addressof(*first), Vc::Aligned);
+        f(tmp);
+        tmp.store(std::addressof(*first), Vc::Aligned);
+    }
+    streaming_fence();
+    return std::move(f);
+}
+
+template <typename InputIt, typename UnaryFunction>
+inline enable_if<
+    std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value &&
+        Traits::is_functor_argument_immutable<
+            UnaryFunction,
+            Vector<typename std::iterator_traits<InputIt>::value_type>>::value,
+    UnaryFunction>
+simd_for_each_streaming(InputIt first, InputIt last, UnaryFunction f)
+{
+    return simd_for_each(first, last, std::move(f));
+}
+
+template <typename InputIt, typename UnaryFunction>
+inline enable_if<
+    !std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    UnaryFunction>
+simd_for_each_streaming(InputIt first, InputIt last, UnaryFunction f)
+{
+    return std::for_each(first, last, std::move(f));
+}
+
+// simd_transform_reduce {{{1
+namespace Detail
+{
+/**\internal
+ * Reduces the full vectors of [\p p, \p p + \p n) into \p init. Four independent
+ * accumulators hide the latency of \p reduce; they are combined pairwise at the end.
+ * Returns the number of elements that were processed.
+ */
+template <typename V, typename T, typename BinaryOp, typename Load>
+Vc_INTRINSIC std::size_t reduceVectors(std::size_t n, T &init, BinaryOp reduce, Load load)
+{
+    std::size_t i = 0;
+    if (n < V::Size) {
+        return i;
+    }
+    auto acc0 = load(i);
+    i += V::Size;
+    if (i + 3 * V::Size <= n) {
+        auto acc1 = load(i);
+        auto acc2 = load(i + V::Size);
+        auto acc3 = load(i + 2 * V::Size);
+        for (i += 3 * V::Size; i + 4 * V::Size <= n; i += 4 * V::Size) {
+            acc0 = reduce(acc0, load(i));
+            acc1 = reduce(acc1, load(i + V::Size));
+            acc2 = reduce(acc2, load(i + 2 * V::Size));
+            acc3 = reduce(acc3, load(i + 3 * V::Size));
+        }
+        acc0 = reduce(reduce(acc0, acc1), reduce(acc2, acc3));
+    }
+    for (; i + V::Size <= n; i += V::Size) {
+        acc0 = reduce(acc0, load(i));
+    }
+    init = reduce(init, reduceHorizontal(acc0, reduce));
+    return i;
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the unary `std::transform_reduce` algorithm for contiguous ranges.
+ *
+ * Applies \p transform to vectors covering [\p first, \p last) and reduces the results
+ * together with \p init using \p reduce. \p reduce must accept vectors as well as scalars
+ * (use e.g. `Vc::minimum`, `Vc::maximum`, or generic lambdas). The vectors are
+ * accumulated in several independent partial results that are combined in a tree and
+ * finally reduced horizontally via Vector::sum(), Vector::product(), Vector::min(), or
+ * Vector::max() if \p reduce is a known operation (the default is addition).
+ *
+ * \note \p reduce must be associative and commutative. For floating-point types the
+ * result may therefore differ from a sequential reduction by rounding.
+ */
+template <typename InputIt, typename T, typename BinaryOp, typename UnaryOp>
+inline enable_if<Detail::is_arithmetic_iterator<InputIt>::value, T> simd_transform_reduce(
+    InputIt first, InputIt last, T init, BinaryOp reduce, UnaryOp transform)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type U;
+    typedef Vector<U> V;
+    typedef Scalar::Vector<U> V1;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return init;
+    }
+    const U *in = std::addressof(*first);
+    const std::size_t head = Detail::unalignedHead<V>(in, n);
+    for (std::size_t i = 0; i < head; ++i) {
+        init = reduce(init, Detail::firstEntry(transform(V1(in + i, Vc::Aligned))));
+    }
+    in += head;
+    const std::size_t body = Detail::reduceVectors<V>(
+        n - head, init, reduce,
+        [&](std::size_t i) { return transform(V(in + i, Vc::Aligned)); });
+    for (std::size_t i = body; i < n - head; ++i) {
+        init = reduce(init, Detail::firstEntry(transform(V1(in + i, Vc::Aligned))));
+    }
+    return init;
+}
+
+template <typename InputIt, typename T, typename BinaryOp, typename UnaryOp>
+inline enable_if<!Detail::is_arithmetic_iterator<InputIt>::value, T> simd_transform_reduce(
+    InputIt first, InputIt last, T init, BinaryOp reduce, UnaryOp transform)
+{
+    for (; first != last; ++first) {
+        init = reduce(init, transform(*first));
+    }
+    return init;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the binary `std::transform_reduce` algorithm for contiguous ranges.
+ *
+ * Applies \p transform to pairs of vectors loaded from [\p first1, \p last1) and the range
+ * starting at \p first2 and reduces the results together with \p init using \p reduce.
+ * Both input ranges must have the same value type.
+ *
+ * \see simd_transform_reduce(InputIt, InputIt, T, BinaryOp, UnaryOp)
+ */
+template <typename InputIt1, typename InputIt2, typename T, typename BinaryOp1,
+          typename BinaryOp2>
+inline enable_if<Detail::is_arithmetic_iterator<InputIt1>::value, T> simd_transform_reduce(
+    InputIt1 first1, InputIt1 last1, InputIt2 first2, T init, BinaryOp1 reduce,
+    BinaryOp2 transform)
+{
+    typedef typename std::iterator_traits<InputIt1>::value_type U;
+    static_assert(
+        std::is_same<U, typename std::iterator_traits<InputIt2>::value_type>::value,
+        "simd_transform_reduce requires both input ranges to have the same value type");
+    typedef Vector<U> V;
+    typedef Scalar::Vector<U> V1;
+    const std::size_t n = std::distance(first1, last1);
+    if (n == 0) {
+        return init;
+    }
+    const U *in1 = std::addressof(*first1);
+    const U *in2 = std::addressof(*first2);
+    const std::size_t head = Detail::unalignedHead<V>(in1, n);
+    for (std::size_t i = 0; i < head; ++i) {
+        init = reduce(init,
+                      Detail::firstEntry(
+                          transform(V1(in1 + i, Vc::Aligned), V1(in2 + i, Vc::Aligned))));
+    }
+    in1 += head;
+    in2 += head;
+    const std::size_t body =
+        Detail::reduceVectors<V>(n - head, init, reduce, [&](std::size_t i) {
+            return transform(V(in1 + i, Vc::Aligned), V(in2 + i, Vc::Unaligned));
+        });
+    for (std::size_t i = body; i < n - head; ++i) {
+        init = reduce(init,
+                      Detail::firstEntry(
+                          transform(V1(in1 + i, Vc::Aligned), V1(in2 + i, Vc::Aligned))));
+    }
+    return init;
+}
+
+template <typename InputIt1, typename InputIt2, typename T, typename BinaryOp1,
+          typename BinaryOp2>
+inline enable_if<!Detail::is_arithmetic_iterator<InputIt1>::value, T> simd_transform_reduce(
+    InputIt1 first1, InputIt1 last1, InputIt2 first2, T init, BinaryOp1 reduce,
+    BinaryOp2 transform)
+{
+    for (; first1 != last1; ++first1, ++first2) {
+        init = reduce(init, transform(*first1, *first2));
+    }
+    return init;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Returns \p init plus the inner product of [\p first1, \p last1) and the range starting
+ * at \p first2.
+ */
+template <typename InputIt1, typename InputIt2, typename T>
+inline T simd_transform_reduce(InputIt1 first1, InputIt1 last1, InputIt2 first2, T init)
+{
+    return simd_transform_reduce(first1, last1, first2, init, Detail::plus(),
+                                 Detail::multiplies());
+}
+
+// simd_reduce {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::reduce` algorithm for contiguous ranges: reduces
+ * [\p first, \p last) together with \p init using \p op (addition by default).
+ *
+ * \code
+ * float sum = Vc::simd_reduce(data.begin(), data.end(), 0.f);
+ * float max = Vc::simd_reduce(data.begin(), data.end(), data[0], Vc::maximum());
+ * \endcode
+ *
+ * \see simd_transform_reduce(InputIt, InputIt, T, BinaryOp, UnaryOp)
+ */
+template <typename InputIt, typename T, typename BinaryOp = Detail::plus>
+inline T simd_reduce(InputIt first, InputIt last, T init, BinaryOp op = BinaryOp())
+{
+    return simd_transform_reduce(first, last, init, op, Detail::identity());
+}
+
+// simd_inclusive_scan {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::inclusive_scan` algorithm for contiguous ranges, restricted to
+ * addition: writes the prefix sums of [\p first, \p last) to the range starting at
+ * \p d_first, which may be equal to \p first. Every vector is scanned with
+ * Vector::partialSum() and offset by the last sum of the preceding vector.
+ *
+ * \return The iterator one past the last element written.
+ */
+template <typename InputIt, typename OutputIt>
+inline enable_if<Detail::is_arithmetic_iterator<InputIt>::value, OutputIt>
+simd_inclusive_scan(InputIt first, InputIt last, OutputIt d_first)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    typedef Vector<T> V;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return d_first;
+    }
+    const T *in = std::addressof(*first);
+    auto *out = std::addressof(*d_first);
+    T carry = T();
+    std::size_t i = 0;
+    for (const std::size_t head = Detail::unalignedHead<V>(in, n); i < head; ++i) {
+        carry += in[i];
+        out[i] = carry;
+    }
+    for (; i + V::Size <= n; i += V::Size) {
+        const V sums = V(in + i, Vc::Aligned).partialSum() + carry;
+        sums.store(out + i, Vc::Unaligned);
+        carry = sums[V::Size - 1];
+    }
+    for (; i < n; ++i) {
+        carry += in[i];
+        out[i] = carry;
+    }
+    return d_first + n;
+}
+
+template <typename InputIt, typename OutputIt>
+inline enable_if<!Detail::is_arithmetic_iterator<InputIt>::value, OutputIt>
+simd_inclusive_scan(InputIt first, InputIt last, OutputIt d_first)
+{
+    return std::partial_sum(first, last, d_first);
+}
+
+// simd_find_if / simd_find {{{1
+namespace Detail
+{
+/**\internal
+ * Predicate comparing its argument (a scalar or a vector) with \p value.
+ */
+template <typename T> struct equal_to_value {
+    const T value;
+    template <typename V>
+    Vc_INTRINSIC auto operator()(const V &x) const -> decltype(x == value)
+    {
+        return x == value;
+    }
+};
+
+/**\internal
+ * Returns the index of the first element of the full vectors of [\p in, \p in + \p n) for
+ * which \p pred returns \c true, or the number of elements in the full vectors if there
+ * is no such element. Four vectors are tested per iteration, such that the loop takes
+ * only one (well predicted) branch per four vectors.
+ */
+template <typename V, typename T, typename UnaryPredicate>
+Vc_INTRINSIC std::size_t findVectors(const T *in, std::size_t n, UnaryPredicate &pred)
+{
+    std::size_t i = 0;
+    for (; i + 4 * V::Size <= n; i += 4 * V::Size) {
+        const auto k0 = pred(V(in + i, Vc::Aligned));
+        const auto k1 = pred(V(in + i + V::Size, Vc::Aligned));
+        const auto k2 = pred(V(in + i + 2 * V::Size, Vc::Aligned));
+        const auto k3 = pred(V(in + i + 3 * V::Size, Vc::Aligned));
+        if (any_of((k0 || k1) || (k2 || k3))) {
+            if (any_of(k0)) {
+                return i + k0.firstOne();
+            } else if (any_of(k1)) {
+                return i + V::Size + k1.firstOne();
+            } else if (any_of(k2)) {
+                return i + 2 * V::Size + k2.firstOne();
+            }
+            return i + 3 * V::Size + k3.firstOne();
+        }
+    }
+    for (; i + V::Size <= n; i += V::Size) {
+        const auto k = pred(V(in + i, Vc::Aligned));
+        if (any_of(k)) {
+            return i + k.firstOne();
+        }
+    }
+    return i;
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::find_if` algorithm for contiguous ranges.
+ *
+ * Calls \p pred with `Vc::Vector<` *value type of InputIt* `, ` *unspecified* `>` objects
+ * covering [\p first, \p last) and returns the iterator to the first element where the
+ * returned mask is \c true. As with simd_for_each, the beginning and end of the range are
+ * processed with one-element vectors, such that all full-width loads are aligned. The
+ * search stops with the (block of) vectors containing the first match.
+ *
+ * \code
+ * auto it = Vc::simd_find_if(data.begin(), data.end(), [](auto v) { return v > 1.f; });
+ * \endcode
+ *
+ * \return The iterator to the first element satisfying \p pred, or \p last.
+ */
+template <typename InputIt, typename UnaryPredicate>
+inline enable_if<Detail::is_arithmetic_iterator<InputIt>::value, InputIt> simd_find_if(
+    InputIt first, InputIt last, UnaryPredicate pred)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return last;
+    }
+    const T *in = std::addressof(*first);
+    const std::size_t head = Detail::unalignedHead<V>(in, n);
+    for (std::size_t i = 0; i < head; ++i) {
+        if (any_of(pred(V1(in + i, Vc::Aligned)))) {
+            return first + i;
+        }
+    }
+    const std::size_t body = (n - head) - (n - head) % V::Size;
+    const std::size_t found = Detail::findVectors<V>(in + head, n - head, pred);
+    if (found < body) {
+        return first + (head + found);
+    }
+    for (std::size_t i = head + body; i < n; ++i) {
+        if (any_of(pred(V1(in + i, Vc::Aligned)))) {
+            return first + i;
+        }
+    }
+    return last;
+}
+
+template <typename InputIt, typename UnaryPredicate>
+inline enable_if<!Detail::is_arithmetic_iterator<InputIt>::value, InputIt> simd_find_if(
+    InputIt first, InputIt last, UnaryPredicate pred)
+{
+    return std::find_if(first, last, std::move(pred));
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::find` algorithm for contiguous ranges.
+ *
+ * \return The iterator to the first element equal to \p value, or \p last.
+ * \see simd_find_if
+ */
+template <typename InputIt, typename T>
+inline InputIt simd_find(InputIt first, InputIt last, const T &value)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type U;
+    return simd_find_if(first, last, Detail::equal_to_value<U>{static_cast<U>(value)});
+}
+
+// simd_count_if / simd_count {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::count_if` algorithm for contiguous ranges.
+ *
+ * Calls \p pred with vectors covering [\p first, \p last) (see simd_find_if) and returns
+ * the number of elements where the returned mask is \c true.
+ */
+template <typename InputIt, typename UnaryPredicate>
+inline enable_if<Detail::is_arithmetic_iterator<InputIt>::value,
+                 typename std::iterator_traits<InputIt>::difference_type>
+simd_count_if(InputIt first, InputIt last, UnaryPredicate pred)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return 0;
+    }
+    const T *in = std::addressof(*first);
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (const std::size_t head = Detail::unalignedHead<V>(in, n); i < head; ++i) {
+        count += pred(V1(in + i, Vc::Aligned)).count();
+    }
+    for (; i + V::Size <= n; i += V::Size) {
+        count += pred(V(in + i, Vc::Aligned)).count();
+    }
+    for (; i < n; ++i) {
+        count += pred(V1(in + i, Vc::Aligned)).count();
+    }
+    return count;
+}
+
+template <typename InputIt, typename UnaryPredicate>
+inline enable_if<!Detail::is_arithmetic_iterator<InputIt>::value,
+                 typename std::iterator_traits<InputIt>::difference_type>
+simd_count_if(InputIt first, InputIt last, UnaryPredicate pred)
+{
+    return std::count_if(first, last, std::move(pred));
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::count` algorithm for contiguous ranges.
+ *
+ * \return The number of elements equal to \p value.
+ * \see simd_count_if
+ */
+template <typename InputIt, typename T>
+inline typename std::iterator_traits<InputIt>::difference_type simd_count(InputIt first,
+                                                                          InputIt last,
+                                                                          const T &value)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type U;
+    return simd_count_if(first, last, Detail::equal_to_value<U>{static_cast<U>(value)});
+}
+
+// simd_copy_if / simd_remove_if {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::copy_if` algorithm for contiguous ranges.
+ *
+ * Copies the elements of [\p first, \p last) for which \p pred returns \c true, in order,
+ * to the range starting at \p d_first. The input is processed as in simd_find_if, the
+ * selected entries of every vector are written with compress_store. Thus exactly as many
+ * elements as are selected are written and the output range needs no alignment. The
+ * value type of \p d_first must be equal to the value type of \p first.
+ *
+ * \return The iterator one past the last element written.
+ */
+template <typename InputIt, typename OutputIt, typename UnaryPredicate>
+inline enable_if<Detail::is_arithmetic_iterator<InputIt>::value, OutputIt> simd_copy_if(
+    InputIt first, InputIt last, OutputIt d_first, UnaryPredicate pred)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return d_first;
+    }
+    const T *in = std::addressof(*first);
+    T *const out = std::addressof(*d_first);
+    std::size_t o = 0;
+    std::size_t i = 0;
+    for (const std::size_t head = Detail::unalignedHead<V>(in, n); i < head; ++i) {
+        if (any_of(pred(V1(in + i, Vc::Aligned)))) {
+            out[o++] = in[i];
+        }
+    }
+    for (; i + V::Size <= n; i += V::Size) {
+        const V x(in + i, Vc::Aligned);
+        o += compress_store(out + o, pred(x), x);
+    }
+    for (; i < n; ++i) {
+        if (any_of(pred(V1(in + i, Vc::Aligned)))) {
+            out[o++] = in[i];
+        }
+    }
+    return d_first + o;
+}
+
+template <typename InputIt, typename OutputIt, typename UnaryPredicate>
+inline enable_if<!Detail::is_arithmetic_iterator<InputIt>::value, OutputIt> simd_copy_if(
+    InputIt first, InputIt last, OutputIt d_first, UnaryPredicate pred)
+{
+    return std::copy_if(first, last, d_first, std::move(pred));
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::remove_if` algorithm for contiguous ranges.
+ *
+ * Moves the elements of [\p first, \p last) for which \p pred returns \c false to the
+ * front of the range, preserving their order. Since the write position never overtakes
+ * the read position, every vector is compressed and stored as a whole; the elements in
+ * [return value, \p last) are overwritten with unspecified values of the range, as
+ * permitted for `std::remove_if`.
+ *
+ * \return The new end of the range.
+ */
+template <typename ForwardIt, typename UnaryPredicate>
+inline enable_if<Detail::is_arithmetic_iterator<ForwardIt>::value, ForwardIt>
+simd_remove_if(ForwardIt first, ForwardIt last, UnaryPredicate pred)
+{
+    typedef typename std::iterator_traits<ForwardIt>::value_type T;
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return last;
+    }
+    T *const data = std::addressof(*first);
+    std::size_t o = 0;
+    std::size_t i = 0;
+    for (const std::size_t head = Detail::unalignedHead<V>(data, n); i < head; ++i) {
+        if (!any_of(pred(V1(data + i, Vc::Aligned)))) {
+            data[o++] = data[i];
+        }
+    }
+    for (; i + V::Size <= n; i += V::Size) {
+        const V x(data + i, Vc::Aligned);
+        const auto keep = !pred(x);
+        // o <= i: the store only touches entries that have been loaded already
+        x.compress(keep).store(data + o, Vc::Unaligned);
+        o += keep.count();
+    }
+    for (; i < n; ++i) {
+        if (!any_of(pred(V1(data + i, Vc::Aligned)))) {
+            data[o++] = data[i];
+        }
+    }
+    return first + o;
+}
+
+template <typename ForwardIt, typename UnaryPredicate>
+inline enable_if<!Detail::is_arithmetic_iterator<ForwardIt>::value, ForwardIt>
+simd_remove_if(ForwardIt first, ForwardIt last, UnaryPredicate pred)
+{
+    return std::remove_if(first, last, std::move(pred));
+}
+
+// simd_min_element / simd_max_element {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::min_element` algorithm for contiguous ranges.
+ *
+ * Determines the smallest value with simd_reduce and then searches for its first
+ * occurrence with simd_find. The second pass stops at the match and usually touches
+ * cached data only.
+ *
+ * \note If the range contains NaNs the result is unspecified.
+ *
+ * \return The iterator to the first smallest element, or \p last if the range is empty.
+ */
+template <typename ForwardIt>
+inline enable_if<Detail::is_arithmetic_iterator<ForwardIt>::value, ForwardIt>
+simd_min_element(ForwardIt first, ForwardIt last)
+{
+    if (first == last) {
+        return last;
+    }
+    const ForwardIt it =
+        simd_find(first, last, simd_reduce(first, last, *first, Vc::minimum()));
+    return it != last ? it : std::min_element(first, last);
+}
+
+template <typename ForwardIt>
+inline enable_if<!Detail::is_arithmetic_iterator<ForwardIt>::value, ForwardIt>
+simd_min_element(ForwardIt first, ForwardIt last)
+{
+    return std::min_element(first, last);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::max_element` algorithm for contiguous ranges.
+ *
+ * \note If the range contains NaNs the result is unspecified.
+ *
+ * \return The iterator to the first largest element, or \p last if the range is empty.
+ * \see simd_min_element
+ */
+template <typename ForwardIt>
+inline enable_if<Detail::is_arithmetic_iterator<ForwardIt>::value, ForwardIt>
+simd_max_element(ForwardIt first, ForwardIt last)
+{
+    if (first == last) {
+        return last;
+    }
+    const ForwardIt it =
+        simd_find(first, last, simd_reduce(first, last, *first, Vc::maximum()));
+    return it != last ? it : std::max_element(first, last);
+}
+
+template <typename ForwardIt>
+inline enable_if<!Detail::is_arithmetic_iterator<ForwardIt>::value, ForwardIt>
+simd_max_element(ForwardIt first, ForwardIt last)
+{
+    return std::max_element(first, last);
+}
+
+// Vc::Memory overloads {{{1
+namespace Detail
+{
+/**\internal
+ * Calls \p f with the vector at \p p and, if \p f takes it by non-const reference,
+ * writes the result back.
+ */
+template <typename V, typename F>
+Vc_INTRINSIC void applyToVector(const typename V::EntryType *p, F &f, std::true_type)
+{
+    f(V(p, Vc::Aligned));
+}
+template <typename V, typename F>
+Vc_INTRINSIC void applyToVector(typename V::EntryType *p, F &f, std::false_type)
+{
+    V tmp(p, Vc::Aligned);
+    f(tmp);
+    tmp.store(p, Vc::Aligned);
+}
+
+/**\internal
+ * Software-pipelined loop over the \p n entries at the aligned address \p p: one cache
+ * line at a time, it prefetches the lines prefetch_distances() ahead and then applies
+ * \p f to the vectors of the current line. The last lines are processed without
+ * prefetches, so that no prefetch reaches past the end of the array.
+ */
+template <typename V, typename T, typename F>
+inline void forEachPrefetched(T *p, std::size_t n, F &f)
+{
+    typedef typename V::EntryType U;
+    typedef Scalar::Vector<U> V1;
+    typedef Traits::is_functor_argument_immutable<F, V> Immutable;
+    std::size_t i = 0;
+#ifdef Vc_IMPL_SSE
+    constexpr std::size_t Line = sizeof(V) >= 64 ? V::Size : V::Size * (64 / sizeof(V));
+    typedef typename std::conditional<Immutable::value, Vc::Shared, Vc::Exclusive>::type
+        Hint;
+    const PrefetchDistances d = prefetch_distances();
+    const std::size_t ahead = (d.l1 > d.l2 ? d.l1 : d.l2) / sizeof(U);
+    const std::size_t l1 = d.l1 / sizeof(U), l2 = d.l2 / sizeof(U);
+    for (; i + ahead + Line <= n; i += Line) {
+        if (l1 != 0) {
+            Common::prefetchClose<Hint>(p + i + l1);
+        }
+        if (l2 != 0) {
+            Common::prefetchMid<Hint>(p + i + l2);
+        }
+        for (std::size_t k = 0; k < Line; k += V::Size) {
+            applyToVector<V>(p + i + k, f, Immutable());
+        }
+    }
+#endif
+    for (; i + V::Size <= n; i += V::Size) {
+        applyToVector<V>(p + i, f, Immutable());
+    }
+    for (; i < n; ++i) {
+        applyToVector<V1>(p + i, f, typename Traits::is_functor_argument_immutable<F, V1>());
+    }
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Calls \p f for all entries of the one-dimensional Memory \p mem, like simd_for_each.
+ * If \p f takes its argument by non-const reference, the modified vectors are stored
+ * back.
+ *
+ * The loop is software-pipelined: for every cache line it issues the prefetches for the
+ * lines prefetch_distances() ahead (i.e. the distances of Prefetch<Auto>) before
+ * processing the current one. Thus a streaming pass over a large Memory keeps enough
+ * cache misses in flight to reach the memory bandwidth.
+ */
+template <typename V, typename Parent, typename RowMemory, typename UnaryFunction>
+inline UnaryFunction simd_for_each(Common::MemoryBase<V, Parent, 1, RowMemory> &mem,
+                                   UnaryFunction f)
+{
+    Detail::forEachPrefetched<typename std::remove_const<V>::type>(mem.entries(),
+                                                                   mem.entriesCount(), f);
+    return f;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Const overload of the above. \p f must not modify its argument.
+ */
+template <typename V, typename Parent, typename RowMemory, typename UnaryFunction>
+inline UnaryFunction simd_for_each(const Common::MemoryBase<V, Parent, 1, RowMemory> &mem,
+                                   UnaryFunction f)
+{
+    Detail::forEachPrefetched<typename std::remove_const<V>::type>(mem.entries(),
+                                                                   mem.entriesCount(), f);
+    return f;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Calls \p f for all entries of the multi-dimensional DynamicMemory \p mem, row by row
+ * like the one-dimensional Memory overload. The padding at the end of every row is skipped.
+ */
+template <typename V, int Dimension, typename UnaryFunction>
+inline UnaryFunction simd_for_each(Common::DynamicMemoryBase<V, Dimension> &mem,
+                                   UnaryFunction f)
+{
+    for (std::size_t r = 0; r < mem.rowsCount(); ++r) {
+        Detail::forEachPrefetched<V>(mem.row(r).entries(), mem.columnsCount(), f);
+    }
+    return f;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Const overload of the above. \p f must not modify its argument.
+ */
+template <typename V, int Dimension, typename UnaryFunction>
+inline UnaryFunction simd_for_each(const Common::DynamicMemoryBase<V, Dimension> &mem,
+                                   UnaryFunction f)
+{
+    for (std::size_t r = 0; r < mem.rowsCount(); ++r) {
+        Detail::forEachPrefetched<V>(mem.row(r).entries(), mem.columnsCount(), f);
+    }
+    return f;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Applies simd_transform to all entries of the one-dimensional Memory \p in and writes the
+ * results to \p out, which must have at least as many entries as \p in.
+ */
+template <typename V, typename Parent, typename RowMemory, typename V2, typename Parent2,
+          typename RowMemory2, typename UnaryOperation>
+inline void simd_transform(const Common::MemoryBase<V, Parent, 1, RowMemory> &in,
+                           Common::MemoryBase<V2, Parent2, 1, RowMemory2> &out,
+                           UnaryOperation op)
+{
+    Vc_ASSERT(out.entriesCount() >= in.entriesCount());
+    simd_transform(in.entries(), in.entries() + in.entriesCount(), out.entries(),
+                   std::move(op));
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Applies simd_transform_streaming to all entries of the one-dimensional Memory \p in and
+ * writes the results to \p out, which must have at least as many entries as \p in.
+ */
+template <typename V, typename Parent, typename RowMemory, typename V2, typename Parent2,
+          typename RowMemory2, typename UnaryOperation>
+inline void simd_transform_streaming(const Common::MemoryBase<V, Parent, 1, RowMemory> &in,
+                                     Common::MemoryBase<V2, Parent2, 1, RowMemory2> &out,
+                                     UnaryOperation op)
+{
+    Vc_ASSERT(out.entriesCount() >= in.entriesCount());
+    simd_transform_streaming(in.entries(), in.entries() + in.entriesCount(),
+                             out.entries(), std::move(op));
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Reduces all entries of the one-dimensional Memory \p mem together with \p init.
+ */
+template <typename V, typename Parent, typename RowMemory, typename T,
+          typename BinaryOp = Detail::plus>
+inline T simd_reduce(const Common::MemoryBase<V, Parent, 1, RowMemory> &mem, T init,
+                     BinaryOp op = BinaryOp())
+{
+    return simd_reduce(mem.entries(), mem.entries() + mem.entriesCount(), init, op);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Applies simd_transform_reduce to all entries of the one-dimensional Memory \p mem.
+ */
+template <typename V, typename Parent, typename RowMemory, typename T, typename BinaryOp,
+          typename UnaryOp>
+inline T simd_transform_reduce(const Common::MemoryBase<V, Parent, 1, RowMemory> &mem,
+                               T init, BinaryOp reduce, UnaryOp transform)
+{
+    return simd_transform_reduce(mem.entries(), mem.entries() + mem.entriesCount(), init,
+                                 reduce, transform);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Writes the prefix sums of the one-dimensional Memory \p in to \p out, which must have
+ * at least as many entries as \p in and may be the same object.
+ */
+template <typename V, typename Parent, typename RowMemory, typename V2, typename Parent2,
+          typename RowMemory2>
+inline void simd_inclusive_scan(const Common::MemoryBase<V, Parent, 1, RowMemory> &in,
+                                Common::MemoryBase<V2, Parent2, 1, RowMemory2> &out)
+{
+    Vc_ASSERT(out.entriesCount() >= in.entriesCount());
+    simd_inclusive_scan(in.entries(), in.entries() + in.entriesCount(), out.entries());
+}
+//}}}1
+
 }  // namespace Vc
 
 #endif // VC_COMMON_ALGORITHMS_H_
@@ -0,0 +1,480 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_AOSOA_VECTOR_H_
+#define VC_COMMON_AOSOA_VECTOR_H_
+
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <vector>
+#include "soa_vector.h"
+#include "interleavedmemory.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+template <typename T, std::size_t N = 0> class aosoa_vector;
+
+namespace AosoaDetail
+{
+// Tile {{{1
+/**\internal
+ * The assumed cache line size in Bytes (cf. Vc::AlignOnCacheline in Vc::malloc).
+ */
+constexpr std::size_t CacheLineSize = 64;
+
+/**\internal
+ * One tile of an aosoa_vector: a simdize<T> object, aligned to and padded to a multiple of
+ * the cache line size.
+ */
+template <typename V> struct alignas(CacheLineSize) Tile {
+    V data;
+};
+
+/**\internal
+ * Whether the tiles of aosoa_vector<T, N> can be converted from and to an array of \p T
+ * via Vc::InterleavedMemoryWrapper: all data members of \p T must have the same type, \p T
+ * must not contain padding, and the member vector type must be a Vc::Vector (SimdArray is
+ * not supported by InterleavedMemoryWrapper).
+ */
+template <std::size_t, typename M> struct repeat {
+    using type = M;
+};
+template <typename T, typename V, typename Seq> struct is_interleavable;
+template <typename T, typename V, std::size_t... Is>
+struct is_interleavable<T, V, Vc::index_sequence<Is...>> {
+    using M = SoaDetail::member_type<0, T>;
+    using MV = typename std::decay<decltype(
+        SimdizeDetail::get_dispatcher<0>(std::declval<V &>()))>::type;
+    static constexpr bool value =
+        Traits::is_simd_vector_internal<MV>::value && sizeof...(Is) >= 2 &&
+        sizeof...(Is) <= 8 && sizeof(T) == sizeof...(Is) * sizeof(M) &&
+        std::is_same<std::tuple<SoaDetail::member_type<Is, T>...>,
+                     std::tuple<typename repeat<Is, M>::type...>>::value;
+};
+
+// Reference {{{1
+/**\internal
+ * Proxy reference to one scalar object in an aosoa_vector. It converts to \p T and can be
+ * assigned from \p T.
+ */
+template <typename C> class Reference
+{
+    using T = typename C::value_type;
+
+public:
+    Reference(C &c, std::size_t i) : container(c), index(i) {}
+
+    Reference &operator=(const T &x)
+    {
+        container.set(index, x);
+        return *this;
+    }
+    Reference &operator=(const Reference &x) { return operator=(static_cast<T>(x)); }
+    operator T() const { return static_cast<const C &>(container)[index]; }
+
+    /// Returns a reference to the \p I-th data member of the referenced object.
+    template <std::size_t I>
+    auto get() const -> decltype(SimdizeDetail::get_dispatcher<I>(
+        std::declval<typename C::vector_type &>())[std::size_t()])
+    {
+        return SimdizeDetail::get_dispatcher<I>(
+            container.vector(index / C::vectorSize()))[index % C::vectorSize()];
+    }
+
+    friend void swap(Reference &&a, Reference &&b)
+    {
+        const T tmp = a;
+        a = static_cast<T>(b);
+        b = tmp;
+    }
+
+private:
+    C &container;
+    std::size_t index;
+};
+
+// TileIterator {{{1
+/**\internal
+ * Random access iterator over the tiles of an aosoa_vector. Dereferencing yields a
+ * reference to the simdize<T> object stored in the tile.
+ */
+template <typename V, typename TileT> class TileIterator
+{
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename std::remove_const<V>::type;
+    using difference_type = std::ptrdiff_t;
+    using reference = V &;
+    using pointer = V *;
+
+    explicit TileIterator(TileT *t) : tile(t) {}
+
+    reference operator*() const { return tile->data; }
+    pointer operator->() const { return &tile->data; }
+    reference operator[](difference_type n) const { return tile[n].data; }
+
+    TileIterator &operator++() { ++tile; return *this; }
+    TileIterator operator++(int) { TileIterator r = *this; ++tile; return r; }
+    TileIterator &operator--() { --tile; return *this; }
+    TileIterator operator--(int) { TileIterator r = *this; --tile; return r; }
+    TileIterator &operator+=(difference_type n) { tile += n; return *this; }
+    TileIterator &operator-=(difference_type n) { tile -= n; return *this; }
+    TileIterator operator+(difference_type n) const { return TileIterator(tile + n); }
+    TileIterator operator-(difference_type n) const { return TileIterator(tile - n); }
+    difference_type operator-(const TileIterator &rhs) const { return tile - rhs.tile; }
+
+    bool operator==(const TileIterator &rhs) const { return tile == rhs.tile; }
+    bool operator!=(const TileIterator &rhs) const { return tile != rhs.tile; }
+    bool operator< (const TileIterator &rhs) const { return tile <  rhs.tile; }
+    bool operator<=(const TileIterator &rhs) const { return tile <= rhs.tile; }
+    bool operator> (const TileIterator &rhs) const { return tile >  rhs.tile; }
+    bool operator>=(const TileIterator &rhs) const { return tile >= rhs.tile; }
+
+private:
+    TileT *tile;
+};
+//}}}1
+}  // namespace AosoaDetail
+
+/**
+ * \ingroup Simdize
+ *
+ * A sequence container of \p T objects with a tiled "array of structures of arrays"
+ * layout: every vectorSize() consecutive objects are stored as one `simdize<T>` object
+ * (a tile), and the tiles are stored contiguously. Consequently, a `simdize<T>` object
+ * is accessed by reference, without any gather, deinterleave, or per-member load, and all
+ * data members of one group of objects share the same cache lines. Every tile is aligned
+ * to (and padded to a multiple of) a 64 Byte cache line, so that a loop over neighboring
+ * tiles never touches a cache line of an unrelated tile. If `sizeof(simdize<T>)` is not a
+ * multiple of 64 this padding costs memory bandwidth (e.g. 16 of 64 Bytes for three
+ * float_v members with SSE).
+ *
+ * \tparam T A type that simdize can vectorize and that exposes its data members via the
+ *           std::tuple get interface (see soa_vector for the requirements).
+ * \tparam N The number of objects per tile, forwarded to simdize<T, N>.
+ *
+ * Use assign(const T *, size_type) and copyTo to convert from and to an array of \p T
+ * in bulk. If all data members of \p T have the same type these functions convert a whole
+ * tile at a time via Vc::InterleavedMemoryWrapper.
+ *
+ * The entries of the last tile beyond size() are unspecified; functions that grow the
+ * container overwrite them.
+ *
+ * \code
+ * Vc::aosoa_vector<Point> points(aos.data(), aos.size());
+ * for (Vc::simdize<Point> &p : points) {  // iteration over the tiles
+ *   p.x += p.y * p.z;
+ * }
+ * points.copyTo(aos.data());
+ * \endcode
+ */
+template <typename T, std::size_t N> class aosoa_vector
+{
+    static constexpr std::size_t Members = SimdizeDetail::determine_tuple_size_<T>::value;
+    using IndexSeq = Vc::make_index_sequence<Members>;
+
+public:
+    using value_type = T;
+    /// The vectorized type, storing vectorSize() objects of type \p T in one tile.
+    using vector_type = simdize<T, N>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = AosoaDetail::Reference<aosoa_vector>;
+    using const_reference = T;
+
+private:
+    using Tile = AosoaDetail::Tile<vector_type>;
+    using Storage = std::vector<Tile, Vc::Allocator<Tile>>;
+
+public:
+    using iterator = AosoaDetail::TileIterator<vector_type, Tile>;
+    using const_iterator = AosoaDetail::TileIterator<const vector_type, const Tile>;
+
+    /// The type of the \p I-th data member of \p T.
+    template <std::size_t I> using member_type = SoaDetail::member_type<I, T>;
+    /// The vector type for the \p I-th data member of \p T, as used in vector_type.
+    template <std::size_t I>
+    using member_vector_type = typename std::decay<decltype(
+        SimdizeDetail::get_dispatcher<I>(std::declval<vector_type &>()))>::type;
+
+    /// Returns the number of objects in one tile.
+    static constexpr size_type vectorSize() { return vector_type::size(); }
+
+    aosoa_vector() = default;
+    /// Constructs a container with \p n copies of \p value.
+    explicit aosoa_vector(size_type n, const T &value) { resize(n, value); }
+    /// Constructs a container with the \p n objects in the array \p data.
+    aosoa_vector(const T *data, size_type n) { assign(data, n); }
+    /// Constructs a container with the objects in [\p first, \p last).
+    template <typename It, typename = decltype(T(*std::declval<It &>()))>
+    aosoa_vector(It first, It last)
+    {
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+    }
+    aosoa_vector(std::initializer_list<T> init) : aosoa_vector(init.begin(), init.size())
+    {
+    }
+
+    ///\name capacity
+    ///@{
+    /// Returns the number of \p T objects stored.
+    size_type size() const { return m_size; }
+    /// Returns whether size() == 0.
+    bool empty() const { return m_size == 0; }
+    /// Returns the number of tiles, i.e. size() / vectorSize() rounded up.
+    size_type vectorsCount() const { return m_tiles.size(); }
+    /// Returns the number of objects the container can hold without reallocation.
+    size_type capacity() const { return m_tiles.capacity() * vectorSize(); }
+    /// Reserves storage for at least \p n objects (rounded up to whole tiles).
+    void reserve(size_type n) { m_tiles.reserve(tilesFor(n)); }
+    ///@}
+
+    ///\name modifiers
+    ///@{
+    /// Resizes the container to \p n objects, value-initializing every data member of new
+    /// objects.
+    void resize(size_type n)
+    {
+        const size_type old = m_size;
+        m_tiles.resize(tilesFor(n), zeroTile(IndexSeq()));
+        m_size = n;
+        // new tiles are zero-initialized, only the tail of the old last tile needs clearing
+        for (size_type i = old; i < std::min(n, tilesFor(old) * vectorSize()); ++i) {
+            forEachMember(ClearOp{i % vectorSize()}, m_tiles[i / vectorSize()].data);
+        }
+    }
+    /// Resizes the container to \p n objects, initializing new objects with \p value.
+    void resize(size_type n, const T &value)
+    {
+        const size_type old = m_size;
+        m_tiles.resize(tilesFor(n), zeroTile(IndexSeq()));
+        m_size = n;
+        for (size_type i = old; i < n; ++i) {
+            set(i, value);
+        }
+    }
+    /// Appends \p x.
+    void push_back(const T &x)
+    {
+        if (m_size == m_tiles.size() * vectorSize()) {
+            m_tiles.push_back(zeroTile(IndexSeq()));
+        }
+        set(m_size++, x);
+    }
+    /// Appends \p x. Equivalent to push_back(T(args...)).
+    template <typename... Args> void emplace_back(Args &&... args)
+    {
+        push_back(T(std::forward<Args>(args)...));
+    }
+    /// Removes the last object.
+    void pop_back()
+    {
+        --m_size;
+        if (tilesFor(m_size) < m_tiles.size()) {
+            m_tiles.pop_back();
+        }
+    }
+    /// Removes all objects. The capacity is not changed.
+    void clear()
+    {
+        m_tiles.clear();
+        m_size = 0;
+    }
+    /**
+     * Replaces the contents with the \p n objects in the array \p data. Whole tiles are
+     * converted with a deinterleaving load if \p T permits it (see the class
+     * documentation).
+     */
+    void assign(const T *data, size_type n)
+    {
+        m_tiles.resize(tilesFor(n), zeroTile(IndexSeq()));
+        m_size = n;
+        const size_type full = n / vectorSize();
+        convertTiles(data, full, Interleavable());
+        for (size_type i = full * vectorSize(); i < n; ++i) {
+            set(i, data[i]);
+        }
+    }
+    ///@}
+
+    ///\name scalar access
+    ///@{
+    /// Returns a proxy reference to the object at index \p i.
+    reference operator[](size_type i) { return {*this, i}; }
+    /// Returns a copy of the object at index \p i.
+    T operator[](size_type i) const
+    {
+        return get(m_tiles[i / vectorSize()].data, i % vectorSize(), IndexSeq());
+    }
+    /// Assigns \p x to the object at index \p i.
+    void set(size_type i, const T &x)
+    {
+        forEachMember(SetOp{i % vectorSize(), x}, m_tiles[i / vectorSize()].data);
+    }
+    /**
+     * Copies all objects to the array \p out, which must have room for size() objects.
+     * Whole tiles are converted with an interleaving store if \p T permits it (see the
+     * class documentation).
+     */
+    void copyTo(T *out) const
+    {
+        const size_type full = m_size / vectorSize();
+        convertTiles(out, full, Interleavable());
+        for (size_type i = full * vectorSize(); i < m_size; ++i) {
+            out[i] = operator[](i);
+        }
+    }
+    ///@}
+
+    ///\name vector access
+    ///@{
+    /// Returns a reference to the \p i-th tile.
+    vector_type &vector(size_type i) { return m_tiles[i].data; }
+    /// Returns a reference to the \p i-th tile. The entries of the last tile beyond size()
+    /// are unspecified.
+    const vector_type &vector(size_type i) const { return m_tiles[i].data; }
+    /// Assigns \p x to the \p i-th tile.
+    void setVector(size_type i, const vector_type &x) { m_tiles[i].data = x; }
+
+    /// Returns an iterator over the tiles.
+    iterator begin() { return iterator(m_tiles.data()); }
+    const_iterator begin() const { return const_iterator(m_tiles.data()); }
+    const_iterator cbegin() const { return const_iterator(m_tiles.data()); }
+    iterator end() { return iterator(m_tiles.data() + m_tiles.size()); }
+    const_iterator end() const { return const_iterator(m_tiles.data() + m_tiles.size()); }
+    const_iterator cend() const { return const_iterator(m_tiles.data() + m_tiles.size()); }
+    ///@}
+
+private:
+    using Interleavable = std::integral_constant<
+        bool, AosoaDetail::is_interleavable<T, vector_type, IndexSeq>::value>;
+
+    static constexpr size_type tilesFor(size_type n)
+    {
+        return (n + vectorSize() - 1) / vectorSize();
+    }
+
+    // per member operations {{{
+    template <typename F> static void forEachMember(F &&f, vector_type &tile)
+    {
+        forEachMember(std::forward<F>(f), tile, IndexSeq());
+    }
+    template <typename F, std::size_t... Is>
+    static void forEachMember(F &&f, vector_type &tile, Vc::index_sequence<Is...>)
+    {
+        auto &&unused = {(f(SimdizeDetail::get_dispatcher<Is>(tile),
+                            std::integral_constant<std::size_t, Is>()),
+                          0)...};
+        if (&unused == &unused) {}
+    }
+
+    struct ClearOp {
+        size_type lane;
+        template <typename V, typename I> void operator()(V &v, I) const
+        {
+            v[lane] = member_type<I::value>();
+        }
+    };
+    struct SetOp {
+        size_type lane;
+        const T &x;
+        template <typename V, typename I> void operator()(V &v, I) const
+        {
+            v[lane] = SimdizeDetail::get_dispatcher<I::value>(x);
+        }
+    };
+
+    /// Returns a tile with all entries value-initialized. (simdize<T> is not necessarily
+    /// default constructible.)
+    template <std::size_t... Is> static Tile zeroTile(Vc::index_sequence<Is...>)
+    {
+        return {vector_type(SoaDetail::construct<typename vector_type::base_type>(
+            member_vector_type<Is>(Vc::Zero)...))};
+    }
+
+    template <std::size_t... Is>
+    static T get(const vector_type &tile, size_type lane, Vc::index_sequence<Is...>)
+    {
+        return SoaDetail::construct<T>(
+            member_type<Is>(SimdizeDetail::get_dispatcher<Is>(tile)[lane])...);
+    }
+
+    // bulk conversion {{{
+    void convertTiles(const T *data, size_type count, std::true_type)
+    {
+        const InterleavedMemoryWrapper<T, member_vector_type<0>> wrapper(const_cast<T *>(data));
+        for (size_type t = 0; t < count; ++t) {
+            deinterleave(m_tiles[t].data, wrapper[t * vectorSize()], IndexSeq());
+        }
+    }
+    void convertTiles(const T *data, size_type count, std::false_type)
+    {
+        for (size_type i = 0; i < count * vectorSize(); ++i) {
+            set(i, data[i]);
+        }
+    }
+    void convertTiles(T *out, size_type count, std::true_type) const
+    {
+        InterleavedMemoryWrapper<T, member_vector_type<0>> wrapper(out);
+        for (size_type t = 0; t < count; ++t) {
+            interleave(wrapper[t * vectorSize()], m_tiles[t].data, IndexSeq());
+        }
+    }
+    void convertTiles(T *out, size_type count, std::false_type) const
+    {
+        for (size_type i = 0; i < count * vectorSize(); ++i) {
+            out[i] = operator[](i);
+        }
+    }
+
+    template <typename Access, std::size_t... Is>
+    static void deinterleave(vector_type &tile, Access &&access, Vc::index_sequence<Is...>)
+    {
+        Vc::tie(SimdizeDetail::get_dispatcher<Is>(tile)...) = std::forward<Access>(access);
+    }
+    template <typename Access, std::size_t... Is>
+    static void interleave(Access &&access, const vector_type &tile,
+                           Vc::index_sequence<Is...>)
+    {
+        std::forward<Access>(access) = Vc::tie(SimdizeDetail::get_dispatcher<Is>(tile)...);
+    }
+    // }}}
+
+    Storage m_tiles;
+    size_type m_size = 0;
+};
+
+}  // namespace Vc
+
+#endif  // VC_COMMON_AOSOA_VECTOR_H_
+
+// vim: foldmethod=marker
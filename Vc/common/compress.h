@@ -0,0 +1,109 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_COMPRESS_H_
+#define VC_COMMON_COMPRESS_H_
+
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+/**\internal
+ * Returns a mask that is \c true for the first \p k.count() entries.
+ */
+template <typename V>
+Vc_INTRINSIC typename V::MaskType leading_mask(const typename V::MaskType &k)
+{
+    return V::One().compress(k) != V::Zero();
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Stores the entries of \p v where \p k is \c true contiguously to \p mem.
+ *
+ * Exactly \p k.count() entries are written, thus \p mem needs no alignment and no
+ * padding. This is the building block for filtering and stream compaction:
+ * \code
+ * float *out = result;
+ * for (std::size_t i = 0; i < n; i += float_v::Size) {
+ *     const float_v x(&in[i], Vc::Aligned);
+ *     out += compress_store(out, x > threshold, x);
+ * }
+ * \endcode
+ * If the destination has room for \VSize{T} more entries, storing the full vector with
+ * <tt>v.compress(k).store(mem, Vc::Unaligned)</tt> avoids the masked store.
+ *
+ * \param mem The destination of the selected entries.
+ * \param k   Selects the entries of \p v to store.
+ * \param v   The values to store.
+ *
+ * \return The number of stored entries, i.e. \p k.count().
+ */
+template <typename V>
+Vc_INTRINSIC std::size_t compress_store(typename V::EntryType *mem,
+                                        const typename V::MaskType &k, const V &v)
+{
+    v.compress(k).store(mem, Detail::leading_mask<V>(k), Vc::Unaligned);
+    return k.count();
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Loads \p k.count() consecutive entries from \p mem and places them, in order, at the
+ * entries of the returned vector where \p k is \c true. The remaining entries are zero.
+ *
+ * No more than \p k.count() entries are read from \p mem.
+ * \code
+ * std::size_t used = 0;
+ * float_v x = expand_load<float_v>(&packed[used], k);
+ * used += k.count();
+ * \endcode
+ *
+ * \tparam V The vector type to return.
+ * \param mem The address of the first value to load. It needs no alignment.
+ * \param k   Selects the entries to fill.
+ */
+template <typename V>
+Vc_INTRINSIC V expand_load(const typename V::EntryType *mem, const typename V::MaskType &k)
+{
+    if (k.isFull()) {
+        return V(mem, Vc::Unaligned);
+    }
+    V tmp = V::Zero();
+    tmp.gather(mem, V::IndexType::IndexesFromZero(), Detail::leading_mask<V>(k));
+    return tmp.expand(k);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_COMPRESS_H_
+
+// vim: foldmethod=marker
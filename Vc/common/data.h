@@ -34,9 +34,23 @@ namespace Vc_VERSIONED_NAMESPACE
 namespace Common
 {
 
-alignas(64) extern unsigned int RandomState[];
+// Every thread owns its state for Vector::Random(). The first thread keeps the initial
+// seed, every further thread mixes a thread counter into its copy on first use (see
+// seedRandomState in src/const.cpp).
+alignas(64) extern thread_local unsigned int RandomState[16];
+extern thread_local bool RandomStateSeeded;
 alignas(32) extern const unsigned int AllBitsSet[8];
 
+void Vc_CDECL seedRandomState();
+
+Vc_ALWAYS_INLINE unsigned int *randomState()
+{
+    if (Vc_IS_UNLIKELY(!RandomStateSeeded)) {
+        seedRandomState();
+    }
+    return RandomState;
+}
+
 }  // namespace Common
 }  // namespace Vc
 
@@ -28,6 +28,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef VC_COMMON_DEINTERLEAVE_H_
 #define VC_COMMON_DEINTERLEAVE_H_
 
+#include "interleave.h"
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -36,7 +37,8 @@ namespace Vc_VERSIONED_NAMESPACE
 /**
  * \ingroup Vectors
  *
- * \deprecated Turn to InterleavedMemoryWrapper for a more flexible and complete solution.
+ * \deprecated Turn to deinterleave(const M *, V &, Vs &...) or InterleavedMemoryWrapper
+ * for a more flexible and complete solution.
  *
  * Loads two vectors of values from an interleaved array.
  *
@@ -86,6 +88,45 @@ template<typename V, typename M> Vc_ALWAYS_INLINE void deinterleave(V *a, V *b,
     Detail::deinterleave(*a, *b, memory, Aligned);
 }
 
+/**
+ * \ingroup Vectors
+ *
+ * Loads `1 + sizeof...(Vs)` (2 to 8) vectors from an interleaved array, i.e. from an
+ * array of `V::Size` structures with one data member per vector: `vk[i] = memory[i * N +
+ * k]`.
+ *
+ * \param memory Pointer to `N * V::Size` objects of type \p M. No alignment is required.
+ *               If \p M differs from `V::EntryType` the values are converted (e.g. from
+ *               unsigned char to float).
+ * \param v0, vs The vectors to load. All must have the same type, which may be any
+ *               Vc::Vector or Vc::SimdArray type.
+ *
+ * For a power of two \p N this function executes \p N (converting) vector loads followed
+ * by `log2(V::Size)` rounds of interleaveLow/interleaveHigh. Otherwise it loads one
+ * structure per vector and transposes `V::Size` x `V::Size` blocks in registers. No
+ * value beyond `memory[N * V::Size - 1]` is read. Only SimdArray types whose size is not
+ * a power of two fall back to scalar loads.
+ *
+ * \code
+ * const unsigned char *rgb = ...;  // r0 g0 b0 r1 g1 b1 ...
+ * Vc::float_v r, g, b;
+ * Vc::deinterleave(rgb + 3 * i, r, g, b);
+ * \endcode
+ *
+ * \see interleave(M *, const V &, const Vs &...)
+ */
+template <typename M, typename V, typename... Vs>
+Vc_INTRINSIC enable_if<(Traits::is_simd_vector<V>::value && sizeof...(Vs) >= 1 &&
+                        sizeof...(Vs) <= 7 &&
+                        std::is_same<std::tuple<V, Vs...>, std::tuple<Vs..., V>>::value &&
+                        std::is_arithmetic<M>::value),
+                       void>
+deinterleave(const M *memory, V &v0, Vs &... vs)
+{
+    Detail::InterleaveStreams<V, M, 1 + sizeof...(Vs)>::deinterleave(
+        memory, make_index_sequence<1 + sizeof...(Vs)>(), v0, vs...);
+}
+
 }  // namespace Vc
 
 #endif // VC_COMMON_DEINTERLEAVE_H_
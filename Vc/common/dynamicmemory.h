@@ -0,0 +1,473 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_DYNAMICMEMORY_H_
+#define VC_COMMON_DYNAMICMEMORY_H_
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include "memory.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+template <typename V, int Dimension> class MemorySlice;
+
+// MemorySlice<V, 1> {{{1
+/**
+ * \ingroup Containers
+ * \headerfile dynamicmemory.h <Vc/Memory>
+ *
+ * A view on one row of a DynamicMemory. It provides the complete interface of a
+ * one-dimensional Memory (vector(), range(), begin()/end(), scalar access, ...), while the
+ * entries are owned by the DynamicMemory.
+ *
+ * Copying a MemorySlice copies the view, assigning to it copies the entries. The const
+ * accessors of DynamicMemory return a MemorySlice<const V, 1>, which only reads the entries.
+ */
+template <typename V> class MemorySlice<V, 1> : public MemoryBase<V, MemorySlice<V, 1>, 1, void>
+{
+public:
+    typedef typename std::conditional<std::is_const<V>::value, const typename V::EntryType,
+                                      typename V::EntryType>::type EntryType;
+
+private:
+    typedef MemoryBase<V, MemorySlice<V, 1>, 1, void> Base;
+    friend class MemoryBase<V, MemorySlice<V, 1>, 1, void>;
+    friend class MemoryDimensionBase<V, MemorySlice<V, 1>, 1, void>;
+    EntryType *m_mem;
+    std::size_t m_entriesCount;
+
+public:
+    using Base::vector;
+
+    /// \internal
+    Vc_INTRINSIC MemorySlice(EntryType *mem, const std::size_t *extents)
+        : m_mem(mem), m_entriesCount(extents[0])
+    {
+    }
+    MemorySlice(const MemorySlice &) = default;
+
+    /// \return the number of scalar entries in the row.
+    Vc_ALWAYS_INLINE std::size_t entriesCount() const { return m_entriesCount; }
+    /// \return the number of vectors in the row, including the padding.
+    Vc_ALWAYS_INLINE std::size_t vectorsCount() const
+    {
+        return (m_entriesCount + V::Size - 1) / V::Size;
+    }
+
+    /// Copies the entries of \p rhs, which must have the same vectorsCount(), into the row.
+    Vc_ALWAYS_INLINE MemorySlice &operator=(const MemorySlice &rhs)
+    {
+        Vc_ASSERT(vectorsCount() == rhs.vectorsCount());
+        Detail::copyVectors(*this, rhs);
+        return *this;
+    }
+    /// \copydoc operator=(const MemorySlice &)
+    template <typename P, typename RM>
+    Vc_ALWAYS_INLINE MemorySlice &operator=(const MemoryBase<V, P, 1, RM> &rhs)
+    {
+        Vc_ASSERT(vectorsCount() == rhs.vectorsCount());
+        Detail::copyVectors(*this, rhs);
+        return *this;
+    }
+    /// Assigns \p v to every vector of the row.
+    inline MemorySlice &operator=(const V &v)
+    {
+        for (std::size_t i = 0; i < vectorsCount(); ++i) {
+            vector(i) = v;
+        }
+        return *this;
+    }
+};
+
+// DynamicMemoryBase {{{1
+/**
+ * \headerfile dynamicmemory.h <Vc/Memory>
+ *
+ * Common interface of DynamicMemory and of the two-dimensional slices of a
+ * three-dimensional DynamicMemory.
+ *
+ * The entries are stored row-major. Every row (the last dimension) is padded to a multiple
+ * of \p V::Size, thus every row starts at an aligned address and can be processed with
+ * aligned vector loads and stores only.
+ */
+template <typename V, int Dimension> class DynamicMemoryBase
+{
+    static_assert(Dimension >= 2, "Use Memory<V> for a one-dimensional dynamic array.");
+
+public:
+    typedef typename std::conditional<std::is_const<V>::value, const typename V::EntryType,
+                                      typename V::EntryType>::type EntryType;
+    /// The type returned from operator[].
+    typedef MemorySlice<V, Dimension - 1> SliceType;
+    /// The read-only view returned from operator[] const.
+    typedef MemorySlice<const V, Dimension - 1> ConstSliceType;
+
+protected:
+    EntryType *m_mem;
+    std::size_t m_extents[Dimension];
+
+    Vc_INTRINSIC DynamicMemoryBase(EntryType *mem, const std::size_t *extents) : m_mem(mem)
+    {
+        std::copy(extents, extents + Dimension, m_extents);
+    }
+
+    /// \internal the number of entries between two consecutive slices
+    Vc_ALWAYS_INLINE std::size_t sliceStride() const
+    {
+        std::size_t n = rowVectorsCount() * V::Size;
+        for (int d = 1; d < Dimension - 1; ++d) {
+            n *= m_extents[d];
+        }
+        return n;
+    }
+
+public:
+    /// \return the extent of dimension \p d. Dimension 0 is indexed by operator[].
+    Vc_ALWAYS_INLINE std::size_t extent(std::size_t d) const { return m_extents[d]; }
+
+    /**
+     * \return the number of rows, i.e. the product of all extents but the last. For a
+     * two-dimensional DynamicMemory this is extent(0).
+     */
+    Vc_ALWAYS_INLINE std::size_t rowsCount() const
+    {
+        std::size_t n = 1;
+        for (int d = 0; d < Dimension - 1; ++d) {
+            n *= m_extents[d];
+        }
+        return n;
+    }
+    /// \return the number of entries in one row, i.e. the last extent.
+    Vc_ALWAYS_INLINE std::size_t columnsCount() const { return m_extents[Dimension - 1]; }
+    /// \return the number of vectors in one row, including the padding.
+    Vc_ALWAYS_INLINE std::size_t rowVectorsCount() const
+    {
+        return (columnsCount() + V::Size - 1) / V::Size;
+    }
+
+    /**
+     * \return the number of scalar entries in the whole array.
+     *
+     * \warning Do not use this function for scalar iteration over the array since there
+     * will be padding between rows if columnsCount() is not divisible by \c V::Size.
+     */
+    Vc_ALWAYS_INLINE std::size_t entriesCount() const { return rowsCount() * columnsCount(); }
+    /// \return the number of vectors in the whole array, including the padding of all rows.
+    Vc_ALWAYS_INLINE std::size_t vectorsCount() const
+    {
+        return rowsCount() * rowVectorsCount();
+    }
+
+    /// Returns a pointer to the start of the allocated memory.
+    Vc_ALWAYS_INLINE EntryType *entries() { return m_mem; }
+    /// Const overload of the above function.
+    Vc_ALWAYS_INLINE const EntryType *entries() const { return m_mem; }
+
+    /**
+     * Returns the \p i-th slice of dimension 0: a row of a two-dimensional and a
+     * two-dimensional slice of a three-dimensional DynamicMemory.
+     * \code
+     * Vc::DynamicMemory<float_v, 2> image(height, width);
+     * for (std::size_t y = 0; y < image.rowsCount(); ++y) {
+     *     for (std::size_t i = 0; i < image.rowVectorsCount(); ++i) {
+     *         image[y].vector(i) *= 2.f;
+     *     }
+     * }
+     * \endcode
+     */
+    Vc_ALWAYS_INLINE SliceType operator[](std::size_t i)
+    {
+        return {m_mem + i * sliceStride(), m_extents + 1};
+    }
+    /// Const overload of the above function.
+    Vc_ALWAYS_INLINE ConstSliceType operator[](std::size_t i) const
+    {
+        return {m_mem + i * sliceStride(), m_extents + 1};
+    }
+
+    /**
+     * Returns the \p r-th row, counting all rows of all slices, i.e. the valid range of \p r
+     * is [0, rowsCount()).
+     */
+    Vc_ALWAYS_INLINE MemorySlice<V, 1> row(std::size_t r)
+    {
+        return {m_mem + r * rowVectorsCount() * V::Size, m_extents + Dimension - 1};
+    }
+    /// Const overload of the above function.
+    Vc_ALWAYS_INLINE MemorySlice<const V, 1> row(std::size_t r) const
+    {
+        return {m_mem + r * rowVectorsCount() * V::Size, m_extents + Dimension - 1};
+    }
+
+    /**
+     * \return a smart object to wrap the \p i-th vector of the whole array, counting the
+     * padding vectors at the end of every row.
+     */
+    template <typename Flags = AlignedTag>
+    Vc_ALWAYS_INLINE MemoryVector<V, Flags> vector(std::size_t i, Flags = Flags())
+    {
+        return m_mem + i * V::Size;
+    }
+    /// Const overload of the above function.
+    template <typename Flags = AlignedTag>
+    Vc_ALWAYS_INLINE MemoryVector<const V, Flags> vector(std::size_t i,
+                                                         Flags = Flags()) const
+    {
+        return m_mem + i * V::Size;
+    }
+
+    /**
+     * Returns an iterable range over the vectors \p firstIndex to \p lastIndex (inclusive)
+     * of the whole array. Loads through the range use \p Flags, which default to
+     * Prefetch<Auto>.
+     */
+    template <typename Flags>
+    Vc_ALWAYS_INLINE MemoryRange<V, DynamicMemoryBase, Flags> range(std::size_t firstIndex,
+                                                                    std::size_t lastIndex,
+                                                                    Flags)
+    {
+        return {this, firstIndex, lastIndex};
+    }
+    /// \copydoc range(std::size_t, std::size_t, Flags)
+    Vc_ALWAYS_INLINE MemoryRange<V, DynamicMemoryBase> range(std::size_t firstIndex,
+                                                             std::size_t lastIndex)
+    {
+        return {this, firstIndex, lastIndex};
+    }
+    /// Const overload of the above function.
+    template <typename Flags>
+    Vc_ALWAYS_INLINE MemoryRange<const V, DynamicMemoryBase, Flags> range(
+        std::size_t firstIndex, std::size_t lastIndex, Flags) const
+    {
+        return {this, firstIndex, lastIndex};
+    }
+    /// Const overload of the above function.
+    Vc_ALWAYS_INLINE MemoryRange<const V, DynamicMemoryBase> range(
+        std::size_t firstIndex, std::size_t lastIndex) const
+    {
+        return {this, firstIndex, lastIndex};
+    }
+
+    /// Return a (vectorized) iterator to the start of the whole array.
+    template <typename Flags = AlignedTag>
+    Vc_ALWAYS_INLINE MemoryVectorIterator<V, Flags> begin(Flags = Flags())
+    {
+        return m_mem;
+    }
+    /// Const overload of the above function.
+    template <typename Flags = AlignedTag>
+    Vc_ALWAYS_INLINE MemoryVectorIterator<const V, Flags> begin(Flags = Flags()) const
+    {
+        return m_mem;
+    }
+    /// Return a (vectorized) iterator to the end of the whole array.
+    template <typename Flags = AlignedTag>
+    Vc_ALWAYS_INLINE MemoryVectorIterator<V, Flags> end(Flags = Flags())
+    {
+        return m_mem + vectorsCount() * V::Size;
+    }
+    /// Const overload of the above function.
+    template <typename Flags = AlignedTag>
+    Vc_ALWAYS_INLINE MemoryVectorIterator<const V, Flags> end(Flags = Flags()) const
+    {
+        return m_mem + vectorsCount() * V::Size;
+    }
+
+    /// Sets all entries, including the padding, to zero.
+    inline void setZero()
+    {
+        for (std::size_t i = 0; i < vectorsCount(); ++i) {
+            vector(i) = V::Zero();
+        }
+    }
+
+protected:
+    inline void assign(const V &v)
+    {
+        for (std::size_t i = 0; i < vectorsCount(); ++i) {
+            vector(i) = v;
+        }
+    }
+};
+
+// MemorySlice<V, Dimension> {{{1
+/**
+ * \ingroup Containers
+ * \headerfile dynamicmemory.h <Vc/Memory>
+ *
+ * A view on a \p Dimension dimensional slice of a DynamicMemory, e.g. one plane of a
+ * three-dimensional grid.
+ *
+ * Copying a MemorySlice copies the view, assigning to it copies the entries.
+ */
+template <typename V, int Dimension>
+class MemorySlice : public DynamicMemoryBase<V, Dimension>
+{
+    typedef DynamicMemoryBase<V, Dimension> Base;
+
+public:
+    typedef typename Base::EntryType EntryType;
+
+    /// \internal
+    Vc_INTRINSIC MemorySlice(EntryType *mem, const std::size_t *extents) : Base(mem, extents)
+    {
+    }
+    MemorySlice(const MemorySlice &) = default;
+
+    /// Copies the entries of \p rhs, which must have the same extents, into the slice.
+    inline MemorySlice &operator=(const MemorySlice &rhs)
+    {
+        Vc_ASSERT(std::equal(rhs.m_extents, rhs.m_extents + Dimension, Base::m_extents));
+        std::copy(rhs.entries(), rhs.entries() + rhs.vectorsCount() * V::Size,
+                  Base::entries());
+        return *this;
+    }
+
+    /// Assigns \p v to every vector of the slice.
+    inline MemorySlice &operator=(const V &v)
+    {
+        Base::assign(v);
+        return *this;
+    }
+};
+
+// DynamicMemory {{{1
+/**
+ * \ingroup Containers
+ * \headerfile dynamicmemory.h <Vc/Memory>
+ *
+ * A \p Dimension dimensional array with extents given at runtime, e.g. an image or a
+ * three-dimensional grid. It is the runtime counterpart of Memory<V, Size1, Size2>:
+ * \code
+ * Vc::DynamicMemory<float_v, 2> image(height, width);
+ * Vc::DynamicMemory<float_v, 3> grid(nz, ny, nx);
+ * image[y].vector(i) = grid[z][y].vector(i);
+ * for (auto x : grid[z][y].range(0, grid.rowVectorsCount() - 1)) { ... }  // prefetching
+ * \endcode
+ * The rows are stored contiguously, every row padded to a multiple of \p V::Size entries.
+ * The padding is zero-initialized, the other entries are left uninitialized. Every row is a
+ * MemorySlice<V, 1>, which supports the complete interface of Memory<V>.
+ *
+ * Moving a DynamicMemory transfers the allocation; the moved-from object is left empty.
+ *
+ * \tparam V The vector type you want to operate on. (e.g. float_v or uint_v)
+ * \tparam Dimension The number of dimensions: 2 or more.
+ */
+template <typename V, int Dimension>
+class DynamicMemory : public DynamicMemoryBase<V, Dimension>
+{
+    typedef DynamicMemoryBase<V, Dimension> Base;
+    using Base::m_mem;
+    using Base::m_extents;
+
+public:
+    typedef typename V::EntryType EntryType;
+
+private:
+    explicit DynamicMemory(const std::array<std::size_t, Dimension> &extents)
+        : Base(nullptr, extents.data())
+    {
+        m_mem = Vc::malloc<EntryType, Vc::AlignOnVector>(Base::vectorsCount() * V::Size);
+        if (Base::columnsCount() % V::Size != 0) {
+            for (std::size_t r = 0; r < Base::rowsCount(); ++r) {
+                Base::row(r).lastVector() = V::Zero();
+            }
+        }
+    }
+
+public:
+    /**
+     * Allocates an array with the given extents. The number of arguments must equal
+     * \p Dimension; the last one is the number of entries per row.
+     */
+    template <typename... Extents,
+              typename = enable_if<(sizeof...(Extents) == Dimension)>>
+    explicit DynamicMemory(Extents... extents)
+        : DynamicMemory(std::array<std::size_t, Dimension>{{std::size_t(extents)...}})
+    {
+    }
+
+    /// Copies the extents and all entries of \p rhs into a new allocation.
+    DynamicMemory(const DynamicMemory &rhs)
+        : Base(Vc::malloc<EntryType, Vc::AlignOnVector>(rhs.vectorsCount() * V::Size),
+               rhs.m_extents)
+    {
+        std::copy(rhs.m_mem, rhs.m_mem + rhs.vectorsCount() * V::Size, m_mem);
+    }
+
+    /// Takes over the allocation of \p rhs, which is left with all extents zero.
+    DynamicMemory(DynamicMemory &&rhs) noexcept : Base(rhs.m_mem, rhs.m_extents)
+    {
+        rhs.m_mem = nullptr;
+        std::fill(rhs.m_extents, rhs.m_extents + Dimension, std::size_t(0));
+    }
+
+    /// Copy (or move) assignment. A move does not allocate.
+    DynamicMemory &operator=(DynamicMemory rhs) noexcept
+    {
+        swap(rhs);
+        return *this;
+    }
+
+    /// Assigns \p v to every vector of the array, including the padding.
+    inline DynamicMemory &operator=(const V &v)
+    {
+        Base::assign(v);
+        return *this;
+    }
+
+    /// Frees the memory which was allocated in the constructor.
+    ~DynamicMemory() { Vc::free(m_mem); }
+
+    /// Swaps the contents and extents of two DynamicMemory objects.
+    inline void swap(DynamicMemory &rhs) noexcept
+    {
+        std::swap(m_mem, rhs.m_mem);
+        std::swap_ranges(m_extents, m_extents + Dimension, rhs.m_extents);
+    }
+};
+
+template <typename V, int Dimension>
+Vc_ALWAYS_INLINE void swap(DynamicMemory<V, Dimension> &a, DynamicMemory<V, Dimension> &b)
+{
+    a.swap(b);
+}
+//}}}1
+}  // namespace Common
+
+using Common::DynamicMemory;
+using Common::MemorySlice;
+}  // namespace Vc
+
+#endif  // VC_COMMON_DYNAMICMEMORY_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,271 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_EXECUTION_H_
+#define VC_COMMON_EXECUTION_H_
+
+#include <algorithm>
+#include <iterator>
+#include "memoryfwd.h"
+#include "threadpool.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace execution
+{
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Execution policy for the parallel overloads of simd_for_each and simd_for_each_n.
+ *
+ * The range is split into chunks of chunk_size() bytes that start on vector-aligned
+ * elements. The chunks are processed by the threads of a Common::ThreadPool (by default
+ * Common::ThreadPool::global()), each one with the sequential algorithm. Therefore only the
+ * first and the last chunk use the narrower Scalar::Vector path for the unaligned head and
+ * tail of the range.
+ *
+ * The policy is a value type; the member functions return modified copies:
+ * \code
+ * Vc::simd_for_each(Vc::execution::par_simd.chunk_size(256 * 1024), data.begin(),
+ *                   data.end(), [](auto &v) { v = sqrt(v); });
+ * \endcode
+ */
+class parallel_simd_policy
+{
+public:
+    /// The default chunk size: 32 KiB, the L1 data cache size of most current x86 cores.
+    static constexpr std::size_t default_chunk_size = 32 * 1024;
+
+    constexpr parallel_simd_policy() = default;
+
+    /// Returns the number of bytes every thread processes at once.
+    constexpr std::size_t chunk_size() const { return m_chunkSize; }
+    /// Returns a copy of the policy that processes chunks of \p bytes.
+    constexpr parallel_simd_policy chunk_size(std::size_t bytes) const
+    {
+        return parallel_simd_policy(bytes, m_pool);
+    }
+
+    /// Returns the thread pool that executes the chunks.
+    Common::ThreadPool &pool() const
+    {
+        return m_pool ? *m_pool : Common::ThreadPool::global();
+    }
+    /// Returns a copy of the policy that executes on \p pool instead of the global pool.
+    constexpr parallel_simd_policy on(Common::ThreadPool &pool) const
+    {
+        return parallel_simd_policy(m_chunkSize, &pool);
+    }
+
+private:
+    constexpr parallel_simd_policy(std::size_t bytes, Common::ThreadPool *pool)
+        : m_chunkSize(bytes), m_pool(pool)
+    {
+    }
+
+    std::size_t m_chunkSize = default_chunk_size;
+    Common::ThreadPool *m_pool = nullptr;
+};
+
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Requests vectorized execution on all threads of the global thread pool.
+ */
+constexpr parallel_simd_policy par_simd{};
+}  // namespace execution
+
+namespace Traits
+{
+/// Whether \p T is one of the Vc execution policy types.
+template <typename T> struct is_execution_policy : public std::false_type {};
+template <>
+struct is_execution_policy<execution::parallel_simd_policy> : public std::true_type {};
+}  // namespace Traits
+
+namespace Detail
+{
+// the number of entries in the vectors simd_for_each works on and their alignment
+template <typename T, bool = std::is_arithmetic<T>::value>
+struct simd_for_each_vector_traits {
+    static constexpr std::size_t size = Vector<T>::Size;
+    static constexpr std::size_t alignment = Vector<T>::MemoryAlignment;
+};
+template <typename T> struct simd_for_each_vector_traits<T, false> {
+    static constexpr std::size_t size = 1;
+    static constexpr std::size_t alignment = 1;
+};
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Parallel variant of simd_for_each: calls \p f on vectors covering the range from
+ * \p first to \p last using the threads of \p policy.
+ *
+ * \p f is copied for every chunk and invoked concurrently from several threads. Thus
+ * it must not rely on state accumulated over calls and must synchronize access to shared
+ * data.
+ *
+ * \param policy An execution policy, i.e. Vc::execution::par_simd.
+ * \param first The begin of a contiguous range.
+ * \param last The end of the range.
+ * \param f The function to call. It receives vectors of different widths, as in
+ *          the sequential simd_for_each.
+ */
+template <typename ExecutionPolicy, typename RandomIt, typename UnaryFunction>
+inline enable_if<Traits::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value,
+                 void>
+simd_for_each(ExecutionPolicy &&policy, RandomIt first, RandomIt last, UnaryFunction f)
+{
+    static_assert(std::is_base_of<std::random_access_iterator_tag,
+                                  typename std::iterator_traits<RandomIt>::iterator_category>::value,
+                  "The parallel simd_for_each requires random access iterators over "
+                  "contiguous memory.");
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    using VT = Detail::simd_for_each_vector_traits<T>;
+
+    const std::size_t n = std::distance(first, last);
+    std::size_t chunk = std::max<std::size_t>(policy.chunk_size() / sizeof(T) / VT::size, 1) *
+                        VT::size;
+    // the pool indexes chunks with 32 bits
+    while (n / chunk >= 0xffffffffu) {
+        chunk *= 2;
+    }
+
+    // The first chunk additionally contains the elements before the first vector-aligned
+    // one. Then all other chunks start aligned and use full vectors only, except for the
+    // last one.
+    std::size_t head = 0;
+    while (head < VT::size && head < n &&
+           reinterpret_cast<std::uintptr_t>(std::addressof(first[head])) &
+               (VT::alignment - 1)) {
+        ++head;
+    }
+    if (n <= head + chunk) {
+        simd_for_each(first, last, std::move(f));
+        return;
+    }
+    const std::size_t chunks = (n - head + chunk - 1) / chunk;
+    policy.pool().parallel_for(chunks, [&](std::size_t k) {
+        const std::size_t begin = k == 0 ? 0 : head + k * chunk;
+        const std::size_t end = std::min(n, head + (k + 1) * chunk);
+        simd_for_each(first + begin, first + end, f);
+    });
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Parallel variant of simd_for_each_n: calls \p f on vectors covering the \p count
+ * elements starting at \p first using the threads of \p policy.
+ *
+ * \see simd_for_each(ExecutionPolicy &&, RandomIt, RandomIt, UnaryFunction)
+ */
+template <typename ExecutionPolicy, typename RandomIt, typename UnaryFunction>
+inline enable_if<Traits::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value,
+                 void>
+simd_for_each_n(ExecutionPolicy &&policy, RandomIt first, std::size_t count, UnaryFunction f)
+{
+    simd_for_each(std::forward<ExecutionPolicy>(policy), first, first + count, std::move(f));
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Writes \p value to the \p count elements starting at \p first, using the threads of
+ * \p policy, such that every page of memory is written by a single thread.
+ *
+ * Most operating systems (Linux with its default policy in particular) place a page on
+ * the NUMA node of the thread that writes to it first. A large array that is initialized
+ * by a single thread therefore ends up on one node, and all threads of a later parallel
+ * algorithm compete for the bandwidth of that node. Initializing the freshly allocated
+ * memory with first_touch instead distributes the pages over the nodes of the pool's
+ * threads:
+ * \code
+ * Vc::Memory<float_v> data(1 << 28, Vc::AlignOnHugePage);
+ * Vc::first_touch(Vc::execution::par_simd.chunk_size(2 << 20), data);
+ * \endcode
+ * The policy's chunk size is rounded up to a multiple of 4 KiB pages and chunks start on
+ * page boundaries. For memory that uses huge pages the chunk size should be a multiple of
+ * 2 MiB. Use the same pool (and a similar chunk size) for the later parallel algorithms so
+ * that their threads mostly process local memory.
+ *
+ * Pages that were touched before are not moved. Use bind_to_numa_node to move them.
+ */
+template <typename ExecutionPolicy, typename T>
+inline enable_if<Traits::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value,
+                 void>
+first_touch(ExecutionPolicy &&policy, T *first, std::size_t count, const T &value = T())
+{
+    constexpr std::size_t page = 4096;
+    const std::size_t chunk =
+        (std::max(policy.chunk_size(), page) + page - 1) / page * page / sizeof(T);
+    // the first chunk additionally contains the elements before the first page boundary
+    const std::size_t headBytes = (page - reinterpret_cast<std::uintptr_t>(first) % page) % page;
+    const std::size_t head = std::min(count, (headBytes + sizeof(T) - 1) / sizeof(T));
+    if (count <= head + chunk) {
+        std::fill_n(first, count, value);
+        return;
+    }
+    const std::size_t chunks = (count - head + chunk - 1) / chunk;
+    policy.pool().parallel_for(chunks, [&](std::size_t k) {
+        const std::size_t begin = k == 0 ? 0 : head + k * chunk;
+        const std::size_t end = std::min(count, head + (k + 1) * chunk);
+        std::fill(first + begin, first + end, value);
+    });
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Writes \p value to all entries of \p mem in parallel. The zero padding after the last
+ * entry is kept.
+ *
+ * \see first_touch(ExecutionPolicy &&, T *, std::size_t, const T &)
+ */
+template <typename ExecutionPolicy, typename V, bool InitPadding>
+inline enable_if<Traits::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value,
+                 void>
+first_touch(ExecutionPolicy &&policy, Common::Memory<V, 0, 0, InitPadding> &mem,
+            typename V::EntryType value = 0)
+{
+    first_touch(std::forward<ExecutionPolicy>(policy), mem.entries(), mem.entriesCount(),
+                value);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_EXECUTION_H_
+
+// vim: foldmethod=marker
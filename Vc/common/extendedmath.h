@@ -0,0 +1,554 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+-------------------------------------------------------------------
+
+The erf and erfc coefficients are taken from FreeBSD's msun (s_erf.c), which
+carries the following Copyright notice:
+
+Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+
+Developed at SunPro, a Sun Microsystems, Inc. business.
+Permission to use, copy, modify, and distribute this
+software is freely granted, provided that this notice
+is preserved.
+
+}}}*/
+
+#ifdef Vc_COMMON_MATH_H_INTERNAL
+
+namespace Detail
+{
+// enable_if_extended_math {{{1
+template <typename T, typename Abi>
+using enable_if_extended_math =
+    enable_if<std::is_floating_point<T>::value &&
+                  (std::is_same<Abi, VectorAbi::Sse>::value ||
+                   std::is_same<Abi, VectorAbi::Avx>::value),
+              Vector<T, Abi>>;
+
+// horner {{{1
+// Evaluates c[0] + c[1] x + ... + c[N-1] xᴺ⁻¹.
+template <typename V, std::size_t N>
+Vc_INTRINSIC V horner(const V &x, const typename V::EntryType (&c)[N])
+{
+    V r = c[N - 1];
+    for (std::size_t i = N - 1; i > 0; --i) {
+        r = r * x + c[i - 1];
+    }
+    return r;
+}
+
+// expm1Series {{{1
+// The Taylor series of eˣ - 1, sufficient for |x| ≤ ½ln(2).
+template <typename V> Vc_INTRINSIC V expm1Series(const V &x, double)
+{
+    const double c[] = {1. / 2,         1. / 6,          1. / 24,         1. / 120,
+                        1. / 720,       1. / 5040,       1. / 40320,      1. / 362880,
+                        1. / 3628800,   1. / 39916800,   1. / 479001600,  1. / 6227020800.};
+    return x + x * x * horner(x, c);
+}
+template <typename V> Vc_INTRINSIC V expm1Series(const V &x, float)
+{
+    const float c[] = {1.f / 2, 1.f / 6, 1.f / 24, 1.f / 120, 1.f / 720, 1.f / 5040};
+    return x + x * x * horner(x, c);
+}
+
+// sinhSeries {{{1
+// The Taylor series of sinh(x), sufficient for |x| < 1.
+template <typename V> Vc_INTRINSIC V sinhSeries(const V &x, double)
+{
+    const double c[] = {1. / 6,           1. / 120,          1. / 5040,
+                        1. / 362880,      1. / 39916800,     1. / 6227020800.,
+                        1. / 1307674368000., 1. / 355687428096000., 1. / 121645100408832000.};
+    const V x2 = x * x;
+    return x + x * x2 * horner(x2, c);
+}
+template <typename V> Vc_INTRINSIC V sinhSeries(const V &x, float)
+{
+    const float c[] = {1.f / 6, 1.f / 120, 1.f / 5040, 1.f / 362880, 1.f / 39916800};
+    const V x2 = x * x;
+    return x + x * x2 * horner(x2, c);
+}
+
+// halfLargeExp {{{1
+// Returns ½eˣ without overflowing for ln(max) < x < ln(2 max).
+template <typename V> Vc_INTRINSIC V halfLargeExp(const V &x)
+{
+    using T = typename V::EntryType;
+    const V e = exp(x * T(0.5));
+    return (e * T(0.5)) * e;
+}
+template <typename T> constexpr T maxLog()
+{
+    return sizeof(T) == 8 ? 709.782712893383973096 : 88.72283905206835;
+}
+
+// erfImpl {{{1
+template <bool Complement, typename T, typename Abi>
+Vector<T, Abi> erfImpl(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using M = typename V::Mask;
+    using C = Detail::Const<T, Abi>;
+    constexpr T erx = 8.45062911510467529297e-01;
+    const V ax = abs(x);
+    const M tiny = ax < T(0.84375);
+    const M around1 = ax >= T(0.84375) && ax < T(1.25);
+    const M tail = !(ax < T(1.25));
+    V r = V::Zero();
+
+    if (any_of(tail)) {
+        // erfc(x) = exp(-x² - 0.5625 + R/S) / x
+        const T ra[] = {-9.86494403484714822705e-03, -6.93858572707181764372e-01,
+                        -1.05586262253232909814e+01, -6.23753324503260060396e+01,
+                        -1.62396669462573470355e+02, -1.84605092906711035994e+02,
+                        -8.12874355063065934246e+01, -9.81432934416914548592e+00};
+        const T sa[] = {1.,
+                        1.96512716674392571292e+01,
+                        1.37657754143519042600e+02,
+                        4.34565877475229228821e+02,
+                        6.45387271733267880336e+02,
+                        4.29008140027567833386e+02,
+                        1.08635005541779435134e+02,
+                        6.57024977031928170135e+00,
+                        -6.04244152148580987438e-02};
+        const T rb[] = {-9.86494292470009928597e-03, -7.99283237680523006574e-01,
+                        -1.77579549177547519889e+01, -1.60636384855821916062e+02,
+                        -6.37566443368389627722e+02, -1.02509513161107724954e+03,
+                        -4.83519191608651397019e+02};
+        const T sb[] = {1.,
+                        3.03380607434824582924e+01,
+                        3.25792512996573918826e+02,
+                        1.53672958608443695994e+03,
+                        3.19985821950859553908e+03,
+                        2.55305040643316442583e+03,
+                        4.74528541206955367215e+02,
+                        -2.24409524465858183362e+01};
+        // beyond the clamp erfc(x) underflows, which also takes care of x = ∞
+        const V a = min(ax, V(sizeof(T) == 8 ? T(28) : T(10.5)));
+        const V s = T(1) / (a * a);
+        const M nearTail = a < T(1 / 0.35);
+        V q;
+        if (all_of(nearTail)) {
+            q = horner(s, ra) / horner(s, sa);
+        } else if (none_of(nearTail)) {
+            q = horner(s, rb) / horner(s, sb);
+        } else {
+            q = iif(nearTail, horner(s, ra) / horner(s, sa), horner(s, rb) / horner(s, sb));
+        }
+        // -a² is evaluated as -z² + (z - a)(z + a), where z is a with the low mantissa bits
+        // cleared such that -z² - 0.5625 is exact
+        const V z = Detail::operator&(a, C::highMask(sizeof(T) == 8 ? 32 : 13));
+        const V e = exp(-z * z - T(0.5625)) * exp((z - a) * (z + a) + q) / a;
+        if (Complement) {
+            r(tail) = iif(x > 0, e, T(2) - e);
+        } else {
+            r(tail) = copysign(T(1) - e, x);
+        }
+    }
+    if (any_of(around1)) {
+        // erf(1 + s) = erx + P/Q
+        const T pa[] = {-2.36211856075265944077e-03, 4.14856118683748331666e-01,
+                        -3.72207876035701323847e-01, 3.18346619901161753674e-01,
+                        -1.10894694282396677476e-01, 3.54783043256182359371e-02,
+                        -2.16637559486879084300e-03};
+        const T qa[] = {1.,
+                        1.06420880400844228286e-01,
+                        5.40397917702171048937e-01,
+                        7.18286544141962662868e-02,
+                        1.26171219808761642112e-01,
+                        1.36370839120290507362e-02,
+                        1.19844998467991074170e-02};
+        const V s = ax - T(1);
+        const V pq = horner(s, pa) / horner(s, qa);
+        if (Complement) {
+            r(around1) = iif(x >= 0, (T(1) - erx) - pq, (T(1) + erx) + pq);
+        } else {
+            r(around1) = copysign(erx + pq, x);
+        }
+    }
+    if (any_of(tiny)) {
+        // erf(x) = x + x·P/Q(x²)
+        const T pp[] = {1.28379167095512558561e-01, -3.25042107247001499370e-01,
+                        -2.84817495755985104766e-02, -5.77027029648944159157e-03,
+                        -2.37630166566501626084e-05};
+        const T qq[] = {1.,
+                        3.97917223959155352819e-01,
+                        6.50222499887672944485e-02,
+                        5.08130628187576562776e-03,
+                        1.32494738004321644526e-04,
+                        -3.96022827877536812320e-06};
+        const V z = x * x;
+        const V y = x * (horner(z, pp) / horner(z, qq));
+        if (Complement) {
+            r(tiny) = iif(x < T(0.25), T(1) - (x + y), T(0.5) - (y + (x - T(0.5))));
+        } else {
+            r(tiny) = x + y;
+        }
+    }
+    r(isnan(x)) = x;
+    return r;
+}
+
+// powFixup {{{1
+// Applies the special cases of C99 Annex F to r = |x|ʸ.
+template <typename V> V powFixup(const V &x, const V &y, V r)
+{
+    using T = typename V::EntryType;
+    constexpr T inf = std::numeric_limits<T>::infinity();
+    const V ax = abs(x);
+    const V halfY = y * T(0.5);
+    const auto yInt = floor(y) == y;
+    const auto yOdd = yInt && floor(halfY) != halfY;
+
+    r(ax == 0) = iif(y < 0, V(inf), V::Zero());
+    r(isinf(ax)) = iif(y < 0, V::Zero(), V(inf));
+    r(isinf(y)) = iif((ax > 1 && y > 0) || (ax < 1 && y < 0), V(inf), V::Zero());
+    r(isinf(y) && ax == 1) = T(1);
+    r(isnegative(x) && yOdd) = -r;
+    r.setQnan(x < 0 && isfinite(x) && !yInt);
+    r.setQnan(isnan(x) || isnan(y));
+    r(y == 0 || x == 1) = T(1);
+    return r;
+}
+
+// logHiLo {{{1
+// Returns log(a) for finite a > 0 as the unevaluated sum of the return value and lo.
+template <typename Abi>
+Vector<double, Abi> logHiLo(Vector<double, Abi> a, Vector<double, Abi> &lo)
+{
+    using V = Vector<double, Abi>;
+    using C = Detail::Const<double, Abi>;
+
+    const auto denormal = a <= C::min();
+    a(denormal) *= V(Vc::Detail::doubleConstant<1, 0, 54>());  // 2⁵⁴
+    V k = Detail::exponent(a.data());
+    k(denormal) -= 54;
+    a.setZero(C::exponentMask());
+    a = Detail::operator|(a, C::_1_2());  // a ∈ [½, 1[
+    const auto small = a < C::_1_sqrt2();
+    a(small) += a;  // a ∈ [√½, √2[
+    k(!small) += 1;
+
+    // log(a) = 2 atanh(s) with s = (a - 1) / (a + 1), |s| < 0.172
+    const V f = a - 1.;
+    const V u = f + 2.;
+    const V uLo = f - (u - 2.);
+    const V s = f / u;
+    const V sLo = (fma(-s, u, f) - s * uLo) / u;
+    const V s2 = s * s;
+    const double atanhCoeff[] = {2. / 3,  2. / 5,  2. / 7,  2. / 9,  2. / 11, 2. / 13,
+                                 2. / 15, 2. / 17, 2. / 19, 2. / 21, 2. / 23};
+    const V t = s * s2 * horner(s2, atanhCoeff);
+    const V s2x = s + s;
+    V hi = s2x + (sLo + sLo + t);
+    lo = (sLo + sLo + t) - (hi - s2x);
+
+    // + k·ln(2), with k·ln2Hi exact
+    const V kHi = k * 6.93147180369123816490e-01;
+    const V sum = kHi + hi;
+    const V b = sum - kHi;
+    lo += (kHi - (sum - b)) + (hi - b) + k * 1.90821492927058770002e-10;
+    hi = sum + lo;
+    lo -= hi - sum;
+    return hi;
+}
+
+// powPositive {{{1
+// Returns aʸ for finite a > 0, computed as exp(y log(a)) with log(a) in double-double
+// precision.
+template <typename Abi>
+Vector<double, Abi> powPositive(const Vector<double, Abi> &a, const Vector<double, Abi> &y)
+{
+    using V = Vector<double, Abi>;
+    V lo;
+    const V hi = logHiLo(a, lo);
+    const V p = y * hi;
+    V pLo = fma(y, hi, -p) + y * lo;
+    const V e = exp(p);
+    V r = e + e * pLo;
+
+    // exp underflows for subnormal results: compute them scaled by 2⁶⁴ instead
+    const auto subnormal = p < -708.;
+    if (any_of(subnormal)) {
+        const V c = 64 * 6.93147180369123816490e-01;
+        const V q = p + c;
+        const V b = q - p;
+        pLo += (p - (q - b)) + (c - b) + 64 * 1.90821492927058770002e-10;
+        const V eq = exp(q);
+        r(subnormal) = (eq + eq * pLo) * Vc::Detail::doubleConstant<1, 0, -64>();
+    }
+    return r;
+}
+template <typename Abi>
+Vector<float, Abi> powPositive(const Vector<float, Abi> &a, const Vector<float, Abi> &y)
+{
+    using V = Vector<float, Abi>;
+    using D = SimdArray<double, V::Size>;
+    return simd_cast<V>(exp(simd_cast<D>(y) * log(simd_cast<D>(a))));
+}
+//}}}1
+}  // namespace Detail
+
+// expm1 {{{1
+/**
+ * \ingroup Math
+ * Returns eˣ - 1, accurate also for \p x close to 0.
+ */
+template <typename T, typename Abi>
+inline Detail::enable_if_extended_math<T, Abi> expm1(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::Const<T, Abi>;
+    using IV = SimdArray<int, V::Size>;
+    constexpr int digits = std::numeric_limits<T>::digits;
+
+    // eˣ - 1 = 2ᵏ(eʳ - 1) + 2ᵏ - 1 with x = k ln(2) + r and |r| ≤ ½ln(2). Below the
+    // lower bound the result rounds to -1, the upper bound keeps 2ᵏ⁻¹ finite.
+    const V xc = min(max(x, V(T(-(digits + 2) * 0.6931471805599453))),
+                     V(Detail::maxLog<T>()));
+    const V kf = floor(C::log2_e() * xc + T(0.5));
+    const IV k = static_cast<IV>(kf);
+    V r = xc - kf * C::ln2_large();
+    r -= kf * C::ln2_small();
+    const V t = Detail::expm1Series(r, T());
+
+    V result = ldexp(t, k) + (ldexp(V::One(), k) - T(1));
+    const auto big = kf > T(digits + 1);  // 2ᵏ - 1 == 2ᵏ
+    if (any_of(big)) {
+        result(big) = ldexp(t + T(1), k - 1) * T(2);
+    }
+    result(x > Detail::maxLog<T>()) = std::numeric_limits<T>::infinity();
+    result(isnan(x) || x == 0) = x;
+    return result;
+}
+
+// log1p {{{1
+/**
+ * \ingroup Math
+ * Returns ln(1 + x), accurate also for \p x close to 0.
+ */
+template <typename Abi>
+inline Detail::enable_if_extended_math<double, Abi> log1p(const Vector<double, Abi> &x)
+{
+    using V = Vector<double, Abi>;
+    // log(1 + x) = log(u) + c / u, where c is the rounding error of u = 1 + x
+    const V u = x + 1.;
+    const V c = iif(x < 1., x - (u - 1.), 1. - (u - x)) / u;
+    V lo;
+    V r = Detail::logHiLo(u, lo);
+    r += lo + c;
+    r(x == -1.) = -std::numeric_limits<double>::infinity();
+    r(x == 0. || x == std::numeric_limits<double>::infinity()) = x;
+    r.setQnan(x < -1. || isnan(x));
+    return r;
+}
+template <typename Abi>
+inline Detail::enable_if_extended_math<float, Abi> log1p(const Vector<float, Abi> &x)
+{
+    using V = Vector<float, Abi>;
+    return simd_cast<V>(log1p(simd_cast<SimdArray<double, V::Size>>(x)));
+}
+
+// sinh {{{1
+/**
+ * \ingroup Math
+ * Returns the hyperbolic sine of \p x.
+ */
+template <typename T, typename Abi>
+inline Detail::enable_if_extended_math<T, Abi> sinh(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    const V a = abs(x);
+    const auto small = a < T(1);
+    V r;
+    if (all_of(small)) {
+        r = Detail::sinhSeries(a, T());
+    } else {
+        // ½(eᵃ - e⁻ᵃ) = ½(t + t / (t + 1)) with t = eᵃ - 1
+        const V t = expm1(a);
+        r = T(0.5) * (t + t / (t + T(1)));
+        if (any_of(small)) {
+            r(small) = Detail::sinhSeries(a, T());
+        }
+    }
+    const auto big = a > Detail::maxLog<T>();
+    if (any_of(big)) {
+        r(big) = Detail::halfLargeExp(a);
+    }
+    r(isnan(x)) = x;
+    return copysign(r, x);
+}
+
+// cosh {{{1
+/**
+ * \ingroup Math
+ * Returns the hyperbolic cosine of \p x.
+ */
+template <typename T, typename Abi>
+inline Detail::enable_if_extended_math<T, Abi> cosh(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    const V a = abs(x);
+    const V t = expm1(a);
+    const V e = t + T(1);
+    // 1 + t² / 2eᵃ avoids the cancellation of ½(eᵃ + e⁻ᵃ) close to 0
+    V r = iif(a < T(0.6931471805599453), T(1) + t * t / (e + e), T(0.5) * e + T(0.5) / e);
+    const auto big = a > Detail::maxLog<T>();
+    if (any_of(big)) {
+        r(big) = Detail::halfLargeExp(a);
+    }
+    r(isnan(x)) = x;
+    return r;
+}
+
+// tanh {{{1
+/**
+ * \ingroup Math
+ * Returns the hyperbolic tangent of \p x.
+ */
+template <typename T, typename Abi>
+inline Detail::enable_if_extended_math<T, Abi> tanh(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    const V a = abs(x);
+    // for |x| > ln(3)/2: 1 - 2 / (e²ᵃ + 1), otherwise -t / (t + 2) with t = e⁻²ᵃ - 1
+    const auto big = a > T(0.5493061443340548);
+    const V t = expm1(iif(big, a + a, -(a + a)));
+    const V r = iif(big, T(1) - T(2) / (t + T(2)), -t / (t + T(2)));
+    return copysign(r, x);
+}
+
+// erf / erfc {{{1
+/**
+ * \ingroup Math
+ * Returns the error function of \p x.
+ */
+template <typename T, typename Abi>
+inline Detail::enable_if_extended_math<T, Abi> erf(const Vector<T, Abi> &x)
+{
+    return Detail::erfImpl<false, T, Abi>(x);
+}
+
+/**
+ * \ingroup Math
+ * Returns the complementary error function of \p x, i.e. 1 - erf(x) without the
+ * cancellation for large \p x.
+ */
+template <typename T, typename Abi>
+inline Detail::enable_if_extended_math<T, Abi> erfc(const Vector<T, Abi> &x)
+{
+    return Detail::erfImpl<true, T, Abi>(x);
+}
+
+// cbrt {{{1
+/**
+ * \ingroup Math
+ * Returns the cube root of \p x.
+ */
+template <typename T, typename Abi>
+inline Detail::enable_if_extended_math<T, Abi> cbrt(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::Const<T, Abi>;
+    using IV = SimdArray<int, V::Size>;
+
+    V a = abs(x);
+    const auto denormal = a <= C::min();
+    a(denormal) *= V(Vc::Detail::doubleConstant<1, 0, 54>());  // 2⁵⁴
+
+    // a = m · 2³ⁿ with m ∈ [1, 8[
+    const V n = floor(V(Detail::exponent(a.data())) / T(3));
+    const V m = ldexp(a, static_cast<IV>(n * T(-3)));
+
+    // cubic fit with 1.4% relative error, followed by two Halley iterations
+    V y = ((T(0.001918169139128443) * m - T(0.03751968702531348)) * m +
+           T(0.34013292196929207)) * m + T(0.7089776628170528);
+    for (int i = 0; i < 2; ++i) {
+        const V y3 = y * y * y;
+        y *= (y3 + m + m) / (y3 + y3 + m);
+    }
+    // a final Newton step with the residual y³ - m evaluated in extended precision
+    const V y2 = y * y;
+    const V y3 = y2 * y;
+    const V residual = (y3 - m) + (fma(y2, y, -y3) + fma(y, y, -y2) * y);
+    y -= residual / (T(3) * y2);
+
+    y = ldexp(y, static_cast<IV>(n));
+    y(denormal) *= V(Vc::Detail::doubleConstant<1, 0, -18>());  // ∛2⁻⁵⁴
+    y = copysign(y, x);
+    y(x == 0 || !isfinite(x)) = x;
+    return y;
+}
+
+// hypot {{{1
+/**
+ * \ingroup Math
+ * Returns √(x² + y²) without undue overflow or underflow.
+ */
+template <typename T, typename Abi>
+inline Detail::enable_if_extended_math<T, Abi> hypot(const Vector<T, Abi> &x,
+                                                      const Vector<T, Abi> &y)
+{
+    using V = Vector<T, Abi>;
+    using IV = SimdArray<int, V::Size>;
+    const V ax = abs(x);
+    const V ay = abs(y);
+    const V hi = max(ax, ay);
+    const V lo = min(ax, ay);
+    // scale hi to [1, 2[ by an exact power of two, the clamp keeps the scale factors
+    // normal (subnormal and huge hi are then only scaled partially, which suffices)
+    constexpr T limit = sizeof(T) == 8 ? 1000 : 100;
+    const V e = min(max(V(Detail::exponent(hi.data())), V(-limit)), V(limit));
+    const IV k = static_cast<IV>(e);
+    const V down = ldexp(V::One(), -k);
+    const V hs = hi * down;
+    const V ls = lo * down;
+    V r = sqrt(fma(hs, hs, ls * ls)) * ldexp(V::One(), k);
+    r.setQnan(isnan(x) || isnan(y));
+    r(isinf(x) || isinf(y)) = std::numeric_limits<T>::infinity();
+    return r;
+}
+
+// pow {{{1
+/**
+ * \ingroup Math
+ * Returns \p x raised to the power \p y, including the special cases of std::pow.
+ *
+ * The double precision result is computed as exp(y · log(x)) with log(x) in
+ * double-double precision, the single precision result is computed in double precision.
+ */
+template <typename T, typename Abi>
+inline Detail::enable_if_extended_math<T, Abi> pow(const Vector<T, Abi> &x,
+                                                    const Vector<T, Abi> &y)
+{
+    return Detail::powFixup(x, y, Detail::powPositive(abs(x), y));
+}
+//}}}1
+
+#endif  // Vc_COMMON_MATH_H_INTERNAL
+
+// vim: foldmethod=marker
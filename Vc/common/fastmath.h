@@ -0,0 +1,321 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+-------------------------------------------------------------------
+
+The double precision log, sin, and cos coefficients are taken from FreeBSD's msun
+(e_log.c, k_sin.c, k_cos.c), which carries the following Copyright notice:
+
+Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+
+Developed at SunPro, a Sun Microsystems, Inc. business.
+Permission to use, copy, modify, and distribute this
+software is freely granted, provided that this notice
+is preserved.
+
+}}}*/
+
+#ifdef Vc_COMMON_MATH_H_INTERNAL
+
+namespace Detail
+{
+// fastReciprocal {{{1
+// The hardware approximation of 1/x refined by one Newton-Raphson step (≈ 22 bits).
+template <typename Abi>
+Vc_INTRINSIC Vector<float, Abi> fastReciprocal(const Vector<float, Abi> &x)
+{
+    const Vector<float, Abi> r = reciprocal(x);
+    return r * (2.f - x * r);
+}
+
+// fastExpSeries {{{1
+// Minimax polynomial for eˣ with |x| ≤ ½ln(2), one degree less than the one used by exp(x).
+template <typename V> Vc_INTRINSIC V fastExpSeries(const V &x)
+{
+    const float c[] = {4.99992316e-1f, 1.66671146e-1f, 4.18901466e-2f, 8.31252135e-3f};
+    return x * x * horner(x, c) + x + 1.f;
+}
+
+// fastLogTail {{{1
+// Returns ln(1 + x) - x for √½ - 1 ≤ x < √2 - 1.
+template <typename V> Vc_INTRINSIC V fastLogTail(const V &x, float)
+{
+    // minimax polynomial, three degrees less than the one used by log(x)
+    const float c[] = {-0.5f,           3.33342457e-1f, -2.49832669e-1f, 1.99245035e-1f,
+                       -1.71371272e-1f, 1.60243806e-1f, -1.01917291e-1f};
+    return x * x * horner(x, c);
+}
+template <typename V> Vc_INTRINSIC V fastLogTail(const V &x, double)
+{
+    // ln(1 + x) = 2 atanh(s) with s = x / (2 + x)
+    const double c[] = {6.666666666666735130e-01, 3.999999999940941908e-01,
+                        2.857142874366239149e-01, 2.222219843214978396e-01,
+                        1.818357216161805012e-01, 1.531383769920937332e-01,
+                        1.479819860511658591e-01};
+    const V s = x / (2. + x);
+    const V z = s * s;
+    const V hfsq = 0.5 * x * x;
+    return s * (hfsq + z * horner(z, c)) - hfsq;
+}
+
+// fastSinSeries / fastCosSeries {{{1
+// Minimax polynomials for sin(x) and cos(x) with |x| ≤ ¼π.
+template <typename V> Vc_INTRINSIC V fastSinSeries(const V &x, float)
+{
+    const float c[] = {-1.66666546e-1f, 8.33216076e-3f, -1.95152832e-4f};
+    const V x2 = x * x;
+    return x * x2 * horner(x2, c) + x;
+}
+template <typename V> Vc_INTRINSIC V fastSinSeries(const V &x, double)
+{
+    const double c[] = {-1.66666666666666324348e-01, 8.33333333332248946124e-03,
+                        -1.98412698298579493134e-04, 2.75573137070700676789e-06,
+                        -2.50507602534068634195e-08, 1.58969099521155010221e-10};
+    const V x2 = x * x;
+    return x * x2 * horner(x2, c) + x;
+}
+template <typename V> Vc_INTRINSIC V fastCosSeries(const V &x, float)
+{
+    const float c[] = {-0.5f, 4.16610713e-2f, -1.36487143e-3f};
+    const V x2 = x * x;
+    return x2 * horner(x2, c) + 1.f;
+}
+template <typename V> Vc_INTRINSIC V fastCosSeries(const V &x, double)
+{
+    const double c[] = {-0.5,
+                        4.16666666666666019037e-02,
+                        -1.38888888888741095749e-03,
+                        2.48015872894767294178e-05,
+                        -2.75573143513906633035e-07,
+                        2.08757232129817482790e-09,
+                        -1.13596475577881948265e-11};
+    const V x2 = x * x;
+    return x2 * horner(x2, c) + 1.;
+}
+
+// fastFold {{{1
+// Reduces x to r = x - q·½π with q = round(x / ½π). The products of q with the leading
+// parts of ½π are exact for |q| < 2¹¹ (float) and |q| < 2²⁹ (double).
+template <typename V> struct FastFolded {
+    V x, q;
+};
+template <typename Abi>
+Vc_INTRINSIC FastFolded<Vector<float, Abi>> fastFold(const Vector<float, Abi> &x)
+{
+    using V = Vector<float, Abi>;
+    const V q = round(x * floatConstant<1, 0x22F983, -1>());  // 2/π
+    V r = x - q * floatConstant<1, 0x491000, 0>();
+    r -= q * floatConstant<-1, 0x157000, -18>();
+    r -= q * floatConstant<-1, 0x6F4B9F, -31>();
+    return {r, q};
+}
+template <typename Abi>
+Vc_INTRINSIC FastFolded<Vector<double, Abi>> fastFold(const Vector<double, Abi> &x)
+{
+    using V = Vector<double, Abi>;
+    const V q = round(x * doubleConstant<1, 0x45F306DC9C883, -1>());  // 2/π
+    V r = x - q * doubleConstant<1, 0x921FB40000000, 0>();
+    r -= q * doubleConstant<1, 0x4442D00000000, -24>();
+    r -= q * doubleConstant<1, 0x8469898CC5170, -48>();
+    return {r, q};
+}
+
+// isOdd {{{1
+// Returns whether the integral values in q are odd, without a conversion to integers.
+template <typename V> Vc_INTRINSIC typename V::Mask isOdd(const V &q)
+{
+    using T = typename V::EntryType;
+    return floor(q * T(0.5)) * T(2) != q;
+}
+
+}  // namespace Detail
+
+// exp {{{1
+/**
+ * \ingroup Math
+ * Returns eˣ with reduced precision, see Vc::fast_math.
+ *
+ * \note The single-precision implementation has a precision of max. 3 ulp. Results in the
+ * subnormal range are flushed to zero and the result for NaN inputs is unspecified.
+ * \note The double-precision implementation is exp(x). Its Padé approximation is cheaper
+ * than a polynomial of sufficient degree without the division.
+ */
+template <typename Abi>
+inline Detail::enable_if_extended_math<float, Abi> exp(const Vector<float, Abi> &x,
+                                                        FastMathTag)
+{
+    using V = Vector<float, Abi>;
+    using C = Detail::Const<float, Abi>;
+    const V kf = round(x * C::log2_e());
+    V r = x - kf * C::ln2_large();
+    r -= kf * C::ln2_small();
+    V result = ldexp(Detail::fastExpSeries(r), static_cast<SimdArray<int, V::Size>>(kf));
+    result.setZero(x < -87.33654475f);  // ln of the smallest normalized number
+    result(x > Detail::maxLog<float>()) = std::numeric_limits<float>::infinity();
+    return result;
+}
+template <typename Abi>
+inline Detail::enable_if_extended_math<double, Abi> exp(const Vector<double, Abi> &x,
+                                                         FastMathTag)
+{
+    return exp(x);
+}
+
+// log {{{1
+/**
+ * \ingroup Math
+ * Returns the natural logarithm of \p x with reduced precision, see Vc::fast_math.
+ *
+ * \note The single-precision implementation has a precision of max. 5 ulp, the
+ * double-precision implementation of max. 1 ulp.
+ * \note Only positive normalized numbers, zero (-∞), and negative numbers (NaN) are
+ * supported. The result for subnormal, infinite, and NaN inputs is unspecified.
+ */
+template <typename T, typename Abi>
+inline Detail::enable_if_extended_math<T, Abi> log(const Vector<T, Abi> &x, FastMathTag)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::Const<T, Abi>;
+    V m = x;
+    V e = Detail::exponent(m.data());
+    m.setZero(C::exponentMask());
+    m = Detail::operator|(m, C::_1_2());  // m ∈ [½, 1[
+    e(m >= C::_1_sqrt2()) += V::One();
+    m(m < C::_1_sqrt2()) += m;
+    m -= V::One();  // m ∈ [√½ - 1, √2 - 1[
+
+    V r = Detail::fastLogTail(m, T()) + e * C::ln2_small();
+    r = (m + r) + e * C::ln2_large();
+    r(x == V::Zero()) = -std::numeric_limits<T>::infinity();
+    r.setQnan(x < V::Zero());
+    return r;
+}
+
+// sin / cos / sincos {{{1
+/**
+ * \ingroup Math
+ * Returns the sine of \p x with reduced precision, see Vc::fast_math.
+ *
+ * The argument reduction is only valid for |x| < 3216 (float) or |x| < 8.4e8 (double).
+ * For |x| ≤ ¼π the precision is max. 3 ulp (float) or 2 ulp (double), elsewhere the
+ * absolute error is max. 1.5 ε (float) or 1 ε (double).
+ */
+template <typename T, typename Abi>
+inline Detail::enable_if_extended_math<T, Abi> sin(const Vector<T, Abi> &x, FastMathTag)
+{
+    using V = Vector<T, Abi>;
+    // quadrant (q mod 4) | 0   | 1   | 2    | 3
+    // sin(x)             | sin | cos | -sin | -cos
+    const auto f = Detail::fastFold(x);
+    V r = iif(Detail::isOdd(f.q), Detail::fastCosSeries(f.x, T()),
+              Detail::fastSinSeries(f.x, T()));
+    r(Detail::isOdd(floor(f.q * T(0.5)))) = -r;
+    return r;
+}
+
+/**
+ * \ingroup Math
+ * Returns the cosine of \p x with reduced precision, see Vc::fast_math.
+ *
+ * The precision and domain are the same as for sin(x, fast_math).
+ */
+template <typename T, typename Abi>
+inline Detail::enable_if_extended_math<T, Abi> cos(const Vector<T, Abi> &x, FastMathTag)
+{
+    using V = Vector<T, Abi>;
+    // quadrant (q mod 4) | 0   | 1    | 2    | 3
+    // cos(x)             | cos | -sin | -cos | sin
+    const auto f = Detail::fastFold(x);
+    V r = iif(Detail::isOdd(f.q), Detail::fastSinSeries(f.x, T()),
+              Detail::fastCosSeries(f.x, T()));
+    r(Detail::isOdd(floor((f.q + T(1)) * T(0.5)))) = -r;
+    return r;
+}
+
+/**
+ * \ingroup Math
+ * Determines sine and cosine of \p x with reduced precision, see Vc::fast_math.
+ *
+ * The precision and domain are the same as for sin(x, fast_math).
+ */
+template <typename T, typename Abi>
+inline void sincos(const Vector<T, Abi> &x, Detail::enable_if_extended_math<T, Abi> *sin,
+                   Vector<T, Abi> *cos, FastMathTag)
+{
+    using V = Vector<T, Abi>;
+    const auto f = Detail::fastFold(x);
+    const V s = Detail::fastSinSeries(f.x, T());
+    const V c = Detail::fastCosSeries(f.x, T());
+    const auto odd = Detail::isOdd(f.q);
+    *sin = iif(odd, c, s);
+    *cos = iif(odd, s, c);
+    (*sin)(Detail::isOdd(floor(f.q * T(0.5)))) = -*sin;
+    (*cos)(Detail::isOdd(floor((f.q + T(1)) * T(0.5)))) = -*cos;
+}
+
+// atan2 {{{1
+/**
+ * \ingroup Math
+ * Returns the arc tangent of \p y / \p x with reduced precision, see Vc::fast_math.
+ *
+ * The single-precision implementation replaces the divisions by a refined reciprocal
+ * approximation and has a precision of max. 4 ulp. Signed zeros are handled as by
+ * atan2(y, x), infinite inputs are not supported. The double-precision implementation is
+ * atan2(y, x).
+ */
+template <typename Abi>
+inline Detail::enable_if_extended_math<float, Abi> atan2(const Vector<float, Abi> &y,
+                                                          const Vector<float, Abi> &x,
+                                                          FastMathTag)
+{
+    using V = Vector<float, Abi>;
+    using C = Detail::Const<float, Abi>;
+    const V ax = abs(x);
+    const V ay = abs(y);
+    const V hi = max(ax, ay);
+    V a = min(ax, ay) * Detail::fastReciprocal(hi);  // a ∈ [0, 1]
+    a.setZero(hi == V::Zero());
+
+    // minimax polynomial for atan(a) with a ∈ [0, 1]
+    const float c[] = {-3.33323916e-1f, 1.99742141e-1f,  -1.40413277e-1f, 9.96847295e-2f,
+                       -6.02031281e-2f, 2.47340619e-2f, -4.82253386e-3f};
+    const V a2 = a * a;
+    V r = a * a2 * Detail::horner(a2, c) + a;
+    r(ay > ax) = C::_pi_2() - r;
+    r(isnegative(x)) = C::_pi() - r;
+    return copysign(r, y);
+}
+template <typename Abi>
+inline Detail::enable_if_extended_math<double, Abi> atan2(const Vector<double, Abi> &y,
+                                                           const Vector<double, Abi> &x,
+                                                           FastMathTag)
+{
+    return atan2(y, x);
+}
+//}}}1
+
+#endif  // Vc_COMMON_MATH_H_INTERNAL
+
+// vim: foldmethod=marker
@@ -39,13 +39,15 @@ enum class GatherScatterImplementation : int {
     SimpleLoop,
     SetIndexZero,
     BitScanLoop,
-    PopcntSwitch
+    PopcntSwitch,
+    HardwareGather  ///< masked gather instruction; implemented by the AVX2 backend only
 };
 
 using SimpleLoopT   = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::SimpleLoop>;
 using SetIndexZeroT = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::SetIndexZero>;
 using BitScanLoopT  = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::BitScanLoop>;
 using PopcntSwitchT = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::PopcntSwitch>;
+using HardwareGatherT = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::HardwareGather>;
 
 template <typename V, typename MT, typename IT>
 Vc_ALWAYS_INLINE void executeGather(SetIndexZeroT,
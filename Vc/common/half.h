@@ -0,0 +1,213 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_HALF_H_
+#define VC_COMMON_HALF_H_
+
+#include <cstring>
+#include <type_traits>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// scalar conversions {{{1
+Vc_INTRINSIC unsigned int floatBits(float x)
+{
+    unsigned int r;
+    std::memcpy(&r, &x, sizeof(r));
+    return r;
+}
+Vc_INTRINSIC float bitsToFloat(unsigned int x)
+{
+    float r;
+    std::memcpy(&r, &x, sizeof(r));
+    return r;
+}
+
+/**\internal
+ * Converts IEEE 754 binary16 bits to float. Exact for all inputs (including subnormals,
+ * infinities and NaNs).
+ */
+Vc_INTRINSIC float float16ToFloat(unsigned short h)
+{
+    const unsigned int expMask = 0x7c00u << 13;
+    unsigned int o = (h & 0x7fffu) << 13;
+    const unsigned int exp = o & expMask;
+    o += (127 - 15) << 23;
+    if (exp == expMask) {  // Inf/NaN
+        o += (128 - 16) << 23;
+    } else if (exp == 0) {  // zero/subnormal: renormalize via a float subtraction
+        o = floatBits(bitsToFloat(o + (1u << 23)) - bitsToFloat(113u << 23));
+    }
+    return bitsToFloat(o | ((h & 0x8000u) << 16));
+}
+
+/**\internal
+ * Converts float to IEEE 754 binary16 bits, rounding to nearest even. Values that are too
+ * large become infinities, NaNs stay (quiet) NaNs.
+ */
+Vc_INTRINSIC unsigned short floatToFloat16(float x)
+{
+    const unsigned int denormMagic = ((127 - 15) + (23 - 10) + 1) << 23;
+    unsigned int f = floatBits(x);
+    const unsigned int sign = f & 0x80000000u;
+    f ^= sign;
+    unsigned int o;
+    if (f >= ((127 + 16) << 23)) {  // overflow, Inf or NaN
+        o = f > (255u << 23) ? 0x7e00u : 0x7c00u;
+    } else if (f < (113u << 23)) {  // result is subnormal or zero
+        o = floatBits(bitsToFloat(f) + bitsToFloat(denormMagic)) - denormMagic;
+    } else {
+        const unsigned int mantOdd = (f >> 13) & 1;
+        o = (f - ((127u - 15) << 23) + 0xfff + mantOdd) >> 13;
+    }
+    return static_cast<unsigned short>(o | (sign >> 16));
+}
+
+/**\internal
+ * Converts bfloat16 bits to float. bfloat16 is the upper half of a float, thus this is
+ * exact.
+ */
+Vc_INTRINSIC float bfloat16ToFloat(unsigned short h)
+{
+    return bitsToFloat(static_cast<unsigned int>(h) << 16);
+}
+
+/**\internal
+ * Converts float to bfloat16 bits, rounding to nearest even. NaNs are made quiet so that
+ * truncation cannot turn them into infinities.
+ */
+Vc_INTRINSIC unsigned short floatToBfloat16(float x)
+{
+    const unsigned int f = floatBits(x);
+    if ((f & 0x7fffffffu) > 0x7f800000u) {
+        return static_cast<unsigned short>((f >> 16) | 0x40);
+    }
+    return static_cast<unsigned short>((f + 0x7fff + ((f >> 16) & 1)) >> 16);
+}
+//}}}1
+}  // namespace Detail
+
+// float16 {{{1
+/**
+ * \ingroup Utilities
+ *
+ * Storage type for IEEE 754 half-precision (binary16) values.
+ *
+ * There is no arithmetic on float16. It converts implicitly from and to \c float and is
+ * meant to be used as the memory type of float vector loads and stores:
+ * \code
+ * const Vc::float16 *weights = ...;
+ * Vc::float_v w(&weights[i], Vc::Unaligned);  // converts 8/16 halfs to float_v
+ * (w * x).store(&out[i], Vc::Unaligned);      // Vc::float16 *out: rounds to nearest
+ * \endcode
+ * Such loads read only half the bytes a float load reads. With F16C enabled (e.g.
+ * `-mf16c` or `-march=ivybridge` and later) the conversions compile to \c vcvtph2ps and \c
+ * vcvtps2ph; otherwise a branch-free integer sequence is used.
+ *
+ * \see bfloat16, HalfMemory
+ */
+struct float16 {
+    /// The IEEE 754 binary16 representation.
+    unsigned short bits;
+
+    float16() = default;
+    /// Converts \p x to half-precision, rounding to nearest even.
+    Vc_INTRINSIC float16(float x) : bits(Detail::floatToFloat16(x)) {}
+    /// Converts to single-precision. This conversion is exact.
+    Vc_INTRINSIC operator float() const { return Detail::float16ToFloat(bits); }
+
+    /// Returns the float16 with the binary representation \p b.
+    static Vc_INTRINSIC float16 fromBits(unsigned short b)
+    {
+        float16 r;
+        r.bits = b;
+        return r;
+    }
+};
+
+// bfloat16 {{{1
+/**
+ * \ingroup Utilities
+ *
+ * Storage type for bfloat16 values, i.e. the upper 16 bits of an IEEE 754 \c float
+ * (8 exponent bits, 7 mantissa bits).
+ *
+ * Like float16 it is only meant as a memory type for float vector loads and stores.
+ * Loading is a zero-extension plus shift; storing rounds to nearest even.
+ *
+ * \see float16, HalfMemory
+ */
+struct bfloat16 {
+    /// The upper 16 bits of the corresponding float.
+    unsigned short bits;
+
+    bfloat16() = default;
+    /// Converts \p x to bfloat16, rounding to nearest even.
+    Vc_INTRINSIC bfloat16(float x) : bits(Detail::floatToBfloat16(x)) {}
+    /// Converts to single-precision. This conversion is exact.
+    Vc_INTRINSIC operator float() const { return Detail::bfloat16ToFloat(bits); }
+
+    /// Returns the bfloat16 with the binary representation \p b.
+    static Vc_INTRINSIC bfloat16 fromBits(unsigned short b)
+    {
+        bfloat16 r;
+        r.bits = b;
+        return r;
+    }
+};
+
+static_assert(sizeof(float16) == 2 && sizeof(bfloat16) == 2,
+              "float16 and bfloat16 must be 16-bit types");
+
+namespace Traits
+{
+// is_half_float {{{1
+/// Identifies the 16-bit floating-point storage types float16 and bfloat16.
+template <typename T> struct is_half_float : public std::false_type {};
+template <> struct is_half_float<float16> : public std::true_type {};
+template <> struct is_half_float<bfloat16> : public std::true_type {};
+
+/**\internal
+ * Whether a vector with entries of type \p T can be loaded from or stored to an array of
+ * \p U.
+ */
+template <typename U, typename T>
+struct is_valid_memory_type
+    : public std::integral_constant<bool, std::is_arithmetic<U>::value ||
+                                              (is_half_float<U>::value &&
+                                               std::is_same<T, float>::value)> {
+};
+//}}}1
+}  // namespace Traits
+}  // namespace Vc
+
+#endif  // VC_COMMON_HALF_H_
+
+// vim: foldmethod=marker
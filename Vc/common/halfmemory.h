@@ -0,0 +1,199 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_HALFMEMORY_H_
+#define VC_COMMON_HALFMEMORY_H_
+
+#include <algorithm>
+#include <initializer_list>
+#include "half.h"
+#include "loadstoreflags.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+/**
+ * \ingroup Containers
+ * \headerfile halfmemory.h <Vc/Memory>
+ *
+ * A variant of Memory<V, Size> that stores its entries as 16-bit floats.
+ *
+ * Vector access converts on the fly: reading a vector loads \VSize{float} half-precision
+ * values and widens them to \p V, writing a vector rounds to nearest even. Thus
+ * bandwidth-bound kernels read and write only half the bytes of a Memory<float_v, Size>:
+ * \code
+ * Vc::HalfMemory<float_v, 1000> weights;          // float16 storage
+ * Vc::HalfMemory<float_v, 1000, Vc::bfloat16> x;  // bfloat16 storage
+ * for (size_t i = 0; i < weights.vectorsCount(); ++i) {
+ *     x.vector(i) *= weights.vector(i);
+ * }
+ * \endcode
+ * Like Memory, the storage is aligned and padded to a multiple of \VSize{float} entries so
+ * that the last vector access stays in bounds. The padding is zero-initialized.
+ *
+ * \tparam V A vector type with \c float entries (e.g. float_v).
+ * \tparam Size The number of entries the memory should hold.
+ * \tparam H The storage type: float16 or bfloat16.
+ *
+ * \see Memory, float16, bfloat16
+ */
+template <typename V, std::size_t Size, typename H = float16> class HalfMemory
+{
+    static_assert(std::is_same<typename V::EntryType, float>::value,
+                  "HalfMemory<V, Size> requires a vector of float, e.g. Vc::float_v");
+    static_assert(Traits::is_half_float<H>::value,
+                  "HalfMemory<V, Size, H> requires H to be Vc::float16 or Vc::bfloat16");
+    enum : std::size_t {
+        MaskedSize = Size % V::Size,
+        PaddedSize = MaskedSize == 0 ? Size : Size + V::Size - MaskedSize
+    };
+    alignas(static_cast<std::size_t>(V::MemoryAlignment)) H m_mem[PaddedSize];
+
+public:
+    typedef typename V::EntryType EntryType;
+    /// The 16-bit type the entries are stored as.
+    typedef H StorageType;
+    enum Constants {
+        EntriesCount = Size,
+        VectorsCount = PaddedSize / V::Size
+    };
+
+    /**
+     * The return type of the non-const vector() function. It converts to \p V and allows
+     * (compound) assignment of \p V objects, converting on every access.
+     */
+    class VectorReference
+    {
+        H *const m_ptr;
+
+    public:
+        explicit Vc_INTRINSIC VectorReference(H *ptr) : m_ptr(ptr) {}
+        Vc_INTRINSIC operator V() const { return V(m_ptr, Vc::Aligned); }
+        Vc_INTRINSIC VectorReference &operator=(const V &x)
+        {
+            x.store(m_ptr, Vc::Aligned);
+            return *this;
+        }
+        Vc_INTRINSIC VectorReference &operator=(const VectorReference &x)
+        {
+            return operator=(static_cast<V>(x));
+        }
+#define Vc_OP_(op_)                                                                      \
+    Vc_INTRINSIC VectorReference &operator op_##=(const V &x)                           \
+    {                                                                                    \
+        return operator=(static_cast<V>(*this) op_ x);                                   \
+    }
+        Vc_ALL_ARITHMETICS(Vc_OP_);
+#undef Vc_OP_
+    };
+
+    /// Initializes the padding entries with zero. The other entries are uninitialized.
+    HalfMemory()
+    {
+        std::fill(&m_mem[Size], &m_mem[PaddedSize], H(0.f));
+    }
+
+    /// Converts the values of \p init to \p H and zero-initializes the rest.
+    HalfMemory(std::initializer_list<float> init)
+    {
+        Vc_ASSERT(init.size() <= Size);
+        std::copy(init.begin(), init.end(), &m_mem[0]);
+        std::fill(&m_mem[init.size()], &m_mem[PaddedSize], H(0.f));
+    }
+
+    /**
+     * \return the number of scalar entries in the whole array.
+     *
+     * \note This function can be optimized into a compile-time constant.
+     */
+    static constexpr std::size_t entriesCount() { return EntriesCount; }
+
+    /**
+     * \return the number of vectors in the whole array.
+     *
+     * \note This function can be optimized into a compile-time constant.
+     */
+    static constexpr std::size_t vectorsCount() { return VectorsCount; }
+
+    /// Returns a reference to the \p i-th entry in its 16-bit representation.
+    Vc_ALWAYS_INLINE H &scalar(std::size_t i) { return m_mem[i]; }
+    /// Const overload of the above.
+    Vc_ALWAYS_INLINE const H &scalar(std::size_t i) const { return m_mem[i]; }
+    /// Same as scalar(i).
+    Vc_ALWAYS_INLINE H &operator[](std::size_t i) { return m_mem[i]; }
+    /// Same as scalar(i).
+    Vc_ALWAYS_INLINE const H &operator[](std::size_t i) const { return m_mem[i]; }
+
+    /// Returns the \p i-th vector, converted to \p V.
+    Vc_ALWAYS_INLINE V vector(std::size_t i) const
+    {
+        return V(&m_mem[i * V::Size], Vc::Aligned);
+    }
+    /// Returns a proxy for reading and writing the \p i-th vector.
+    Vc_ALWAYS_INLINE VectorReference vector(std::size_t i)
+    {
+        return VectorReference(&m_mem[i * V::Size]);
+    }
+
+    /**
+     * Returns the \VSize{float} entries starting at entry \p offset, converted to \p V.
+     *
+     * \param offset The entry index of the first vector entry. Need not be a multiple of
+     *               \VSize{float}.
+     */
+    Vc_ALWAYS_INLINE V vectorAt(std::size_t offset) const
+    {
+        return V(&m_mem[offset], Vc::Unaligned);
+    }
+
+    /// Returns a pointer to the start of the (aligned) storage.
+    Vc_ALWAYS_INLINE H *data() { return m_mem; }
+    /// Const overload of the above.
+    Vc_ALWAYS_INLINE const H *data() const { return m_mem; }
+
+    /// Sets all entries, including the padding, to zero.
+    Vc_ALWAYS_INLINE void setZero() { std::fill(&m_mem[0], &m_mem[PaddedSize], H(0.f)); }
+
+    /// Assigns \p v to every vector of the memory.
+    inline HalfMemory &operator=(const V &v)
+    {
+        for (std::size_t i = 0; i < vectorsCount(); ++i) {
+            vector(i) = v;
+        }
+        return *this;
+    }
+};
+}  // namespace Common
+
+using Common::HalfMemory;
+}  // namespace Vc
+
+#endif  // VC_COMMON_HALFMEMORY_H_
+
+// vim: foldmethod=marker
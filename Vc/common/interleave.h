@@ -28,6 +28,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef VC_COMMON_INTERLEAVE_H_
 #define VC_COMMON_INTERLEAVE_H_
 
+#include <array>
+#include <tuple>
+#include <utility>
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -56,6 +59,305 @@ std::pair<V, V> interleave(const V &a, const V &b)
 {
     return {a.interleaveLow(b), a.interleaveHigh(b)};
 }
+
+namespace Detail
+{
+// N-way (de)interleave helpers {{{1
+constexpr bool isPowerOf2(std::size_t x) { return x != 0 && (x & (x - 1)) == 0; }
+constexpr std::size_t ilog2(std::size_t x) { return x <= 1 ? 0 : 1 + ilog2(x / 2); }
+
+/**\internal
+ * Whether interleaveLow/interleaveHigh of \p V implement a complete zip of two vectors,
+ * which is the building block of the shuffle networks below.
+ */
+template <typename V>
+struct has_zip_interleave : public std::integral_constant<bool, isPowerOf2(V::Size)> {
+};
+template <typename T, std::size_t N, typename V, std::size_t M>
+struct has_zip_interleave<SimdArray<T, N, V, M>>
+    : public std::integral_constant<bool, isPowerOf2(N) && N % M == 0> {
+};
+
+/**\internal
+ * Whether `V(const M *, Vc::Unaligned)` converts correctly (cf. tests/load.cpp).
+ */
+template <typename T, typename M>
+struct has_converting_load
+    : public std::integral_constant<
+          bool,
+          std::is_same<T, M>::value ||
+              (std::is_same<T, float>::value &&
+               (std::is_same<M, double>::value || std::is_same<M, int>::value ||
+                std::is_same<M, uint>::value || std::is_same<M, short>::value ||
+                std::is_same<M, ushort>::value || std::is_same<M, schar>::value ||
+                std::is_same<M, uchar>::value)) ||
+              (std::is_same<T, int>::value &&
+               (std::is_same<M, uint>::value || std::is_same<M, short>::value ||
+                std::is_same<M, ushort>::value || std::is_same<M, schar>::value ||
+                std::is_same<M, uchar>::value)) ||
+              (std::is_same<T, uint>::value &&
+               (std::is_same<M, ushort>::value || std::is_same<M, uchar>::value)) ||
+              ((std::is_same<T, short>::value || std::is_same<T, ushort>::value) &&
+               std::is_same<M, uchar>::value)> {
+};
+
+/**\internal
+ * Loads V::Size values of type \p M from \p mem and converts them to V::EntryType.
+ */
+template <typename V, typename M>
+Vc_INTRINSIC V loadConverted(const M *mem, std::true_type)
+{
+    return V(mem, Vc::Unaligned);
+}
+template <typename V, typename M>
+Vc_INTRINSIC V loadConverted(const M *mem, std::false_type)
+{
+    alignas(V::MemoryAlignment) typename V::EntryType tmp[V::Size];
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        tmp[i] = static_cast<typename V::EntryType>(mem[i]);
+    }
+    return V(tmp, Vc::Aligned);
+}
+template <typename V, typename M> Vc_INTRINSIC V loadConverted(const M *mem)
+{
+    return loadConverted<V>(mem,
+                            has_converting_load<typename V::EntryType, M>());
+}
+
+/**\internal
+ * Stores the first \p n values of \p x to \p mem, converted to \p M.
+ */
+template <typename V, typename M>
+Vc_INTRINSIC void storeConverted(const V &x, M *mem, std::size_t n)
+{
+    if (std::is_same<typename V::EntryType, M>::value && n == V::Size) {
+        x.store(reinterpret_cast<typename V::EntryType *>(mem), Vc::Unaligned);
+    } else {
+        alignas(V::MemoryAlignment) typename V::EntryType tmp[V::Size];
+        x.store(tmp, Vc::Aligned);
+        for (std::size_t i = 0; i < n; ++i) {
+            mem[i] = static_cast<M>(tmp[i]);
+        }
+    }
+}
+
+/**\internal
+ * Applies \p Stages rounds of a perfect shuffle to the concatenation of the \p K vectors
+ * in \p x (K a power of two): every round zips the first half of the vectors with the
+ * second half. One round rotates the bits of an entry's index (vector index in the high
+ * bits, lane index in the low bits) left by one. Consequently, ilog2(V::Size) rounds turn
+ * K vectors loaded from V::Size structures with K members into one vector per member,
+ * and ilog2(K) rounds perform the inverse.
+ */
+template <std::size_t J, typename V, std::size_t K>
+Vc_INTRINSIC V zipEntry(const std::array<V, K> &x)
+{
+    return J % 2 == 0 ? x[J / 2].interleaveLow(x[J / 2 + K / 2])
+                      : x[J / 2].interleaveHigh(x[J / 2 + K / 2]);
+}
+template <typename V, std::size_t K, std::size_t... Js>
+Vc_INTRINSIC std::array<V, K> zipRound(const std::array<V, K> &x, index_sequence<Js...>)
+{
+    return {{zipEntry<Js>(x)...}};
+}
+template <std::size_t Stages> struct ZipRounds {
+    template <typename V, std::size_t K>
+    static Vc_INTRINSIC std::array<V, K> apply(const std::array<V, K> &x)
+    {
+        static_assert(isPowerOf2(K), "the zip network requires 2^n vectors");
+        return ZipRounds<Stages - 1>::apply(zipRound(x, make_index_sequence<K>()));
+    }
+};
+template <> struct ZipRounds<0> {
+    template <typename V, std::size_t K>
+    static Vc_INTRINSIC std::array<V, K> apply(const std::array<V, K> &x)
+    {
+        return x;
+    }
+};
+
+template <typename V, typename M, std::size_t N> struct InterleaveStreams {
+    static constexpr std::size_t W = V::Size;
+    static constexpr std::size_t Chunks = (N + W - 1) / W;
+    using T = typename V::EntryType;
+    using Strategy = std::integral_constant<int, !has_zip_interleave<V>::value
+                                                     ? 0
+                                                     : isPowerOf2(N) ? 1 : 2>;
+
+    // deinterleave {{{2
+    template <std::size_t... Ks, typename... Vs>
+    static Vc_INTRINSIC void deinterleave(const M *mem, index_sequence<Ks...> seq,
+                                          Vs &... out)
+    {
+        deinterleave(mem, seq, Strategy(), out...);
+    }
+    // generic fallback
+    template <std::size_t... Ks, typename... Vs>
+    static Vc_INTRINSIC void deinterleave(const M *mem, index_sequence<Ks...>,
+                                          std::integral_constant<int, 0>, Vs &... out)
+    {
+        auto &&unused = {(out = V([&](std::size_t i) { return mem[i * N + Ks]; }), 0)...};
+        if (&unused == &unused) {}
+    }
+    // N is a power of two: load N contiguous vectors and transpose the N x W matrix
+    template <std::size_t... Ks, typename... Vs>
+    static Vc_INTRINSIC void deinterleave(const M *mem, index_sequence<Ks...>,
+                                          std::integral_constant<int, 1>, Vs &... out)
+    {
+        const std::array<V, N> x = ZipRounds<ilog2(W)>::apply(
+            std::array<V, N>{{loadConverted<V>(mem + Ks * W)...}});
+        auto &&unused = {(out = x[Ks], 0)...};
+        if (&unused == &unused) {}
+    }
+    // otherwise: load one (partial) struct per vector and transpose W x W blocks
+    template <std::size_t Offset>
+    static Vc_INTRINSIC V loadRow(const M *mem, std::true_type)
+    {
+        return loadConverted<V>(mem + Offset);
+    }
+    template <std::size_t Offset>
+    static Vc_INTRINSIC V loadRow(const M *mem, std::false_type)
+    {
+        // don't read beyond the last struct
+        return loadConverted<V>(mem + N * W - W).shifted(int(Offset - (N * W - W)));
+    }
+    template <std::size_t C, std::size_t... Is>
+    static Vc_INTRINSIC std::array<V, W> transposedChunk(const M *mem, index_sequence<Is...>)
+    {
+        return ZipRounds<ilog2(W)>::apply(std::array<V, W>{{loadRow<Is * N + C * W>(
+            mem, std::integral_constant<bool, (Is * N + C * W + W <= N * W)>())...}});
+    }
+    template <std::size_t... Cs>
+    static Vc_INTRINSIC std::array<std::array<V, W>, Chunks> transposedChunks(
+        const M *mem, index_sequence<Cs...>)
+    {
+        return {{transposedChunk<Cs>(mem, make_index_sequence<W>())...}};
+    }
+    template <std::size_t... Ks, typename... Vs>
+    static Vc_INTRINSIC void deinterleave(const M *mem, index_sequence<Ks...>,
+                                          std::integral_constant<int, 2>, Vs &... out)
+    {
+        const auto x = transposedChunks(mem, make_index_sequence<Chunks>());
+        auto &&unused = {(out = x[Ks / W][Ks % W], 0)...};
+        if (&unused == &unused) {}
+    }
+
+    // interleave {{{2
+    template <typename... Vs>
+    static Vc_INTRINSIC void interleave(M *mem, const Vs &... in)
+    {
+        interleave(mem, Strategy(), in...);
+    }
+    // generic fallback
+    template <typename... Vs>
+    static Vc_INTRINSIC void interleave(M *mem, std::integral_constant<int, 0>,
+                                        const Vs &... in)
+    {
+        const V *const v[N] = {&in...};
+        for (std::size_t k = 0; k < N; ++k) {
+            for (std::size_t i = 0; i < W; ++i) {
+                mem[i * N + k] = static_cast<M>((*v[k])[i]);
+            }
+        }
+    }
+    // N is a power of two: transpose the W x N matrix and store N contiguous vectors
+    template <typename... Vs>
+    static Vc_INTRINSIC void interleave(M *mem, std::integral_constant<int, 1>,
+                                        const Vs &... in)
+    {
+        const std::array<V, N> x = ZipRounds<ilog2(N)>::apply(std::array<V, N>{{in...}});
+        for (std::size_t j = 0; j < N; ++j) {
+            storeConverted(x[j], mem + j * W, W);
+        }
+    }
+    // otherwise: transpose W x W blocks and store one (partial) struct per vector
+    template <std::size_t C, std::size_t... Ls>
+    static Vc_INTRINSIC std::array<V, W> chunkOf(const std::array<V, Chunks * W> &v,
+                                                 index_sequence<Ls...>)
+    {
+        return ZipRounds<ilog2(W)>::apply(std::array<V, W>{{v[C * W + Ls]...}});
+    }
+    template <std::size_t... Cs>
+    static Vc_INTRINSIC std::array<std::array<V, W>, Chunks> transposedChunks(
+        const std::array<V, Chunks * W> &v, index_sequence<Cs...>)
+    {
+        return {{chunkOf<Cs>(v, make_index_sequence<W>())...}};
+    }
+    template <std::size_t... Pad, typename... Vs>
+    static Vc_INTRINSIC std::array<V, Chunks * W> padded(index_sequence<Pad...>,
+                                                         const Vs &... in)
+    {
+        return {{in..., (void(Pad), V::Zero())...}};
+    }
+    template <std::size_t R>
+    static Vc_INTRINSIC void storeRow(M *mem,
+                                      const std::array<std::array<V, W>, Chunks> &rows)
+    {
+        constexpr std::size_t i = R / Chunks;
+        constexpr std::size_t c = R % Chunks;
+        constexpr std::size_t offset = i * N + c * W;
+        storeConverted(rows[c][i], mem + offset, offset + W <= N * W ? W : N * W - offset);
+    }
+    template <std::size_t... Rs>
+    static Vc_INTRINSIC void storeRows(M *mem,
+                                       const std::array<std::array<V, W>, Chunks> &rows,
+                                       index_sequence<Rs...>)
+    {
+        // Store in ascending address order: every full store spills into the next
+        // struct (or chunk), which is overwritten by the subsequent store.
+        auto &&unused = {(storeRow<Rs>(mem, rows), 0)...};
+        if (&unused == &unused) {}
+    }
+    template <typename... Vs>
+    static Vc_INTRINSIC void interleave(M *mem, std::integral_constant<int, 2>,
+                                        const Vs &... in)
+    {
+        storeRows(mem,
+                  transposedChunks(padded(make_index_sequence<Chunks * W - N>(), in...),
+                                   make_index_sequence<Chunks>()),
+                  make_index_sequence<W * Chunks>());
+    }
+    //}}}2
+};
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Stores the entries of the vectors \p v0, \p vs... to \p memory in interleaved order,
+ * i.e. as an array of `V::Size` structures with `1 + sizeof...(Vs)` (2 to 8) data
+ * members each: `memory[i * N + k] = vk[i]`.
+ *
+ * \param memory Pointer to `N * V::Size` objects of type \p M. No alignment is required.
+ *               If \p M differs from `V::EntryType` the values are converted with a
+ *               `static_cast`.
+ * \param v0, vs The vectors to store. All must have the same type, which may be any
+ *               Vc::Vector or Vc::SimdArray type.
+ *
+ * For a power of two \p N the values are permuted in registers with `ilog2(N)` rounds of
+ * interleaveLow/interleaveHigh and stored with \p N vector stores. Otherwise every
+ * structure is assembled in a vector register (via a `V::Size` x `V::Size` transpose)
+ * and stored with one (overlapping) vector store. Only SimdArray types whose size is
+ * not a power of two fall back to scalar stores.
+ *
+ * \code
+ * struct { float r, g, b; } pixels[float_v::Size];
+ * Vc::interleave(&pixels[0].r, r, g, b);
+ * \endcode
+ *
+ * \see deinterleave(const M *, V &, Vs &...)
+ */
+template <typename M, typename V, typename... Vs>
+Vc_INTRINSIC enable_if<(Traits::is_simd_vector<V>::value && sizeof...(Vs) >= 1 &&
+                        sizeof...(Vs) <= 7 &&
+                        std::is_same<std::tuple<V, Vs...>, std::tuple<Vs..., V>>::value &&
+                        std::is_arithmetic<M>::value),
+                       void>
+interleave(M *memory, const V &v0, const Vs &... vs)
+{
+    Detail::InterleaveStreams<V, M, 1 + sizeof...(Vs)>::interleave(memory, v0, vs...);
+}
 }  // namespace Vc
 
 #endif  // VC_COMMON_INTERLEAVE_H_
@@ -247,13 +247,13 @@ template<typename M> Vc_ALWAYS_INLINE BitmaskIterator end(const WhereImpl::Where
 template<typename V, typename Flags, typename T> Vc_ALWAYS_INLINE MemoryVectorIterator<V, Flags>
     makeIterator(T *mem, Flags)
 {
-    return new(mem) MemoryVector<V, Flags>;
+    return mem;
 }
 
 template<typename V, typename Flags, typename T> Vc_ALWAYS_INLINE MemoryVectorIterator<const V, Flags>
     makeIterator(const T *mem, Flags)
 {
-    return new(const_cast<T *>(mem)) MemoryVector<const V, Flags>;
+    return mem;
 }
 
 template<typename V, typename Flags, typename FlagsX> Vc_ALWAYS_INLINE MemoryVectorIterator<V, Flags>
@@ -51,11 +51,18 @@ explicit Vc_INTRINSIC Vector(const EntryType *mem, Flags flags)
     load(mem, flags);
 }
 
+/**
+ * Construct a vector from loading and converting \VSize{T} values of type \p U.
+ *
+ * For float vectors \p U may also be Vc::float16 or Vc::bfloat16, which reads half the
+ * bytes of a float load (using \c vcvtph2ps if F16C is enabled).
+ */
 template <typename U, typename Flags = DefaultLoadTag,
           typename = enable_if<
               (!std::is_integral<U>::value || !std::is_integral<EntryType>::value ||
                sizeof(EntryType) >= sizeof(U)) &&
-              std::is_arithmetic<U>::value &&Traits::is_load_store_flag<Flags>::value>>
+              Traits::is_valid_memory_type<U, EntryType>::value &&
+              Traits::is_load_store_flag<Flags>::value>>
 explicit Vc_INTRINSIC Vector(const U *x, Flags flags = Flags())
 {
     load<U, Flags>(x, flags);
@@ -94,7 +101,8 @@ template <typename U, typename Flags>
 struct load_concept : public std::enable_if<
               (!std::is_integral<U>::value || !std::is_integral<EntryType>::value ||
                sizeof(EntryType) >= sizeof(U)) &&
-              std::is_arithmetic<U>::value && Traits::is_load_store_flag<Flags>::value, void>
+              Traits::is_valid_memory_type<U, EntryType>::value &&
+              Traits::is_load_store_flag<Flags>::value, void>
 {};
 
 public:
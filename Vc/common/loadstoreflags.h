@@ -50,7 +50,7 @@ namespace LoadStoreFlags
 struct StreamingFlag {};
 struct UnalignedFlag {};
 struct PrefetchFlagBase {};
-// TODO: determine a good default for typical CPU use
+// fixed defaults for Prefetch<>; Prefetch<Auto> derives the distances from the cache sizes
 template <size_t L1 = 16 * 64, size_t L2 = 128 * 64, typename ExclusiveOrShared_ = void>
 struct PrefetchFlag : public PrefetchFlagBase {
     typedef ExclusiveOrShared_ ExclusiveOrShared;
@@ -213,12 +213,27 @@ constexpr LoadStoreFlags::LoadStoreFlags<PrefetchFlag<>> PrefetchDefault;
 ///@}
 
 /**
- * \tparam L1
- * \tparam L2
- * \tparam ExclusiveOrShared
+ * Use this value for the \p L1 and/or \p L2 parameter of Prefetch to determine the
+ * prefetch distance at runtime. See prefetch_distances().
+ */
+constexpr size_t Auto = ~size_t(0);
+
+/**
+ * Load flag that emits software prefetches \p L1 bytes ahead into the L1 cache and \p L2
+ * bytes ahead into the L2 cache of every vector load. A distance of zero disables the
+ * respective prefetch.
+ *
+ * With Prefetch<Auto> both distances are read at runtime from prefetch_distances(),
+ * which derives them from the cache sizes of the CPU the program runs on (and which
+ * calibrate_prefetch_distances() can tune by measurement).
+ *
+ * \tparam L1 The prefetch distance in bytes for the L1 cache, or Auto.
+ * \tparam L2 The prefetch distance in bytes for the L2 cache, or Auto. Defaults to Auto if
+ *            \p L1 is Auto.
+ * \tparam ExclusiveOrShared Either Vc::Exclusive, Vc::Shared, or \c void.
  */
 template <size_t L1 = PrefetchFlag<>::L1Stride,
-          size_t L2 = PrefetchFlag<>::L2Stride,
+          size_t L2 = L1 == Auto ? Auto : PrefetchFlag<>::L2Stride,
           typename ExclusiveOrShared = PrefetchFlag<>::ExclusiveOrShared>
 struct Prefetch : public LoadStoreFlags::LoadStoreFlags<PrefetchFlag<L1, L2, ExclusiveOrShared>>
 {
@@ -37,6 +37,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #else
 #include <cstdlib>
 #endif
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
 
 #include "macros.h"
 
@@ -70,6 +73,27 @@ template <std::size_t alignment> Vc_INTRINSIC void *aligned_malloc(std::size_t n
 #endif
 }
 
+/**\internal
+ * The size of the huge pages used for Vc::AlignOnHugePage.
+ */
+constexpr std::size_t HugePageSize = 2 * 1024 * 1024;
+
+/**\internal
+ * Asks the kernel to back the \p n Bytes starting at \p p with transparent huge pages.
+ * Has no effect if the platform does not support it.
+ */
+Vc_INTRINSIC void adviseHugePages(void *p, std::size_t n)
+{
+#if defined __linux__ && defined MADV_HUGEPAGE
+    if (p) {
+        madvise(p, n, MADV_HUGEPAGE);
+    }
+#else
+    (void)p;
+    (void)n;
+#endif
+}
+
 template <Vc::MallocAlignment A> Vc_ALWAYS_INLINE void *malloc(size_t n)
 {
     switch (A) {
@@ -81,6 +105,11 @@ template <Vc::MallocAlignment A> Vc_ALWAYS_INLINE void *malloc(size_t n)
     case Vc::AlignOnPage:
         // TODO: hardcoding 4096 is not such a great idea
         return aligned_malloc<4096>(n);
+    case Vc::AlignOnHugePage: {
+        void *p = aligned_malloc<HugePageSize>(n);
+        adviseHugePages(p, nextMultipleOf<HugePageSize>(n));
+        return p;
+    }
     }
     return nullptr;
 }
@@ -134,6 +134,8 @@ inline SSE::double_v exp(SSE::double_v::AsArg _x) {
         return x;
     }
 
+#include "extendedmath.h"
+#include "fastmath.h"
 #endif
 }  // namespace Vc
 
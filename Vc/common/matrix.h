@@ -0,0 +1,483 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_MATRIX_H_
+#define VC_COMMON_MATRIX_H_
+
+#include <algorithm>
+#include "utility.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// GemmBlocking {{{1
+/**\internal
+ * Register and cache blocking parameters of gemm for entries of type \p T.
+ *
+ * The micro-kernel keeps an MR x NR block of C in 2 * MR vector registers (NR is two
+ * vectors wide). A packed MR x KC panel of A (the MC x KC block stays in L2) and a packed
+ * KC x NR panel of B (the KC x NC block stays in L3) stream through it.
+ */
+template <typename T> struct GemmBlocking {
+    enum : std::size_t {
+        NR = 2 * Vector<T>::Size,
+        MR = Vector<T>::Size == 1 ? 4 : 6,
+        KC = 256,
+        MC = 16 * MR,
+        NC = 64 * NR
+    };
+};
+
+// GemmBuffer {{{1
+/**\internal
+ * Uninitialized, cache line aligned scratch memory for the packed blocks of gemm.
+ */
+template <typename T> struct GemmBuffer {
+    T *const data;
+    explicit GemmBuffer(std::size_t n) : data(Vc::malloc<T, Vc::AlignOnCacheline>(n)) {}
+    ~GemmBuffer() { Vc::free(data); }
+    GemmBuffer(const GemmBuffer &) = delete;
+    GemmBuffer &operator=(const GemmBuffer &) = delete;
+};
+
+// gemmPackA {{{1
+/**\internal
+ * Copies the \p mc x \p kc block at \p a to \p packed as consecutive MR x \p kc panels,
+ * each stored column by column, and scales the entries by \p alpha. Missing rows of the
+ * last panel are filled with zeros.
+ */
+template <typename T, std::size_t MR>
+inline void gemmPackA(std::size_t mc, std::size_t kc, T alpha, const T *a, std::size_t lda,
+                      T *packed)
+{
+    for (std::size_t i0 = 0; i0 < mc; i0 += MR) {
+        const std::size_t mr = std::min<std::size_t>(MR, mc - i0);
+        const T *panel = a + i0 * lda;
+        for (std::size_t p = 0; p < kc; ++p) {
+            std::size_t i = 0;
+            for (; i < mr; ++i) {
+                packed[i] = alpha * panel[i * lda + p];
+            }
+            for (; i < MR; ++i) {
+                packed[i] = T();
+            }
+            packed += MR;
+        }
+    }
+}
+
+// gemmPackB {{{1
+/**\internal
+ * Copies the \p kc x \p nc block at \p b to \p packed as consecutive \p kc x NR panels,
+ * each stored row by row, such that the micro-kernel reads B with aligned vector loads.
+ * Missing columns of the last panel are filled with zeros.
+ */
+template <typename V>
+inline void gemmPackB(std::size_t kc, std::size_t nc, const typename V::EntryType *b,
+                      std::size_t ldb, typename V::EntryType *packed)
+{
+    typedef typename V::EntryType T;
+    constexpr std::size_t NR = 2 * V::Size;
+    for (std::size_t j0 = 0; j0 < nc; j0 += NR) {
+        const std::size_t nr = std::min(NR, nc - j0);
+        const T *panel = b + j0;
+        if (nr == NR) {
+            for (std::size_t p = 0; p < kc; ++p) {
+                V(panel + p * ldb, Vc::Unaligned).store(packed, Vc::Aligned);
+                V(panel + p * ldb + V::Size, Vc::Unaligned)
+                    .store(packed + V::Size, Vc::Aligned);
+                packed += NR;
+            }
+        } else {
+            for (std::size_t p = 0; p < kc; ++p) {
+                std::size_t j = 0;
+                for (; j < nr; ++j) {
+                    packed[j] = panel[p * ldb + j];
+                }
+                for (; j < NR; ++j) {
+                    packed[j] = T();
+                }
+                packed += NR;
+            }
+        }
+    }
+}
+
+// gemmKernel {{{1
+/**\internal
+ * Adds the product of the packed MR x \p kc panel \p a and the packed \p kc x NR panel \p
+ * b to the \p mr x \p nr block at \p c. The accumulators are kept in registers over the
+ * whole \p kc loop; every iteration costs two vector loads, MR broadcasts and 2 * MR
+ * multiply-adds.
+ */
+template <typename V, std::size_t MR>
+Vc_INTRINSIC Vc_FLATTEN void gemmKernel(std::size_t kc, const typename V::EntryType *a,
+                                        const typename V::EntryType *b,
+                                        typename V::EntryType *c, std::size_t ldc,
+                                        std::size_t mr, std::size_t nr)
+{
+    typedef typename V::EntryType T;
+    V c0[MR], c1[MR];
+    Common::unrolled_loop<std::size_t, 0, MR>([&](std::size_t i) {
+        c0[i] = V::Zero();
+        c1[i] = V::Zero();
+    });
+    for (std::size_t p = 0; p < kc; ++p) {
+        const V b0(b, Vc::Aligned);
+        const V b1(b + V::Size, Vc::Aligned);
+        Common::unrolled_loop<std::size_t, 0, MR>([&](std::size_t i) {
+            const V ai = a[i];
+            c0[i] = multiplyAdd(ai, b0, c0[i]);
+            c1[i] = multiplyAdd(ai, b1, c1[i]);
+        });
+        a += MR;
+        b += 2 * V::Size;
+    }
+    if (mr == MR && nr == 2 * V::Size) {
+        Common::unrolled_loop<std::size_t, 0, MR>([&](std::size_t i) {
+            T *ci = c + i * ldc;
+            (V(ci, Vc::Unaligned) + c0[i]).store(ci, Vc::Unaligned);
+            (V(ci + V::Size, Vc::Unaligned) + c1[i]).store(ci + V::Size, Vc::Unaligned);
+        });
+    } else {
+        for (std::size_t i = 0; i < mr; ++i) {
+            for (std::size_t j = 0; j < nr; ++j) {
+                c[i * ldc + j] += j < V::Size ? c0[i][j] : c1[i][j - V::Size];
+            }
+        }
+    }
+}
+
+// gemvRows {{{1
+/**\internal
+ * Computes `y[i] = alpha * dot(A[i], x) + beta * y[i]` for \p R consecutive rows of \p a,
+ * reusing each vector of \p x for all \p R rows.
+ */
+template <typename V, std::size_t R>
+Vc_INTRINSIC void gemvRows(std::size_t n, typename V::EntryType alpha,
+                           const typename V::EntryType *a, std::size_t lda,
+                           const typename V::EntryType *x, typename V::EntryType beta,
+                           typename V::EntryType *y)
+{
+    typedef typename V::EntryType T;
+    V acc[R];
+    Common::unrolled_loop<std::size_t, 0, R>([&](std::size_t r) { acc[r] = V::Zero(); });
+    std::size_t j = 0;
+    for (; j + V::Size <= n; j += V::Size) {
+        const V xj(x + j, Vc::Unaligned);
+        Common::unrolled_loop<std::size_t, 0, R>([&](std::size_t r) {
+            acc[r] = multiplyAdd(V(a + r * lda + j, Vc::Unaligned), xj, acc[r]);
+        });
+    }
+    T sum[R];
+    Common::unrolled_loop<std::size_t, 0, R>([&](std::size_t r) { sum[r] = acc[r].sum(); });
+    for (; j < n; ++j) {
+        for (std::size_t r = 0; r < R; ++r) {
+            sum[r] += a[r * lda + j] * x[j];
+        }
+    }
+    for (std::size_t r = 0; r < R; ++r) {
+        y[r] = alpha * sum[r] + (beta == T() ? T() : beta * y[r]);
+    }
+}
+//}}}1
+}  // namespace Detail
+
+// gemm {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile matrix.h <Vc/matrix>
+ *
+ * General matrix-matrix multiplication: `C = alpha * A * B + beta * C`.
+ *
+ * All matrices are stored row-major; \p lda, \p ldb and \p ldc are the distances (in
+ * entries) between consecutive rows. A is \p m x \p k, B is \p k x \p n and C is \p m x
+ * \p n. No alignment is required.
+ *
+ * The implementation follows the usual cache-blocked scheme: B is packed in blocks that
+ * fit into the last level cache, A in blocks that fit into L2, and a register-blocked
+ * micro-kernel computes a 6 x 2\VSize{T} block of C at a time (4 x 2 for the Scalar
+ * implementation) using fused multiply-add instructions where available. As with BLAS, if
+ * \p beta is zero C is not read before it is written.
+ *
+ * \code
+ * std::vector<float> a(m * k), b(k * n), c(m * n);
+ * Vc::gemm(m, n, k, 1.f, a.data(), k, b.data(), n, 0.f, c.data(), n);
+ * \endcode
+ *
+ * \tparam T \c float or \c double.
+ */
+template <typename T>
+inline void gemm(std::size_t m, std::size_t n, std::size_t k, T alpha, const T *a,
+                 std::size_t lda, const T *b, std::size_t ldb, T beta, T *c,
+                 std::size_t ldc)
+{
+    static_assert(std::is_floating_point<T>::value,
+                  "Vc::gemm is only implemented for float and double");
+    typedef Vector<T> V;
+    typedef Detail::GemmBlocking<T> Blocking;
+    if (m == 0 || n == 0) {
+        return;
+    }
+    if (beta != T(1)) {
+        for (std::size_t i = 0; i < m; ++i) {
+            T *ci = c + i * ldc;
+            if (beta == T()) {
+                std::fill(ci, ci + n, T());
+            } else {
+                for (std::size_t j = 0; j < n; ++j) {
+                    ci[j] *= beta;
+                }
+            }
+        }
+    }
+    if (k == 0 || alpha == T()) {
+        return;
+    }
+
+    // small problems only need (and only touch) a fraction of the full block size
+    const std::size_t kcMax = std::min<std::size_t>(Blocking::KC, k);
+    const Detail::GemmBuffer<T> packedA(
+        kcMax * std::min<std::size_t>(
+                    Blocking::MC, (m + Blocking::MR - 1) / Blocking::MR * Blocking::MR));
+    const Detail::GemmBuffer<T> packedB(
+        kcMax * std::min<std::size_t>(
+                    Blocking::NC, (n + Blocking::NR - 1) / Blocking::NR * Blocking::NR));
+    for (std::size_t jc = 0; jc < n; jc += Blocking::NC) {
+        const std::size_t nc = std::min<std::size_t>(Blocking::NC, n - jc);
+        for (std::size_t pc = 0; pc < k; pc += Blocking::KC) {
+            const std::size_t kc = std::min<std::size_t>(Blocking::KC, k - pc);
+            Detail::gemmPackB<V>(kc, nc, b + pc * ldb + jc, ldb, packedB.data);
+            for (std::size_t ic = 0; ic < m; ic += Blocking::MC) {
+                const std::size_t mc = std::min<std::size_t>(Blocking::MC, m - ic);
+                Detail::gemmPackA<T, Blocking::MR>(mc, kc, alpha, a + ic * lda + pc, lda,
+                                                   packedA.data);
+                for (std::size_t jr = 0; jr < nc; jr += Blocking::NR) {
+                    const std::size_t nr = std::min<std::size_t>(Blocking::NR, nc - jr);
+                    for (std::size_t ir = 0; ir < mc; ir += Blocking::MR) {
+                        Detail::gemmKernel<V, Blocking::MR>(
+                            kc, packedA.data + ir * kc, packedB.data + jr * kc,
+                            c + (ic + ir) * ldc + jc + jr, ldc,
+                            std::min<std::size_t>(Blocking::MR, mc - ir), nr);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// gemv {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile matrix.h <Vc/matrix>
+ *
+ * General matrix-vector multiplication: `y = alpha * A * x + beta * y`.
+ *
+ * A is an \p m x \p n matrix stored row-major with \p lda entries between consecutive
+ * rows, \p x has \p n entries and \p y has \p m entries. Four rows are processed at once,
+ * such that every vector loaded from \p x is used for four multiply-adds. If \p beta is
+ * zero \p y is not read.
+ *
+ * \tparam T \c float or \c double.
+ */
+template <typename T>
+inline void gemv(std::size_t m, std::size_t n, T alpha, const T *a, std::size_t lda,
+                 const T *x, T beta, T *y)
+{
+    static_assert(std::is_floating_point<T>::value,
+                  "Vc::gemv is only implemented for float and double");
+    typedef Vector<T> V;
+    std::size_t i = 0;
+    for (; i + 4 <= m; i += 4) {
+        Detail::gemvRows<V, 4>(n, alpha, a + i * lda, lda, x, beta, y + i);
+    }
+    for (; i < m; ++i) {
+        Detail::gemvRows<V, 1>(n, alpha, a + i * lda, lda, x, beta, y + i);
+    }
+}
+
+// SmallMatrix {{{1
+/**
+ * \ingroup Containers
+ * \headerfile matrix.h <Vc/matrix>
+ *
+ * A \p Rows x \p Cols matrix with every row held in one SimdArray<T, Cols>.
+ *
+ * SmallMatrix is meant for the fixed sizes where a blocked gemm does not pay off (about
+ * 4 x 4 up to 16 x 16). Its multiplication is unrolled completely at compile time: there
+ * are no loops and no packing, only broadcasts of the entries of the left operand and
+ * multiply-adds on the rows of the right operand, four rows of the result at a time.
+ * \code
+ * Vc::SmallMatrix<float, 8> a(dataA), b(dataB);  // row-major float[64]
+ * const auto c = a * b;
+ * c.store(dataC);
+ * \endcode
+ *
+ * \tparam T The entry type.
+ * \tparam Rows The number of rows.
+ * \tparam Cols The number of columns.
+ */
+template <typename T, std::size_t Rows, std::size_t Cols = Rows> class SmallMatrix
+{
+public:
+    /// The type of one row.
+    typedef SimdArray<T, Cols> RowType;
+
+    /// Initializes all entries with zero.
+    SmallMatrix()
+    {
+        for (auto &r : m_rows) {
+            r = RowType::Zero();
+        }
+    }
+
+    /// Loads the entries from the row-major array at \p mem (\p Rows * \p Cols entries).
+    explicit SmallMatrix(const T *mem)
+    {
+        for (std::size_t i = 0; i < Rows; ++i) {
+            m_rows[i] = RowType(mem + i * Cols, Vc::Unaligned);
+        }
+    }
+
+    /// Returns the identity matrix.
+    static SmallMatrix identity()
+    {
+        SmallMatrix r;
+        for (std::size_t i = 0; i < Rows && i < Cols; ++i) {
+            r.m_rows[i][i] = T(1);
+        }
+        return r;
+    }
+
+    /// Stores the entries row-major to \p mem (\p Rows * \p Cols entries).
+    void store(T *mem) const
+    {
+        for (std::size_t i = 0; i < Rows; ++i) {
+            m_rows[i].store(mem + i * Cols, Vc::Unaligned);
+        }
+    }
+
+    static constexpr std::size_t rows() { return Rows; }
+    static constexpr std::size_t cols() { return Cols; }
+
+    /// Returns the \p i-th row. Entries are written via `row(i)[j] = x`.
+    Vc_ALWAYS_INLINE RowType &row(std::size_t i) { return m_rows[i]; }
+    /// Const overload of the above.
+    Vc_ALWAYS_INLINE const RowType &row(std::size_t i) const { return m_rows[i]; }
+    /// Returns the entry in row \p i and column \p j.
+    Vc_ALWAYS_INLINE T operator()(std::size_t i, std::size_t j) const
+    {
+        return m_rows[i][j];
+    }
+
+private:
+    RowType m_rows[Rows];
+};
+
+namespace Detail
+{
+/**\internal
+ * Adds `a(i, k) * b.row(k)` to \p acc[i - Begin] for all rows i in [Begin, End) and all
+ * columns k in [Col, K). The recursion over k (instead of a nested lambda) guarantees the
+ * complete unrolling.
+ */
+template <std::size_t Col, std::size_t Begin, std::size_t End, typename T, std::size_t R,
+          std::size_t K, std::size_t C>
+Vc_INTRINSIC enable_if<(Col >= K), void> multiplyAddColumns(SimdArray<T, C> *,
+                                                            const SmallMatrix<T, R, K> &,
+                                                            const SmallMatrix<T, K, C> &)
+{
+}
+
+template <std::size_t Col, std::size_t Begin, std::size_t End, typename T, std::size_t R,
+          std::size_t K, std::size_t C>
+Vc_INTRINSIC enable_if<(Col < K), void> multiplyAddColumns(SimdArray<T, C> *acc,
+                                                           const SmallMatrix<T, R, K> &a,
+                                                           const SmallMatrix<T, K, C> &b)
+{
+    typedef SimdArray<T, C> Row;
+    const Row &bk = b.row(Col);
+    Common::unrolled_loop<std::size_t, Begin, End>([&](std::size_t i) {
+        acc[i - Begin] = multiplyAdd(Row(a(i, Col)), bk, acc[i - Begin]);
+    });
+    multiplyAddColumns<Col + 1, Begin, End>(acc, a, b);
+}
+
+/**\internal
+ * Computes the rows [Begin, End) of `c = a * b`.
+ */
+template <std::size_t Begin, std::size_t End, typename T, std::size_t R, std::size_t K,
+          std::size_t C>
+Vc_INTRINSIC void multiplyRows(const SmallMatrix<T, R, K> &a, const SmallMatrix<T, K, C> &b,
+                               SmallMatrix<T, R, C> &c)
+{
+    typedef SimdArray<T, C> Row;
+    Row acc[End - Begin];
+    Common::unrolled_loop<std::size_t, Begin, End>(
+        [&](std::size_t i) { acc[i - Begin] = Row(a(i, 0)) * b.row(0); });
+    multiplyAddColumns<1, Begin, End>(acc, a, b);
+    Common::unrolled_loop<std::size_t, Begin, End>(
+        [&](std::size_t i) { c.row(i) = acc[i - Begin]; });
+}
+
+template <std::size_t Begin, typename T, std::size_t R, std::size_t K, std::size_t C>
+Vc_INTRINSIC enable_if<(Begin >= R), void> multiplyRowBlocks(const SmallMatrix<T, R, K> &,
+                                                             const SmallMatrix<T, K, C> &,
+                                                             SmallMatrix<T, R, C> &)
+{
+}
+
+template <std::size_t Begin, typename T, std::size_t R, std::size_t K, std::size_t C>
+Vc_INTRINSIC enable_if<(Begin < R), void> multiplyRowBlocks(const SmallMatrix<T, R, K> &a,
+                                                            const SmallMatrix<T, K, C> &b,
+                                                            SmallMatrix<T, R, C> &c)
+{
+    multiplyRows<Begin, (Begin + 4 < R ? Begin + 4 : R)>(a, b, c);
+    multiplyRowBlocks<Begin + 4>(a, b, c);
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Containers
+ * Multiplies the \p R x \p K matrix \p a with the \p K x \p C matrix \p b.
+ */
+template <typename T, std::size_t R, std::size_t K, std::size_t C>
+inline SmallMatrix<T, R, C> operator*(const SmallMatrix<T, R, K> &a,
+                                      const SmallMatrix<T, K, C> &b)
+{
+    SmallMatrix<T, R, C> c;
+    Detail::multiplyRowBlocks<0>(a, b, c);
+    return c;
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_MATRIX_H_
+
+// vim: foldmethod=marker
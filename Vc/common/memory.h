@@ -36,6 +36,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <initializer_list>
 #include "memoryfwd.h"
 #include "malloc.h"
+#include "memoryresource.h"
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -469,11 +470,25 @@ class Memory<V, Size, 0u, InitPadding> :
         size_t m_entriesCount;
         size_t m_vectorsCount;
         EntryType *m_mem;
+        pmr::memory_resource *m_resource = nullptr;  // nullptr: Vc::malloc
         size_t calcPaddedEntriesCount(size_t x)
         {
             size_t masked = x & AlignmentMask;
             return (masked == 0 ? x : x + (Alignment - masked));
         }
+        static EntryType *allocate(size_t n, Vc::MallocAlignment alignment)
+        {
+            switch (alignment) {
+            case Vc::AlignOnCacheline:
+                return Vc::malloc<EntryType, Vc::AlignOnCacheline>(n);
+            case Vc::AlignOnPage:
+                return Vc::malloc<EntryType, Vc::AlignOnPage>(n);
+            case Vc::AlignOnHugePage:
+                return Vc::malloc<EntryType, Vc::AlignOnHugePage>(n);
+            default:
+                return Vc::malloc<EntryType, Vc::AlignOnVector>(n);
+            }
+        }
     public:
         using Base::vector;
 
@@ -493,6 +508,52 @@ class Memory<V, Size, 0u, InitPadding> :
             Base::lastVector() = V::Zero();
         }
 
+        /**
+         * Allocate enough memory to access \p size values of type \p V::EntryType, using
+         * the alignment \p alignment (at least the alignment of \p V).
+         *
+         * Large arrays that are accessed randomly or with a large stride benefit from
+         * Vc::AlignOnHugePage, which requests 2 MiB pages and thus needs far fewer TLB
+         * entries. Apart from the padding in the last vector the memory is not touched:
+         * the pages are placed on the NUMA node of the thread that first writes to them
+         * (see Vc::first_touch in <Vc/execution>).
+         *
+         * \param size Determines how many scalar values will fit into the allocated memory.
+         * \param alignment See \ref Vc::MallocAlignment.
+         */
+        Vc_ALWAYS_INLINE Memory(size_t size, Vc::MallocAlignment alignment)
+            : m_entriesCount(size),
+            m_vectorsCount(calcPaddedEntriesCount(m_entriesCount)),
+            m_mem(allocate(m_vectorsCount, alignment))
+        {
+            m_vectorsCount /= V::Size;
+            Base::lastVector() = V::Zero();
+        }
+
+        /**
+         * Allocate enough memory to access \p size values of type \p V::EntryType from
+         * \p resource. The memory is returned to \p resource in the destructor.
+         *
+         * Scratch buffers that are created and destroyed frequently are much cheaper to
+         * obtain from a pool or an arena than from the heap:
+         * \code
+         * Vc::Memory<float_v> tmp(n, Vc::pmr::thread_local_pool_resource());
+         * \endcode
+         *
+         * \param size Determines how many scalar values will fit into the allocated memory.
+         * \param resource The resource to allocate from. It must outlive the Memory object.
+         */
+        Vc_ALWAYS_INLINE Memory(size_t size, pmr::memory_resource *resource)
+            : m_entriesCount(size),
+            m_vectorsCount(calcPaddedEntriesCount(m_entriesCount)),
+            m_mem(static_cast<EntryType *>(
+                resource->allocate(m_vectorsCount * sizeof(EntryType), V::MemoryAlignment))),
+            m_resource(resource)
+        {
+            m_vectorsCount /= V::Size;
+            Base::lastVector() = V::Zero();
+        }
+
         /**
          * Copy the memory into a new memory area.
          *
@@ -524,12 +585,34 @@ class Memory<V, Size, 0u, InitPadding> :
             Detail::copyVectors(*this, rhs);
         }
 
+        /**
+         * Takes over the memory of \p rhs without a new allocation. \p rhs is left empty.
+         *
+         * \param rhs The Memory object to move from.
+         */
+        Vc_ALWAYS_INLINE Memory(Memory &&rhs) noexcept
+            : m_entriesCount(rhs.m_entriesCount),
+            m_vectorsCount(rhs.m_vectorsCount),
+            m_mem(rhs.m_mem),
+            m_resource(rhs.m_resource)
+        {
+            rhs.m_entriesCount = 0;
+            rhs.m_vectorsCount = 0;
+            rhs.m_mem = nullptr;
+            rhs.m_resource = nullptr;
+        }
+
         /**
          * Frees the memory which was allocated in the constructor.
          */
         Vc_ALWAYS_INLINE ~Memory()
         {
-            Vc::free(m_mem);
+            if (m_resource) {
+                m_resource->deallocate(m_mem, m_vectorsCount * V::Size * sizeof(EntryType),
+                                       V::MemoryAlignment);
+            } else {
+                Vc::free(m_mem);
+            }
         }
 
         /**
@@ -541,6 +624,7 @@ class Memory<V, Size, 0u, InitPadding> :
             std::swap(m_mem, rhs.m_mem);
             std::swap(m_entriesCount, rhs.m_entriesCount);
             std::swap(m_vectorsCount, rhs.m_vectorsCount);
+            std::swap(m_resource, rhs.m_resource);
         }
 
         /**
@@ -575,6 +659,19 @@ class Memory<V, Size, 0u, InitPadding> :
             return *this;
         }
 
+        /**
+         * Exchanges the memory with \p rhs. In contrast to the copy assignment, the sizes of
+         * the two objects may differ.
+         *
+         * \param rhs The object to take the data from.
+         *
+         * \return reference to the modified Memory object.
+         */
+        Vc_ALWAYS_INLINE Memory &operator=(Memory &&rhs) noexcept {
+            swap(rhs);
+            return *this;
+        }
+
         /**
          * Overwrite all entries with the values stored in the memory at \p rhs.
          *
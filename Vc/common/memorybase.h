@@ -31,6 +31,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assert.h>
 #include <type_traits>
 #include <iterator>
+#include "streaming.h"
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -104,42 +105,45 @@ public:
         Vc_ALL_ARITHMETICS(Vc_MEM_OPERATOR_EQ);
 };
 
+/**\internal
+ * Random access iterator over the vectors of a Memory object. Dereferencing yields a
+ * MemoryVector proxy for the vector at the current position; all loads and stores
+ * through it use \p Flags (e.g. for prefetching).
+ */
 template<typename _V, typename Flags> class MemoryVectorIterator
 {
     typedef typename std::remove_cv<_V>::type V;
 
-    template<typename T, typename R> using enable_if_mutable =
-        typename std::enable_if<std::is_same<T, T>::value && !std::is_const<_V>::value, R>::type;
-
-    using iterator_traits = std::iterator_traits<MemoryVector<_V, Flags> *>;
+    using EntryType =
+        typename std::conditional<std::is_const<_V>::value, const typename V::EntryType,
+                                  typename V::EntryType>::type;
 
-    MemoryVector<_V, Flags> *d;
+    EntryType *d;
 public:
-    typedef typename iterator_traits::difference_type difference_type;
-    typedef typename iterator_traits::value_type value_type;
-    typedef typename iterator_traits::pointer pointer;
-    typedef typename iterator_traits::reference reference;
-    typedef typename iterator_traits::iterator_category iterator_category;
+    typedef std::ptrdiff_t difference_type;
+    typedef V value_type;
+    typedef void pointer;
+    typedef MemoryVector<_V, Flags> reference;
+    typedef std::random_access_iterator_tag iterator_category;
 
-    constexpr MemoryVectorIterator(MemoryVector<_V, Flags> *dd) : d(dd) {}
+    constexpr MemoryVectorIterator(EntryType *dd) : d(dd) {}
     constexpr MemoryVectorIterator(const MemoryVectorIterator &) = default;
     constexpr MemoryVectorIterator(MemoryVectorIterator &&) = default;
     Vc_ALWAYS_INLINE MemoryVectorIterator &operator=(const MemoryVectorIterator &) = default;
 
-    Vc_ALWAYS_INLINE void *orderBy() const { return d; }
-
-    Vc_ALWAYS_INLINE difference_type operator-(const MemoryVectorIterator &rhs) const { return d - rhs.d; }
-    Vc_ALWAYS_INLINE reference operator[](size_t i) const { return d[i]; }
-    Vc_ALWAYS_INLINE reference operator*() const { return *d; }
-    Vc_ALWAYS_INLINE pointer operator->() const { return d; }
-    Vc_ALWAYS_INLINE MemoryVectorIterator &operator++() { ++d; return *this; }
-    Vc_ALWAYS_INLINE MemoryVectorIterator operator++(int) { MemoryVectorIterator r(*this); ++d; return r; }
-    Vc_ALWAYS_INLINE MemoryVectorIterator &operator--() { --d; return *this; }
-    Vc_ALWAYS_INLINE MemoryVectorIterator operator--(int) { MemoryVectorIterator r(*this); --d; return r; }
-    Vc_ALWAYS_INLINE MemoryVectorIterator &operator+=(size_t n) { d += n; return *this; }
-    Vc_ALWAYS_INLINE MemoryVectorIterator &operator-=(size_t n) { d -= n; return *this; }
-    Vc_ALWAYS_INLINE MemoryVectorIterator operator+(size_t n) const { return MemoryVectorIterator(d + n); }
-    Vc_ALWAYS_INLINE MemoryVectorIterator operator-(size_t n) const { return MemoryVectorIterator(d - n); }
+    Vc_ALWAYS_INLINE const void *orderBy() const { return d; }
+
+    Vc_ALWAYS_INLINE difference_type operator-(const MemoryVectorIterator &rhs) const { return (d - rhs.d) / difference_type(V::Size); }
+    Vc_ALWAYS_INLINE reference operator[](size_t i) const { return d + i * V::Size; }
+    Vc_ALWAYS_INLINE reference operator*() const { return d; }
+    Vc_ALWAYS_INLINE MemoryVectorIterator &operator++() { d += V::Size; return *this; }
+    Vc_ALWAYS_INLINE MemoryVectorIterator operator++(int) { MemoryVectorIterator r(*this); d += V::Size; return r; }
+    Vc_ALWAYS_INLINE MemoryVectorIterator &operator--() { d -= V::Size; return *this; }
+    Vc_ALWAYS_INLINE MemoryVectorIterator operator--(int) { MemoryVectorIterator r(*this); d -= V::Size; return r; }
+    Vc_ALWAYS_INLINE MemoryVectorIterator &operator+=(size_t n) { d += n * V::Size; return *this; }
+    Vc_ALWAYS_INLINE MemoryVectorIterator &operator-=(size_t n) { d -= n * V::Size; return *this; }
+    Vc_ALWAYS_INLINE MemoryVectorIterator operator+(size_t n) const { return MemoryVectorIterator(d + n * V::Size); }
+    Vc_ALWAYS_INLINE MemoryVectorIterator operator-(size_t n) const { return MemoryVectorIterator(d - n * V::Size); }
 };
 
 template<typename V, typename FlagsL, typename FlagsR>
@@ -187,19 +191,26 @@ Vc_ALL_BINARY     (Vc_VPH_OPERATOR);
 Vc_ALL_COMPARES   (Vc_VPH_OPERATOR);
 #undef Vc_VPH_OPERATOR
 
-template<typename V, typename Parent, typename Flags = Prefetch<>> class MemoryRange/*{{{*/
+template<typename V, typename Parent, typename Flags = Prefetch<Auto>> class MemoryRange/*{{{*/
 {
-    Parent *m_parent;
-    size_t m_first;
-    size_t m_last;
+    typedef typename std::conditional<std::is_const<V>::value, const Parent, Parent>::type
+        ParentType;
+    typedef typename std::conditional<std::is_const<V>::value,
+                                      const typename V::EntryType,
+                                      typename V::EntryType>::type EntryType;
+    // the range stores the addresses, not the parent, so that it may outlive a temporary
+    // parent, such as a row of a DynamicMemory
+    EntryType *m_begin;
+    EntryType *m_end;
 
 public:
-    MemoryRange(Parent *p, size_t firstIndex, size_t lastIndex)
-        : m_parent(p), m_first(firstIndex), m_last(lastIndex)
+    MemoryRange(ParentType *p, size_t firstIndex, size_t lastIndex)
+        : m_begin(p->entries() + firstIndex * V::Size)
+        , m_end(p->entries() + (lastIndex + 1) * V::Size)
     {}
 
-    MemoryVectorIterator<V, Flags> begin() const { return &m_parent->vector(m_first   , Flags()); }
-    MemoryVectorIterator<V, Flags> end() const   { return &m_parent->vector(m_last + 1, Flags()); }
+    MemoryVectorIterator<V, Flags> begin() const { return m_begin; }
+    MemoryVectorIterator<V, Flags> end() const   { return m_end; }
 };/*}}}*/
 template<typename V, typename Parent, int Dimension, typename RowMemory> class MemoryDimensionBase;
 template<typename V, typename Parent, typename RowMemory> class MemoryDimensionBase<V, Parent, 1, RowMemory> // {{{1
@@ -209,9 +220,12 @@ template<typename V, typename Parent, typename RowMemory> class MemoryDimensionB
         const Parent *p() const { return static_cast<const Parent *>(this); }
     public:
         /**
-         * The type of the scalar entries in the array.
+         * The type of the scalar entries in the array. It is const if \p V is const, i.e.
+         * for a read-only view such as MemorySlice<const V, 1>.
          */
-        typedef typename V::EntryType EntryType;
+        typedef typename std::conditional<std::is_const<V>::value,
+                                          const typename V::EntryType,
+                                          typename V::EntryType>::type EntryType;
 
         /**
          * Returns a pointer to the start of the allocated memory.
@@ -258,7 +272,9 @@ template<typename V, typename Parent, typename RowMemory> class MemoryDimensionB
 #endif
 
         /**
-         *
+         * Returns an iterable range over the vectors \p firstIndex to \p lastIndex
+         * (inclusive). Loads through the range use \p Flags, which default to
+         * Prefetch<Auto>.
          */
         template<typename Flags>
         Vc_ALWAYS_INLINE MemoryRange<V, Parent, Flags> range(size_t firstIndex, size_t lastIndex, Flags) {
@@ -374,9 +390,11 @@ template<typename V, typename Parent, int Dimension, typename RowMemory> class M
         const Parent *p() const { return static_cast<const Parent *>(this); }
     public:
         /**
-         * The type of the scalar entries in the array.
+         * The type of the scalar entries in the array (const if \p V is const).
          */
-        typedef typename V::EntryType EntryType;
+        typedef typename std::conditional<std::is_const<V>::value,
+                                          const typename V::EntryType,
+                                          typename V::EntryType>::type EntryType;
 
         /**
          * \return the number of scalar entries in the array. This function is optimized away
@@ -396,19 +414,19 @@ template<typename V, typename Parent, int Dimension, typename RowMemory> class M
          * Return a (vectorized) iterator to the start of this memory object.
          */
         template<typename Flags = AlignedTag>
-        Vc_ALWAYS_INLINE MemoryVectorIterator<      V, Flags> begin(Flags flags = Flags())       { return &firstVector(flags); }
+        Vc_ALWAYS_INLINE MemoryVectorIterator<      V, Flags> begin(Flags = Flags())       { return entries(); }
         //! const overload of the above
         template<typename Flags = AlignedTag>
-        Vc_ALWAYS_INLINE MemoryVectorIterator<const V, Flags> begin(Flags flags = Flags()) const { return &firstVector(flags); }
+        Vc_ALWAYS_INLINE MemoryVectorIterator<const V, Flags> begin(Flags = Flags()) const { return entries(); }
 
         /**
          * Return a (vectorized) iterator to the end of this memory object.
          */
         template<typename Flags = AlignedTag>
-        Vc_ALWAYS_INLINE MemoryVectorIterator<      V, Flags>   end(Flags flags = Flags())       { return &lastVector(flags) + 1; }
+        Vc_ALWAYS_INLINE MemoryVectorIterator<      V, Flags>   end(Flags = Flags())       { return entries() + vectorsCount() * V::Size; }
         //! const overload of the above
         template<typename Flags = AlignedTag>
-        Vc_ALWAYS_INLINE MemoryVectorIterator<const V, Flags>   end(Flags flags = Flags()) const { return &lastVector(flags) + 1; }
+        Vc_ALWAYS_INLINE MemoryVectorIterator<const V, Flags>   end(Flags = Flags()) const { return entries() + vectorsCount() * V::Size; }
 
         /**
          * \param i Selects the offset, where the vector should be read.
@@ -600,6 +618,52 @@ template<typename V, typename Parent, int Dimension, typename RowMemory> class M
             }
         }
 
+        /**
+         * Assign \p x to all vectors in the array, like operator=, but with non-temporal
+         * stores (Vc::Streaming) if the array occupies at least streaming_store_threshold()
+         * bytes. The stores are followed by streaming_fence().
+         *
+         * Use this to initialize large arrays that are not read again soon, so that the
+         * initialization neither reads the destination into the caches nor evicts the
+         * working set.
+         */
+        inline Parent &streamingStore(const V &x)
+        {
+            if (!Vc::Detail::useStreamingStores(vectorsCount() * sizeof(V))) {
+                for (size_t i = 0; i < vectorsCount(); ++i) {
+                    vector(i) = x;
+                }
+            } else {
+                for (size_t i = 0; i < vectorsCount(); ++i) {
+                    vector(i, Vc::Aligned | Vc::Streaming) = x;
+                }
+                streaming_fence();
+            }
+            return static_cast<Parent &>(*this);
+        }
+
+        /**
+         * Copy all vectors of \p rhs, which must have the same number of vectors, using
+         * non-temporal stores if the array occupies at least streaming_store_threshold()
+         * bytes. See above.
+         */
+        template <typename P2, typename RM>
+        inline Parent &streamingStore(const MemoryBase<V, P2, Dimension, RM> &rhs)
+        {
+            assert(vectorsCount() == rhs.vectorsCount());
+            if (!Vc::Detail::useStreamingStores(vectorsCount() * sizeof(V))) {
+                for (size_t i = 0; i < vectorsCount(); ++i) {
+                    vector(i) = rhs.vector(i);
+                }
+            } else {
+                for (size_t i = 0; i < vectorsCount(); ++i) {
+                    vector(i, Vc::Aligned | Vc::Streaming) = rhs.vector(i);
+                }
+                streaming_fence();
+            }
+            return static_cast<Parent &>(*this);
+        }
+
         /**
          * (Inefficient) shorthand to add up two arrays.
          */
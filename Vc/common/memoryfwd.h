@@ -38,6 +38,8 @@ class Memory;
 
 template <typename V, typename Parent, int Dimension, typename RowMemory>
 class MemoryBase;
+
+template <typename V, int Dimension> class DynamicMemoryBase;
 }  // namespace Common
 
 using Common::Memory;
@@ -0,0 +1,627 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_MEMORYRESOURCE_H_
+#define VC_COMMON_MEMORYRESOURCE_H_
+
+#ifndef Vc_VECTOR_DECLARED_
+#error "Incorrect inclusion order. This header must be included from Vc/vector.h only."
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#if defined _WIN32 || defined _WIN64
+#include <malloc.h>
+#endif
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ *
+ * Memory resources and a polymorphic allocator modelled after \c std::pmr (C++17), usable
+ * with C++11.
+ *
+ * In contrast to \c std::pmr the default alignment of all allocations is
+ * Vc::VectorAlignment, and polymorphic_allocator requests at least this alignment. Thus
+ * containers using it can always be accessed with aligned vector loads and stores.
+ */
+namespace pmr
+{
+// memory_resource {{{1
+/**
+ * \headerfile memoryresource.h <Vc/Allocator>
+ *
+ * The interface of all memory resources, equivalent to \c std::pmr::memory_resource.
+ */
+class memory_resource
+{
+public:
+    virtual ~memory_resource() = default;
+
+    /// Allocates \p bytes Bytes aligned to \p alignment. Throws on failure.
+    void *allocate(std::size_t bytes, std::size_t alignment = VectorAlignment)
+    {
+        return do_allocate(bytes, alignment);
+    }
+    /// Releases memory obtained from allocate with the same \p bytes and \p alignment.
+    void deallocate(void *p, std::size_t bytes, std::size_t alignment = VectorAlignment)
+    {
+        do_deallocate(p, bytes, alignment);
+    }
+    /// Returns whether memory allocated from \p other can be deallocated by \c this.
+    bool is_equal(const memory_resource &other) const noexcept
+    {
+        return do_is_equal(other);
+    }
+
+private:
+    virtual void *do_allocate(std::size_t bytes, std::size_t alignment) = 0;
+    virtual void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) = 0;
+    virtual bool do_is_equal(const memory_resource &other) const noexcept = 0;
+};
+
+inline bool operator==(const memory_resource &a, const memory_resource &b) noexcept
+{
+    return &a == &b || a.is_equal(b);
+}
+inline bool operator!=(const memory_resource &a, const memory_resource &b) noexcept
+{
+    return !(a == b);
+}
+}  // namespace pmr
+
+namespace Detail
+{
+// MallocResource {{{1
+/**\internal
+ * Allocates every block separately from the aligned heap (like Vc::malloc).
+ */
+class MallocResource final : public pmr::memory_resource
+{
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        if (alignment < sizeof(void *)) {
+            alignment = sizeof(void *);
+        }
+        if (bytes == 0) {
+            bytes = 1;
+        }
+#if defined _WIN32 || defined _WIN64
+#ifdef __GNUC__
+        void *p = __mingw_aligned_malloc(bytes, alignment);
+#else
+        void *p = _aligned_malloc(bytes, alignment);
+#endif
+#else
+        void *p = nullptr;
+        if (0 != posix_memalign(&p, alignment, bytes)) {
+            p = nullptr;
+        }
+#endif
+        if (!p) {
+            throw std::bad_alloc();
+        }
+        return p;
+    }
+    void do_deallocate(void *p, std::size_t, std::size_t) override
+    {
+#if defined _WIN32 || defined _WIN64
+#ifdef __GNUC__
+        __mingw_aligned_free(p);
+#else
+        _aligned_free(p);
+#endif
+#else
+        std::free(p);
+#endif
+    }
+    bool do_is_equal(const pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+// nullptr stands for pmr::malloc_resource()
+inline std::atomic<pmr::memory_resource *> &defaultResource()
+{
+    static std::atomic<pmr::memory_resource *> r(nullptr);
+    return r;
+}
+
+// ChunkList {{{1
+/**\internal
+ * The list of chunks a resource obtained from its upstream resource. The list is kept in
+ * headers in front of the usable memory, which starts cacheline aligned.
+ */
+class ChunkList
+{
+public:
+    static constexpr std::size_t HeaderSize = 64;
+
+    /// Returns \p bytes usable Bytes, aligned to HeaderSize.
+    void *allocate(pmr::memory_resource *upstream, std::size_t bytes)
+    {
+        Header *h = static_cast<Header *>(upstream->allocate(bytes + HeaderSize, HeaderSize));
+        h->next = m_head;
+        h->bytes = bytes + HeaderSize;
+        m_head = h;
+        return reinterpret_cast<char *>(h) + HeaderSize;
+    }
+
+    /// Returns all chunks to \p upstream.
+    void release(pmr::memory_resource *upstream)
+    {
+        while (m_head) {
+            Header *next = m_head->next;
+            upstream->deallocate(m_head, m_head->bytes, HeaderSize);
+            m_head = next;
+        }
+    }
+
+private:
+    struct Header {
+        Header *next;
+        std::size_t bytes;
+    };
+    Header *m_head = nullptr;
+};
+//}}}1
+}  // namespace Detail
+
+namespace pmr
+{
+// default resource {{{1
+/**
+ * \headerfile memoryresource.h <Vc/Allocator>
+ *
+ * Returns a resource that allocates every block from the aligned heap, like Vc::malloc.
+ * This is the initial default resource.
+ */
+inline memory_resource *malloc_resource() noexcept
+{
+    static Detail::MallocResource r;
+    return &r;
+}
+
+/**
+ * \headerfile memoryresource.h <Vc/Allocator>
+ *
+ * Returns the resource used by default constructed polymorphic allocators and as the
+ * default upstream resource.
+ */
+inline memory_resource *get_default_resource() noexcept
+{
+    memory_resource *r = Detail::defaultResource().load();
+    return r ? r : malloc_resource();
+}
+
+/**
+ * \headerfile memoryresource.h <Vc/Allocator>
+ *
+ * Sets the default resource to \p r (malloc_resource() if \p r is \c nullptr) and returns
+ * the previous default resource.
+ */
+inline memory_resource *set_default_resource(memory_resource *r) noexcept
+{
+    memory_resource *previous = Detail::defaultResource().exchange(r);
+    return previous ? previous : malloc_resource();
+}
+
+// monotonic_buffer_resource {{{1
+/**
+ * \headerfile memoryresource.h <Vc/Allocator>
+ *
+ * A resource that hands out memory by incrementing a pointer and releases it only all at
+ * once, when the resource is destroyed or release() is called. Equivalent to
+ * \c std::pmr::monotonic_buffer_resource.
+ *
+ * This is the fastest way to obtain many short-lived scratch buffers, e.g. for the
+ * duration of one request:
+ * \code
+ * alignas(Vc::VectorAlignment) char stack[16384];
+ * Vc::pmr::monotonic_buffer_resource arena(stack, sizeof(stack));
+ * Vc::pmr::vector<float> tmp(n, &arena);
+ * Vc::Memory<float_v> scratch(m, &arena);
+ * \endcode
+ * If the initial buffer is exhausted, chunks of growing size are obtained from the
+ * upstream resource. The resource is not thread-safe.
+ */
+class monotonic_buffer_resource : public memory_resource
+{
+public:
+    /// Uses \p upstream for all memory.
+    explicit monotonic_buffer_resource(memory_resource *upstream = get_default_resource())
+        : m_upstream(upstream)
+    {
+    }
+    /// Uses \p upstream for all memory. The first chunk has \p initialSize Bytes.
+    explicit monotonic_buffer_resource(std::size_t initialSize,
+                                       memory_resource *upstream = get_default_resource())
+        : m_upstream(upstream), m_nextSize(initialSize > 0 ? initialSize : 1)
+    {
+    }
+    /**
+     * Uses the \p bufferSize Bytes at \p buffer first and \p upstream once they are
+     * exhausted. The resource does not take ownership of \p buffer.
+     */
+    monotonic_buffer_resource(void *buffer, std::size_t bufferSize,
+                              memory_resource *upstream = get_default_resource())
+        : m_upstream(upstream)
+        , m_buffer(buffer)
+        , m_bufferSize(bufferSize)
+        , m_current(buffer)
+        , m_space(bufferSize)
+        , m_nextSize(bufferSize > InitialSize ? 2 * bufferSize : InitialSize)
+    {
+    }
+
+    monotonic_buffer_resource(const monotonic_buffer_resource &) = delete;
+    monotonic_buffer_resource &operator=(const monotonic_buffer_resource &) = delete;
+
+    ~monotonic_buffer_resource() { release(); }
+
+    /// Returns all chunks to the upstream resource and starts over with the initial buffer.
+    void release()
+    {
+        m_chunks.release(m_upstream);
+        m_current = m_buffer;
+        m_space = m_bufferSize;
+    }
+
+    /// Returns the resource the chunks are obtained from.
+    memory_resource *upstream_resource() const { return m_upstream; }
+
+private:
+    static constexpr std::size_t InitialSize = 4096;
+
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        if (bytes == 0) {
+            bytes = 1;
+        }
+        void *p = m_current;
+        if (!p || !std::align(alignment, bytes, p, m_space)) {
+            while (m_nextSize < bytes + alignment) {
+                m_nextSize *= 2;
+            }
+            p = m_chunks.allocate(m_upstream, m_nextSize);
+            m_space = m_nextSize;
+            m_nextSize *= 2;
+            std::align(alignment, bytes, p, m_space);
+        }
+        m_current = static_cast<char *>(p) + bytes;
+        m_space -= bytes;
+        return p;
+    }
+    void do_deallocate(void *, std::size_t, std::size_t) override {}
+    bool do_is_equal(const memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    memory_resource *m_upstream;
+    void *m_buffer = nullptr;
+    std::size_t m_bufferSize = 0;
+    void *m_current = nullptr;
+    std::size_t m_space = 0;
+    std::size_t m_nextSize = InitialSize;
+    Detail::ChunkList m_chunks;
+};
+
+// unsynchronized_pool_resource {{{1
+/**
+ * \headerfile memoryresource.h <Vc/Allocator>
+ *
+ * Configures unsynchronized_pool_resource, as \c std::pmr::pool_options. Zero selects the
+ * default.
+ */
+struct pool_options {
+    /// The maximum number of blocks a chunk obtained from upstream contains.
+    std::size_t max_blocks_per_chunk = 0;
+    /// Larger allocations are forwarded to the upstream resource. At most 2 MiB.
+    std::size_t largest_required_pool_block = 0;
+};
+
+/**
+ * \headerfile memoryresource.h <Vc/Allocator>
+ *
+ * A resource that keeps pools of free blocks with power-of-two sizes from 64 Bytes to
+ * pool_options::largest_required_pool_block (64 KiB by default). Equivalent to
+ * \c std::pmr::unsynchronized_pool_resource.
+ *
+ * Deallocated blocks are put on the free list of their size and are reused by the next
+ * allocation of that size, thus buffers that are repeatedly created and destroyed do not
+ * reach the heap after the first time. All blocks are aligned to 64 Bytes. Allocations
+ * that are larger or need a larger alignment are forwarded to the upstream resource.
+ *
+ * The resource is not thread-safe. Use thread_local_pool_resource() to get one pool per
+ * thread.
+ */
+class unsynchronized_pool_resource : public memory_resource
+{
+public:
+    unsynchronized_pool_resource()
+        : unsynchronized_pool_resource(pool_options(), get_default_resource())
+    {
+    }
+    explicit unsynchronized_pool_resource(memory_resource *upstream)
+        : unsynchronized_pool_resource(pool_options(), upstream)
+    {
+    }
+    explicit unsynchronized_pool_resource(const pool_options &opts)
+        : unsynchronized_pool_resource(opts, get_default_resource())
+    {
+    }
+    unsynchronized_pool_resource(const pool_options &opts, memory_resource *upstream)
+        : m_upstream(upstream), m_options(opts)
+    {
+        if (m_options.largest_required_pool_block == 0) {
+            m_options.largest_required_pool_block = 64 * 1024;
+        }
+        std::size_t largest = SmallestBlock;
+        while (largest < m_options.largest_required_pool_block &&
+               largest < (SmallestBlock << (MaxPools - 1))) {
+            largest *= 2;
+        }
+        m_options.largest_required_pool_block = largest;
+        if (m_options.max_blocks_per_chunk == 0) {
+            m_options.max_blocks_per_chunk = std::size_t(1) << 20;
+        }
+        for (auto &f : m_free) {
+            f = nullptr;
+        }
+    }
+
+    unsynchronized_pool_resource(const unsynchronized_pool_resource &) = delete;
+    unsynchronized_pool_resource &operator=(const unsynchronized_pool_resource &) = delete;
+
+    ~unsynchronized_pool_resource() { release(); }
+
+    /**
+     * Returns all chunks to the upstream resource. Allocations that were forwarded to the
+     * upstream resource are not affected.
+     */
+    void release()
+    {
+        m_chunks.release(m_upstream);
+        for (auto &f : m_free) {
+            f = nullptr;
+        }
+        m_current = nullptr;
+        m_space = 0;
+    }
+
+    /// Returns the resource the chunks are obtained from.
+    memory_resource *upstream_resource() const { return m_upstream; }
+    /// Returns the options in effect, with the defaults filled in.
+    pool_options options() const { return m_options; }
+
+private:
+    static constexpr std::size_t SmallestBlock = 64;
+    static constexpr int MaxPools = 16;  // up to 2 MiB blocks
+    static constexpr std::size_t MaxChunkSize = 4 * 1024 * 1024;
+
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+
+    // the index of the smallest pool with blocks of at least the given size
+    static int poolIndex(std::size_t bytes)
+    {
+        int i = 0;
+        for (std::size_t size = SmallestBlock; size < bytes; size *= 2) {
+            ++i;
+        }
+        return i;
+    }
+
+    bool fromUpstream(std::size_t bytes, std::size_t alignment) const
+    {
+        return bytes > m_options.largest_required_pool_block ||
+               alignment > Detail::ChunkList::HeaderSize;
+    }
+
+    void push(int i, void *p)
+    {
+        FreeBlock *b = static_cast<FreeBlock *>(p);
+        b->next = m_free[i];
+        m_free[i] = b;
+    }
+
+    // obtains a new chunk for blocks of blockSize Bytes. The remainder of the current chunk
+    // is split into free blocks first, so that it is not lost.
+    void refill(std::size_t blockSize)
+    {
+        while (m_space >= SmallestBlock) {
+            int i = poolIndex(m_space + 1) - 1;
+            std::size_t size = SmallestBlock << i;
+            while (size > m_options.largest_required_pool_block) {
+                size /= 2;
+                --i;
+            }
+            push(i, m_current);
+            m_current += size;
+            m_space -= size;
+        }
+        std::size_t chunk = m_nextChunkSize;
+        if (chunk / blockSize > m_options.max_blocks_per_chunk) {
+            chunk = blockSize * m_options.max_blocks_per_chunk;
+        }
+        if (chunk < blockSize) {
+            chunk = blockSize;
+        }
+        m_current = static_cast<char *>(m_chunks.allocate(m_upstream, chunk));
+        m_space = chunk;
+        if (m_nextChunkSize < MaxChunkSize) {
+            m_nextChunkSize *= 2;
+        }
+    }
+
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        if (fromUpstream(bytes, alignment)) {
+            return m_upstream->allocate(bytes, alignment);
+        }
+        const int i = poolIndex(bytes);
+        if (FreeBlock *b = m_free[i]) {
+            m_free[i] = b->next;
+            return b;
+        }
+        const std::size_t blockSize = SmallestBlock << i;
+        if (m_space < blockSize) {
+            refill(blockSize);
+        }
+        void *p = m_current;
+        m_current += blockSize;
+        m_space -= blockSize;
+        return p;
+    }
+    void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override
+    {
+        if (fromUpstream(bytes, alignment)) {
+            m_upstream->deallocate(p, bytes, alignment);
+        } else {
+            push(poolIndex(bytes), p);
+        }
+    }
+    bool do_is_equal(const memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    memory_resource *m_upstream;
+    pool_options m_options;
+    FreeBlock *m_free[MaxPools];
+    char *m_current = nullptr;
+    std::size_t m_space = 0;
+    std::size_t m_nextChunkSize = 64 * 1024;
+    Detail::ChunkList m_chunks;
+};
+
+/**
+ * \headerfile memoryresource.h <Vc/Allocator>
+ *
+ * Returns the pool resource of the calling thread. Every thread has its own free lists,
+ * thus allocation and deallocation need no synchronization:
+ * \code
+ * void handleRequest(const Request &r)
+ * {
+ *     Vc::pmr::vector<float> tmp(r.size(), Vc::pmr::thread_local_pool_resource());
+ *     ...
+ * }  // the buffer goes back to the free list of this thread
+ * \endcode
+ * Memory from this resource must be deallocated by the thread that allocated it and must
+ * not outlive the thread. The pool obtains its chunks from malloc_resource().
+ */
+inline unsynchronized_pool_resource *thread_local_pool_resource()
+{
+    static thread_local unsynchronized_pool_resource pool(malloc_resource());
+    return &pool;
+}
+
+// polymorphic_allocator {{{1
+/**
+ * \headerfile memoryresource.h <Vc/Allocator>
+ *
+ * An allocator that obtains its memory from a memory_resource chosen at runtime, similar
+ * to \c std::pmr::polymorphic_allocator. Thus containers with different resources have
+ * the same type:
+ * \code
+ * Vc::pmr::monotonic_buffer_resource arena;
+ * Vc::pmr::vector<float> a(100, &arena);  // Vc::vector<float, polymorphic_allocator<float>>
+ * Vc::pmr::vector<float> b(100);          // uses get_default_resource()
+ * \endcode
+ * The memory is aligned to at least Vc::VectorAlignment.
+ *
+ * \tparam T The type of objects to allocate.
+ */
+template <typename T> class polymorphic_allocator
+{
+public:
+    typedef T value_type;
+
+    /// Uses get_default_resource().
+    polymorphic_allocator() noexcept : m_resource(get_default_resource()) {}
+    /// Uses \p r.
+    polymorphic_allocator(memory_resource *r) noexcept : m_resource(r) {}
+    polymorphic_allocator(const polymorphic_allocator &) = default;
+    template <typename U>
+    polymorphic_allocator(const polymorphic_allocator<U> &rhs) noexcept
+        : m_resource(rhs.resource())
+    {
+    }
+    polymorphic_allocator &operator=(const polymorphic_allocator &) = delete;
+
+    T *allocate(std::size_t n)
+    {
+        if (n > std::size_t(-1) / sizeof(T)) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T *>(m_resource->allocate(n * sizeof(T), Alignment));
+    }
+    void deallocate(T *p, std::size_t n) { m_resource->deallocate(p, n * sizeof(T), Alignment); }
+
+    /// A copy of a container uses the default resource, as with \c std::pmr.
+    polymorphic_allocator select_on_container_copy_construction() const
+    {
+        return polymorphic_allocator();
+    }
+
+    /// Returns the resource the memory is obtained from.
+    memory_resource *resource() const noexcept { return m_resource; }
+
+private:
+    static constexpr std::size_t Alignment =
+        alignof(T) > VectorAlignment ? alignof(T) : VectorAlignment;
+
+    memory_resource *m_resource;
+};
+
+template <typename T, typename U>
+inline bool operator==(const polymorphic_allocator<T> &a,
+                       const polymorphic_allocator<U> &b) noexcept
+{
+    return *a.resource() == *b.resource();
+}
+template <typename T, typename U>
+inline bool operator!=(const polymorphic_allocator<T> &a,
+                       const polymorphic_allocator<U> &b) noexcept
+{
+    return !(a == b);
+}
+//}}}1
+}  // namespace pmr
+}  // namespace Vc
+
+#endif  // VC_COMMON_MEMORYRESOURCE_H_
+
+// vim: foldmethod=marker
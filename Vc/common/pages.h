@@ -0,0 +1,271 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_PAGES_H_
+#define VC_COMMON_PAGES_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ * \headerfile pages.h <Vc/Allocator>
+ *
+ * Binds the pages that contain the \p bytes Bytes starting at \p p to the NUMA node
+ * \p node. Pages that were already touched are migrated to \p node.
+ *
+ * The whole page containing \p p is bound. Thus \p p should be page aligned (e.g. from
+ * Vc::malloc with Vc::AlignOnPage or Vc::AlignOnHugePage), otherwise data sharing the first
+ * page is bound as well.
+ *
+ * \return \c true on success, \c false if the binding failed or is not supported (only
+ * Linux is). Failure is harmless: the memory then stays where the default policy (i.e.
+ * first touch) puts it.
+ */
+inline bool bind_to_numa_node(void *p, std::size_t bytes, int node)
+{
+#if defined __linux__ && defined SYS_mbind
+    constexpr int MaxNodes = 1024;
+    constexpr int BitsPerLong = 8 * sizeof(unsigned long);
+    if (node < 0 || node >= MaxNodes || bytes == 0) {
+        return false;
+    }
+    const std::uintptr_t pageMask = sysconf(_SC_PAGESIZE) - 1;
+    const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(p) & ~pageMask;
+    const std::uintptr_t end = reinterpret_cast<std::uintptr_t>(p) + bytes;
+    unsigned long nodeMask[MaxNodes / BitsPerLong] = {};
+    nodeMask[node / BitsPerLong] = 1ul << (node % BitsPerLong);
+    // mbind(addr, len, MPOL_BIND, nodemask, maxnode, MPOL_MF_MOVE); the kernel ignores the
+    // last bit of maxnode
+    return 0 == syscall(SYS_mbind, begin, end - begin, 2, nodeMask, MaxNodes + 1, 2);
+#else
+    (void)p;
+    (void)bytes;
+    (void)node;
+    return false;
+#endif
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile pages.h <Vc/Allocator>
+ *
+ * Returns the NUMA node the page containing \p p resides on, or -1 if this cannot be
+ * determined (only Linux is supported). If the page was not touched yet, it is touched
+ * (and thus placed) by this call.
+ */
+inline int numa_node_of(const void *p)
+{
+#if defined __linux__ && defined SYS_get_mempolicy
+    int node = -1;
+    // get_mempolicy(&node, nullptr, 0, p, MPOL_F_NODE | MPOL_F_ADDR)
+    if (0 != syscall(SYS_get_mempolicy, &node, nullptr, 0, p, 3)) {
+        return -1;
+    }
+    return node;
+#else
+    (void)p;
+    return -1;
+#endif
+}
+
+namespace Common
+{
+/**\internal
+ * Maps \p bytes (a multiple of \p pageSize) of anonymous memory, preferably backed by huge
+ * pages of \p pageSize Bytes, and binds it to the NUMA node \p node if \p node >= 0.
+ *
+ * Explicit huge pages (\c MAP_HUGETLB) are only available if the administrator reserved
+ * them. Otherwise the mapping falls back to normal pages aligned on a 2 MiB boundary and
+ * advised to use transparent huge pages.
+ *
+ * \return The mapped memory or \c nullptr. Release with unmapPages(p, bytes).
+ */
+inline void *mapPages(std::size_t bytes, std::size_t pageSize, int node)
+{
+#ifdef _WIN32
+    (void)pageSize;
+    (void)node;
+    return _aligned_malloc(bytes, 4096);
+#else
+    void *p = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    // MAP_HUGE_2MB and MAP_HUGE_1GB: log2 of the page size, shifted by MAP_HUGE_SHIFT
+    const int sizeFlag = (pageSize >= (std::size_t(1) << 30) ? 30 : 21) << 26;
+    p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | sizeFlag, -1, 0);
+#endif
+    if (p == MAP_FAILED) {
+        // map an additional huge page to be able to trim the mapping to an aligned one
+        const std::size_t align = 2 * 1024 * 1024;
+        char *q = static_cast<char *>(mmap(nullptr, bytes + align, PROT_READ | PROT_WRITE,
+                                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        if (q == MAP_FAILED) {
+            return nullptr;
+        }
+        const std::size_t head = (align - reinterpret_cast<std::uintptr_t>(q) % align) % align;
+        if (head > 0) {
+            munmap(q, head);
+        }
+        if (head < align) {
+            munmap(q + head + bytes, align - head);
+        }
+        p = q + head;
+#ifdef MADV_HUGEPAGE
+        madvise(p, bytes, MADV_HUGEPAGE);
+#endif
+    }
+    if (node >= 0) {
+        bind_to_numa_node(p, bytes, node);
+    }
+    return p;
+#endif
+}
+
+/**\internal
+ * Releases memory obtained from mapPages.
+ */
+inline void unmapPages(void *p, std::size_t bytes)
+{
+#ifdef _WIN32
+    (void)bytes;
+    _aligned_free(p);
+#else
+    munmap(p, bytes);
+#endif
+}
+}  // namespace Common
+
+/**
+ * \ingroup Utilities
+ * \headerfile pages.h <Vc/Allocator>
+ *
+ * An allocator for large arrays that maps its memory directly from the operating system,
+ * preferably backed by huge pages, and optionally bound to a NUMA node.
+ *
+ * Every allocation is rounded up to a multiple of \p PageSize and aligned to (at least)
+ * 2 MiB. On Linux, explicit huge pages of \p PageSize (\c MAP_HUGETLB) are used if the
+ * administrator reserved them (e.g. via \c /proc/sys/vm/nr_hugepages or the \c hugepages=
+ * boot parameter for 1 GiB pages). Otherwise the allocator falls back to normal pages that
+ * are advised to use transparent huge pages (2 MiB). Other systems use normal pages.
+ *
+ * Thus the allocator is only sensible for few large allocations, e.g. the buffer of a
+ * std::vector that is accessed randomly:
+ * \code
+ * std::vector<float, Vc::HugePageAllocator<float>> table(1 << 28);
+ * std::vector<float, Vc::HugePageAllocator<float>> local(1 << 28, 0.f,
+ *                                                        Vc::HugePageAllocator<float>(1));
+ * \endcode
+ * The second vector is bound to NUMA node 1 (if binding is supported). An unbound
+ * allocation is placed by the first-touch policy of the operating system, see
+ * Vc::first_touch.
+ *
+ * \tparam T The type of objects to allocate.
+ * \tparam PageSize The preferred page size: 2 MiB or 1 GiB.
+ */
+template <typename T, std::size_t PageSize = 2 * 1024 * 1024> class HugePageAllocator
+{
+    static_assert(PageSize == 2 * 1024 * 1024 || PageSize == 1024 * 1024 * 1024,
+                  "HugePageAllocator supports page sizes of 2 MiB and 1 GiB");
+
+public:
+    typedef std::size_t    size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T*             pointer;
+    typedef const T*       const_pointer;
+    typedef T&             reference;
+    typedef const T&       const_reference;
+    typedef T              value_type;
+
+    template <typename U> struct rebind { typedef HugePageAllocator<U, PageSize> other; };
+
+    /// Creates an allocator that does not bind its memory to a NUMA node.
+    HugePageAllocator() noexcept = default;
+    /// Creates an allocator that binds its memory to the NUMA node \p numaNode.
+    explicit HugePageAllocator(int numaNode) noexcept : m_node(numaNode) {}
+    template <typename U>
+    HugePageAllocator(const HugePageAllocator<U, PageSize> &rhs) noexcept
+        : m_node(rhs.numaNode())
+    {
+    }
+
+    /// Returns the NUMA node the memory is bound to, or -1.
+    int numaNode() const noexcept { return m_node; }
+
+    pointer allocate(size_type n, const void * = nullptr)
+    {
+        if (n > max_size()) {
+            throw std::bad_alloc();
+        }
+        void *p = Common::mapPages(bytes(n), PageSize, m_node);
+        if (!p) {
+            throw std::bad_alloc();
+        }
+        return static_cast<pointer>(p);
+    }
+
+    void deallocate(pointer p, size_type n) { Common::unmapPages(p, bytes(n)); }
+
+    size_type max_size() const noexcept { return (size_type(-1) - PageSize) / sizeof(T); }
+
+private:
+    static std::size_t bytes(size_type n)
+    {
+        return n == 0 ? PageSize : (n * sizeof(T) + PageSize - 1) / PageSize * PageSize;
+    }
+
+    int m_node = -1;
+};
+
+template <typename T, typename U, std::size_t P>
+inline bool operator==(const HugePageAllocator<T, P> &a, const HugePageAllocator<U, P> &b)
+{
+    return a.numaNode() == b.numaNode();
+}
+template <typename T, typename U, std::size_t P>
+inline bool operator!=(const HugePageAllocator<T, P> &a, const HugePageAllocator<U, P> &b)
+{
+    return a.numaNode() != b.numaNode();
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_PAGES_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,184 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_PREFETCH_H_
+#define VC_COMMON_PREFETCH_H_
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include "macros.h"
+#ifdef Vc_IMPL_SSE
+#include <emmintrin.h>
+#include "../cpuid.h"
+#endif
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ *
+ * The distances in bytes ahead of the current load at which Prefetch<Auto> issues its
+ * software prefetches.
+ */
+struct PrefetchDistances {
+    /// The distance for prefetches into the L1 cache (\c prefetcht0). Zero disables them.
+    std::size_t l1;
+    /// The distance for prefetches into the L2 cache (\c prefetcht1). Zero disables them.
+    std::size_t l2;
+};
+
+namespace Detail
+{
+/**\internal
+ * Derives prefetch distances from the cache geometry CpuId reports: 1/32 of the L1 and L2
+ * data caches, which reproduces the compile-time Prefetch<> defaults (16 and 128 cache
+ * lines) for a 32 KiB L1 and a 256 KiB L2. Larger caches tolerate more data in flight.
+ * The result is rounded to whole cache lines and clamped to 4-64 lines for L1 and
+ * 32-512 lines for L2.
+ */
+inline PrefetchDistances prefetchDistancesFromCpuId()
+{
+#ifdef Vc_IMPL_SSE
+    const std::size_t line = CpuId::cacheLineSize() == 0 ? 64 : CpuId::cacheLineSize();
+    auto clampLines = [line](std::size_t bytes, std::size_t lo,
+                             std::size_t hi) -> std::size_t {
+        const std::size_t lines = bytes / line;
+        return (lines < lo ? lo : lines > hi ? hi : lines) * line;
+    };
+    return {clampLines(CpuId::L1Data() / 32, 4, 64),
+            clampLines(CpuId::L2Data() / 32, 32, 512)};
+#else
+    return {0, 0};
+#endif
+}
+
+inline PrefetchDistances &prefetchDistances()
+{
+    static PrefetchDistances distances = prefetchDistancesFromCpuId();
+    return distances;
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Returns the distances used by Prefetch<Auto>. They are derived from the CpuId cache
+ * geometry on first use, unless set_prefetch_distances() or
+ * calibrate_prefetch_distances() was called before.
+ */
+inline PrefetchDistances prefetch_distances() { return Detail::prefetchDistances(); }
+
+/**
+ * \ingroup Utilities
+ *
+ * Sets the distances used by Prefetch<Auto>. Call this before other threads execute
+ * loads with Prefetch<Auto>.
+ */
+inline void set_prefetch_distances(PrefetchDistances d) { Detail::prefetchDistances() = d; }
+
+/**
+ * \ingroup Utilities
+ *
+ * Measures which prefetch distances stream a buffer of four times the L2 size (at least
+ * 8 MiB) from memory fastest on this machine, stores them for Prefetch<Auto> and
+ * returns them.
+ *
+ * The candidates are no software prefetches at all and the CpuId derived distances
+ * scaled by 1/4, 1/2, 1, 2, and 4. Every candidate reads the buffer three times after
+ * flushing it from the caches; the fastest read decides. This takes a few tens of
+ * milliseconds, thus call it once at startup (before other threads use Prefetch<Auto>)
+ * rather than in a hot path. Without an x86 SIMD implementation there are no prefetches
+ * and this function returns zero distances.
+ */
+inline PrefetchDistances calibrate_prefetch_distances()
+{
+#ifdef Vc_IMPL_SSE
+    const PrefetchDistances geometry = Detail::prefetchDistancesFromCpuId();
+    const std::size_t line = CpuId::cacheLineSize() == 0 ? 64 : CpuId::cacheLineSize();
+    const std::size_t bytes =
+        4 * std::size_t(CpuId::L2Data()) > (8u << 20) ? 4 * std::size_t(CpuId::L2Data())
+                                                       : (8u << 20);
+    const std::size_t n = bytes / sizeof(float);
+    std::unique_ptr<float[]> buffer(new float[n]());
+    const float *const data = buffer.get();
+
+    auto measure = [&](PrefetchDistances d) -> std::chrono::steady_clock::duration {
+        const std::size_t l1 = d.l1 / sizeof(float), l2 = d.l2 / sizeof(float);
+        auto best = std::chrono::steady_clock::duration::max();
+        for (int rep = 0; rep < 3; ++rep) {
+            for (std::size_t i = 0; i < n; i += line / sizeof(float)) {
+                _mm_clflush(data + i);
+            }
+            _mm_mfence();
+            const auto start = std::chrono::steady_clock::now();
+            __m128 a = _mm_setzero_ps(), b = _mm_setzero_ps();
+            for (std::size_t i = 0; i + 16 <= n; i += 16) {
+                if (l1 != 0) {
+                    _mm_prefetch(reinterpret_cast<const char *>(data + i + l1), _MM_HINT_T0);
+                }
+                if (l2 != 0) {
+                    _mm_prefetch(reinterpret_cast<const char *>(data + i + l2), _MM_HINT_T1);
+                }
+                a = _mm_add_ps(a, _mm_loadu_ps(data + i));
+                b = _mm_add_ps(b, _mm_loadu_ps(data + i + 4));
+                a = _mm_add_ps(a, _mm_loadu_ps(data + i + 8));
+                b = _mm_add_ps(b, _mm_loadu_ps(data + i + 12));
+            }
+            volatile float sink = _mm_cvtss_f32(_mm_add_ps(a, b));
+            static_cast<void>(sink);
+            const auto t = std::chrono::steady_clock::now() - start;
+            best = t < best ? t : best;
+        }
+        return best;
+    };
+
+    PrefetchDistances result = {0, 0};
+    auto fastest = measure(result);
+    for (int shift = -2; shift <= 2; ++shift) {
+        auto scale = [&](std::size_t x) -> std::size_t {
+            x = shift < 0 ? x >> -shift : x << shift;
+            return x < line ? line : x / line * line;
+        };
+        const PrefetchDistances candidate = {scale(geometry.l1), scale(geometry.l2)};
+        const auto t = measure(candidate);
+        if (t < fastest) {
+            fastest = t;
+            result = candidate;
+        }
+    }
+    set_prefetch_distances(result);
+    return result;
+#else
+    return {0, 0};
+#endif
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_PREFETCH_H_
+
+// vim: foldmethod=marker
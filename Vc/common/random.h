@@ -0,0 +1,377 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_RANDOM_H_
+#define VC_COMMON_RANDOM_H_
+
+#include <atomic>
+#include <cstdint>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// splitmix64 {{{1
+Vc_INTRINSIC std::uint64_t splitmix64(std::uint64_t &x)
+{
+    std::uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+// rotl {{{1
+template <int K, typename U> Vc_INTRINSIC U rotl(const U &x)
+{
+    return (x << K) | (x >> (32 - K));
+}
+//}}}1
+}  // namespace Detail
+
+// xoshiro128pp_engine {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile random <Vc/random>
+ *
+ * A vectorized xoshiro128++ pseudo-random number generator (Blackman & Vigna).
+ *
+ * Every one of the \p N lanes is an independent xoshiro128++ generator with a period of
+ * \f$2^{128}-1\f$. After seeding, lane \c k starts \f$k\cdot 2^{64}\f$ steps after lane
+ * 0, thus the lanes never overlap for up to \f$2^{64}\f$ draws each. The engine contains
+ * no shared state: use one object per thread, either explicitly (e.g. copies advanced
+ * with jump() or long_jump()) or via thread_engine().
+ *
+ * \tparam N The number of lanes. It must match the size of the vectors that are
+ *           generated from it (e.g. `float_v::size()`).
+ */
+template <std::size_t N = float_v::size()> class xoshiro128pp_engine
+{
+public:
+    /// The type returned by operator(): \p N random 32-bit values.
+    using result_type = SimdArray<unsigned int, N>;
+
+    /// The seed used by the default constructor.
+    static constexpr std::uint64_t default_seed = 0x853c49e6748fea9bull;
+
+    /// Returns the number of lanes.
+    static constexpr std::size_t size() { return N; }
+    /// The smallest value a lane of operator() can return.
+    static constexpr unsigned int min() { return 0u; }
+    /// The largest value a lane of operator() can return.
+    static constexpr unsigned int max() { return 0xffffffffu; }
+
+    /// Initializes the engine via seed(\p value).
+    explicit xoshiro128pp_engine(std::uint64_t value = default_seed) { seed(value); }
+
+    /**
+     * Reinitializes the state from \p value (expanded with splitmix64) and spaces the
+     * lanes \f$2^{64}\f$ steps apart.
+     */
+    void seed(std::uint64_t value)
+    {
+        const std::uint64_t a = Detail::splitmix64(value);
+        const std::uint64_t b = Detail::splitmix64(value);
+        s0 = static_cast<unsigned int>(a);
+        s1 = static_cast<unsigned int>(a >> 32);
+        s2 = static_cast<unsigned int>(b);
+        s3 = static_cast<unsigned int>(b >> 32);
+        if (a == 0 && b == 0) {
+            s0 = 1u;  // the all-zero state is a fixed point
+        }
+        const result_type lane = result_type::IndexesFromZero();
+        for (std::size_t k = 1; k < N; ++k) {
+            xoshiro128pp_engine tmp(*this, 0);
+            tmp.jump(Jump);
+            const auto m = lane >= static_cast<unsigned int>(k);
+            s0(m) = tmp.s0;
+            s1(m) = tmp.s1;
+            s2(m) = tmp.s2;
+            s3(m) = tmp.s3;
+        }
+    }
+
+    /// Returns the next \p N random values and advances every lane by one step.
+    Vc_ALWAYS_INLINE result_type operator()()
+    {
+        const result_type r = Detail::rotl<7>(s0 + s3) + s0;
+        step();
+        return r;
+    }
+
+    /// Advances every lane by \p z steps.
+    void discard(unsigned long long z)
+    {
+        for (; z; --z) {
+            step();
+        }
+    }
+
+    /**
+     * Advances every lane by \f$N\cdot 2^{64}\f$ steps, i.e. past all lanes of the
+     * current engine. Calling jump() \c k times on the \c k-th copy of an engine yields
+     * non-overlapping streams for parallel computations.
+     */
+    void jump()
+    {
+        for (std::size_t k = 0; k < N; ++k) {
+            jump(Jump);
+        }
+    }
+
+    /**
+     * Advances every lane by \f$2^{96}\f$ steps. This yields \f$2^{32}\f$ starting
+     * points, from each of which jump() can generate further non-overlapping streams.
+     */
+    void long_jump() { jump(LongJump); }
+
+    /// Returns whether both engines will produce the same sequence.
+    friend bool operator==(const xoshiro128pp_engine &a, const xoshiro128pp_engine &b)
+    {
+        return all_of(a.s0 == b.s0 && a.s1 == b.s1 && a.s2 == b.s2 && a.s3 == b.s3);
+    }
+    friend bool operator!=(const xoshiro128pp_engine &a, const xoshiro128pp_engine &b)
+    {
+        return !(a == b);
+    }
+
+private:
+    // copy without reseeding, used by seed()
+    xoshiro128pp_engine(const xoshiro128pp_engine &rhs, int)
+        : s0(rhs.s0), s1(rhs.s1), s2(rhs.s2), s3(rhs.s3)
+    {
+    }
+
+    Vc_ALWAYS_INLINE void step()
+    {
+        const result_type t = s1 << 9;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = Detail::rotl<11>(s3);
+    }
+
+    // the jump polynomials for 2^64 and 2^96 steps from the reference implementation
+    static constexpr unsigned int Jump[4] = {0x8764000bu, 0xf542d2d3u, 0x6fa035c3u,
+                                             0x77f2db5bu};
+    static constexpr unsigned int LongJump[4] = {0xb523952eu, 0x0b6f099fu, 0xccf5a0efu,
+                                                 0x1c580662u};
+
+    void jump(const unsigned int (&poly)[4])
+    {
+        result_type t0 = 0u, t1 = 0u, t2 = 0u, t3 = 0u;
+        for (int i = 0; i < 4; ++i) {
+            for (int b = 0; b < 32; ++b) {
+                if (poly[i] & (1u << b)) {
+                    t0 ^= s0;
+                    t1 ^= s1;
+                    t2 ^= s2;
+                    t3 ^= s3;
+                }
+                step();
+            }
+        }
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
+    }
+
+    result_type s0, s1, s2, s3;
+};
+template <std::size_t N> constexpr std::uint64_t xoshiro128pp_engine<N>::default_seed;
+template <std::size_t N> constexpr unsigned int xoshiro128pp_engine<N>::Jump[4];
+template <std::size_t N> constexpr unsigned int xoshiro128pp_engine<N>::LongJump[4];
+
+// thread_engine {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile random <Vc/random>
+ *
+ * Returns an engine that is private to the calling thread. The \c k-th thread that calls
+ * this function gets the default-seeded engine advanced by \c k long jumps, thus the
+ * streams of different threads never overlap.
+ */
+template <std::size_t N = float_v::size()> xoshiro128pp_engine<N> &thread_engine()
+{
+    static std::atomic<unsigned long long> threadCount{0};
+    static thread_local xoshiro128pp_engine<N> engine = [] {
+        xoshiro128pp_engine<N> e;
+        for (auto k = threadCount.fetch_add(1, std::memory_order_relaxed); k; --k) {
+            e.long_jump();
+        }
+        return e;
+    }();
+    return engine;
+}
+
+// generate_canonical {{{1
+namespace Detail
+{
+template <typename V, typename Engine>
+Vc_INTRINSIC V generate_canonical(Engine &g, float)
+{
+    // the upper 24 bits yield every float k * 2^-24 in [0, 1)
+    using I = SimdArray<int, V::Size>;
+    return simd_cast<V>(simd_cast<I>(g() >> 8)) * typename V::EntryType(1.f / 16777216.f);
+}
+template <typename V, typename Engine>
+Vc_INTRINSIC V generate_canonical(Engine &g, double)
+{
+    // 27 + 26 bits from two draws yield every double k * 2^-53 in [0, 1)
+    using I = SimdArray<int, V::Size>;
+    const V hi = simd_cast<V>(simd_cast<I>(g() >> 5));
+    const V lo = simd_cast<V>(simd_cast<I>(g() >> 6));
+    return (hi * 67108864. + lo) * (1. / 9007199254740992.);
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile random <Vc/random>
+ *
+ * Returns uniformly distributed values in [0, 1) with the full mantissa precision of \p
+ * V.
+ */
+template <typename V, typename Engine> Vc_INTRINSIC V generate_canonical(Engine &g)
+{
+    static_assert(Engine::size() == V::Size,
+                  "the number of engine lanes must match the vector size");
+    return Detail::generate_canonical<V>(g, typename V::EntryType());
+}
+
+// uniform_real_distribution {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile random <Vc/random>
+ *
+ * Produces values of \p V uniformly distributed in \f$[a, b)\f$.
+ */
+template <typename V> class uniform_real_distribution
+{
+    using T = typename V::EntryType;
+
+public:
+    using result_type = V;
+
+    explicit uniform_real_distribution(T a = T(0), T b = T(1)) : m_a(a), m_b(b) {}
+
+    T a() const { return m_a; }
+    T b() const { return m_b; }
+    void reset() {}
+
+    template <typename Engine> V operator()(Engine &g)
+    {
+        return V(m_a) + V(m_b - m_a) * generate_canonical<V>(g);
+    }
+
+private:
+    T m_a, m_b;
+};
+
+// normal_distribution {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile random <Vc/random>
+ *
+ * Produces normally distributed values of \p V via the Box-Muller transform. Every
+ * second call returns the cached second half of the transform.
+ */
+template <typename V> class normal_distribution
+{
+    using T = typename V::EntryType;
+
+public:
+    using result_type = V;
+
+    explicit normal_distribution(T mean = T(0), T stddev = T(1))
+        : m_mean(mean), m_stddev(stddev)
+    {
+    }
+
+    T mean() const { return m_mean; }
+    T stddev() const { return m_stddev; }
+    /// Discards the cached value.
+    void reset() { m_haveSaved = false; }
+
+    template <typename Engine> V operator()(Engine &g)
+    {
+        if (m_haveSaved) {
+            m_haveSaved = false;
+            return m_saved;
+        }
+        // 1 - u is in (0, 1], so the logarithm is finite
+        const V r = sqrt(V(T(-2)) * log(V(T(1)) - generate_canonical<V>(g)));
+        const V phi = generate_canonical<V>(g) * T(2 * 3.14159265358979323846);
+        V s, c;
+        sincos(phi, &s, &c);
+        m_saved = V(m_mean) + V(m_stddev) * r * s;
+        m_haveSaved = true;
+        return V(m_mean) + V(m_stddev) * r * c;
+    }
+
+private:
+    T m_mean, m_stddev;
+    V m_saved;
+    bool m_haveSaved = false;
+};
+
+// exponential_distribution {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile random <Vc/random>
+ *
+ * Produces exponentially distributed values of \p V with rate \p lambda.
+ */
+template <typename V> class exponential_distribution
+{
+    using T = typename V::EntryType;
+
+public:
+    using result_type = V;
+
+    explicit exponential_distribution(T lambda = T(1)) : m_lambda(lambda) {}
+
+    T lambda() const { return m_lambda; }
+    void reset() {}
+
+    template <typename Engine> V operator()(Engine &g)
+    {
+        return log(V(T(1)) - generate_canonical<V>(g)) * V(T(-1) / m_lambda);
+    }
+
+private:
+    T m_lambda;
+};
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_RANDOM_H_
+
+// vim: foldmethod=marker
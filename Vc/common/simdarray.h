@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #endif
 
 #include <array>
+#include <limits>
 
 #include "writemaskedvector.h"
 #include "simdarrayhelper.h"
@@ -449,6 +450,15 @@ public:
         return {private_init, data.sorted()};
     }
 
+    Vc_INTRINSIC SimdArray compress(const mask_type &k) const
+    {
+        return {private_init, data.compress(internal_data(k))};
+    }
+    Vc_INTRINSIC SimdArray expand(const mask_type &k) const
+    {
+        return {private_init, data.expand(internal_data(k))};
+    }
+
     template <typename G> static Vc_INTRINSIC SimdArray generate(const G &gen)
     {
         return {private_init, VectorType::generate(gen)};
@@ -1132,7 +1142,7 @@ public:
             i += amount;
             if (i < SSize) {
                 return operator[](i);
-            } else if (i < 2 * SSize) {
+            } else if (i < SSize + static_cast<int>(NN)) {
                 return shiftIn[i - SSize];
             }
             return 0;
@@ -1369,6 +1379,27 @@ public:
         */
     }
 
+    ///\copydoc Vector::compress
+    inline SimdArray compress(const mask_type &k) const  //{{{2
+    {
+        constexpr int SSize0 = storage_type0::Size;
+        const auto k0 = Split::lo(k);
+        const int n0 = k0.count();
+        // move the n0 selected entries of data0 to the top of data0, directly in front of
+        // the selected entries of data1, and then shift everything down
+        return SimdArray{data0.compress(k0).shifted(n0 - SSize0),
+                         data1.compress(Split::hi(k))}
+            .shifted(SSize0 - n0);
+    }
+
+    ///\copydoc Vector::expand
+    inline SimdArray expand(const mask_type &k) const  //{{{2
+    {
+        const auto k0 = Split::lo(k);
+        return {data0.expand(k0), simd_cast<storage_type1>(internal_data0(shifted(k0.count())))
+                                      .expand(Split::hi(k))};
+    }
+
     /// \name Deprecated Members
     ///@{
 
@@ -1701,10 +1732,15 @@ Vc_FORWARD_UNARY_OPERATOR(abs);
 Vc_FORWARD_UNARY_OPERATOR(asin);
 Vc_FORWARD_UNARY_OPERATOR(atan);
 Vc_FORWARD_BINARY_OPERATOR(atan2);
+Vc_FORWARD_UNARY_OPERATOR(cbrt);
 Vc_FORWARD_UNARY_OPERATOR(ceil);
 Vc_FORWARD_BINARY_OPERATOR(copysign);
 Vc_FORWARD_UNARY_OPERATOR(cos);
+Vc_FORWARD_UNARY_OPERATOR(cosh);
+Vc_FORWARD_UNARY_OPERATOR(erf);
+Vc_FORWARD_UNARY_OPERATOR(erfc);
 Vc_FORWARD_UNARY_OPERATOR(exp);
+Vc_FORWARD_UNARY_OPERATOR(expm1);
 Vc_FORWARD_UNARY_OPERATOR(exponent);
 Vc_FORWARD_UNARY_OPERATOR(floor);
 /// Applies the std::fma function component-wise and concurrently.
@@ -1714,6 +1750,7 @@ inline SimdArray<T, N> fma(const SimdArray<T, N> &a, const SimdArray<T, N> &b,
 {
     return SimdArray<T, N>::fromOperation(Common::Operations::Forward_fma(), a, b, c);
 }
+Vc_FORWARD_BINARY_OPERATOR(hypot);
 Vc_FORWARD_UNARY_BOOL_OPERATOR(isfinite);
 Vc_FORWARD_UNARY_BOOL_OPERATOR(isinf);
 Vc_FORWARD_UNARY_BOOL_OPERATOR(isnan);
@@ -1748,11 +1785,14 @@ inline SimdArray<T, N> ldexp(const SimdArray<T, N> &x, const SimdArray<int, N> &
 }
 Vc_FORWARD_UNARY_OPERATOR(log);
 Vc_FORWARD_UNARY_OPERATOR(log10);
+Vc_FORWARD_UNARY_OPERATOR(log1p);
 Vc_FORWARD_UNARY_OPERATOR(log2);
+Vc_FORWARD_BINARY_OPERATOR(pow);
 Vc_FORWARD_UNARY_OPERATOR(reciprocal);
 Vc_FORWARD_UNARY_OPERATOR(round);
 Vc_FORWARD_UNARY_OPERATOR(rsqrt);
 Vc_FORWARD_UNARY_OPERATOR(sin);
+Vc_FORWARD_UNARY_OPERATOR(sinh);
 /// Determines sine and cosine concurrently and component-wise on \p x.
 template <typename T, std::size_t N>
 void sincos(const SimdArray<T, N> &x, SimdArray<T, N> *sin, SimdArray<T, N> *cos)
@@ -1760,10 +1800,45 @@ void sincos(const SimdArray<T, N> &x, SimdArray<T, N> *sin, SimdArray<T, N> *cos
     SimdArray<T, N>::callOperation(Common::Operations::Forward_sincos(), x, sin, cos);
 }
 Vc_FORWARD_UNARY_OPERATOR(sqrt);
+Vc_FORWARD_UNARY_OPERATOR(tanh);
 Vc_FORWARD_UNARY_OPERATOR(trunc);
 Vc_FORWARD_BINARY_OPERATOR(min);
 Vc_FORWARD_BINARY_OPERATOR(max);
 ///@}
+
+/**
+ * \name Reduced precision math functions
+ * These functions apply the Vc::fast_math overloads component-wise and concurrently.
+ */
+///@{
+#define Vc_FORWARD_FAST_MATH_UNARY(name_)                                                \
+    template <typename T, std::size_t N, typename V, std::size_t M>                      \
+    inline SimdArray<T, N, V, M> name_(const SimdArray<T, N, V, M> &x, FastMathTag)      \
+    {                                                                                    \
+        return SimdArray<T, N, V, M>::fromOperation(                                     \
+            Common::Operations::Forward_##name_(), x, fast_math);                        \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_FORWARD_FAST_MATH_UNARY(cos);
+Vc_FORWARD_FAST_MATH_UNARY(exp);
+Vc_FORWARD_FAST_MATH_UNARY(log);
+Vc_FORWARD_FAST_MATH_UNARY(sin);
+#undef Vc_FORWARD_FAST_MATH_UNARY
+template <typename T, std::size_t N, typename V, std::size_t M>
+inline SimdArray<T, N, V, M> atan2(const SimdArray<T, N, V, M> &y,
+                                   const SimdArray<T, N, V, M> &x, FastMathTag)
+{
+    return SimdArray<T, N, V, M>::fromOperation(Common::Operations::Forward_atan2(), y, x,
+                                                fast_math);
+}
+template <typename T, std::size_t N>
+void sincos(const SimdArray<T, N> &x, SimdArray<T, N> *sin, SimdArray<T, N> *cos,
+            FastMathTag)
+{
+    SimdArray<T, N>::callOperation(Common::Operations::Forward_sincos(), x, sin, cos,
+                                   fast_math);
+}
+///@}
 #undef Vc_FORWARD_UNARY_OPERATOR
 #undef Vc_FORWARD_UNARY_BOOL_OPERATOR
 #undef Vc_FORWARD_BINARY_OPERATOR
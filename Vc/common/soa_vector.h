@@ -0,0 +1,469 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SOA_VECTOR_H_
+#define VC_COMMON_SOA_VECTOR_H_
+
+#include <iterator>
+#include <tuple>
+#include <vector>
+#include "simdize.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+template <typename T, std::size_t N = 0> class soa_vector;
+
+namespace SoaDetail
+{
+// member types {{{1
+/**\internal
+ * The type of the \p I-th data member of \p T, as accessed by the simdize machinery.
+ */
+template <std::size_t I, typename T>
+using member_type = typename std::decay<decltype(
+    SimdizeDetail::get_dispatcher<I>(std::declval<T &>()))>::type;
+
+/**\internal
+ * The storage of soa_vector: one std::vector per data member of \p T.
+ */
+template <typename T, typename Seq> struct Columns;
+template <typename T, std::size_t... Is> struct Columns<T, Vc::index_sequence<Is...>> {
+    using type = std::tuple<std::vector<member_type<Is, T>, Vc::Allocator<member_type<Is, T>>>...>;
+};
+
+/**\internal
+ * Aligned loads and stores are used for a column if every vector-sized chunk of the column
+ * starts at an address that satisfies the alignment requirement of the vector type.
+ */
+template <typename V, typename M>
+using column_flags =
+    typename std::conditional<(V::Size * sizeof(M)) % V::MemoryAlignment == 0,
+                              Vc::AlignedTag, Vc::UnalignedTag>::type;
+
+// construct {{{1
+/**\internal
+ * Constructs a \p T from its data members via parenthesis-init, brace-init, or
+ * double-brace-init, whichever is valid (cf. the broadcast constructor of
+ * SimdizeDetail::Adapter).
+ */
+template <typename T, typename... Args>
+T construct_impl(std::integral_constant<int, 0>, Args &&... args)
+{
+    return T(std::forward<Args>(args)...);
+}
+template <typename T, typename... Args>
+T construct_impl(std::integral_constant<int, 1>, Args &&... args)
+{
+    return T{std::forward<Args>(args)...};
+}
+template <typename T, typename... Args>
+T construct_impl(std::integral_constant<int, 2>, Args &&... args)
+{
+    return T{{std::forward<Args>(args)...}};
+}
+template <typename T, typename... Args> T construct(Args &&... args)
+{
+    return construct_impl<T>(SimdizeDetail::preferred_construction<T, Args...>(),
+                             std::forward<Args>(args)...);
+}
+
+// Reference {{{1
+/**\internal
+ * Proxy reference to one scalar object in a soa_vector. It converts to \p T and can be
+ * assigned from \p T.
+ */
+template <typename C> class Reference
+{
+    using T = typename C::value_type;
+
+public:
+    Reference(C &c, std::size_t i) : container(c), index(i) {}
+
+    Reference &operator=(const T &x)
+    {
+        container.set(index, x);
+        return *this;
+    }
+    Reference &operator=(const Reference &x) { return operator=(static_cast<T>(x)); }
+    operator T() const { return static_cast<const C &>(container)[index]; }
+
+    /// Returns a reference to the \p I-th data member of the referenced object.
+    template <std::size_t I>
+    auto get() const -> decltype(std::declval<C &>().template column<I>()[0])
+    {
+        return container.template column<I>()[index];
+    }
+
+    friend void swap(Reference &&a, Reference &&b)
+    {
+        const T tmp = a;
+        a = static_cast<T>(b);
+        b = tmp;
+    }
+
+private:
+    C &container;
+    std::size_t index;
+};
+
+// VectorReference {{{1
+/**\internal
+ * Proxy reference to one vector-sized chunk in a soa_vector. It converts to
+ * simdize<T> (loading every column) and can be assigned from simdize<T> (storing every
+ * column).
+ */
+template <typename C> class VectorReference
+{
+    using V = typename C::vector_type;
+
+public:
+    VectorReference(C &c, std::size_t i) : container(c), index(i) {}
+
+    VectorReference &operator=(const V &x)
+    {
+        container.setVector(index, x);
+        return *this;
+    }
+    VectorReference &operator=(const VectorReference &x)
+    {
+        return operator=(static_cast<V>(x));
+    }
+    operator V() const { return static_cast<const C &>(container).vector(index); }
+
+private:
+    C &container;
+    std::size_t index;
+};
+
+// VectorIterator {{{1
+/**\internal
+ * Random access iterator over the vector-sized chunks of a soa_vector. Dereferencing a
+ * mutable iterator yields a VectorReference, a const iterator yields simdize<T>.
+ */
+template <typename C> class VectorIterator
+{
+    using Container = typename std::remove_const<C>::type;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename Container::vector_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = typename std::conditional<std::is_const<C>::value, value_type,
+                                                VectorReference<Container>>::type;
+    using pointer = void;
+
+    VectorIterator(C &c, std::size_t i) : container(&c), index(i) {}
+
+    reference operator*() const { return deref(std::is_const<C>()); }
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    VectorIterator &operator++() { ++index; return *this; }
+    VectorIterator operator++(int) { VectorIterator r = *this; ++index; return r; }
+    VectorIterator &operator--() { --index; return *this; }
+    VectorIterator operator--(int) { VectorIterator r = *this; --index; return r; }
+    VectorIterator &operator+=(difference_type n) { index += n; return *this; }
+    VectorIterator &operator-=(difference_type n) { index -= n; return *this; }
+    VectorIterator operator+(difference_type n) const { return {*container, index + n}; }
+    VectorIterator operator-(difference_type n) const { return {*container, index - n}; }
+    difference_type operator-(const VectorIterator &rhs) const
+    {
+        return difference_type(index) - difference_type(rhs.index);
+    }
+
+    bool operator==(const VectorIterator &rhs) const { return index == rhs.index; }
+    bool operator!=(const VectorIterator &rhs) const { return index != rhs.index; }
+    bool operator< (const VectorIterator &rhs) const { return index <  rhs.index; }
+    bool operator<=(const VectorIterator &rhs) const { return index <= rhs.index; }
+    bool operator> (const VectorIterator &rhs) const { return index >  rhs.index; }
+    bool operator>=(const VectorIterator &rhs) const { return index >= rhs.index; }
+
+private:
+    reference deref(std::true_type) const { return container->vector(index); }
+    reference deref(std::false_type) const { return {*container, index}; }
+
+    C *container;
+    std::size_t index;
+};
+//}}}1
+}  // namespace SoaDetail
+
+/**
+ * \ingroup Simdize
+ *
+ * A sequence container of \p T objects that stores every data member of \p T in its own
+ * contiguous, vector-aligned array ("structure of arrays"). Whereas a
+ * `std::vector<T>` requires a deinterleave (or gather) to obtain a `simdize<T>` object,
+ * soa_vector loads and stores `simdize<T>` objects with one vector load/store per data
+ * member.
+ *
+ * \tparam T A type that simdize can vectorize and that exposes its data members via the
+ *           std::tuple get interface, i.e. a class template declaring
+ *           Vc_SIMDIZE_INTERFACE, or a std::tuple, std::pair or std::array. All data
+ *           members must be arithmetic types. \p T must be constructible from its data
+ *           members in declaration order (via parenthesis or brace initialization).
+ * \tparam N The number of objects per vector, forwarded to simdize<T, N>.
+ *
+ * Every column is padded to a multiple of vectorSize() entries, such that the last
+ * vector-sized chunk can be loaded and stored as a whole. The values of the padding
+ * entries are unspecified; functions that grow the container overwrite them.
+ *
+ * \code
+ * Vc::soa_vector<Point> points;
+ * for (...) {
+ *   points.push_back(Point{x, y, z});    // scalar access
+ * }
+ * points[3] = Point{1.f, 2.f, 3.f};      // via a proxy reference
+ * for (auto &&chunk : points) {          // iteration over simdize<Point> chunks
+ *   Vc::simdize<Point> p = chunk;
+ *   p.x += p.y * p.z;
+ *   chunk = p;
+ * }
+ * \endcode
+ */
+template <typename T, std::size_t N> class soa_vector
+{
+    static constexpr std::size_t Members = SimdizeDetail::determine_tuple_size_<T>::value;
+    using IndexSeq = Vc::make_index_sequence<Members>;
+    using Storage = typename SoaDetail::Columns<T, IndexSeq>::type;
+
+public:
+    using value_type = T;
+    /// The vectorized type, storing vectorSize() objects of type \p T.
+    using vector_type = simdize<T, N>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = SoaDetail::Reference<soa_vector>;
+    using const_reference = T;
+    using vector_reference = SoaDetail::VectorReference<soa_vector>;
+    using iterator = SoaDetail::VectorIterator<soa_vector>;
+    using const_iterator = SoaDetail::VectorIterator<const soa_vector>;
+
+    /// The type of the \p I-th data member of \p T.
+    template <std::size_t I> using member_type = SoaDetail::member_type<I, T>;
+    /// The vector type for the \p I-th data member of \p T, as used in vector_type.
+    template <std::size_t I>
+    using member_vector_type = typename std::decay<decltype(
+        SimdizeDetail::get_dispatcher<I>(std::declval<vector_type &>()))>::type;
+
+    /// Returns the number of objects in one vector_type object.
+    static constexpr size_type vectorSize() { return vector_type::size(); }
+
+    soa_vector() = default;
+    /// Constructs a container with \p n copies of \p value.
+    explicit soa_vector(size_type n, const T &value) { resize(n, value); }
+    /// Constructs a container with the objects in [\p first, \p last).
+    template <typename It, typename = decltype(T(*std::declval<It &>()))>
+    soa_vector(It first, It last)
+    {
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+    }
+    soa_vector(std::initializer_list<T> init) : soa_vector(init.begin(), init.end()) {}
+
+    ///\name capacity
+    ///@{
+    /// Returns the number of \p T objects stored.
+    size_type size() const { return m_size; }
+    /// Returns whether size() == 0.
+    bool empty() const { return m_size == 0; }
+    /// Returns the number of vector-sized chunks, i.e. size() / vectorSize() rounded up.
+    size_type vectorsCount() const { return paddedSize(m_size) / vectorSize(); }
+    /// Returns the number of objects the container can hold without reallocation.
+    size_type capacity() const { return std::get<0>(m_columns).capacity(); }
+    /// Reserves storage for at least \p n objects (padded to vectorSize()).
+    void reserve(size_type n) { unpack(IndexSeq(), ReserveOp{paddedSize(n)}); }
+    ///@}
+
+    ///\name modifiers
+    ///@{
+    /// Resizes the container to \p n objects, value-initializing every data member of new
+    /// objects.
+    void resize(size_type n)
+    {
+        const size_type old = m_size;
+        unpack(IndexSeq(), ResizeOp{paddedSize(n)});
+        m_size = n;
+        for (size_type i = old; i < n; ++i) {
+            unpack(IndexSeq(), ClearOp{i});
+        }
+    }
+    /// Resizes the container to \p n objects, initializing new objects with \p value.
+    void resize(size_type n, const T &value)
+    {
+        const size_type old = m_size;
+        unpack(IndexSeq(), ResizeOp{paddedSize(n)});
+        m_size = n;
+        for (size_type i = old; i < n; ++i) {
+            set(i, value);
+        }
+    }
+    /// Appends \p x.
+    void push_back(const T &x)
+    {
+        if (m_size == std::get<0>(m_columns).size()) {
+            unpack(IndexSeq(), ResizeOp{m_size + vectorSize()});
+        }
+        set(m_size++, x);
+    }
+    /// Appends \p x. Equivalent to push_back(T(args...)).
+    template <typename... Args> void emplace_back(Args &&... args)
+    {
+        push_back(T(std::forward<Args>(args)...));
+    }
+    /// Removes the last object.
+    void pop_back()
+    {
+        --m_size;
+        if (paddedSize(m_size) < std::get<0>(m_columns).size()) {
+            unpack(IndexSeq(), ResizeOp{paddedSize(m_size)});
+        }
+    }
+    /// Removes all objects. The capacity is not changed.
+    void clear()
+    {
+        unpack(IndexSeq(), ResizeOp{0});
+        m_size = 0;
+    }
+    ///@}
+
+    ///\name scalar access
+    ///@{
+    /// Returns a proxy reference to the object at index \p i.
+    reference operator[](size_type i) { return {*this, i}; }
+    /// Returns a copy of the object at index \p i.
+    T operator[](size_type i) const { return get(i, IndexSeq()); }
+    /// Assigns \p x to the object at index \p i.
+    void set(size_type i, const T &x) { unpack(IndexSeq(), SetOp{i, x}); }
+    /// Returns a pointer to the contiguous array of the \p I-th data member.
+    template <std::size_t I> member_type<I> *column()
+    {
+        return std::get<I>(m_columns).data();
+    }
+    template <std::size_t I> const member_type<I> *column() const
+    {
+        return std::get<I>(m_columns).data();
+    }
+    ///@}
+
+    ///\name vector access
+    ///@{
+    /// Returns a proxy reference to the \p i-th vector-sized chunk.
+    vector_reference vector(size_type i) { return {*this, i}; }
+    /// Loads and returns the \p i-th vector-sized chunk. The entries of the last chunk
+    /// beyond size() are unspecified.
+    vector_type vector(size_type i) const
+    {
+        return loadVector(i * vectorSize(), IndexSeq());
+    }
+    /// Stores \p x to the \p i-th vector-sized chunk.
+    void setVector(size_type i, const vector_type &x)
+    {
+        unpack(IndexSeq(), StoreOp{i * vectorSize(), x});
+    }
+
+    /// Returns an iterator over the vector-sized chunks.
+    iterator begin() { return {*this, 0}; }
+    const_iterator begin() const { return {*this, 0}; }
+    const_iterator cbegin() const { return {*this, 0}; }
+    iterator end() { return {*this, vectorsCount()}; }
+    const_iterator end() const { return {*this, vectorsCount()}; }
+    const_iterator cend() const { return {*this, vectorsCount()}; }
+    ///@}
+
+private:
+    static constexpr size_type paddedSize(size_type n)
+    {
+        return (n + vectorSize() - 1) / vectorSize() * vectorSize();
+    }
+
+    // per column operations {{{
+    template <typename F, std::size_t... Is> void unpack(Vc::index_sequence<Is...>, F &&f)
+    {
+        auto &&unused = {(f(std::get<Is>(m_columns), std::integral_constant<std::size_t, Is>()), 0)...};
+        if (&unused == &unused) {}
+    }
+
+    struct ReserveOp {
+        size_type n;
+        template <typename Col, typename I> void operator()(Col &c, I) const { c.reserve(n); }
+    };
+    struct ResizeOp {
+        size_type n;
+        template <typename Col, typename I> void operator()(Col &c, I) const { c.resize(n); }
+    };
+    struct ClearOp {
+        size_type i;
+        template <typename Col, typename I> void operator()(Col &c, I) const
+        {
+            c[i] = typename Col::value_type();
+        }
+    };
+    struct SetOp {
+        size_type i;
+        const T &x;
+        template <typename Col, typename I> void operator()(Col &c, I) const
+        {
+            c[i] = SimdizeDetail::get_dispatcher<I::value>(x);
+        }
+    };
+    struct StoreOp {
+        size_type offset;
+        const vector_type &x;
+        template <typename Col, typename I> void operator()(Col &c, I) const
+        {
+            using V = member_vector_type<I::value>;
+            SimdizeDetail::get_dispatcher<I::value>(x).store(
+                &c[offset], SoaDetail::column_flags<V, typename Col::value_type>());
+        }
+    };
+
+    template <std::size_t... Is> T get(size_type i, Vc::index_sequence<Is...>) const
+    {
+        return SoaDetail::construct<T>(std::get<Is>(m_columns)[i]...);
+    }
+
+    template <std::size_t... Is>
+    vector_type loadVector(size_type offset, Vc::index_sequence<Is...>) const
+    {
+        return vector_type(SoaDetail::construct<typename vector_type::base_type>(
+            member_vector_type<Is>(
+                &std::get<Is>(m_columns)[offset],
+                SoaDetail::column_flags<member_vector_type<Is>, member_type<Is>>())...));
+    }
+    // }}}
+
+    Storage m_columns;
+    size_type m_size = 0;
+};
+
+}  // namespace Vc
+
+#endif  // VC_COMMON_SOA_VECTOR_H_
+
+// vim: foldmethod=marker
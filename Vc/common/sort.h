@@ -0,0 +1,312 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SORT_H_
+#define VC_COMMON_SORT_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// bitonicMerge {{{1
+/**\internal
+ * Merges the sorted vectors \p a and \p b: afterwards \p a holds the smaller and \p b
+ * the larger half of the entries, both sorted. Comparing \p a against the reversed \p b
+ * yields two bitonic sequences, which the sorting network of sorted() orders.
+ */
+template <typename V> Vc_INTRINSIC void bitonicMerge(V &a, V &b)
+{
+    const V r = b.reversed();
+    const V lo = min(a, r);
+    const V hi = max(a, r);
+    a = lo.sorted();
+    b = hi.sorted();
+}
+
+// mergeRuns {{{1
+/**\internal
+ * Merges the sorted ranges [\p a, \p a + \p na) and [\p b, \p b + \p nb) into \p out,
+ * which must not overlap the inputs.
+ *
+ * One register holds the largest entries merged so far. It is merged with the next
+ * vector from the input whose next entry is smaller and the lower half is stored.
+ * Everything that has not been loaded is at least as large as that lower half.
+ */
+template <typename V, typename T>
+void mergeRuns(const T *a, std::size_t na, const T *b, std::size_t nb, T *out)
+{
+    std::size_t ia = 0, ib = 0;
+    if (na >= V::Size && nb >= V::Size) {
+        V lo(a, Vc::Unaligned);
+        V hi(b, Vc::Unaligned);
+        ia = ib = V::Size;
+        for (;;) {
+            bitonicMerge(lo, hi);
+            lo.store(out, Vc::Unaligned);
+            out += V::Size;
+            const bool fromA = ia < na && (ib == nb || !(b[ib] < a[ia]));
+            if (fromA && ia + V::Size <= na) {
+                lo = V(a + ia, Vc::Unaligned);
+                ia += V::Size;
+            } else if (!fromA && ib + V::Size <= nb) {
+                lo = V(b + ib, Vc::Unaligned);
+                ib += V::Size;
+            } else {
+                break;
+            }
+        }
+        // the remaining entries of hi go back in front of one of the inputs
+        alignas(V) T tmp[V::Size];
+        hi.store(tmp, Vc::Aligned);
+        std::size_t it = 0;
+        while (it < V::Size) {
+            const bool fromA = ia < na && (ib == nb || !(b[ib] < a[ia]));
+            if (fromA && a[ia] < tmp[it]) {
+                *out++ = a[ia++];
+            } else if (!fromA && ib < nb && b[ib] < tmp[it]) {
+                *out++ = b[ib++];
+            } else {
+                *out++ = tmp[it++];
+            }
+        }
+    }
+    while (ia < na && ib < nb) {
+        *out++ = b[ib] < a[ia] ? b[ib++] : a[ia++];
+    }
+    out = std::copy(a + ia, a + na, out);
+    std::copy(b + ib, b + nb, out);
+}
+
+// mergeSort {{{1
+/**\internal
+ * Sorts [\p data, \p data + \p n) with a bottom-up merge sort. Every vector is sorted
+ * in-register with sorted(), then runs of doubling length are merged via mergeRuns,
+ * alternating between \p data and \p buffer (which must have room for \p n entries).
+ */
+template <typename V, typename T> void mergeSort(T *data, std::size_t n, T *buffer)
+{
+    std::size_t i = 0;
+    for (; i + V::Size <= n; i += V::Size) {
+        V(data + i, Vc::Unaligned).sorted().store(data + i, Vc::Unaligned);
+    }
+    std::sort(data + i, data + n);
+
+    T *from = data;
+    T *to = buffer;
+    for (std::size_t run = V::Size; run < n; run *= 2) {
+        for (std::size_t begin = 0; begin < n; begin += 2 * run) {
+            const std::size_t mid = std::min(begin + run, n);
+            const std::size_t end = std::min(begin + 2 * run, n);
+            mergeRuns<V>(from + begin, mid - begin, from + mid, end - mid, to + begin);
+        }
+        std::swap(from, to);
+    }
+    if (from != data) {
+        std::memcpy(data, from, n * sizeof(T));
+    }
+}
+
+// partition {{{1
+/**\internal
+ * Moves the entries of [\p data, \p data + \p n) that are less than \p pivot to the
+ * front and returns their number. The comparison is done for a full vector at once and
+ * the entries are then written without branches: to the front of \p buffer if they
+ * are less, to the back otherwise.
+ */
+template <typename V, typename T>
+std::size_t partition(T *data, std::size_t n, T *buffer, T pivot)
+{
+    const V vpivot = pivot;
+    std::size_t left = 0;
+    std::size_t right = n;
+    std::size_t i = 0;
+    for (; i + V::Size <= n; i += V::Size) {
+        const int less = (V(data + i, Vc::Unaligned) < vpivot).toInt();
+        for (std::size_t k = 0; k < V::Size; ++k) {
+            const std::size_t isLess = (less >> k) & 1;
+            buffer[left] = data[i + k];
+            buffer[right - 1] = data[i + k];
+            left += isLess;
+            right -= 1 - isLess;
+        }
+    }
+    for (; i < n; ++i) {
+        const std::size_t isLess = data[i] < pivot;
+        buffer[left] = data[i];
+        buffer[right - 1] = data[i];
+        left += isLess;
+        right -= 1 - isLess;
+    }
+    std::memcpy(data, buffer, n * sizeof(T));
+    return left;
+}
+
+template <typename T> Vc_INTRINSIC const T &median3(const T &a, const T &b, const T &c)
+{
+    return a < b ? (b < c ? b : (a < c ? c : a)) : (a < c ? a : (b < c ? c : b));
+}
+
+// quickSort {{{1
+/**\internal
+ * Partitions large ranges recursively until they fit into the cache and sorts those with
+ * mergeSort. If a partition makes no progress (many equal keys) or the recursion gets
+ * too deep, the range is merge-sorted directly, thus the complexity is O(n log n).
+ */
+template <typename V, typename T>
+void quickSort(T *data, std::size_t n, T *buffer, int depthLimit)
+{
+    constexpr std::size_t threshold = 32 * 1024 / sizeof(T);
+    while (n > threshold && depthLimit > 0) {
+        --depthLimit;
+        const T pivot = median3(data[n / 4], data[n / 2], data[n - n / 4]);
+        const std::size_t left = partition<V>(data, n, buffer, pivot);
+        if (left == 0 || left == n) {
+            break;
+        }
+        // recurse into the smaller part to bound the stack depth
+        if (left < n - left) {
+            quickSort<V>(data, left, buffer, depthLimit);
+            data += left;
+            buffer += left;
+            n -= left;
+        } else {
+            quickSort<V>(data + left, n - left, buffer + left, depthLimit);
+            n = left;
+        }
+    }
+    mergeSort<V>(data, n, buffer);
+}
+
+// signed zeros {{{1
+/**\internal
+ * Returns the number of -0 entries in [\p data, \p data + \p n).
+ */
+template <typename V, typename T>
+std::size_t countNegativeZeros(const T *data, std::size_t n, std::true_type)
+{
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + V::Size <= n; i += V::Size) {
+        const V x(data + i, Vc::Unaligned);
+        count += (x == V::Zero() && isnegative(x)).count();
+    }
+    for (; i < n; ++i) {
+        count += data[i] == T(0) && std::signbit(data[i]);
+    }
+    return count;
+}
+template <typename V, typename T>
+constexpr std::size_t countNegativeZeros(const T *, std::size_t, std::false_type)
+{
+    return 0;
+}
+
+/**\internal
+ * min and max do not distinguish -0 and +0, thus the sorting networks may turn one into
+ * the other. All zeros are adjacent in the sorted range [\p data, \p data + \p n):
+ * rewrite them with \p negativeZeros times -0 first.
+ */
+template <typename T>
+void restoreSignedZeros(T *data, std::size_t n, std::size_t negativeZeros, std::true_type)
+{
+    T *it = std::lower_bound(data, data + n, T(0));
+    for (; negativeZeros > 0; --negativeZeros) {
+        *it++ = -T(0);
+    }
+    for (; it != data + n && *it == T(0); ++it) {
+        *it = T(0);
+    }
+}
+template <typename T>
+Vc_INTRINSIC void restoreSignedZeros(T *, std::size_t, std::size_t, std::false_type)
+{
+}
+
+template <typename It>
+using is_sortable_iterator =
+    Traits::is_valid_vector_argument<typename std::iterator_traits<It>::value_type>;
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile sort.h <Vc/Vc>
+ *
+ * Sorts the contiguous range [\p first, \p last) in ascending order using the vector
+ * sorting networks of Vector::sorted().
+ *
+ * Ranges that fit into the cache are sorted by sorting every vector in-register and
+ * merging the resulting runs with vectorized bitonic merges. Larger ranges are first
+ * split by a quicksort partition step that compares a full vector against the pivot at
+ * once. The algorithm allocates a buffer of the size of the range and is not stable.
+ *
+ * Ranges of types that Vc cannot vectorize are sorted with `std::sort`. As with
+ * `std::sort`, -0 and +0 are equivalent and may appear in any order, but both are kept.
+ * The result for ranges containing NaNs is unspecified.
+ */
+template <typename RandomIt>
+inline enable_if<Detail::is_sortable_iterator<RandomIt>::value, void> simd_sort(
+    RandomIt first, RandomIt last)
+{
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+    typedef Vector<T> V;
+    const std::size_t n = std::distance(first, last);
+    // without vectorization there is nothing to gain over std::sort
+    if (V::Size == 1 || n < 2 * V::Size) {
+        std::sort(first, last);
+        return;
+    }
+    T *data = std::addressof(*first);
+    const std::size_t negativeZeros =
+        Detail::countNegativeZeros<V>(data, n, std::is_floating_point<T>());
+    std::unique_ptr<T[]> buffer(new T[n]);
+    int depthLimit = 0;
+    for (std::size_t k = n; k > 1; k >>= 1) {
+        depthLimit += 2;
+    }
+    Detail::quickSort<V>(data, n, buffer.get(), depthLimit);
+    Detail::restoreSignedZeros(data, n, negativeZeros, std::is_floating_point<T>());
+}
+
+template <typename RandomIt>
+inline enable_if<!Detail::is_sortable_iterator<RandomIt>::value, void> simd_sort(
+    RandomIt first, RandomIt last)
+{
+    std::sort(first, last);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_SORT_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,573 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_STENCIL_H_
+#define VC_COMMON_STENCIL_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include "utility.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ * \headerfile stencil.h <Vc/stencil>
+ *
+ * How fill_halo initializes the halo (ghost cells) around a grid.
+ */
+enum class Boundary {
+    /// The halo is set to zero.
+    Zeros,
+    /// Every halo entry repeats the nearest entry of the grid.
+    Clamp,
+    /// The grid is continued periodically.
+    Periodic
+};
+
+namespace Detail
+{
+// StencilTaps {{{1
+/**\internal
+ * Maps the taps of the \p Dim dimensional stencil \p S onto Lines x Width taps: the input
+ * lines (rows) the stencil reads and the offsets in x direction within each line.
+ */
+template <typename S, std::size_t Dim> struct StencilTaps;
+template <typename S> struct StencilTaps<S, 1> {
+    static constexpr int Radius = S::radius;
+    static constexpr int Width = 2 * Radius + 1;
+    static constexpr std::size_t Lines = 1;
+    static constexpr int dz(std::size_t) { return 0; }
+    static constexpr int dy(std::size_t) { return 0; }
+    static constexpr auto coefficient(std::size_t, int dx) -> decltype(S::coefficient(dx))
+    {
+        return S::coefficient(dx);
+    }
+};
+template <typename S> struct StencilTaps<S, 2> {
+    static constexpr int Radius = S::radius;
+    static constexpr int Width = 2 * Radius + 1;
+    static constexpr std::size_t Lines = Width;
+    static constexpr int dz(std::size_t) { return 0; }
+    static constexpr int dy(std::size_t l) { return int(l) - Radius; }
+    static constexpr auto coefficient(std::size_t l, int dx)
+        -> decltype(S::coefficient(0, dx))
+    {
+        return S::coefficient(dy(l), dx);
+    }
+};
+template <typename S> struct StencilTaps<S, 3> {
+    static constexpr int Radius = S::radius;
+    static constexpr int Width = 2 * Radius + 1;
+    static constexpr std::size_t Lines = Width * Width;
+    static constexpr int dz(std::size_t l) { return int(l) / Width - Radius; }
+    static constexpr int dy(std::size_t l) { return int(l) % Width - Radius; }
+    static constexpr auto coefficient(std::size_t l, int dx)
+        -> decltype(S::coefficient(0, 0, dx))
+    {
+        return S::coefficient(dz(l), dy(l), dx);
+    }
+};
+
+// has_single_instruction_concat {{{1
+/**\internal
+ * Whether Vector::shifted(amount, shiftIn) compiles to a single shuffle for all constant
+ * amounts: palignr for 16 Byte vectors, valignd/valignq with AVX-512. On AVX(2) a shift
+ * across the 128-bit lanes needs two shuffles, which is more expensive than an unaligned
+ * load that hits L1.
+ */
+template <typename V>
+struct has_single_instruction_concat
+    : public std::integral_constant<bool, (sizeof(V) <= 16
+#ifdef Vc_IMPL_AVX512VL
+                                           || sizeof(typename V::EntryType) >= 4
+#endif
+                                           )> {
+};
+
+// StencilTapLoop {{{1
+/**\internal
+ * Accumulates the taps [\p Tap, \p End) of \p Taps, where tap t reads line t / Width at
+ * the offset t % Width - Radius. The recursion makes the offsets and coefficients
+ * compile-time constants, such that taps with a zero coefficient vanish and
+ * Vector::shifted sees constant amounts.
+ */
+template <typename V, typename Taps, std::size_t Tap = 0,
+          std::size_t End = Taps::Lines * Taps::Width>
+struct StencilTapLoop {
+    typedef typename V::EntryType T;
+    static constexpr std::size_t Line = Tap / Taps::Width;
+    static constexpr int Offset = int(Tap % Taps::Width) - Taps::Radius;
+    typedef StencilTapLoop<V, Taps, Tap + 1, End> Next;
+
+    /// One unaligned load per tap.
+    static Vc_INTRINSIC V direct(const T *const *lines, std::size_t x, V acc)
+    {
+        const T c = Taps::coefficient(Line, Offset);
+        if (c != T()) {
+            acc = multiplyAdd(V(c), V(lines[Line] + x + Offset, Vc::Unaligned), acc);
+        }
+        return Next::direct(lines, x, acc);
+    }
+
+    /**
+     * Taps at a multiple of Size load with \p Flags (i.e. aligned if possible). The other
+     * taps concatenate the two vectors at q * Size and (q + 1) * Size with
+     * Vector::shifted, if that is a single instruction, and use an unaligned load
+     * otherwise. The loads of equal offsets are shared by the taps.
+     */
+    template <typename Flags>
+    static Vc_INTRINSIC V shifted(const T *const *lines, std::size_t x, V acc, Flags flags)
+    {
+        // Offset = q * Size + r with 0 <= r < Size
+        constexpr int Size = V::Size;
+        constexpr int q = (Offset + Taps::Radius * Size) / Size - Taps::Radius;
+        constexpr int r = Offset - q * Size;
+        const T c = Taps::coefficient(Line, Offset);
+        if (c != T()) {
+            const T *const mem = lines[Line] + x;
+            if (r == 0) {
+                acc = multiplyAdd(V(c), V(mem + Offset, flags), acc);
+            } else if (has_single_instruction_concat<V>::value) {
+                acc = multiplyAdd(
+                    V(c), V(mem + q * Size, flags).shifted(r, V(mem + (q + 1) * Size, flags)),
+                    acc);
+            } else {
+                acc = multiplyAdd(V(c), V(mem + Offset, Vc::Unaligned), acc);
+            }
+        }
+        return Next::shifted(lines, x, acc, flags);
+    }
+};
+template <typename V, typename Taps, std::size_t End>
+struct StencilTapLoop<V, Taps, End, End> {
+    typedef typename V::EntryType T;
+    static Vc_INTRINSIC V direct(const T *const *, std::size_t, V acc) { return acc; }
+    template <typename Flags>
+    static Vc_INTRINSIC V shifted(const T *const *, std::size_t, V acc, Flags)
+    {
+        return acc;
+    }
+};
+
+// stencilVector {{{1
+/**\internal
+ * Computes the \p V::Size results starting at \p x from unaligned loads of every tap.
+ * This is the straightforward approach (one load per non-zero tap), used for the ends of
+ * the lines.
+ */
+template <typename V, typename Taps>
+Vc_INTRINSIC V stencilVector(const typename V::EntryType *const *lines, std::size_t x)
+{
+    return StencilTapLoop<V, Taps>::direct(lines, x, V::Zero());
+}
+
+// stencilShifted {{{1
+/**\internal
+ * The main loop over one line of output. The input of every line is read with one vector
+ * load per V::Size entries, aligned if \p Flags says so, and the neighbor vectors are
+ * built by concatenating two of these vectors with Vector::shifted(amount, shiftIn)
+ * (palignr/valignd) instead of one unaligned load per tap (see StencilTapLoop::shifted).
+ *
+ * Computes the results in [\p x, \p end); \p end - \p x must be a multiple of \p V::Size,
+ * and the input must be readable from x - Q * V::Size up to end + Q * V::Size, where Q is
+ * the radius in vectors.
+ */
+template <typename V, typename Taps, typename Flags>
+inline void stencilShifted(const typename V::EntryType *const *lines,
+                           typename V::EntryType *out, std::size_t x, std::size_t end,
+                           Flags flags)
+{
+    for (; x < end; x += V::Size) {
+        StencilTapLoop<V, Taps>::shifted(lines, x, V::Zero(), flags)
+            .store(out + x, Vc::Unaligned);
+    }
+}
+
+// stencilLine {{{1
+/**\internal
+ * Computes \p n results of one output line:
+ * `out[x] = sum over l, dx of coefficient(l, dx) * lines[l][x + dx]`.
+ * All \p lines must be readable from -Radius to n + Radius.
+ */
+template <typename V, typename Taps>
+inline void stencilLine(const typename V::EntryType *const *lineArg,
+                        typename V::EntryType *out, std::size_t n)
+{
+    typedef typename V::EntryType T;
+    constexpr std::size_t Size = V::Size;
+    constexpr std::size_t R = Taps::Radius;
+    constexpr std::size_t Q = (R + Size - 1) / Size;
+    if (n < Size) {
+        for (std::size_t x = 0; x < n; ++x) {
+            T acc = T();
+            for (std::size_t l = 0; l < Taps::Lines; ++l) {
+                for (int dx = -Taps::Radius; dx <= Taps::Radius; ++dx) {
+                    acc += Taps::coefficient(l, dx) * lineArg[l][int(x) + dx];
+                }
+            }
+            out[x] = acc;
+        }
+        return;
+    }
+    // Vector stores may alias anything, including the caller's array of line pointers.
+    // A local copy, which is only indexed with constants, keeps the pointers in registers.
+    const T *lines[Taps::Lines];
+    std::copy(lineArg, lineArg + Taps::Lines, lines);
+
+    // The shifted loop needs Q vectors of context on both sides and starts where the first
+    // line is aligned.
+    constexpr std::size_t A = V::MemoryAlignment / sizeof(T);  // alignment in entries
+    const std::size_t misalignment =
+        reinterpret_cast<std::uintptr_t>(lineArg[0]) % V::MemoryAlignment / sizeof(T);
+    const std::size_t begin = Q * Size - R + (A - (Q * Size - R + misalignment) % A) % A;
+    const std::size_t end =
+        n + R >= begin + (Q + 1) * Size
+            ? begin + (n + R - Q * Size - begin) / Size * Size
+            : begin;
+
+    if (begin >= end) {  // too short for the shifted loop
+        for (std::size_t x = 0; x + Size < n; x += Size) {
+            stencilVector<V, Taps>(lines, x).store(out + x, Vc::Unaligned);
+        }
+        stencilVector<V, Taps>(lines, n - Size).store(out + n - Size, Vc::Unaligned);
+        return;
+    }
+
+    // head: unaligned vectors, the last one overlapping the shifted loop
+    for (std::size_t x = 0; x + Size < begin; x += Size) {
+        stencilVector<V, Taps>(lines, x).store(out + x, Vc::Unaligned);
+    }
+    const std::size_t headLast = std::max(begin, Size) - Size;
+    stencilVector<V, Taps>(lines, headLast).store(out + headLast, Vc::Unaligned);
+
+    bool aligned = true;
+    for (std::size_t l = 0; l < Taps::Lines; ++l) {
+        aligned = aligned && 0 == (reinterpret_cast<std::uintptr_t>(lineArg[l] + begin) &
+                                   (V::MemoryAlignment - 1));
+    }
+    if (aligned) {
+        stencilShifted<V, Taps>(lines, out, begin, end, Vc::Aligned);
+    } else {
+        stencilShifted<V, Taps>(lines, out, begin, end, Vc::Unaligned);
+    }
+
+    // tail: unaligned vectors, the last one overlapping
+    if (end < n) {
+        for (std::size_t x = end; x + Size < n; x += Size) {
+            stencilVector<V, Taps>(lines, x).store(out + x, Vc::Unaligned);
+        }
+        stencilVector<V, Taps>(lines, n - Size).store(out + n - Size, Vc::Unaligned);
+    }
+}
+
+// StencilGrid {{{1
+/**\internal
+ * The geometry of a stencil application: input and output pointers to the first entry of
+ * the (interior) grid, the pitches between rows and slices, and the extents. Row r
+ * denotes the row r % ny of slice r / ny.
+ */
+template <typename T> struct StencilGrid {
+    const T *in;
+    std::size_t inPitch, inSlicePitch;
+    T *out;
+    std::size_t outPitch, outSlicePitch;
+    std::size_t nx, ny, rows;
+};
+
+/**\internal
+ * Applies the stencil to the rows [\p begin, \p end) of \p g.
+ */
+template <typename S, std::size_t Dim, typename T>
+inline void stencilRows(const StencilGrid<T> &g, std::size_t begin, std::size_t end)
+{
+    typedef StencilTaps<S, Dim> Taps;
+    // increment (z, y) instead of dividing every row index
+    std::size_t z = begin / g.ny;
+    std::size_t y = begin % g.ny;
+    for (std::size_t r = begin; r < end; ++r, ++y) {
+        if (y == g.ny) {
+            y = 0;
+            ++z;
+        }
+        const T *lines[Taps::Lines];
+        for (std::size_t l = 0; l < Taps::Lines; ++l) {
+            lines[l] = g.in + (std::ptrdiff_t(z) + Taps::dz(l)) * std::ptrdiff_t(g.inSlicePitch) +
+                       (std::ptrdiff_t(y) + Taps::dy(l)) * std::ptrdiff_t(g.inPitch);
+        }
+        stencilLine<Vector<T>, Taps>(lines, g.out + z * g.outSlicePitch + y * g.outPitch,
+                                     g.nx);
+    }
+}
+
+/**\internal
+ * Distributes the rows of \p g over the threads of \p policy, in slabs of consecutive rows
+ * of about chunk_size() Bytes of output each. A one-dimensional grid is one row; it is
+ * split into chunks instead.
+ */
+template <typename S, std::size_t Dim, typename ExecutionPolicy, typename T>
+inline void stencilParallel(ExecutionPolicy &&policy, const StencilGrid<T> &g)
+{
+    typedef Vector<T> V;
+    if (Dim == 1) {
+        const std::size_t chunk =
+            std::max<std::size_t>(policy.chunk_size() / sizeof(T) / V::Size, 1) * V::Size;
+        const std::size_t chunks = (g.nx + chunk - 1) / chunk;
+        policy.pool().parallel_for(chunks, [&](std::size_t k) {
+            StencilGrid<T> part = g;
+            part.in += k * chunk;
+            part.out += k * chunk;
+            part.nx = std::min(chunk, g.nx - k * chunk);
+            stencilRows<S, Dim>(part, 0, 1);
+        });
+        return;
+    }
+    const std::size_t slab =
+        std::max<std::size_t>(policy.chunk_size() / sizeof(T) / std::max<std::size_t>(g.nx, 1), 1);
+    const std::size_t slabs = (g.rows + slab - 1) / slab;
+    policy.pool().parallel_for(slabs, [&](std::size_t k) {
+        stencilRows<S, Dim>(g, k * slab, std::min(g.rows, (k + 1) * slab));
+    });
+}
+
+// fillHaloLine {{{1
+/**\internal
+ * Fills the \p r entries before and after the \p n entries at \p line, which are \p
+ * stride apart.
+ */
+template <typename T>
+inline void fillHaloLine(T *line, std::ptrdiff_t stride, std::ptrdiff_t n, std::ptrdiff_t r,
+                         Boundary b)
+{
+    for (std::ptrdiff_t k = 1; k <= r; ++k) {
+        T &before = line[-k * stride];
+        T &after = line[(n - 1 + k) * stride];
+        switch (b) {
+        case Boundary::Zeros:
+            before = after = T();
+            break;
+        case Boundary::Clamp:
+            before = line[0];
+            after = line[(n - 1) * stride];
+            break;
+        case Boundary::Periodic:
+            before = line[((n - k % n) % n) * stride];
+            after = line[((k - 1) % n) * stride];
+            break;
+        }
+    }
+}
+//}}}1
+}  // namespace Detail
+
+// simd_stencil {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile stencil.h <Vc/stencil>
+ *
+ * Applies the one-dimensional stencil \p S to \p n entries:
+ * `out[x] = sum over dx of S::coefficient(dx) * in[x + dx]`.
+ *
+ * The stencil is a type with a static constexpr member \c radius and a static constexpr
+ * member function \c coefficient. Since the coefficients are known at compile time all
+ * taps are unrolled and taps with a zero coefficient cost nothing:
+ * \code
+ * struct SecondDerivative {
+ *     static constexpr int radius = 1;
+ *     static constexpr float coefficient(int dx) { return dx == 0 ? -2.f : 1.f; }
+ * };
+ * Vc::simd_stencil<SecondDerivative>(&u[1], &d2u[0], n);  // u has n + 2 entries
+ * \endcode
+ *
+ * Every input line is read with aligned vector loads and the neighbor vectors are built
+ * from two of them with Vector::shifted(amount, shiftIn), which compiles to a single
+ * palignr (SSE) or valignd/valignq (AVX-512). On AVX and AVX2, where such a shift needs
+ * two shuffles, the taps that are not a multiple of the vector width use unaligned loads
+ * instead. Only the first and last vectors of a line are computed from unaligned loads
+ * throughout.
+ *
+ * \param in  The first entry of the grid. The \c radius entries before and after the \p n
+ *            entries (the halo) must be readable; see fill_halo.
+ * \param out The first output entry. Must not overlap the input.
+ * \param n   The number of entries to compute.
+ */
+template <typename S, typename T> inline void simd_stencil(const T *in, T *out, std::size_t n)
+{
+    Detail::stencilRows<S, 1>(Detail::StencilGrid<T>{in, 0, 0, out, 0, 0, n, 1, 1}, 0, 1);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile stencil.h <Vc/stencil>
+ *
+ * Applies the two-dimensional stencil \p S (with `S::coefficient(dy, dx)`) to the \p nx x
+ * \p ny grid at \p in, which has a halo of `S::radius` entries on every side. The pitches
+ * are the distances (in entries) between consecutive rows.
+ *
+ * \see simd_stencil(const T *, T *, std::size_t)
+ */
+template <typename S, typename T>
+inline void simd_stencil(const T *in, std::size_t inPitch, T *out, std::size_t outPitch,
+                         std::size_t nx, std::size_t ny)
+{
+    Detail::stencilRows<S, 2>(
+        Detail::StencilGrid<T>{in, inPitch, 0, out, outPitch, 0, nx, ny, ny}, 0, ny);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile stencil.h <Vc/stencil>
+ *
+ * Applies the three-dimensional stencil \p S (with `S::coefficient(dz, dy, dx)`) to the \p
+ * nx x \p ny x \p nz grid at \p in, which has a halo of `S::radius` entries on every side.
+ * The pitches are the distances between consecutive rows, the slice pitches the distances
+ * between consecutive xy planes.
+ *
+ * \see simd_stencil(const T *, T *, std::size_t)
+ */
+template <typename S, typename T>
+inline void simd_stencil(const T *in, std::size_t inPitch, std::size_t inSlicePitch, T *out,
+                         std::size_t outPitch, std::size_t outSlicePitch, std::size_t nx,
+                         std::size_t ny, std::size_t nz)
+{
+    Detail::stencilRows<S, 3>(Detail::StencilGrid<T>{in, inPitch, inSlicePitch, out,
+                                                     outPitch, outSlicePitch, nx, ny,
+                                                     ny * nz},
+                              0, ny * nz);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile stencil.h <Vc/stencil>
+ *
+ * Parallel variants of simd_stencil. The rows of the grid are distributed over the
+ * threads of \p policy in slabs of about `policy.chunk_size()` Bytes of output (a
+ * one-dimensional grid is split into chunks of that size). Every slab is computed with
+ * the sequential algorithm.
+ * \code
+ * Vc::simd_stencil<Laplace3D>(Vc::execution::par_simd.chunk_size(256 * 1024), in, pitch,
+ *                             slicePitch, out, pitch, slicePitch, nx, ny, nz);
+ * \endcode
+ */
+template <typename S, typename ExecutionPolicy, typename T>
+inline enable_if<Traits::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value,
+                 void>
+simd_stencil(ExecutionPolicy &&policy, const T *in, T *out, std::size_t n)
+{
+    Detail::stencilParallel<S, 1>(policy,
+                                  Detail::StencilGrid<T>{in, 0, 0, out, 0, 0, n, 1, 1});
+}
+
+/// \copydoc simd_stencil(ExecutionPolicy &&, const T *, T *, std::size_t)
+template <typename S, typename ExecutionPolicy, typename T>
+inline enable_if<Traits::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value,
+                 void>
+simd_stencil(ExecutionPolicy &&policy, const T *in, std::size_t inPitch, T *out,
+             std::size_t outPitch, std::size_t nx, std::size_t ny)
+{
+    Detail::stencilParallel<S, 2>(
+        policy, Detail::StencilGrid<T>{in, inPitch, 0, out, outPitch, 0, nx, ny, ny});
+}
+
+/// \copydoc simd_stencil(ExecutionPolicy &&, const T *, T *, std::size_t)
+template <typename S, typename ExecutionPolicy, typename T>
+inline enable_if<Traits::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value,
+                 void>
+simd_stencil(ExecutionPolicy &&policy, const T *in, std::size_t inPitch,
+             std::size_t inSlicePitch, T *out, std::size_t outPitch, std::size_t outSlicePitch,
+             std::size_t nx, std::size_t ny, std::size_t nz)
+{
+    Detail::stencilParallel<S, 3>(
+        policy, Detail::StencilGrid<T>{in, inPitch, inSlicePitch, out, outPitch,
+                                       outSlicePitch, nx, ny, ny * nz});
+}
+
+// fill_halo {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile stencil.h <Vc/stencil>
+ *
+ * Initializes the \p radius entries before and after the \p n entries at \p data
+ * according to \p boundary.
+ */
+template <typename T>
+inline void fill_halo(T *data, std::size_t n, std::size_t radius, Boundary boundary)
+{
+    Detail::fillHaloLine(data, 1, n, radius, boundary);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile stencil.h <Vc/stencil>
+ *
+ * Initializes the halo of width \p radius around the \p nx x \p ny grid at \p data
+ * according to \p boundary. The corners are filled as well, such that stencils with
+ * diagonal taps see consistent values.
+ */
+template <typename T>
+inline void fill_halo(T *data, std::size_t pitch, std::size_t nx, std::size_t ny,
+                      std::size_t radius, Boundary boundary)
+{
+    for (std::size_t y = 0; y < ny; ++y) {
+        Detail::fillHaloLine(data + y * pitch, 1, nx, radius, boundary);
+    }
+    const std::ptrdiff_t r = radius;
+    for (std::ptrdiff_t x = -r; x < std::ptrdiff_t(nx) + r; ++x) {
+        Detail::fillHaloLine(data + x, pitch, ny, radius, boundary);
+    }
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile stencil.h <Vc/stencil>
+ *
+ * Initializes the halo of width \p radius around the \p nx x \p ny x \p nz grid at \p
+ * data according to \p boundary, including edges and corners.
+ */
+template <typename T>
+inline void fill_halo(T *data, std::size_t pitch, std::size_t slicePitch, std::size_t nx,
+                      std::size_t ny, std::size_t nz, std::size_t radius, Boundary boundary)
+{
+    for (std::size_t z = 0; z < nz; ++z) {
+        fill_halo(data + z * slicePitch, pitch, nx, ny, radius, boundary);
+    }
+    const std::ptrdiff_t r = radius;
+    for (std::ptrdiff_t y = -r; y < std::ptrdiff_t(ny) + r; ++y) {
+        for (std::ptrdiff_t x = -r; x < std::ptrdiff_t(nx) + r; ++x) {
+            Detail::fillHaloLine(data + y * std::ptrdiff_t(pitch) + x, slicePitch, nz,
+                                 radius, boundary);
+        }
+    }
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_STENCIL_H_
+
+// vim: foldmethod=marker
@@ -32,13 +32,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * Store the vector data to \p mem.
  *
  * \param mem A pointer to memory, where \VSize{T} consecutive values will be stored.
+ *            For float vectors this may also be an array of Vc::float16 or Vc::bfloat16;
+ *            the values are then rounded to nearest even.
  * \param flags The flags parameter can be used to select e.g. the Vc::Aligned,
  *              Vc::Unaligned, Vc::Streaming, and/or Vc::PrefetchDefault flags.
  */
 template <
     typename U,
     typename Flags = DefaultStoreTag,
-    typename = enable_if<std::is_arithmetic<U>::value &&Traits::is_load_store_flag<Flags>::value>>
+    typename = enable_if<Traits::is_valid_memory_type<U, EntryType>::value &&
+                         Traits::is_load_store_flag<Flags>::value>>
 Vc_INTRINSIC_L void store(U *mem, Flags flags = Flags()) const Vc_INTRINSIC_R;
 
 /**
@@ -58,7 +61,8 @@ Vc_INTRINSIC_L void store(U *mem, Flags flags = Flags()) const Vc_INTRINSIC_R;
 template <
     typename U,
     typename Flags = DefaultStoreTag,
-    typename = enable_if<std::is_arithmetic<U>::value &&Traits::is_load_store_flag<Flags>::value>>
+    typename = enable_if<Traits::is_valid_memory_type<U, EntryType>::value &&
+                         Traits::is_load_store_flag<Flags>::value>>
 Vc_INTRINSIC_L void Vc_VDECL store(U *mem, MaskType mask, Flags flags = Flags()) const Vc_INTRINSIC_R;
 
 //@{
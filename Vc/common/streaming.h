@@ -0,0 +1,124 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_STREAMING_H_
+#define VC_COMMON_STREAMING_H_
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include "macros.h"
+#ifdef Vc_IMPL_SSE
+#include <xmmintrin.h>
+#include "../cpuid.h"
+#endif
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+/**\internal
+ * The default for streaming_store_threshold(): three quarters of the largest data cache
+ * reported by CpuId, or 8 MiB if CpuId does not know the cache sizes. Without an x86 SIMD
+ * implementation there are no non-temporal stores, thus the threshold is never reached.
+ */
+inline std::size_t defaultStreamingStoreThreshold()
+{
+#ifdef Vc_IMPL_SSE
+    const std::size_t cache =
+        CpuId::L3Data() > CpuId::L2Data() ? CpuId::L3Data() : CpuId::L2Data();
+    return cache == 0 ? std::size_t(8) << 20 : cache / 4 * 3;
+#else
+    return std::numeric_limits<std::size_t>::max();
+#endif
+}
+
+inline std::atomic<std::size_t> &streamingStoreThreshold()
+{
+    static std::atomic<std::size_t> threshold(defaultStreamingStoreThreshold());
+    return threshold;
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Returns the number of bytes from which on the \c _streaming algorithms (e.g.
+ * simd_transform_streaming) and Memory::streamingStore write with non-temporal stores.
+ *
+ * Non-temporal stores bypass the cache hierarchy: they save the read-for-ownership of
+ * every destination cache line and do not evict the working set. This only pays off if
+ * the output does not fit into the caches anyway, therefore the default is three quarters
+ * of the largest data cache reported by CpuId (the same heuristic glibc uses for
+ * \c memcpy).
+ */
+inline std::size_t streaming_store_threshold()
+{
+    return Detail::streamingStoreThreshold().load(std::memory_order_relaxed);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Overrides the value returned by streaming_store_threshold(). Pass \c 0 to always use
+ * non-temporal stores and \c std::numeric_limits<std::size_t>::max() to never use them.
+ */
+inline void set_streaming_store_threshold(std::size_t bytes)
+{
+    Detail::streamingStoreThreshold().store(bytes, std::memory_order_relaxed);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Orders all preceding non-temporal stores (i.e. stores with the Vc::Streaming flag)
+ * before any subsequent store. Non-temporal stores are weakly ordered; call this function
+ * before another thread may read the data, e.g. before releasing a lock or setting a
+ * flag. The \c _streaming algorithms call it before they return.
+ */
+Vc_INTRINSIC void streaming_fence()
+{
+#ifdef Vc_IMPL_SSE
+    _mm_sfence();
+#endif
+}
+
+namespace Detail
+{
+/**\internal
+ * Whether writing \p bytes should use non-temporal stores.
+ */
+inline bool useStreamingStores(std::size_t bytes)
+{
+    return bytes >= streaming_store_threshold();
+}
+}  // namespace Detail
+}  // namespace Vc
+
+#endif  // VC_COMMON_STREAMING_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,275 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_THREADPOOL_H_
+#define VC_COMMON_THREADPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * A fixed set of worker threads that execute the iterations of parallel_for.
+ *
+ * The iterations are distributed evenly over one queue per participating thread (the
+ * workers and the calling thread). Every thread takes iterations from the front of its own
+ * queue and, once that is empty, steals single iterations from the back of the other
+ * queues. Thus uneven per-iteration cost is balanced without a central work queue.
+ *
+ * parallel_for calls that cannot use the workers, i.e. calls from within an iteration
+ * (nested parallelism) or while another thread is using the pool, execute all iterations
+ * sequentially on the calling thread instead of blocking.
+ *
+ * \note Code using the pool must be linked with the threads library of the platform
+ * (e.g. \c -pthread or \c Threads::Threads in CMake).
+ */
+class ThreadPool
+{
+public:
+    /// Starts \p workers threads. With zero workers all work runs on the calling thread.
+    explicit ThreadPool(unsigned workers)
+    {
+        m_queues.reset(new Queue[workers + 1]);
+        m_threads.reserve(workers);
+        for (unsigned i = 1; i <= workers; ++i) {
+            m_threads.emplace_back([this, i]() { work(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /// Stops and joins the worker threads.
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (auto &t : m_threads) {
+            t.join();
+        }
+    }
+
+    /**
+     * Returns the pool used by default, with one worker less than the number of hardware
+     * threads (the calling thread participates). It is started on first use.
+     */
+    static ThreadPool &global()
+    {
+        static ThreadPool pool(std::thread::hardware_concurrency() > 1
+                                   ? std::thread::hardware_concurrency() - 1
+                                   : 0);
+        return pool;
+    }
+
+    /// Returns the number of threads that execute parallel_for: the workers plus the caller.
+    std::size_t concurrency() const { return m_threads.size() + 1; }
+
+    /**
+     * Calls \p f(i) for every \c i in [0, \p n) and returns when all calls have returned.
+     * The calls are executed concurrently by the workers and the calling thread, in
+     * unspecified order. If a call throws, the remaining iterations are skipped and the
+     * first exception is rethrown from parallel_for.
+     *
+     * \p n must be less than \f$2^{32}\f$.
+     */
+    template <typename F> void parallel_for(std::size_t n, F &&f)
+    {
+        Vc_ASSERT(n <= 0xffffffffu);
+        if (n == 0) {
+            return;
+        }
+        if (n == 1 || m_threads.empty() || insidePool() || !m_jobMutex.try_lock()) {
+            for (std::size_t i = 0; i < n; ++i) {
+                f(i);
+            }
+            return;
+        }
+        std::lock_guard<std::mutex> jobLock(m_jobMutex, std::adopt_lock);
+        using Fn = typename std::remove_reference<F>::type;
+        m_call = [](void *ff, std::size_t i) { (*static_cast<Fn *>(ff))(i); };
+        m_function = const_cast<void *>(static_cast<const void *>(std::addressof(f)));
+        const std::size_t participants = concurrency();
+        for (std::size_t k = 0; k < participants; ++k) {
+            m_queues[k].range.store(
+                makeRange(n * k / participants, n * (k + 1) / participants),
+                std::memory_order_relaxed);
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending = m_threads.size();
+            ++m_generation;
+        }
+        m_wake.notify_all();
+
+        insidePool() = true;
+        participate(0);
+        insidePool() = false;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done.wait(lock, [this]() { return m_pending == 0; });
+        }
+        if (m_exception) {
+            std::exception_ptr e = std::move(m_exception);
+            m_exception = nullptr;
+            std::rethrow_exception(e);
+        }
+    }
+
+private:
+    // A range of iterations [begin, end), packed into 64 bits for lock-free updates:
+    // begin in the low half, end in the high half. The padding keeps the queues of
+    // different threads on different cache lines.
+    struct Queue {
+        std::atomic<std::uint64_t> range{0};
+        char padding[64 - sizeof(std::atomic<std::uint64_t>)];
+    };
+    static std::uint64_t makeRange(std::uint64_t begin, std::uint64_t end)
+    {
+        return begin | (end << 32);
+    }
+
+    static bool &insidePool()
+    {
+        static thread_local bool inside = false;
+        return inside;
+    }
+
+    // takes the first iteration of queue q
+    static bool popFront(Queue &q, std::size_t &i)
+    {
+        std::uint64_t r = q.range.load(std::memory_order_relaxed);
+        do {
+            const std::uint64_t begin = r & 0xffffffffu, end = r >> 32;
+            if (begin >= end) {
+                return false;
+            }
+            i = begin;
+        } while (!q.range.compare_exchange_weak(r, makeRange(i + 1, r >> 32),
+                                                std::memory_order_relaxed));
+        return true;
+    }
+
+    // takes the last iteration of queue q
+    static bool popBack(Queue &q, std::size_t &i)
+    {
+        std::uint64_t r = q.range.load(std::memory_order_relaxed);
+        do {
+            const std::uint64_t begin = r & 0xffffffffu, end = r >> 32;
+            if (begin >= end) {
+                return false;
+            }
+            i = end - 1;
+        } while (!q.range.compare_exchange_weak(r, makeRange(r & 0xffffffffu, i),
+                                                std::memory_order_relaxed));
+        return true;
+    }
+
+    void participate(std::size_t self)
+    {
+        const std::size_t participants = concurrency();
+        try {
+            std::size_t i;
+            for (;;) {
+                if (!popFront(m_queues[self], i)) {
+                    bool stolen = false;
+                    for (std::size_t k = 1; k < participants && !stolen; ++k) {
+                        stolen = popBack(m_queues[(self + k) % participants], i);
+                    }
+                    if (!stolen) {
+                        return;
+                    }
+                }
+                m_call(m_function, i);
+            }
+        } catch (...) {
+            for (std::size_t k = 0; k < participants; ++k) {
+                m_queues[k].range.store(0, std::memory_order_relaxed);
+            }
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_exception) {
+                m_exception = std::current_exception();
+            }
+        }
+    }
+
+    void work(std::size_t self)
+    {
+        insidePool() = true;
+        std::uint64_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [&]() { return m_stop || m_generation != seen; });
+                if (m_stop) {
+                    return;
+                }
+                seen = m_generation;
+            }
+            participate(self);
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_pending == 0) {
+                m_done.notify_one();
+            }
+        }
+    }
+
+    std::unique_ptr<Queue[]> m_queues;
+    std::vector<std::thread> m_threads;
+    std::mutex m_jobMutex;  // held by the thread that currently runs parallel_for
+    std::mutex m_mutex;     // protects the members below
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    std::uint64_t m_generation = 0;
+    std::size_t m_pending = 0;
+    bool m_stop = false;
+    std::exception_ptr m_exception;
+    void (*m_call)(void *, std::size_t) = nullptr;
+    void *m_function = nullptr;
+};
+}  // namespace Common
+}  // namespace Vc
+
+#endif  // VC_COMMON_THREADPOOL_H_
+
+// vim: foldmethod=marker
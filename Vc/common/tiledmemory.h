@@ -0,0 +1,894 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_TILEDMEMORY_H_
+#define VC_COMMON_TILEDMEMORY_H_
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "memory.h"
+#include "indexsequence.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+/**\internal
+ * The default edge length of the square tiles of TiledMemory: 32 entries (i.e. 4 KiB tiles
+ * of float), but at least one vector.
+ */
+template <typename V> constexpr std::size_t defaultTileSide()
+{
+    return V::Size > 32 ? V::Size : 32;
+}
+}  // namespace Detail
+
+namespace Common
+{
+template <typename V, std::size_t Rows = 0, std::size_t Columns = 0,
+          std::size_t TileSide = Vc::Detail::defaultTileSide<V>()>
+class TiledMemory;
+}  // namespace Common
+
+template <typename V, std::size_t TileSide>
+void simd_transpose(Common::TiledMemory<V, 0, 0, TileSide> &m);
+
+namespace Common
+{
+// MemoryTile {{{1
+/**
+ * \ingroup Containers
+ * \headerfile tiledmemory.h <Vc/Memory>
+ *
+ * A view on one \p Side x \p Side tile of a TiledMemory. The entries of a tile are stored
+ * contiguously in row-major order and the tile starts at an address aligned for \p V.
+ */
+template <typename _V, std::size_t Side> class MemoryTile
+{
+    typedef typename std::remove_cv<_V>::type V;
+    using EntryType =
+        typename std::conditional<std::is_const<_V>::value, const typename V::EntryType,
+                                  typename V::EntryType>::type;
+
+    EntryType *m_mem;
+    std::size_t m_row;
+    std::size_t m_column;
+
+public:
+    Vc_INTRINSIC MemoryTile(EntryType *mem, std::size_t row, std::size_t column)
+        : m_mem(mem), m_row(row), m_column(column)
+    {
+    }
+
+    /// \return the number of rows (and columns) of the tile.
+    static constexpr std::size_t side() { return Side; }
+    /// \return the number of vectors in one row of the tile.
+    static constexpr std::size_t rowVectorsCount() { return Side / V::Size; }
+
+    /// \return the row index of the first entry of the tile in the TiledMemory.
+    Vc_ALWAYS_INLINE std::size_t firstRow() const { return m_row; }
+    /// \return the column index of the first entry of the tile in the TiledMemory.
+    Vc_ALWAYS_INLINE std::size_t firstColumn() const { return m_column; }
+
+    /// Returns a pointer to the first entry of the tile.
+    Vc_ALWAYS_INLINE EntryType *entries() const { return m_mem; }
+
+    /// Returns the entry in row \p r and column \p c of the tile.
+    Vc_ALWAYS_INLINE EntryType &operator()(std::size_t r, std::size_t c) const
+    {
+        return m_mem[r * Side + c];
+    }
+
+    /**
+     * \return a smart object to wrap the \p i-th vector in row \p r of the tile.
+     */
+    template <typename Flags = AlignedTag>
+    Vc_ALWAYS_INLINE MemoryVector<_V, Flags> vector(std::size_t r, std::size_t i,
+                                                    Flags = Flags()) const
+    {
+        return m_mem + r * Side + i * V::Size;
+    }
+};
+
+// MemoryTileIterator {{{1
+/**\internal
+ * Random access iterator over the tiles of a TiledMemory in storage order. Dereferencing
+ * returns a MemoryTile by value.
+ */
+template <typename _V, std::size_t Side> class MemoryTileIterator
+{
+    typedef typename std::remove_cv<_V>::type V;
+    using EntryType =
+        typename std::conditional<std::is_const<_V>::value, const typename V::EntryType,
+                                  typename V::EntryType>::type;
+    static constexpr std::size_t TileEntries = Side * Side;
+
+    EntryType *m_mem;
+    std::size_t m_index;
+    std::size_t m_tileColumns;
+
+public:
+    typedef std::ptrdiff_t difference_type;
+    typedef MemoryTile<_V, Side> value_type;
+    typedef void pointer;
+    typedef MemoryTile<_V, Side> reference;
+    typedef std::random_access_iterator_tag iterator_category;
+
+    Vc_INTRINSIC MemoryTileIterator(EntryType *mem, std::size_t index,
+                                    std::size_t tileColumns)
+        : m_mem(mem), m_index(index), m_tileColumns(tileColumns)
+    {
+    }
+
+    Vc_ALWAYS_INLINE reference operator[](std::size_t n) const
+    {
+        const std::size_t k = m_index + n;
+        return {m_mem + k * TileEntries, k / m_tileColumns * Side,
+                k % m_tileColumns * Side};
+    }
+    Vc_ALWAYS_INLINE reference operator*() const { return operator[](0); }
+
+    Vc_ALWAYS_INLINE difference_type operator-(const MemoryTileIterator &rhs) const { return difference_type(m_index) - difference_type(rhs.m_index); }
+    Vc_ALWAYS_INLINE MemoryTileIterator &operator++() { ++m_index; return *this; }
+    Vc_ALWAYS_INLINE MemoryTileIterator operator++(int) { MemoryTileIterator r(*this); ++m_index; return r; }
+    Vc_ALWAYS_INLINE MemoryTileIterator &operator--() { --m_index; return *this; }
+    Vc_ALWAYS_INLINE MemoryTileIterator operator--(int) { MemoryTileIterator r(*this); --m_index; return r; }
+    Vc_ALWAYS_INLINE MemoryTileIterator &operator+=(std::size_t n) { m_index += n; return *this; }
+    Vc_ALWAYS_INLINE MemoryTileIterator &operator-=(std::size_t n) { m_index -= n; return *this; }
+    Vc_ALWAYS_INLINE MemoryTileIterator operator+(std::size_t n) const { return {m_mem, m_index + n, m_tileColumns}; }
+    Vc_ALWAYS_INLINE MemoryTileIterator operator-(std::size_t n) const { return {m_mem, m_index - n, m_tileColumns}; }
+
+    Vc_ALWAYS_INLINE bool operator==(const MemoryTileIterator &rhs) const { return m_index == rhs.m_index; }
+    Vc_ALWAYS_INLINE bool operator!=(const MemoryTileIterator &rhs) const { return m_index != rhs.m_index; }
+    Vc_ALWAYS_INLINE bool operator< (const MemoryTileIterator &rhs) const { return m_index <  rhs.m_index; }
+    Vc_ALWAYS_INLINE bool operator> (const MemoryTileIterator &rhs) const { return m_index >  rhs.m_index; }
+    Vc_ALWAYS_INLINE bool operator<=(const MemoryTileIterator &rhs) const { return m_index <= rhs.m_index; }
+    Vc_ALWAYS_INLINE bool operator>=(const MemoryTileIterator &rhs) const { return m_index >= rhs.m_index; }
+};
+
+// TiledMemoryBase {{{1
+/**
+ * \headerfile tiledmemory.h <Vc/Memory>
+ *
+ * Common interface of the fixed-size and the dynamically sized TiledMemory.
+ *
+ * \param V The vector type you want to operate on. (e.g. float_v or uint_v)
+ * \param Parent The type of the class that derives from TiledMemoryBase.
+ * \param Side The number of rows and columns of a tile.
+ */
+template <typename V, typename Parent, std::size_t Side> class TiledMemoryBase
+{
+    static_assert(Side > 0 && Side % V::Size == 0,
+                  "The tile side of Vc::TiledMemory must be a multiple of V::Size.");
+
+    Parent *p() { return static_cast<Parent *>(this); }
+    const Parent *p() const { return static_cast<const Parent *>(this); }
+
+    Vc_ALWAYS_INLINE std::size_t offset(std::size_t r, std::size_t c) const
+    {
+        return ((r / Side) * tileColumnsCount() + c / Side) * Side * Side +
+               (r % Side) * Side + c % Side;
+    }
+
+public:
+    typedef typename V::EntryType EntryType;
+    typedef MemoryTile<V, Side> Tile;
+    typedef MemoryTile<const V, Side> ConstTile;
+    typedef MemoryTileIterator<V, Side> iterator;
+    typedef MemoryTileIterator<const V, Side> const_iterator;
+
+    /// \return the number of rows and columns of a tile.
+    static constexpr std::size_t tileSide() { return Side; }
+
+    /// \return the number of rows of the matrix.
+    Vc_ALWAYS_INLINE std::size_t rowsCount() const { return p()->rowsCount(); }
+    /// \return the number of columns of the matrix.
+    Vc_ALWAYS_INLINE std::size_t columnsCount() const { return p()->columnsCount(); }
+
+    /// \return the number of tiles that span the rows of the matrix.
+    Vc_ALWAYS_INLINE std::size_t tileRowsCount() const
+    {
+        return (rowsCount() + Side - 1) / Side;
+    }
+    /// \return the number of tiles that span the columns of the matrix.
+    Vc_ALWAYS_INLINE std::size_t tileColumnsCount() const
+    {
+        return (columnsCount() + Side - 1) / Side;
+    }
+    /// \return the number of tiles in the whole matrix.
+    Vc_ALWAYS_INLINE std::size_t tilesCount() const
+    {
+        return tileRowsCount() * tileColumnsCount();
+    }
+    /**
+     * \return the number of vectors in one row of the matrix, including the padding up to
+     * the next multiple of the tile side.
+     */
+    Vc_ALWAYS_INLINE std::size_t rowVectorsCount() const
+    {
+        return tileColumnsCount() * (Side / V::Size);
+    }
+
+    /// Returns a pointer to the start of the allocated memory, i.e. the first tile.
+    Vc_ALWAYS_INLINE EntryType *entries() { return &p()->m_mem[0]; }
+    /// Const overload of the above function.
+    Vc_ALWAYS_INLINE const EntryType *entries() const { return &p()->m_mem[0]; }
+
+    /// Returns the entry in row \p r and column \p c.
+    Vc_ALWAYS_INLINE EntryType &operator()(std::size_t r, std::size_t c)
+    {
+        return entries()[offset(r, c)];
+    }
+    /// Const overload of the above function.
+    Vc_ALWAYS_INLINE const EntryType &operator()(std::size_t r, std::size_t c) const
+    {
+        return entries()[offset(r, c)];
+    }
+
+    /**
+     * \return a smart object to wrap the \p i-th vector in row \p r.
+     *
+     * The vectors of a row never straddle two tiles, thus all vector accesses are aligned.
+     */
+    template <typename Flags = AlignedTag>
+    Vc_ALWAYS_INLINE MemoryVector<V, Flags> vector(std::size_t r, std::size_t i,
+                                                   Flags = Flags())
+    {
+        return &entries()[offset(r, i * V::Size)];
+    }
+    /// Const overload of the above function.
+    template <typename Flags = AlignedTag>
+    Vc_ALWAYS_INLINE MemoryVector<const V, Flags> vector(std::size_t r, std::size_t i,
+                                                         Flags = Flags()) const
+    {
+        return &entries()[offset(r, i * V::Size)];
+    }
+
+    /// Returns the tile in tile row \p tr and tile column \p tc.
+    Vc_ALWAYS_INLINE Tile tile(std::size_t tr, std::size_t tc)
+    {
+        return {entries() + (tr * tileColumnsCount() + tc) * Side * Side, tr * Side,
+                tc * Side};
+    }
+    /// Const overload of the above function.
+    Vc_ALWAYS_INLINE ConstTile tile(std::size_t tr, std::size_t tc) const
+    {
+        return {entries() + (tr * tileColumnsCount() + tc) * Side * Side, tr * Side,
+                tc * Side};
+    }
+
+    /**
+     * Iterators over the tiles in storage order, i.e. row by row of tiles. Every tile is one
+     * contiguous block of memory, which makes this the cache friendly traversal:
+     * \code
+     * for (auto tile : m) {
+     *     for (std::size_t r = 0; r < tile.side(); ++r) {
+     *         for (std::size_t i = 0; i < tile.rowVectorsCount(); ++i) {
+     *             tile.vector(r, i) *= 2;
+     *         }
+     *     }
+     * }
+     * \endcode
+     */
+    Vc_ALWAYS_INLINE iterator begin() { return {entries(), 0, tileColumnsCount()}; }
+    /// \copydoc begin()
+    Vc_ALWAYS_INLINE iterator end() { return {entries(), tilesCount(), tileColumnsCount()}; }
+    /// \copydoc begin()
+    Vc_ALWAYS_INLINE const_iterator begin() const { return {entries(), 0, tileColumnsCount()}; }
+    /// \copydoc begin()
+    Vc_ALWAYS_INLINE const_iterator end() const
+    {
+        return {entries(), tilesCount(), tileColumnsCount()};
+    }
+
+    /// Sets all entries, including the padding, to zero.
+    Vc_ALWAYS_INLINE void setZero()
+    {
+        EntryType *mem = entries();
+        const std::size_t n = tilesCount() * Side * Side;
+        for (std::size_t i = 0; i < n; i += V::Size) {
+            V::Zero().store(mem + i, Vc::Aligned);
+        }
+    }
+
+    /**
+     * Copies a row-major matrix with \p ld entries between the starts of two rows into this
+     * object. The padding is not modified.
+     */
+    inline void copyFrom(const EntryType *mem, std::size_t ld)
+    {
+        for (std::size_t r = 0; r < rowsCount(); ++r) {
+            copyRowFrom(r, mem + r * ld);
+        }
+    }
+    /// Copies the rows of the two-dimensional Memory \p m into this object.
+    template <typename P, typename RM>
+    inline void copyFrom(const MemoryBase<V, P, 2, RM> &m)
+    {
+        Vc_ASSERT(m.rowsCount() == rowsCount());
+        for (std::size_t r = 0; r < rowsCount(); ++r) {
+            copyRowFrom(r, m.entries(r));
+        }
+    }
+
+    /**
+     * Copies this object to a row-major matrix with \p ld entries between the starts of two
+     * rows.
+     */
+    inline void copyTo(EntryType *mem, std::size_t ld) const
+    {
+        for (std::size_t r = 0; r < rowsCount(); ++r) {
+            copyRowTo(r, mem + r * ld);
+        }
+    }
+    /// Copies this object into the rows of the two-dimensional Memory \p m.
+    template <typename P, typename RM> inline void copyTo(MemoryBase<V, P, 2, RM> &m) const
+    {
+        Vc_ASSERT(m.rowsCount() == rowsCount());
+        for (std::size_t r = 0; r < rowsCount(); ++r) {
+            copyRowTo(r, m.entries(r));
+        }
+    }
+
+private:
+    inline void copyRowFrom(std::size_t r, const EntryType *row)
+    {
+        for (std::size_t c = 0; c < columnsCount(); c += Side) {
+            const std::size_t n = std::min(Side, columnsCount() - c);
+            std::copy(row + c, row + c + n, &entries()[offset(r, c)]);
+        }
+    }
+    inline void copyRowTo(std::size_t r, EntryType *row) const
+    {
+        for (std::size_t c = 0; c < columnsCount(); c += Side) {
+            const std::size_t n = std::min(Side, columnsCount() - c);
+            const EntryType *tileRow = &entries()[offset(r, c)];
+            std::copy(tileRow, tileRow + n, row + c);
+        }
+    }
+};
+
+// TiledMemory {{{1
+/**
+ * \ingroup Containers
+ * \headerfile tiledmemory.h <Vc/Memory>
+ *
+ * A two-dimensional array stored as square tiles of \p TileSide x \p TileSide entries.
+ *
+ * Memory<V, Size1, Size2> stores its entries row by row. Walking down a column of a large
+ * matrix therefore touches a new cache line and, for rows of 4 KiB and more, a new page on
+ * every row. TiledMemory stores every tile contiguously in row-major order and the tiles
+ * themselves row by row. Thus row and column sweeps that go tile by tile (see begin()) stay
+ * within a few KiB, and the transposition (simd_transpose) works on pairs of tiles that fit
+ * into the L1 cache together.
+ *
+ * Rows and columns are padded to a multiple of \p TileSide. The padding is zero-initialized
+ * and all vector accesses are aligned.
+ * \code
+ * Vc::TiledMemory<float_v, 1000, 1000> a;      // fixed size
+ * Vc::TiledMemory<float_v> b(rows, columns);   // dynamic size
+ * b.copyFrom(rowMajorData, columns);
+ * for (std::size_t i = 0; i < b.rowVectorsCount(); ++i) {
+ *     b.vector(0, i) += 1.f;
+ * }
+ * \endcode
+ *
+ * \tparam V The vector type you want to operate on. (e.g. float_v or uint_v)
+ * \tparam Rows Number of rows. Use 0 (the default) for the dynamically sized variant.
+ * \tparam Columns Number of columns. Use 0 (the default) for the dynamically sized variant.
+ * \tparam TileSide The number of rows and columns of a tile. It must be a multiple of
+ *                  \p V::Size. The default makes a tile 32 x 32 entries large.
+ *
+ * \see simd_transpose
+ */
+template <typename V, std::size_t Rows, std::size_t Columns, std::size_t TileSide>
+class TiledMemory : public AlignedBase<V::MemoryAlignment>,
+                    public TiledMemoryBase<V, TiledMemory<V, Rows, Columns, TileSide>, TileSide>
+{
+    static_assert(Rows > 0 && Columns > 0,
+                  "Use TiledMemory<V> for the dynamically sized variant.");
+    typedef TiledMemoryBase<V, TiledMemory, TileSide> Base;
+    friend class TiledMemoryBase<V, TiledMemory, TileSide>;
+
+public:
+    typedef typename V::EntryType EntryType;
+
+private:
+    enum : std::size_t {
+        TileRows = (Rows + TileSide - 1) / TileSide,
+        TileColumns = (Columns + TileSide - 1) / TileSide,
+        PaddedEntriesCount = TileRows * TileColumns * TileSide * TileSide
+    };
+    alignas(static_cast<std::size_t>(V::MemoryAlignment)) EntryType m_mem[PaddedEntriesCount];
+
+public:
+    /// Initializes all entries with zero.
+    TiledMemory() { Base::setZero(); }
+
+    /// \return the number of rows of the matrix.
+    static constexpr std::size_t rowsCount() { return Rows; }
+    /// \return the number of columns of the matrix.
+    static constexpr std::size_t columnsCount() { return Columns; }
+};
+
+/**
+ * \ingroup Containers
+ * \headerfile tiledmemory.h <Vc/Memory>
+ *
+ * The dynamically sized variant of TiledMemory. The extents are given to the constructor and
+ * the tiles are allocated with Vc::malloc on a cache line boundary.
+ *
+ * \see TiledMemory
+ */
+template <typename V, std::size_t TileSide>
+class TiledMemory<V, 0, 0, TileSide>
+    : public TiledMemoryBase<V, TiledMemory<V, 0, 0, TileSide>, TileSide>
+{
+    typedef TiledMemoryBase<V, TiledMemory, TileSide> Base;
+    friend class TiledMemoryBase<V, TiledMemory, TileSide>;
+
+public:
+    typedef typename V::EntryType EntryType;
+
+private:
+    std::size_t m_rows;
+    std::size_t m_columns;
+    EntryType *m_mem;
+
+    static std::size_t paddedEntriesCount(std::size_t rows, std::size_t columns)
+    {
+        return (rows + TileSide - 1) / TileSide * ((columns + TileSide - 1) / TileSide) *
+               TileSide * TileSide;
+    }
+
+public:
+    /**
+     * Allocates a \p rows x \p columns matrix and initializes all entries with zero.
+     */
+    TiledMemory(std::size_t rows, std::size_t columns)
+        : m_rows(rows)
+        , m_columns(columns)
+        , m_mem(Vc::malloc<EntryType, Vc::AlignOnCacheline>(
+              paddedEntriesCount(rows, columns)))
+    {
+        Base::setZero();
+    }
+
+    /// Copies the extents and the entries of \p rhs.
+    TiledMemory(const TiledMemory &rhs)
+        : m_rows(rhs.m_rows)
+        , m_columns(rhs.m_columns)
+        , m_mem(Vc::malloc<EntryType, Vc::AlignOnCacheline>(
+              paddedEntriesCount(m_rows, m_columns)))
+    {
+        std::copy(rhs.m_mem, rhs.m_mem + paddedEntriesCount(m_rows, m_columns), m_mem);
+    }
+
+    /// Takes over the memory of \p rhs, which is left as an empty 0 x 0 matrix.
+    TiledMemory(TiledMemory &&rhs) noexcept
+        : m_rows(rhs.m_rows), m_columns(rhs.m_columns), m_mem(rhs.m_mem)
+    {
+        rhs.m_rows = rhs.m_columns = 0;
+        rhs.m_mem = nullptr;
+    }
+
+    TiledMemory &operator=(TiledMemory rhs) noexcept
+    {
+        swap(rhs);
+        return *this;
+    }
+
+    /// Frees the memory which was allocated in the constructor.
+    ~TiledMemory() { Vc::free(m_mem); }
+
+    /// Swaps the contents and extents of two TiledMemory objects.
+    inline void swap(TiledMemory &rhs) noexcept
+    {
+        std::swap(m_rows, rhs.m_rows);
+        std::swap(m_columns, rhs.m_columns);
+        std::swap(m_mem, rhs.m_mem);
+    }
+
+    /// \return the number of rows of the matrix.
+    Vc_ALWAYS_INLINE std::size_t rowsCount() const { return m_rows; }
+    /// \return the number of columns of the matrix.
+    Vc_ALWAYS_INLINE std::size_t columnsCount() const { return m_columns; }
+
+    friend void Vc::simd_transpose<V, TileSide>(TiledMemory &);
+};
+
+template <typename V, std::size_t S>
+Vc_ALWAYS_INLINE void swap(TiledMemory<V, 0, 0, S> &a, TiledMemory<V, 0, 0, S> &b)
+{
+    a.swap(b);
+}
+//}}}1
+}  // namespace Common
+
+using Common::TiledMemory;
+
+namespace Detail
+{
+// transposeBlock {{{1
+/**\internal
+ * Transposes the V::Size x V::Size block at \p in into \p out with Vc::transpose. All rows
+ * are loaded before the first store, thus \p in may equal \p out.
+ */
+template <typename V, typename Flags, std::size_t... Indexes>
+Vc_INTRINSIC void transposeBlock(const typename V::EntryType *in, std::size_t ldIn,
+                                 typename V::EntryType *out, std::size_t ldOut, Flags f,
+                                 index_sequence<Indexes...>)
+{
+    const V rows[V::Size] = {V(in + Indexes * ldIn, f)...};
+    V columns[V::Size];
+    Vc::tie(columns[Indexes]...) = Vc::transpose(rows[Indexes]...);
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        columns[i].store(out + i * ldOut, f);
+    }
+}
+template <typename V, typename Flags>
+Vc_INTRINSIC void transposeBlock(const typename V::EntryType *in, std::size_t ldIn,
+                                 typename V::EntryType *out, std::size_t ldOut, Flags f)
+{
+    transposeBlock<V>(in, ldIn, out, ldOut, f, make_index_sequence<V::Size>());
+}
+
+/**\internal
+ * Replaces the V::Size x V::Size blocks at \p a and \p b with the transpose of the other.
+ */
+template <typename V, typename Flags, std::size_t... Indexes>
+Vc_INTRINSIC void transposeSwapBlocks(typename V::EntryType *a, typename V::EntryType *b,
+                                      std::size_t ld, Flags f, index_sequence<Indexes...>)
+{
+    const V rowsA[V::Size] = {V(a + Indexes * ld, f)...};
+    const V rowsB[V::Size] = {V(b + Indexes * ld, f)...};
+    V columnsA[V::Size], columnsB[V::Size];
+    Vc::tie(columnsA[Indexes]...) = Vc::transpose(rowsA[Indexes]...);
+    Vc::tie(columnsB[Indexes]...) = Vc::transpose(rowsB[Indexes]...);
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        columnsB[i].store(a + i * ld, f);
+        columnsA[i].store(b + i * ld, f);
+    }
+}
+template <typename V, typename Flags>
+Vc_INTRINSIC void transposeSwapBlocks(typename V::EntryType *a, typename V::EntryType *b,
+                                      std::size_t ld, Flags f)
+{
+    transposeSwapBlocks<V>(a, b, ld, f, make_index_sequence<V::Size>());
+}
+
+// row-major transposition {{{1
+/**\internal
+ * The split point of the cache-oblivious recursion: half of \p n, rounded up to a multiple
+ * of V::Size so that only the last part of a dimension has a scalar remainder.
+ */
+template <typename V> Vc_INTRINSIC std::size_t transposeSplit(std::size_t n)
+{
+    return (n / 2 + V::Size - 1) / V::Size * V::Size;
+}
+
+template <typename V, typename T>
+void transposeLeaf(std::size_t rows, std::size_t cols, const T *in, std::size_t ldIn,
+                   T *out, std::size_t ldOut)
+{
+    const std::size_t rm = rows - rows % V::Size;
+    const std::size_t cm = cols - cols % V::Size;
+    for (std::size_t i = 0; i < rm; i += V::Size) {
+        for (std::size_t j = 0; j < cm; j += V::Size) {
+            transposeBlock<V>(in + i * ldIn + j, ldIn, out + j * ldOut + i, ldOut,
+                              Vc::Unaligned);
+        }
+    }
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = i < rm ? cm : 0; j < cols; ++j) {
+            out[j * ldOut + i] = in[i * ldIn + j];
+        }
+    }
+}
+
+/**\internal
+ * Cache-oblivious out-of-place transposition: halves the larger dimension until the block
+ * fits the tile size of TiledMemory.
+ */
+template <typename V, typename T>
+void transposeRecursive(std::size_t rows, std::size_t cols, const T *in, std::size_t ldIn,
+                        T *out, std::size_t ldOut)
+{
+    constexpr std::size_t Leaf = defaultTileSide<V>();
+    if (rows <= Leaf && cols <= Leaf) {
+        transposeLeaf<V>(rows, cols, in, ldIn, out, ldOut);
+    } else if (rows >= cols) {
+        const std::size_t h = transposeSplit<V>(rows);
+        transposeRecursive<V>(h, cols, in, ldIn, out, ldOut);
+        transposeRecursive<V>(rows - h, cols, in + h * ldIn, ldIn, out + h, ldOut);
+    } else {
+        const std::size_t h = transposeSplit<V>(cols);
+        transposeRecursive<V>(rows, h, in, ldIn, out, ldOut);
+        transposeRecursive<V>(rows, cols - h, in + h, ldIn, out + h * ldOut, ldOut);
+    }
+}
+
+/**\internal
+ * Replaces the \p rows x \p cols matrix at \p a and the \p cols x \p rows matrix at \p b
+ * with the transpose of the other.
+ */
+template <typename V, typename T>
+void transposeSwapRecursive(std::size_t rows, std::size_t cols, T *a, T *b, std::size_t ld)
+{
+    constexpr std::size_t Leaf = defaultTileSide<V>();
+    if (rows <= Leaf && cols <= Leaf) {
+        const std::size_t rm = rows - rows % V::Size;
+        const std::size_t cm = cols - cols % V::Size;
+        for (std::size_t i = 0; i < rm; i += V::Size) {
+            for (std::size_t j = 0; j < cm; j += V::Size) {
+                transposeSwapBlocks<V>(a + i * ld + j, b + j * ld + i, ld, Vc::Unaligned);
+            }
+        }
+        for (std::size_t i = 0; i < rows; ++i) {
+            for (std::size_t j = i < rm ? cm : 0; j < cols; ++j) {
+                std::swap(a[i * ld + j], b[j * ld + i]);
+            }
+        }
+    } else if (rows >= cols) {
+        const std::size_t h = transposeSplit<V>(rows);
+        transposeSwapRecursive<V>(h, cols, a, b, ld);
+        transposeSwapRecursive<V>(rows - h, cols, a + h * ld, b + h, ld);
+    } else {
+        const std::size_t h = transposeSplit<V>(cols);
+        transposeSwapRecursive<V>(rows, h, a, b, ld);
+        transposeSwapRecursive<V>(rows, cols - h, a + h, b + h * ld, ld);
+    }
+}
+
+/**\internal
+ * Cache-oblivious in-place transposition of the square \p n x \p n matrix at \p a.
+ */
+template <typename V, typename T>
+void transposeInPlaceRecursive(std::size_t n, T *a, std::size_t ld)
+{
+    constexpr std::size_t Leaf = defaultTileSide<V>();
+    if (n <= Leaf) {
+        const std::size_t m = n - n % V::Size;
+        for (std::size_t i = 0; i < m; i += V::Size) {
+            transposeBlock<V>(a + i * ld + i, ld, a + i * ld + i, ld, Vc::Unaligned);
+            for (std::size_t j = i + V::Size; j < m; j += V::Size) {
+                transposeSwapBlocks<V>(a + i * ld + j, a + j * ld + i, ld, Vc::Unaligned);
+            }
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = std::max(i + 1, m); j < n; ++j) {
+                std::swap(a[i * ld + j], a[j * ld + i]);
+            }
+        }
+    } else {
+        const std::size_t h = transposeSplit<V>(n);
+        transposeInPlaceRecursive<V>(h, a, ld);
+        transposeInPlaceRecursive<V>(n - h, a + h * ld + h, ld);
+        transposeSwapRecursive<V>(h, n - h, a + h, a + h * ld, ld);
+    }
+}
+
+// tiled transposition {{{1
+template <typename V, std::size_t Side>
+Vc_INTRINSIC void transposeTile(const typename V::EntryType *in, typename V::EntryType *out)
+{
+    for (std::size_t i = 0; i < Side; i += V::Size) {
+        for (std::size_t j = 0; j < Side; j += V::Size) {
+            transposeBlock<V>(in + i * Side + j, Side, out + j * Side + i, Side, Vc::Aligned);
+        }
+    }
+}
+
+template <typename V, std::size_t Side>
+Vc_INTRINSIC void transposeTileInPlace(typename V::EntryType *a)
+{
+    for (std::size_t i = 0; i < Side; i += V::Size) {
+        transposeBlock<V>(a + i * Side + i, Side, a + i * Side + i, Side, Vc::Aligned);
+        for (std::size_t j = i + V::Size; j < Side; j += V::Size) {
+            transposeSwapBlocks<V>(a + i * Side + j, a + j * Side + i, Side, Vc::Aligned);
+        }
+    }
+}
+
+template <typename V, std::size_t Side>
+Vc_INTRINSIC void transposeSwapTiles(typename V::EntryType *a, typename V::EntryType *b)
+{
+    for (std::size_t i = 0; i < Side; i += V::Size) {
+        for (std::size_t j = 0; j < Side; j += V::Size) {
+            transposeSwapBlocks<V>(a + i * Side + j, b + j * Side + i, Side, Vc::Aligned);
+        }
+    }
+}
+
+/**\internal
+ * Transposes a TiledMemory with as many tile rows as tile columns in place.
+ */
+template <typename V, typename P, std::size_t Side>
+void transposeSquareTiles(Common::TiledMemoryBase<V, P, Side> &m)
+{
+    const std::size_t n = m.tileRowsCount();
+    for (std::size_t i = 0; i < n; ++i) {
+        transposeTileInPlace<V, Side>(m.tile(i, i).entries());
+        for (std::size_t j = i + 1; j < n; ++j) {
+            transposeSwapTiles<V, Side>(m.tile(i, j).entries(), m.tile(j, i).entries());
+        }
+    }
+}
+//}}}1
+}  // namespace Detail
+
+// simd_transpose {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile tiledmemory.h <Vc/Memory>
+ *
+ * Writes the transpose of the row-major \p rows x \p cols matrix \p in to the row-major
+ * \p cols x \p rows matrix \p out.
+ *
+ * The matrix is split recursively (cache-obliviously) into blocks of at most 32 x 32 entries,
+ * which are transposed with Vc::transpose on \VSize{T} x \VSize{T} blocks.
+ *
+ * \param rows  The number of rows of \p in.
+ * \param cols  The number of columns of \p in.
+ * \param in    The matrix to transpose. It must not overlap with \p out.
+ * \param ldIn  The number of entries between the starts of two rows of \p in.
+ * \param out   The destination.
+ * \param ldOut The number of entries between the starts of two rows of \p out.
+ */
+template <typename T>
+inline void simd_transpose(std::size_t rows, std::size_t cols, const T *in,
+                           std::size_t ldIn, T *out, std::size_t ldOut)
+{
+    Detail::transposeRecursive<Vector<T>>(rows, cols, in, ldIn, out, ldOut);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile tiledmemory.h <Vc/Memory>
+ *
+ * Transposes the row-major \p n x \p n matrix \p a in place.
+ *
+ * \param n  The number of rows and columns of \p a.
+ * \param a  The matrix to transpose.
+ * \param ld The number of entries between the starts of two rows of \p a.
+ */
+template <typename T> inline void simd_transpose(std::size_t n, T *a, std::size_t ld)
+{
+    Detail::transposeInPlaceRecursive<Vector<T>>(n, a, ld);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile tiledmemory.h <Vc/Memory>
+ *
+ * Writes the transpose of the two-dimensional Memory \p in to \p out.
+ */
+template <typename V, std::size_t Rows, std::size_t Cols, bool P1, bool P2>
+inline void simd_transpose(const Memory<V, Rows, Cols, P1> &in, Memory<V, Cols, Rows, P2> &out)
+{
+    static_assert(Rows > 0 && Cols > 0, "simd_transpose requires two-dimensional Memory");
+    Detail::transposeRecursive<V>(Rows, Cols, in.entries(0), in[0].vectorsCount() * V::Size,
+                                  out.entries(0), out[0].vectorsCount() * V::Size);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile tiledmemory.h <Vc/Memory>
+ *
+ * Transposes the square two-dimensional Memory \p m in place.
+ */
+template <typename V, std::size_t N, bool P>
+inline void simd_transpose(Memory<V, N, N, P> &m)
+{
+    static_assert(N > 0, "simd_transpose requires two-dimensional Memory");
+    Detail::transposeInPlaceRecursive<V>(N, m.entries(0), m[0].vectorsCount() * V::Size);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile tiledmemory.h <Vc/Memory>
+ *
+ * Writes the transpose of \p in to \p out, tile by tile.
+ *
+ * \p out must have as many rows as \p in has columns and vice versa. The padding of \p in
+ * becomes the padding of \p out, i.e. it stays zero.
+ */
+template <typename V, typename P1, typename P2, std::size_t Side>
+inline void simd_transpose(const Common::TiledMemoryBase<V, P1, Side> &in,
+                           Common::TiledMemoryBase<V, P2, Side> &out)
+{
+    Vc_ASSERT(out.rowsCount() == in.columnsCount() && out.columnsCount() == in.rowsCount());
+    for (std::size_t tr = 0; tr < out.tileRowsCount(); ++tr) {
+        for (std::size_t tc = 0; tc < out.tileColumnsCount(); ++tc) {
+            Detail::transposeTile<V, Side>(in.tile(tc, tr).entries(),
+                                           out.tile(tr, tc).entries());
+        }
+    }
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile tiledmemory.h <Vc/Memory>
+ *
+ * Transposes the square TiledMemory \p m in place.
+ */
+template <typename V, std::size_t N, std::size_t Side>
+inline void simd_transpose(Common::TiledMemory<V, N, N, Side> &m)
+{
+    Detail::transposeSquareTiles(m);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile tiledmemory.h <Vc/Memory>
+ *
+ * Transposes the dynamically sized TiledMemory \p m in place. Afterwards \p m has
+ * columnsCount() rows and rowsCount() columns.
+ *
+ * If the number of tile rows and tile columns differ, the tiles are transposed one by one
+ * and then permuted along the cycles of the transposition; no additional memory is needed
+ * except for one bit per tile.
+ */
+template <typename V, std::size_t Side>
+void simd_transpose(Common::TiledMemory<V, 0, 0, Side> &m)
+{
+    const std::size_t tileRows = m.tileRowsCount();
+    const std::size_t tileCols = m.tileColumnsCount();
+    if (tileRows == tileCols) {
+        Detail::transposeSquareTiles(m);
+    } else {
+        constexpr std::size_t TileEntries = Side * Side;
+        auto *mem = m.entries();
+        for (std::size_t k = 0; k < tileRows * tileCols; ++k) {
+            Detail::transposeTileInPlace<V, Side>(mem + k * TileEntries);
+        }
+        // tile k = i * tileCols + j moves to j * tileRows + i
+        std::vector<bool> done(tileRows * tileCols, false);
+        for (std::size_t start = 0; start < done.size(); ++start) {
+            if (done[start]) {
+                continue;
+            }
+            done[start] = true;
+            for (std::size_t k = start % tileCols * tileRows + start / tileCols; k != start;
+                 k = k % tileCols * tileRows + k / tileCols) {
+                std::swap_ranges(mem + start * TileEntries, mem + (start + 1) * TileEntries,
+                                 mem + k * TileEntries);
+                done[k] = true;
+            }
+        }
+    }
+    std::swap(m.m_rows, m.m_columns);
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_TILEDMEMORY_H_
+
+// vim: foldmethod=marker
@@ -29,7 +29,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define VC_COMMON_TRANSPOSE_H_
 
 #include "macros.h"
+#include "indexsequence.h"
 #include <tuple>
+#include <type_traits>
 
 namespace Vc_VERSIONED_NAMESPACE
 {
@@ -44,9 +46,61 @@ template <typename... Inputs> struct TransposeProxy
 
 template <int LhsLength, size_t RhsLength> struct TransposeTag {
 };
+
+// generic transpose_impl {{{1
+/**\internal
+ * Transposes the square matrix of N = V::Size vectors in \p proxy with log2(N) rounds of
+ * interleaveLow/interleaveHigh. Every round moves the most significant bit of the row index
+ * to the least significant bit of the column index, thus after log2(N) rounds row and column
+ * are swapped. The (non-template) overloads for specific types are preferred.
+ */
+template <typename V, typename... Inputs, std::size_t... Indexes>
+Vc_INTRINSIC void transposeInterleaved(V *Vc_RESTRICT r[],
+                                       const TransposeProxy<Inputs...> &proxy,
+                                       index_sequence<Indexes...>)
+{
+    constexpr std::size_t N = sizeof...(Indexes);
+    static_assert((N & (N - 1)) == 0, "the generic transpose requires a power-of-2 size");
+    V x[N] = {V(std::get<Indexes>(proxy.in))...};
+    for (std::size_t round = 1; round < N; round *= 2) {
+        V y[N];
+        for (std::size_t i = 0; i < N / 2; ++i) {
+            y[2 * i] = x[i].interleaveLow(x[i + N / 2]);
+            y[2 * i + 1] = x[i].interleaveHigh(x[i + N / 2]);
+        }
+        for (std::size_t i = 0; i < N; ++i) {
+            x[i] = y[i];
+        }
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+        *r[i] = x[i];
+    }
+}
+
+template <typename T, typename Abi, int LhsLength, size_t RhsLength, typename... Inputs>
+Vc_INTRINSIC typename std::enable_if<(LhsLength == Vector<T, Abi>::Size &&
+                                      RhsLength == Vector<T, Abi>::Size),
+                                     void>::type
+transpose_impl(TransposeTag<LhsLength, RhsLength>, Vector<T, Abi> *Vc_RESTRICT r[],
+               const TransposeProxy<Inputs...> &proxy)
+{
+    transposeInterleaved(r, proxy, make_index_sequence<RhsLength>());
+}
+//}}}1
 }  // namespace Common
 
-template <typename... Vs> Common::TransposeProxy<Vs...> transpose(Vs... vs)
+/**
+ * \ingroup Utilities
+ *
+ * Transposes the matrix given by the rows \p vs into the vectors on the left-hand side of
+ * the assignment:
+ * \code
+ * Vc::tie(c0, c1, c2, c3) = Vc::transpose(r0, r1, r2, r3);  // float_v with 4 entries
+ * \endcode
+ * Every vector type supports the square case of \VSize{T} vectors. The inputs are
+ * referenced, not copied, until the assignment.
+ */
+template <typename... Vs> Common::TransposeProxy<Vs...> transpose(const Vs &... vs)
 {
     return {vs...};
 }
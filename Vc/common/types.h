@@ -36,6 +36,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../global.h"
 #include "../traits/type_traits.h"
 #include "permutation.h"
+#include "half.h"
 
 namespace Vc_VERSIONED_NAMESPACE
 {
@@ -90,6 +91,23 @@ constexpr VectorSpecialInitializerOne One = {};
 constexpr VectorSpecialInitializerIndexesFromZero IndexesFromZero = {};
 ///@}
 
+/**\internal
+ * Tag type for selecting the reduced precision math functions.
+ */
+struct FastMathTag {};
+/**
+ * \ingroup Math
+ *
+ * Pass \p Vc::fast_math as additional argument to exp, log, sin, cos, sincos, or atan2 to
+ * select an implementation that trades precision and special value handling for
+ * throughput. The achieved precision is documented at the respective function.
+ *
+ * \code
+ * const float_v y = Vc::exp(x, Vc::fast_math);
+ * \endcode
+ */
+constexpr FastMathTag fast_math = {};
+
 namespace Detail
 {
 template<typename T> struct MayAliasImpl {
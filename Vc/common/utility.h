@@ -89,6 +89,23 @@ template <std::size_t N> static constexpr std::size_t right_size()
 }
 
 }  // namespace Common
+
+namespace Detail
+{
+/**\internal
+ * Returns `a * b + c`. The multiply-add is fused only if the target has FMA instructions;
+ * otherwise Vc::fma would emulate the single rounding, which costs far more than
+ * the matrix and stencil kernels can afford.
+ */
+template <typename V> Vc_INTRINSIC V multiplyAdd(const V &a, const V &b, const V &c)
+{
+#if defined Vc_IMPL_FMA || defined Vc_IMPL_FMA4
+    return fma(a, b, c);
+#else
+    return a * b + c;
+#endif
+}
+}  // namespace Detail
 }  // namespace Vc
 
 #endif  // VC_COMMON_UTILITY_H_
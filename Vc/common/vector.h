@@ -199,15 +199,18 @@ public:
     /**
      * Returns a vector with pseudo-random entries.
      *
-     * Currently the state of the random number generator cannot be modified and starts
-     * off with the same state. Thus you will get the same sequence of numbers for the
-     * same sequence of calls.
+     * Currently the state of the random number generator cannot be modified. Every
+     * thread uses its own state. The first thread starts off with the same state on
+     * every run, thus you will get the same sequence of numbers for the same sequence
+     * of calls; further threads get a state derived from the order in which they first
+     * call Random().
      *
      * \return a new random vector. Floating-point values will be in the 0-1 range.
      * Integers will use the full range the integer representation allows.
      *
      * \note This function may use a very small amount of state and thus will be a weak
-     * random number generator.
+     * random number generator. Use xoshiro128pp_engine and the distributions in
+     * <Vc/random> for reproducible, independent streams.
      */
     static inline Vector Random();
 
@@ -670,6 +673,36 @@ public:
      */
     inline Vector sorted() const;
 
+    /**
+     * \name Compress and Expand
+     *
+     * These functions move the entries selected by a mask to the front of the vector and
+     * back. Together with compress_store and expand_load they implement filtering and
+     * stream compaction without branches.
+     *
+     * Example:
+     * \code
+     * using namespace Vc;
+     * int_v x = int_v::IndexesFromZero() + 1;      // e.g. [1, 2, 3, 4] with SSE
+     * int_v y = x.compress(x > 2 || x == 1);      // [1, 3, 4, 0]
+     * int_v z = y.expand(x > 2 || x == 1);        // [1, 0, 3, 4]
+     * \endcode
+     */
+    ///@{
+
+    /**
+     * Returns the entries where \p mask is \c true, in order, in the first \p mask.count()
+     * entries. The remaining entries are zero.
+     */
+    inline Vector compress(MaskType mask) const;
+    /**
+     * The inverse of compress: returns a vector where the entries selected by \p mask are
+     * the first \p mask.count() entries of this vector, in order. The remaining entries are
+     * zero.
+     */
+    inline Vector expand(MaskType mask) const;
+    ///@}
+
     /*!
      * \name Apply/Call/Fill Functions
      *
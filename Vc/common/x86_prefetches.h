@@ -29,6 +29,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define VC_COMMON_X86_PREFETCHES_H_
 
 #include <xmmintrin.h>
+#include "prefetch.h"
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -84,18 +85,34 @@ Vc_INTRINSIC void prefetchFar(const void *addr)
 /*handlePrefetch/handleLoadPrefetches/handleStorePrefetches{{{*/
 namespace
 {
-template<size_t L1, size_t L2, bool UseExclusivePrefetch> Vc_INTRINSIC void handlePrefetch(const void *addr_, typename std::enable_if<L1 != 0 && L2 != 0, void *>::type = nullptr)
+template <size_t L1, size_t L2>
+using is_auto_prefetch = std::integral_constant<bool, L1 == Vc::Auto || L2 == Vc::Auto>;
+
+template<size_t L1, size_t L2, bool UseExclusivePrefetch> Vc_INTRINSIC void handlePrefetch(const void *addr_, typename std::enable_if<is_auto_prefetch<L1, L2>::value, void *>::type = nullptr)
+{
+    const char *addr = static_cast<const char *>(addr_);
+    const PrefetchDistances &d = Vc::Detail::prefetchDistances();
+    const size_t l1 = L1 == Vc::Auto ? d.l1 : L1;
+    const size_t l2 = L2 == Vc::Auto ? d.l2 : L2;
+    if (l1 != 0) {
+        prefetchClose<typename std::conditional<UseExclusivePrefetch, Vc::Exclusive, Vc::Shared>::type>(addr + l1);
+    }
+    if (l2 != 0) {
+        prefetchMid  <typename std::conditional<UseExclusivePrefetch, Vc::Exclusive, Vc::Shared>::type>(addr + l2);
+    }
+}
+template<size_t L1, size_t L2, bool UseExclusivePrefetch> Vc_INTRINSIC void handlePrefetch(const void *addr_, typename std::enable_if<!is_auto_prefetch<L1, L2>::value && L1 != 0 && L2 != 0, void *>::type = nullptr)
 {
     const char *addr = static_cast<const char *>(addr_);
     prefetchClose<typename std::conditional<UseExclusivePrefetch, Vc::Exclusive, Vc::Shared>::type>(addr + L1);
     prefetchMid  <typename std::conditional<UseExclusivePrefetch, Vc::Exclusive, Vc::Shared>::type>(addr + L2);
 }
-template<size_t L1, size_t L2, bool UseExclusivePrefetch> Vc_INTRINSIC void handlePrefetch(const void *addr_, typename std::enable_if<L1 == 0 && L2 != 0, void *>::type = nullptr)
+template<size_t L1, size_t L2, bool UseExclusivePrefetch> Vc_INTRINSIC void handlePrefetch(const void *addr_, typename std::enable_if<!is_auto_prefetch<L1, L2>::value && L1 == 0 && L2 != 0, void *>::type = nullptr)
 {
     const char *addr = static_cast<const char *>(addr_);
     prefetchMid  <typename std::conditional<UseExclusivePrefetch, Vc::Exclusive, Vc::Shared>::type>(addr + L2);
 }
-template<size_t L1, size_t L2, bool UseExclusivePrefetch> Vc_INTRINSIC void handlePrefetch(const void *addr_, typename std::enable_if<L1 != 0 && L2 == 0, void *>::type = nullptr)
+template<size_t L1, size_t L2, bool UseExclusivePrefetch> Vc_INTRINSIC void handlePrefetch(const void *addr_, typename std::enable_if<!is_auto_prefetch<L1, L2>::value && L1 != 0 && L2 == 0, void *>::type = nullptr)
 {
     const char *addr = static_cast<const char *>(addr_);
     prefetchClose<typename std::conditional<UseExclusivePrefetch, Vc::Exclusive, Vc::Shared>::type>(addr + L1);
@@ -0,0 +1,231 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_DISPATCH_H_
+#define VC_DISPATCH_H_
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "global.h"
+#include "support.h"
+#include "common/macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// FirstImplementation {{{1
+template <typename Impl, typename...> struct FirstImplementation {
+    using type = Impl;
+};
+
+// ImplementationFeatures {{{1
+template <typename Impl> struct ImplementationFeatures;
+template <unsigned int Features>
+struct ImplementationFeatures<ImplementationT<Features>>
+    : public std::integral_constant<unsigned int, Features> {
+};
+
+// Dispatcher {{{1
+template <typename Kernel, typename F, typename... Impls> class Dispatcher;
+template <typename Kernel, typename R, typename... Args, typename... Impls>
+class Dispatcher<Kernel, R (*)(Args...), Impls...>
+{
+public:
+    typedef R (*pointer)(Args...);
+
+    /**
+     * Calls the kernel for the best implementation supported by the executing system.
+     * After the first call this is a single indirect call.
+     */
+    static Vc_ALWAYS_INLINE R call(Args... args)
+    {
+        return s_function.load(std::memory_order_relaxed)(std::forward<Args>(args)...);
+    }
+
+    /// Returns the implementation that call() dispatches to.
+    static Implementation implementation()
+    {
+        return static_cast<Implementation>(features()[bestIndex()] & ImplementationMask);
+    }
+
+    /**
+     * Returns the kernel compiled for \p Impl, or \c nullptr if \p Impl is not in the
+     * list of implementations of this dispatcher. The caller is responsible for checking
+     * isImplementationSupported<Impl>() before calling the returned function.
+     */
+    template <typename Impl> static pointer function()
+    {
+        for (std::size_t i = 0; i < sizeof...(Impls); ++i) {
+            if (features()[i] == ImplementationFeatures<Impl>::value) {
+                return functions()[i];
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    static const unsigned int *features()
+    {
+        static constexpr unsigned int f[] = {ImplementationFeatures<Impls>::value...};
+        return f;
+    }
+    static const pointer *functions()
+    {
+        static constexpr pointer fns[] = {&Kernel::template apply<Impls>...};
+        return fns;
+    }
+
+    // Whether implementation a is preferable over b: a higher Vc::Implementation wins. For
+    // the same Vc::Implementation a superset of the extra instructions wins.
+    static bool isBetter(unsigned int a, unsigned int b)
+    {
+        const unsigned int implA = a & ImplementationMask;
+        const unsigned int implB = b & ImplementationMask;
+        if (implA != implB) {
+            return implA > implB;
+        }
+        return a != b && (a & b) == b;
+    }
+
+    // The best implementation the system supports, considering the extra instructions each
+    // kernel was compiled with. If none is supported the first entry is used, which
+    // therefore should be the baseline (ScalarImpl or SSE2Impl).
+    static std::size_t bestIndex()
+    {
+        const bool supported[] = {isImplementationSupported<Impls>()...};
+        std::size_t best = 0;
+        bool found = false;
+        for (std::size_t i = 0; i < sizeof...(Impls); ++i) {
+            if (supported[i] && (!found || isBetter(features()[i], features()[best]))) {
+                best = i;
+                found = true;
+            }
+        }
+        return best;
+    }
+
+    // s_function initially points here. The first call resolves the kernel and replaces
+    // the pointer. Concurrent first calls all store the same value, so relaxed ordering
+    // suffices.
+    static R resolve(Args... args)
+    {
+        const pointer f = functions()[bestIndex()];
+        s_function.store(f, std::memory_order_relaxed);
+        return f(std::forward<Args>(args)...);
+    }
+
+    static std::atomic<pointer> s_function;
+};
+
+template <typename Kernel, typename R, typename... Args, typename... Impls>
+std::atomic<R (*)(Args...)> Dispatcher<Kernel, R (*)(Args...), Impls...>::s_function{
+    &Dispatcher<Kernel, R (*)(Args...), Impls...>::resolve};
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile dispatch.h <Vc/dispatch.h>
+ *
+ * Selects, at the first call, the best of several compilations of a kernel for the
+ * system the code is executing on.
+ *
+ * The kernel is a class with a static member function template `apply` that is
+ * parameterized on the Vc::ImplementationT type of the compilation. A source file that
+ * defines the explicit specialization for Vc::CurrentImplementation is compiled once per
+ * implementation (e.g. with \c vc_compile_for_all_implementations from VcMacros.cmake),
+ * while the code that calls the kernel is compiled for the baseline target:
+ *
+ * \code
+ * // saxpy.h
+ * struct Saxpy {
+ *   template <typename Impl>
+ *   static void apply(float a, const float *x, float *y, std::size_t n);
+ * };
+ *
+ * // saxpy.cpp, compiled with Vc_IMPL=SSE2 and Vc_IMPL=AVX2+FMA+BMI2
+ * template <>
+ * void Saxpy::apply<Vc::CurrentImplementation>(float a, const float *x, float *y,
+ *                                              std::size_t n)
+ * {
+ *   ...
+ * }
+ *
+ * // main.cpp
+ * using SSE2 = Vc::ImplementationT<Vc::SSE2Impl>;
+ * using AVX2 = Vc::ImplementationT<Vc::AVX2Impl + Vc::FmaInstructions +
+ *                                  Vc::Bmi2Instructions + Vc::PopcntInstructions +
+ *                                  Vc::VexInstructions>;
+ * Vc::dispatch<Saxpy, SSE2, AVX2>(2.f, x, y, n);
+ * \endcode
+ *
+ * Each listed type must name exactly the Vc::CurrentImplementation of one of the kernel
+ * compilations, including the extra instructions the compiler flags imply (e.g.
+ * \c -mavx implies POPCNT and VEX coding). Otherwise the specialization is not found
+ * at link time. A kernel is only called if the system supports its Vc::Implementation
+ * and all of its Vc::ExtraInstructions (see isImplementationSupported<Impl>()).
+ *
+ * The chosen function pointer is cached, thus every call after the first costs a single
+ * indirect call. All implementations must be listed in the same order of the dispatcher
+ * everywhere it is used and each listed specialization must be linked in.
+ *
+ * \note Functions that are not inlined (e.g. non-Vc helpers defined in headers) may be
+ * merged across the differently compiled translation units by the linker. Keep the
+ * per-implementation code self-contained.
+ *
+ * \tparam Kernel A class providing `template <typename Impl> static R apply(...)`.
+ * \tparam Impls The Vc::ImplementationT types the kernel was compiled for.
+ */
+template <typename Kernel, typename... Impls>
+using ImplementationDispatcher = Detail::Dispatcher<
+    Kernel,
+    decltype(&Kernel::template apply<typename Detail::FirstImplementation<Impls...>::type>),
+    Impls...>;
+
+/**
+ * \ingroup Utilities
+ * \headerfile dispatch.h <Vc/dispatch.h>
+ *
+ * Calls the best supported implementation of \p Kernel.
+ *
+ * \see ImplementationDispatcher
+ */
+template <typename Kernel, typename... Impls, typename... Args>
+Vc_ALWAYS_INLINE auto dispatch(Args &&... args)
+    -> decltype(ImplementationDispatcher<Kernel, Impls...>::call(std::forward<Args>(args)...))
+{
+    return ImplementationDispatcher<Kernel, Impls...>::call(std::forward<Args>(args)...);
+}
+}  // namespace Vc
+
+#endif  // VC_DISPATCH_H_
+
+// vim: foldmethod=marker
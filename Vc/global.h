@@ -172,6 +172,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define SSE4a  0x00000010
 #define FMA    0x00000020
 #define BMI2   0x00000040
+#define AVX512VL 0x00000080
 
 #define IMPL_MASK 0xFFF00000
 #define EXT_MASK  0x000FFFFF
@@ -266,6 +267,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #    ifdef __BMI2__
 #      define Vc_IMPL_BMI2 1
 #    endif
+#    if defined(__AVX512F__) && defined(__AVX512CD__) && defined(__AVX512VL__) &&       \
+        defined(__AVX512BW__) && defined(__AVX512DQ__)
+#      define Vc_IMPL_AVX512VL 1
+#    endif
 #  endif
 
 #else // Vc_IMPL
@@ -347,6 +352,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #  if (Vc_IMPL & BMI2)
 #    define Vc_IMPL_BMI2 1
 #  endif
+#  if (Vc_IMPL & AVX512VL)
+#    define Vc_IMPL_AVX512VL 1
+#  endif
 #  undef Vc_IMPL
 
 #endif // Vc_IMPL
@@ -380,6 +388,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #  error "No suitable Vc implementation was selected! Probably Vc_IMPL was set to an invalid value."
 # elif defined(Vc_IMPL_SSE) && !defined(Vc_IMPL_SSE2)
 #  error "SSE requested but no SSE2 support. Vc needs at least SSE2!"
+# elif defined(Vc_IMPL_AVX512VL) &&                                                      \
+    !(defined(__AVX512F__) && defined(__AVX512CD__) && defined(__AVX512VL__) &&         \
+      defined(__AVX512BW__) && defined(__AVX512DQ__))
+#  error "AVX512VL requested but the compiler does not enable AVX512F, AVX512CD, AVX512VL, AVX512BW, and AVX512DQ."
 # endif
 
 #undef Scalar
@@ -399,6 +411,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #undef SSE4a
 #undef FMA
 #undef BMI2
+#undef AVX512VL
 
 #undef IMPL_MASK
 #undef EXT_MASK
@@ -453,7 +466,15 @@ enum MallocAlignment {
      * full page access to the end. Thus the allocated memory contains a multiple of
      * 4096 bytes.
      */
-    AlignOnPage
+    AlignOnPage,
+    /**
+     * Align on boundary of huge page sizes (2 MiB on x86) and pad to a multiple of 2 MiB.
+     * On Linux the kernel is additionally asked to back the memory with transparent huge
+     * pages (\c madvise(MADV_HUGEPAGE)), which reduces TLB misses for large arrays that are
+     * accessed with a large stride or randomly. If transparent huge pages are disabled the
+     * memory silently falls back to normal pages.
+     */
+    AlignOnHugePage
 };
 
 /**
@@ -514,6 +535,8 @@ enum ExtraInstructions : std::uint_least32_t { // TODO: make enum class
     VexInstructions       = 0x40000,
     //! Support for BMI2 instructions
     Bmi2Instructions      = 0x80000,
+    //! Support for AVX-512 F, CD, VL, BW, and DQ instructions (on 128- and 256-bit registers)
+    Avx512VlInstructions  = 0x100000,
     // PclmulqdqInstructions,
     // AesInstructions,
     // RdrandInstructions
@@ -600,6 +623,9 @@ using CurrentImplementation = ImplementationT<
 #ifdef Vc_IMPL_BMI2
     + Vc::Bmi2Instructions
 #endif
+#ifdef Vc_IMPL_AVX512VL
+    + Vc::Avx512VlInstructions
+#endif
 #ifdef Vc_USE_VEX_CODING
     + Vc::VexInstructions
 #endif
@@ -70,8 +70,44 @@ Vc_INTRINSIC Vc_CONST Scalar::double_v copysign(Scalar::double_v mag,
         return Scalar::V(std::max(x.data(), y.data()));                                  \
     }
 Vc_ALL_VECTOR_TYPES(Vc_MINMAX);
+Vc_MINMAX( schar_v);
+Vc_MINMAX( uchar_v);
+Vc_MINMAX( llong_v);
+Vc_MINMAX(ullong_v);
 #undef Vc_MINMAX
 
+// saturating arithmetic {{{1
+#define Vc_SATURATING(V)                                                                 \
+    static Vc_ALWAYS_INLINE Scalar::V add_sat(const Scalar::V &x, const Scalar::V &y)    \
+    {                                                                                    \
+        using T = Scalar::V::EntryType;                                                  \
+        return Scalar::V(T(std::min<int>(std::numeric_limits<T>::max(),                  \
+                                         std::max<int>(std::numeric_limits<T>::min(),    \
+                                                       int(x.data()) + int(y.data())))));\
+    }                                                                                    \
+    static Vc_ALWAYS_INLINE Scalar::V sub_sat(const Scalar::V &x, const Scalar::V &y)    \
+    {                                                                                    \
+        using T = Scalar::V::EntryType;                                                  \
+        return Scalar::V(T(std::min<int>(std::numeric_limits<T>::max(),                  \
+                                         std::max<int>(std::numeric_limits<T>::min(),    \
+                                                       int(x.data()) - int(y.data())))));\
+    }
+Vc_SATURATING( schar_v);
+Vc_SATURATING( uchar_v);
+Vc_SATURATING( short_v);
+Vc_SATURATING(ushort_v);
+#undef Vc_SATURATING
+
+// byte shuffle {{{1
+static Vc_ALWAYS_INLINE Scalar::uchar_v shuffle(const Scalar::uchar_v &x, const Scalar::uchar_v &indexes)
+{
+    return Scalar::uchar_v(indexes.data() == 0 ? x.data() : uchar(0));
+}
+static Vc_ALWAYS_INLINE Scalar::schar_v shuffle(const Scalar::schar_v &x, const Scalar::uchar_v &indexes)
+{
+    return Scalar::schar_v(indexes.data() == 0 ? x.data() : schar(0));
+}
+
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> sqrt (const Scalar::Vector<T> &x)
 {
     return Scalar::Vector<T>(std::sqrt(x.data()));
@@ -85,7 +121,9 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> rsqrt(const Scala
 template <typename T,
           typename = enable_if<std::is_same<T, double>::value || std::is_same<T, float>::value ||
                                std::is_same<T, short>::value ||
-                               std::is_same<T, int>::value>>
+                               std::is_same<T, int>::value ||
+                               std::is_same<T, signed char>::value ||
+                               std::is_same<T, long long>::value>>
 Vc_ALWAYS_INLINE Vc_PURE Scalar::Vector<T> abs(Scalar::Vector<T> x)
 {
     return std::abs(x.data());
@@ -150,6 +188,56 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> exp (const Scalar
     return Scalar::Vector<T>(std::exp(x.data()));
 }
 
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> expm1(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::expm1(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> log1p(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::log1p(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> sinh(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::sinh(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> cosh(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::cosh(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> tanh(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::tanh(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> erf(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::erf(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> erfc(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::erfc(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> cbrt(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::cbrt(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> hypot(const Scalar::Vector<T> &x, const Scalar::Vector<T> &y)
+{
+    return Scalar::Vector<T>(std::hypot(x.data(), y.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> pow(const Scalar::Vector<T> &x, const Scalar::Vector<T> &y)
+{
+    return Scalar::Vector<T>(std::pow(x.data(), y.data()));
+}
+
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> atan (const Scalar::Vector<T> &x)
 {
     return Scalar::Vector<T>(std::atan( x.data() ));
@@ -268,6 +356,41 @@ Vc_ALWAYS_INLINE Vector<T, VectorAbi::Scalar> fma(Vector<T, VectorAbi::Scalar> a
     }
 }
 
+// fast_math {{{1
+// The Scalar implementation uses <cmath> for both precision tiers.
+template <typename T>
+Vc_ALWAYS_INLINE Scalar::Vector<T> exp(const Scalar::Vector<T> &x, FastMathTag)
+{
+    return exp(x);
+}
+template <typename T>
+Vc_ALWAYS_INLINE Scalar::Vector<T> log(const Scalar::Vector<T> &x, FastMathTag)
+{
+    return log(x);
+}
+template <typename T>
+Vc_ALWAYS_INLINE Scalar::Vector<T> sin(const Scalar::Vector<T> &x, FastMathTag)
+{
+    return sin(x);
+}
+template <typename T>
+Vc_ALWAYS_INLINE Scalar::Vector<T> cos(const Scalar::Vector<T> &x, FastMathTag)
+{
+    return cos(x);
+}
+template <typename T>
+Vc_ALWAYS_INLINE void sincos(const Scalar::Vector<T> &x, Scalar::Vector<T> *sin,
+                             Scalar::Vector<T> *cos, FastMathTag)
+{
+    sincos(x, sin, cos);
+}
+template <typename T>
+Vc_ALWAYS_INLINE Scalar::Vector<T> atan2(const Scalar::Vector<T> &y,
+                                         const Scalar::Vector<T> &x, FastMathTag)
+{
+    return atan2(y, x);
+}
+
 // }}}1
 }  // namespace Vc
 
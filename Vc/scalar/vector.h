@@ -249,6 +249,9 @@ template <typename T> class Vector<T, VectorAbi::Scalar>
         Vc_INTRINSIC Vector reversed() const { return *this; }
         Vc_INTRINSIC Vector sorted() const { return *this; }
 
+        Vc_INTRINSIC Vector compress(Mask k) const { return k.data() ? *this : Zero(); }
+        Vc_INTRINSIC Vector expand(Mask k) const { return k.data() ? *this : Zero(); }
+
         template <typename F> void callWithValuesSorted(F &&f) { f(m_data); }
 
         template <typename F> Vc_INTRINSIC void call(F &&f) const { f(m_data); }
@@ -136,15 +136,16 @@ Vc_INTRINSIC Vc_CONST Scalar::double_v Vc_VDECL exponent(Scalar::double_v x)
 static Vc_ALWAYS_INLINE void _doRandomStep(Scalar::uint_v &state0, Scalar::uint_v &state1)
 {
     using Scalar::uint_v;
-    state0.load(&Common::RandomState[0]);
-    state1.load(&Common::RandomState[uint_v::Size]);
+    unsigned int *const randomState = Common::randomState();
+    state0.load(&randomState[0]);
+    state1.load(&randomState[uint_v::Size]);
     Detail::operator+(Detail::operator*(state1, uint_v(0xdeece66du)),
                       uint_v(11))
-        .store(&Common::RandomState[uint_v::Size]);
+        .store(&randomState[uint_v::Size]);
     uint_v(Detail::operator+(Detail::operator*(state0, uint_v(0xdeece66du)), uint_v(11))
                .data() ^
            (state1.data() >> 16))
-        .store(&Common::RandomState[0]);
+        .store(&randomState[0]);
 }
 
 template<typename T> Vc_INTRINSIC Vector<T, VectorAbi::Scalar> Vector<T, VectorAbi::Scalar>::Random()
@@ -164,9 +165,10 @@ template<> Vc_INTRINSIC Scalar::float_v Scalar::float_v::Random()
 template<> Vc_INTRINSIC Scalar::double_v Scalar::double_v::Random()
 {
     typedef unsigned long long uint64 Vc_MAY_ALIAS;
-    uint64 state0 = *reinterpret_cast<const uint64 *>(&Common::RandomState[8]);
+    unsigned int *const randomState = Common::randomState();
+    uint64 state0 = *reinterpret_cast<const uint64 *>(&randomState[8]);
     state0 = (state0 * 0x5deece66dull + 11) & 0x000fffffffffffffull;
-    *reinterpret_cast<uint64 *>(&Common::RandomState[8]) = state0;
+    *reinterpret_cast<uint64 *>(&randomState[8]) = state0;
     union { unsigned long long i; double f; } x;
     x.i = state0 | 0x3ff0000000000000ull;
     return Scalar::double_v(x.f - 1.);
@@ -40,6 +40,8 @@ using uint = unsigned int;
 using ushort = unsigned short;
 using uchar = unsigned char;
 using schar = signed char;
+using llong = long long;
+using ullong = unsigned long long;
 
 // sse_cast {{{1
 template <typename To, typename From> Vc_ALWAYS_INLINE Vc_CONST To sse_cast(From v)
@@ -97,6 +99,9 @@ Vc_INTRINSIC __m128  convert(__m128  v, ConvertTag<float , float >) { return v;
 Vc_INTRINSIC __m128  convert(__m128d v, ConvertTag<double, float >) { return _mm_cvtpd_ps(v); }
 Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<int   , float >) { return _mm_cvtepi32_ps(v); }
 Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<uint  , float >) {
+#ifdef Vc_IMPL_AVX512VL
+    return _mm_cvtepu32_ps(v);
+#else
     // see AVX::convert<uint, float> for an explanation of the math behind the
     // implementation
     using namespace SSE;
@@ -105,13 +110,20 @@ Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<uint  , float >) {
                       _mm_add_ps(_mm_set1_ps(1u << 31), _mm_cvtepi32_ps(_mm_and_si128(
                                                           v, _mm_set1_epi32(0x000001ff))))),
         _mm_castsi128_ps(_mm_cmplt_epi32(v, _mm_setzero_si128())));
+#endif
 }
 Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<short , float >) { return convert(convert(v, ConvertTag<short, int>()), ConvertTag<int, float>()); }
 Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<ushort, float >) { return convert(convert(v, ConvertTag<ushort, int>()), ConvertTag<int, float>()); }
 Vc_INTRINSIC __m128d convert(__m128  v, ConvertTag<float , double>) { return _mm_cvtps_pd(v); }
 Vc_INTRINSIC __m128d convert(__m128d v, ConvertTag<double, double>) { return v; }
 Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<int   , double>) { return _mm_cvtepi32_pd(v); }
-Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<uint  , double>) { return _mm_add_pd(_mm_cvtepi32_pd(_mm_xor_si128(v, setmin_epi32())), _mm_set1_pd(1u << 31)); }
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<uint  , double>) {
+#ifdef Vc_IMPL_AVX512VL
+    return _mm_cvtepu32_pd(v);
+#else
+    return _mm_add_pd(_mm_cvtepi32_pd(_mm_xor_si128(v, setmin_epi32())), _mm_set1_pd(1u << 31));
+#endif
+}
 Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<short , double>) { return convert(convert(v, ConvertTag<short, int>()), ConvertTag<int, double>()); }
 Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<ushort, double>) { return convert(convert(v, ConvertTag<ushort, int>()), ConvertTag<int, double>()); }
 Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , short >) { return _mm_packs_epi32(_mm_cvttps_epi32(v), _mm_setzero_si128()); }
@@ -139,6 +151,170 @@ Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , ushort>) { return v;
 Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, ushort>) { return v; }
 Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, ushort>) { return convert(convert(v, ConvertTag<double, int>()), ConvertTag<int, ushort>()); }
 
+// 8-bit conversions truncate (modulo 2^8), as static_cast does
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , schar >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , schar >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , schar >) { return _mm_packus_epi16(_mm_and_si128(v, _mm_set1_epi16(0xff)), _mm_setzero_si128()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, schar >) { return convert(v, ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , schar >) { return convert(_mm_packs_epi32(_mm_and_si128(v, _mm_set1_epi32(0xff)), _mm_setzero_si128()), ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , schar >) { return convert(v, ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , schar >) { return convert(_mm_cvttps_epi32(v), ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, schar >) { return convert(_mm_cvttpd_epi32(v), ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , uchar >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , uchar >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , uchar >) { return convert(v, ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, uchar >) { return convert(v, ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , uchar >) { return convert(v, ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , uchar >) { return convert(v, ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , uchar >) { return convert(convert(v, ConvertTag<float, uint>()), ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, uchar >) { return convert(convert(v, ConvertTag<double, uint>()), ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , short >) { return cvtepi8_epi16(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , short >) { return cvtepu8_epi16(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , ushort>) { return cvtepi8_epi16(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , ushort>) { return cvtepu8_epi16(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , int   >) { return cvtepi8_epi32(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , int   >) { return cvtepu8_epi32(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , uint  >) { return cvtepi8_epi32(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , uint  >) { return cvtepu8_epi32(v); }
+Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<schar , float >) { return _mm_cvtepi32_ps(cvtepi8_epi32(v)); }
+Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<uchar , float >) { return _mm_cvtepi32_ps(cvtepu8_epi32(v)); }
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<schar , double>) { return _mm_cvtepi32_pd(cvtepi8_epi32(v)); }
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<uchar , double>) { return _mm_cvtepi32_pd(cvtepu8_epi32(v)); }
+
+// 64-bit integer conversions; SSE has no conversion between 64-bit integers and
+// floating-point, thus those go through the scalar registers
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , llong >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, llong >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , llong >) { return _mm_unpacklo_epi32(v, _mm_srai_epi32(v, 31)); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , llong >) { return _mm_unpacklo_epi32(v, _mm_setzero_si128()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , llong >) { return convert(convert(v, ConvertTag<short, int>()), ConvertTag<int, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, llong >) { return convert(convert(v, ConvertTag<ushort, int>()), ConvertTag<uint, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , llong >) { return convert(cvtepi8_epi32(v), ConvertTag<int, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , llong >) { return convert(cvtepu8_epi32(v), ConvertTag<uint, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , llong >) {
+    return _mm_set_epi64x(llong(_mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)))),
+                          llong(_mm_cvtss_f32(v)));
+}
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, llong >) {
+    return _mm_set_epi64x(llong(_mm_cvtsd_f64(_mm_unpackhi_pd(v, v))), llong(_mm_cvtsd_f64(v)));
+}
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, ullong>) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , ullong>) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , ullong>) { return convert(v, ConvertTag<int, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , ullong>) { return convert(v, ConvertTag<uint, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , ullong>) { return convert(v, ConvertTag<short, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, ullong>) { return convert(v, ConvertTag<ushort, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , ullong>) { return convert(v, ConvertTag<schar, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , ullong>) { return convert(v, ConvertTag<uchar, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , ullong>) {
+    return _mm_set_epi64x(ullong(_mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)))),
+                          ullong(_mm_cvtss_f32(v)));
+}
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, ullong>) {
+    return _mm_set_epi64x(ullong(_mm_cvtsd_f64(_mm_unpackhi_pd(v, v))), ullong(_mm_cvtsd_f64(v)));
+}
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , int   >) { return _mm_move_epi64(_mm_shuffle_epi32(v, _MM_SHUFFLE(2, 2, 2, 0))); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, int   >) { return convert(v, ConvertTag<llong, int>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , uint  >) { return convert(v, ConvertTag<llong, int>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, uint  >) { return convert(v, ConvertTag<llong, int>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , short >) { return convert(convert(v, ConvertTag<llong, int>()), ConvertTag<int, ushort>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, short >) { return convert(v, ConvertTag<llong, short>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , ushort>) { return convert(v, ConvertTag<llong, short>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, ushort>) { return convert(v, ConvertTag<llong, short>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , schar >) { return convert(convert(v, ConvertTag<llong, int>()), ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, schar >) { return convert(v, ConvertTag<llong, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , uchar >) { return convert(v, ConvertTag<llong, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, uchar >) { return convert(v, ConvertTag<llong, schar>()); }
+Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<llong , float >) {
+    return _mm_setr_ps(float(_mm_cvtsi128_si64(v)),
+                       float(_mm_cvtsi128_si64(_mm_unpackhi_epi64(v, v))), 0.f, 0.f);
+}
+Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<ullong, float >) {
+    return _mm_setr_ps(float(ullong(_mm_cvtsi128_si64(v))),
+                       float(ullong(_mm_cvtsi128_si64(_mm_unpackhi_epi64(v, v)))), 0.f, 0.f);
+}
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<llong , double>) {
+    return _mm_setr_pd(double(_mm_cvtsi128_si64(v)),
+                       double(_mm_cvtsi128_si64(_mm_unpackhi_epi64(v, v))));
+}
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<ullong, double>) {
+    return _mm_setr_pd(double(ullong(_mm_cvtsi128_si64(v))),
+                       double(ullong(_mm_cvtsi128_si64(_mm_unpackhi_epi64(v, v)))));
+}
+
+// half-precision {{{1
+// float16 and bfloat16 are storage types only: their __m128i holds the four 16-bit values
+// in the low 64 bits.
+Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<float16, float>)
+{
+#ifdef Vc_IMPL_F16C
+    return _mm_cvtph_ps(v);
+#else
+    // same algorithm as Detail::float16ToFloat
+    const __m128i h = _mm_unpacklo_epi16(v, _mm_setzero_si128());
+    const __m128i expMask = _mm_set1_epi32(0x7c00 << 13);
+    __m128i o = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7fff)), 13);
+    const __m128i exp = _mm_and_si128(o, expMask);
+    o = _mm_add_epi32(o, _mm_set1_epi32((127 - 15) << 23));
+    // Inf/NaN
+    o = _mm_add_epi32(o, _mm_and_si128(_mm_cmpeq_epi32(exp, expMask),
+                                       _mm_set1_epi32((128 - 16) << 23)));
+    // zero/subnormal: renormalize via a float subtraction
+    const __m128 renormalized =
+        _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(o, _mm_set1_epi32(1 << 23))),
+                   _mm_castsi128_ps(_mm_set1_epi32(113 << 23)));
+    o = blendv_epi8(o, _mm_castps_si128(renormalized),
+                    _mm_cmpeq_epi32(exp, _mm_setzero_si128()));
+    return _mm_castsi128_ps(
+        _mm_or_si128(o, _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16)));
+#endif
+}
+Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float, float16>)
+{
+#ifdef Vc_IMPL_F16C
+    return _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT);
+#else
+    // same algorithm as Detail::floatToFloat16
+    const __m128i denormMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+    __m128i f = _mm_castps_si128(v);
+    const __m128i sign = _mm_and_si128(f, setmin_epi32());
+    f = _mm_xor_si128(f, sign);
+    // normal results, rounded to nearest even
+    const __m128i mantOdd = _mm_and_si128(_mm_srli_epi32(f, 13), _mm_set1_epi32(1));
+    __m128i o = _mm_srli_epi32(
+        _mm_add_epi32(_mm_add_epi32(f, _mm_set1_epi32(0xfff - ((127 - 15) << 23))), mantOdd),
+        13);
+    // subnormal results, the float addition does the rounding
+    const __m128i subnormal = _mm_sub_epi32(
+        _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(f), _mm_castsi128_ps(denormMagic))),
+        denormMagic);
+    o = blendv_epi8(o, subnormal, _mm_cmplt_epi32(f, _mm_set1_epi32(113 << 23)));
+    // overflow to Inf, NaN to quiet NaN
+    const __m128i infOrNan =
+        _mm_or_si128(_mm_set1_epi32(0x7c00),
+                     _mm_and_si128(_mm_cmpgt_epi32(f, _mm_set1_epi32(255 << 23)),
+                                   _mm_set1_epi32(0x0200)));
+    o = blendv_epi8(o, infOrNan, _mm_cmpgt_epi32(f, _mm_set1_epi32(((127 + 16) << 23) - 1)));
+    o = _mm_or_si128(o, _mm_srli_epi32(sign, 16));
+    // sign-extend so that packs does not saturate
+    return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(o, 16), 16), _mm_setzero_si128());
+#endif
+}
+Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<bfloat16, float>)
+{
+    return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), v));
+}
+Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float, bfloat16>)
+{
+    // same algorithm as Detail::floatToBfloat16
+    const __m128i f = _mm_castps_si128(v);
+    const __m128i lsb = _mm_and_si128(_mm_srli_epi32(f, 16), _mm_set1_epi32(1));
+    __m128i o = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(f, _mm_set1_epi32(0x7fff)), lsb), 16);
+    o = blendv_epi8(o, _mm_or_si128(_mm_srli_epi32(f, 16), _mm_set1_epi32(0x40)),
+                    _mm_castps_si128(_mm_cmpunord_ps(v, v)));
+    return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(o, 16), 16), _mm_setzero_si128());
+}
+
 // }}}1
 }  // namespace SSE
 }  // namespace Vc
@@ -58,6 +58,23 @@ struct c_general
     alignas(16) static const unsigned long long frexpMask[2];
 };
 
+/**\internal
+ * Lookup tables for Vector::compress and Vector::expand. The rows are indexed with (up to)
+ * eight mask bits and contain one byte per lane.
+ */
+struct c_compress
+{
+    /// The lane indices of the set bits, packed to the front. Unused lanes are 0xff.
+    alignas(64) static const unsigned char compress[256][8];
+    /// For every set bit the number of set bits below it. Unset bits are 0xff.
+    alignas(64) static const unsigned char expand[256][8];
+    /**
+     * 16 × 0x80, 0, 1, …, 15, 16 × 0x80. A pshufb control loaded from
+     * &byteShift[16 + n] moves byte i + n to byte i and shifts in zeros.
+     */
+    alignas(16) static const unsigned char byteShift[48];
+};
+
 template<typename T> struct c_trig
 {
     alignas(64) static const T data[];
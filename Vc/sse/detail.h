@@ -297,7 +297,7 @@ Vc_INTRINSIC __m128d load(const uchar *mem, Flags, LoadTag<__m128d, double>)
 template <typename Flags>
 Vc_INTRINSIC __m128d load(const schar *mem, Flags, LoadTag<__m128d, double>)
 {
-    return SSE::convert<char, double>(
+    return SSE::convert<schar, double>(
         _mm_set1_epi16(*reinterpret_cast<const MayAlias<short> *>(mem)));
 }
 
@@ -329,6 +329,18 @@ Vc_INTRINSIC __m128 load(const T *mem, Flags f, LoadTag<__m128, float>)
 {
     return _mm_cvtepi32_ps(load<__m128i, int>(mem, f));
 }
+template <typename Flags>
+Vc_INTRINSIC __m128 load(const float16 *mem, Flags, LoadTag<__m128, float>)
+{
+    return SSE::convert(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(mem)),
+                        SSE::ConvertTag<float16, float>());
+}
+template <typename Flags>
+Vc_INTRINSIC __m128 load(const bfloat16 *mem, Flags, LoadTag<__m128, float>)
+{
+    return SSE::convert(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(mem)),
+                        SSE::ConvertTag<bfloat16, float>());
+}
 
 // shifted{{{1
 template <int amount, typename T>
@@ -425,6 +437,11 @@ template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<2, 8, __m128>(__m128i k)
     return SSE::sse_cast<__m128>(
         _mm_packs_epi16(_mm_packs_epi16(k, _mm_setzero_si128()), _mm_setzero_si128()));
 }
+template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<2, 16, __m128>(__m128i k)
+{
+    const auto tmp = SSE::sse_cast<__m128i>(mask_cast<2, 8, __m128>(k));
+    return SSE::sse_cast<__m128>(_mm_packs_epi16(tmp, _mm_setzero_si128()));
+}
 
 template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<4, 2, __m128>(__m128i k)
 {
@@ -434,6 +451,11 @@ template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<4, 8, __m128>(__m128i k)
 {
     return SSE::sse_cast<__m128>(_mm_packs_epi16(k, _mm_setzero_si128()));
 }
+template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<4, 16, __m128>(__m128i k)
+{
+    return SSE::sse_cast<__m128>(
+        _mm_packs_epi16(_mm_packs_epi16(k, _mm_setzero_si128()), _mm_setzero_si128()));
+}
 
 template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<8, 2, __m128>(__m128i k)
 {
@@ -444,6 +466,10 @@ template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<8, 4, __m128>(__m128i k)
 {
     return SSE::sse_cast<__m128>(_mm_unpacklo_epi16(k, k));
 }
+template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<8, 16, __m128>(__m128i k)
+{
+    return SSE::sse_cast<__m128>(_mm_packs_epi16(k, _mm_setzero_si128()));
+}
 
 template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<16, 8, __m128>(__m128i k)
 {
@@ -497,6 +523,18 @@ Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::
     return _mm_sub_epi16(_mm_setzero_si128(), v);
 #endif
 }
+Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::size_t, 1>)
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_sign_epi8(v, allone<__m128i>());
+#else
+    return _mm_sub_epi8(_mm_setzero_si128(), v);
+#endif
+}
+Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::size_t, 8>)
+{
+    return _mm_sub_epi64(_mm_setzero_si128(), v);
+}
 
 // xor_{{{1
 Vc_INTRINSIC __m128 xor_(__m128 a, __m128 b) { return _mm_xor_ps(a, b); }
@@ -532,6 +570,8 @@ Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  short) { return _mm_add_epi16(a,
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b, ushort) { return _mm_add_epi16(a, b); }
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  schar) { return _mm_add_epi8 (a, b); }
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  uchar) { return _mm_add_epi8 (a, b); }
+Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  llong) { return _mm_add_epi64(a, b); }
+Vc_INTRINSIC __m128i add(__m128i a, __m128i b, ullong) { return _mm_add_epi64(a, b); }
 
 // sub{{{1
 Vc_INTRINSIC __m128  sub(__m128  a, __m128  b,  float) { return _mm_sub_ps(a, b); }
@@ -542,6 +582,8 @@ Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  short) { return _mm_sub_epi16(a,
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b, ushort) { return _mm_sub_epi16(a, b); }
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  schar) { return _mm_sub_epi8 (a, b); }
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  uchar) { return _mm_sub_epi8 (a, b); }
+Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  llong) { return _mm_sub_epi64(a, b); }
+Vc_INTRINSIC __m128i sub(__m128i a, __m128i b, ullong) { return _mm_sub_epi64(a, b); }
 
 // mul{{{1
 Vc_INTRINSIC __m128  mul(__m128  a, __m128  b,  float) { return _mm_mul_ps(a, b); }
@@ -567,9 +609,7 @@ Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  schar) {
                    reinterpret_cast<const MayAlias<B> &>(b);
     return reinterpret_cast<const __m128i &>(x);
 #else
-    return or_(
-        and_(_mm_mullo_epi16(a, b), _mm_slli_epi16(allone<__m128i>(), 8)),
-        _mm_slli_epi16(_mm_mullo_epi16(_mm_srli_si128(a, 1), _mm_srli_si128(b, 1)), 8));
+    return SSE::VectorHelper<schar>::mul(a, b);
 #endif
 }
 Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  uchar) {
@@ -579,11 +619,11 @@ Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  uchar) {
                    reinterpret_cast<const MayAlias<B> &>(b);
     return reinterpret_cast<const __m128i &>(x);
 #else
-    return or_(
-        and_(_mm_mullo_epi16(a, b), _mm_slli_epi16(allone<__m128i>(), 8)),
-        _mm_slli_epi16(_mm_mullo_epi16(_mm_srli_si128(a, 1), _mm_srli_si128(b, 1)), 8));
+    return SSE::VectorHelper<uchar>::mul(a, b);
 #endif
 }
+Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  llong) { return SSE::VectorHelper<llong>::mul(a, b); }
+Vc_INTRINSIC __m128i mul(__m128i a, __m128i b, ullong) { return SSE::VectorHelper<llong>::mul(a, b); }
 
 // div{{{1
 Vc_INTRINSIC __m128  div(__m128  a, __m128  b,  float) { return _mm_div_ps(a, b); }
@@ -608,6 +648,8 @@ Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  short) { return _mm_min_epi16(a,
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b, ushort) { return SSE::min_epu16(a, b); }
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  schar) { return SSE::min_epi8 (a, b); }
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  uchar) { return _mm_min_epu8 (a, b); }
+Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  llong) { return SSE::VectorHelper< llong>::min(a, b); }
+Vc_INTRINSIC __m128i min(__m128i a, __m128i b, ullong) { return SSE::VectorHelper<ullong>::min(a, b); }
 
 // max{{{1
 Vc_INTRINSIC __m128  max(__m128  a, __m128  b,  float) { return _mm_max_ps(a, b); }
@@ -618,6 +660,8 @@ Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  short) { return _mm_max_epi16(a,
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b, ushort) { return SSE::max_epu16(a, b); }
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  schar) { return SSE::max_epi8 (a, b); }
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  uchar) { return _mm_max_epu8 (a, b); }
+Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  llong) { return SSE::VectorHelper< llong>::max(a, b); }
+Vc_INTRINSIC __m128i max(__m128i a, __m128i b, ullong) { return SSE::VectorHelper<ullong>::max(a, b); }
 
 // horizontal add{{{1
 Vc_INTRINSIC  float add(__m128  a,  float) {
@@ -642,14 +686,10 @@ Vc_INTRINSIC  short add(__m128i a,  short) {
     return _mm_cvtsi128_si32(a);  // & 0xffff is implicit
 }
 Vc_INTRINSIC ushort add(__m128i a, ushort) { return add(a, short()); }
-Vc_INTRINSIC  schar add(__m128i a,  schar) {
-    a = add(a, _mm_srli_si128(a, 8), schar());
-    a = add(a, _mm_srli_si128(a, 4), schar());
-    a = add(a, _mm_srli_si128(a, 2), schar());
-    a = add(a, _mm_srli_si128(a, 1), schar());
-    return _mm_cvtsi128_si32(a);  // & 0xff is implicit
-}
-Vc_INTRINSIC  uchar add(__m128i a,  uchar) { return add(a, schar()); }
+Vc_INTRINSIC  schar add(__m128i a,  schar) { return SSE::VectorHelper<schar>::add(a); }
+Vc_INTRINSIC  uchar add(__m128i a,  uchar) { return SSE::VectorHelper<uchar>::add(a); }
+Vc_INTRINSIC  llong add(__m128i a,  llong) { return SSE::VectorHelper< llong>::add(a); }
+Vc_INTRINSIC ullong add(__m128i a, ullong) { return SSE::VectorHelper<ullong>::add(a); }
 
 // horizontal mul{{{1
 Vc_INTRINSIC  float mul(__m128  a,  float) {
@@ -674,13 +714,10 @@ Vc_INTRINSIC  short mul(__m128i a,  short) {
     return _mm_cvtsi128_si32(a);  // & 0xffff is implicit
 }
 Vc_INTRINSIC ushort mul(__m128i a, ushort) { return mul(a, short()); }
-Vc_INTRINSIC  schar mul(__m128i a,  schar) {
-    // convert to two short vectors, multiply them and then do horizontal reduction
-    const __m128i s0 = _mm_srai_epi16(a, 1);
-    const __m128i s1 = Detail::and_(a, _mm_set1_epi32(0x0f0f0f0f));
-    return mul(mul(s0, s1, short()), short());
-}
-Vc_INTRINSIC  uchar mul(__m128i a,  uchar) { return mul(a, schar()); }
+Vc_INTRINSIC  schar mul(__m128i a,  schar) { return SSE::VectorHelper<schar>::mul(a); }
+Vc_INTRINSIC  uchar mul(__m128i a,  uchar) { return SSE::VectorHelper<uchar>::mul(a); }
+Vc_INTRINSIC  llong mul(__m128i a,  llong) { return SSE::VectorHelper< llong>::mul(a); }
+Vc_INTRINSIC ullong mul(__m128i a, ullong) { return SSE::VectorHelper<ullong>::mul(a); }
 
 // horizontal min{{{1
 Vc_INTRINSIC  float min(__m128  a,  float) {
@@ -714,18 +751,10 @@ Vc_INTRINSIC ushort min(__m128i a, ushort) {
     a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), ushort());
     return _mm_cvtsi128_si32(a);  // & 0xffff is implicit
 }
-Vc_INTRINSIC  schar min(__m128i a,  schar) {
-    a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
-    return std::min(schar(_mm_cvtsi128_si32(a) >> 8), schar(_mm_cvtsi128_si32(a)));
-}
-Vc_INTRINSIC  uchar min(__m128i a,  uchar) {
-    a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
-    return std::min((_mm_cvtsi128_si32(a) >> 8) & 0xff, _mm_cvtsi128_si32(a) & 0xff);
-}
+Vc_INTRINSIC  schar min(__m128i a,  schar) { return SSE::VectorHelper<schar>::min(a); }
+Vc_INTRINSIC  uchar min(__m128i a,  uchar) { return SSE::VectorHelper<uchar>::min(a); }
+Vc_INTRINSIC  llong min(__m128i a,  llong) { return SSE::VectorHelper< llong>::min(a); }
+Vc_INTRINSIC ullong min(__m128i a, ullong) { return SSE::VectorHelper<ullong>::min(a); }
 
 // horizontal max{{{1
 Vc_INTRINSIC  float max(__m128  a,  float) {
@@ -759,18 +788,10 @@ Vc_INTRINSIC ushort max(__m128i a, ushort) {
     a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), ushort());
     return _mm_cvtsi128_si32(a);  // & 0xffff is implicit
 }
-Vc_INTRINSIC  schar max(__m128i a,  schar) {
-    a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
-    return std::max(schar(_mm_cvtsi128_si32(a) >> 8), schar(_mm_cvtsi128_si32(a)));
-}
-Vc_INTRINSIC  uchar max(__m128i a,  uchar) {
-    a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
-    return std::max((_mm_cvtsi128_si32(a) >> 8) & 0xff, _mm_cvtsi128_si32(a) & 0xff);
-}
+Vc_INTRINSIC  schar max(__m128i a,  schar) { return SSE::VectorHelper<schar>::max(a); }
+Vc_INTRINSIC  uchar max(__m128i a,  uchar) { return SSE::VectorHelper<uchar>::max(a); }
+Vc_INTRINSIC  llong max(__m128i a,  llong) { return SSE::VectorHelper< llong>::max(a); }
+Vc_INTRINSIC ullong max(__m128i a, ullong) { return SSE::VectorHelper<ullong>::max(a); }
 
 // sorted{{{1
 template <Vc::Implementation, typename T>
@@ -1493,6 +1514,140 @@ template<typename V> struct InterleaveImpl<V, 2, 16> {
     }/*}}}*/
 };
 
+// compress/expand{{{1
+/**\internal
+ * Returns the bytes of \p v shifted by \p n positions: byte i of the result is byte i + n
+ * of \p v, or zero if i + n is outside [0, 16). \p n must be in [-16, 16].
+ */
+Vc_INTRINSIC __m128i shifted_bytes(__m128i v, int n)
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_shuffle_epi8(v, _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                   &SSE::c_compress::byteShift[16 + n])));
+#else
+    alignas(16) unsigned char mem[48] = {};
+    _mm_store_si128(reinterpret_cast<__m128i *>(&mem[16]), v);
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(&mem[16 + n]));
+#endif
+}
+
+#ifdef Vc_IMPL_SSSE3
+/**\internal
+ * Turns the lane indices in the low \p N bytes of \p idx into a pshufb control for \p N
+ * lanes of 16 / \p N bytes. Lane index 0xff yields zeros.
+ */
+template <std::size_t N> Vc_INTRINSIC __m128i lane_shuffle(__m128i idx);
+template <> Vc_INTRINSIC __m128i lane_shuffle<16>(__m128i idx) { return idx; }
+template <> Vc_INTRINSIC __m128i lane_shuffle<8>(__m128i idx)
+{
+    idx = _mm_add_epi8(idx, idx);  // 0xff becomes 0xfe, which still zeroes
+    return _mm_add_epi8(_mm_unpacklo_epi8(idx, idx), _mm_set1_epi16(0x0100));
+}
+template <> Vc_INTRINSIC __m128i lane_shuffle<4>(__m128i idx)
+{
+    idx = _mm_add_epi8(idx, idx);
+    idx = _mm_add_epi8(idx, idx);
+    idx = _mm_unpacklo_epi8(idx, idx);
+    return _mm_add_epi8(_mm_unpacklo_epi16(idx, idx), _mm_set1_epi32(0x03020100));
+}
+template <> Vc_INTRINSIC __m128i lane_shuffle<2>(__m128i idx)
+{
+    idx = _mm_add_epi8(idx, idx);
+    idx = _mm_add_epi8(idx, idx);
+    idx = _mm_add_epi8(idx, idx);
+    idx = _mm_unpacklo_epi8(idx, idx);
+    idx = _mm_unpacklo_epi16(idx, idx);
+    return _mm_add_epi8(_mm_unpacklo_epi32(idx, idx),
+                        _mm_set1_epi64x(0x0706050403020100ll));
+}
+
+Vc_INTRINSIC __m128i compress_row(unsigned int bits)
+{
+    return _mm_loadl_epi64(reinterpret_cast<const __m128i *>(SSE::c_compress::compress[bits]));
+}
+Vc_INTRINSIC __m128i expand_row(unsigned int bits)
+{
+    return _mm_loadl_epi64(reinterpret_cast<const __m128i *>(SSE::c_compress::expand[bits]));
+}
+#endif  // Vc_IMPL_SSSE3
+
+/**\internal
+ * Moves the \p N lanes of \p v where \p bits is set to the front, preserving their
+ * order, and zeroes the remaining lanes.
+ */
+template <std::size_t N> Vc_INTRINSIC __m128i compress(__m128i v, unsigned int bits)
+{
+#if defined Vc_IMPL_AVX512VL
+    if (N == 4) {
+        return _mm_maskz_compress_epi32(bits, v);
+    } else if (N == 2) {
+        return _mm_maskz_compress_epi64(bits, v);
+    }
+#endif
+#ifdef Vc_IMPL_SSSE3
+    if (N == 16) {
+        // compress both halves separately, then concatenate them
+        const unsigned int lo = bits & 0xff;
+        const unsigned int hi = bits >> 8;
+        const __m128i a = _mm_shuffle_epi8(
+            v, _mm_or_si128(compress_row(lo), _mm_set_epi32(-1, -1, 0, 0)));
+        const __m128i b = _mm_shuffle_epi8(
+            v, _mm_or_si128(compress_row(hi), _mm_set_epi32(-1, -1, 0x08080808, 0x08080808)));
+        return _mm_or_si128(a, shifted_bytes(b, -int(popcnt8(lo))));
+    }
+    return _mm_shuffle_epi8(v, lane_shuffle<N>(compress_row(bits)));
+#else
+    constexpr std::size_t S = 16 / N;
+    alignas(16) unsigned char in[16];
+    alignas(16) unsigned char out[16] = {};
+    _mm_store_si128(reinterpret_cast<__m128i *>(in), v);
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        if ((bits >> i) & 1) {
+            std::memcpy(&out[S * n++], &in[S * i], S);
+        }
+    }
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(out));
+#endif
+}
+
+/**\internal
+ * The inverse of compress: distributes the leading lanes of \p v, in order, to the lanes
+ * where \p bits is set and zeroes the remaining lanes.
+ */
+template <std::size_t N> Vc_INTRINSIC __m128i expand(__m128i v, unsigned int bits)
+{
+#if defined Vc_IMPL_AVX512VL
+    if (N == 4) {
+        return _mm_maskz_expand_epi32(bits, v);
+    } else if (N == 2) {
+        return _mm_maskz_expand_epi64(bits, v);
+    }
+#endif
+#ifdef Vc_IMPL_SSSE3
+    if (N == 16) {
+        // the high half starts reading where the low half stopped (0xff saturates)
+        const unsigned int lo = bits & 0xff;
+        const __m128i hi = _mm_adds_epu8(expand_row(bits >> 8),
+                                         _mm_set1_epi8(static_cast<char>(popcnt8(lo))));
+        return _mm_shuffle_epi8(v, _mm_unpacklo_epi64(expand_row(lo), hi));
+    }
+    return _mm_shuffle_epi8(v, lane_shuffle<N>(expand_row(bits)));
+#else
+    constexpr std::size_t S = 16 / N;
+    alignas(16) unsigned char in[16];
+    alignas(16) unsigned char out[16] = {};
+    _mm_store_si128(reinterpret_cast<__m128i *>(in), v);
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        if ((bits >> i) & 1) {
+            std::memcpy(&out[S * i], &in[S * n++], S);
+        }
+    }
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(out));
+#endif
+}
+
 //}}}1
 }  // namespace Detail
 }  // namespace Vc
@@ -84,6 +84,8 @@ namespace SseIntrinsics
     static Vc_INTRINSIC __m128i Vc_CONST _mm_setone_epu16()  { return _mm_setone_epi16(); }
     static Vc_INTRINSIC __m128i Vc_CONST _mm_setone_epi32()  { return _mm_load_si128(reinterpret_cast<const __m128i *>(c_general::one32)); }
     static Vc_INTRINSIC __m128i Vc_CONST _mm_setone_epu32()  { return _mm_setone_epi32(); }
+    static Vc_INTRINSIC __m128i Vc_CONST _mm_setone_epi64()  { return _mm_set_epi32(0, 1, 0, 1); }
+    static Vc_INTRINSIC __m128i Vc_CONST _mm_setone_epu64()  { return _mm_setone_epi64(); }
 
     static Vc_INTRINSIC __m128  Vc_CONST _mm_setone_ps()     { return _mm_load_ps(c_general::oneFloat); }
     static Vc_INTRINSIC __m128d Vc_CONST _mm_setone_pd()     { return _mm_load_pd(c_general::oneDouble); }
@@ -98,6 +100,31 @@ namespace SseIntrinsics
     static Vc_INTRINSIC __m128i Vc_CONST setmin_epi32() { return _mm_load_si128(reinterpret_cast<const __m128i *>(c_general::signMaskFloat)); }
     static Vc_INTRINSIC __m128i Vc_CONST setmin_epi64() { return _mm_load_si128(reinterpret_cast<const __m128i *>(c_general::signMaskDouble)); }
 
+    Vc_INTRINSIC __m128i Vc_CONST cmpgt_epi64(__m128i a, __m128i b)
+    {
+#ifdef Vc_IMPL_SSE4_2
+        return _mm_cmpgt_epi64(a, b);
+#else
+        const auto aa = _mm_xor_si128(a, _mm_srli_epi64(setmin_epi32(),32));
+        const auto bb = _mm_xor_si128(b, _mm_srli_epi64(setmin_epi32(),32));
+        const auto gt = _mm_cmpgt_epi32(aa, bb);
+        const auto eq = _mm_cmpeq_epi32(aa, bb);
+        // Algorithm:
+        // 1. if the high 32 bits of gt are true, make the full 64 bits true
+        // 2. if the high 32 bits of gt are false and the high 32 bits of eq are true,
+        //    duplicate the low 32 bits of gt to the high 32 bits (note that this requires
+        //    unsigned compare on the lower 32 bits, which is the reason for the xors
+        //    above)
+        // 3. else make the full 64 bits false
+
+        const auto gt2 =
+            _mm_shuffle_epi32(gt, 0xf5);  // dup the high 32 bits to the low 32 bits
+        const auto lo =
+            _mm_shuffle_epi32(_mm_and_si128(_mm_srli_epi64(eq, 32), gt), 0xa0);
+        return _mm_or_si128(gt2, lo);
+#endif
+    }
+
 #if defined(Vc_IMPL_XOP)
     static Vc_INTRINSIC __m128i Vc_CONST cmplt_epu8(__m128i a, __m128i b) { return _mm_comlt_epu8(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu8(__m128i a, __m128i b) { return _mm_comgt_epu8(a, b); }
@@ -138,30 +165,6 @@ namespace SseIntrinsics
         return _mm_cmpgt_epi32(_mm_xor_si128(a, setmin_epi32()),
                                _mm_xor_si128(b, setmin_epi32()));
     }
-    Vc_INTRINSIC __m128i Vc_CONST cmpgt_epi64(__m128i a, __m128i b)
-    {
-#ifdef Vc_IMPL_SSE4_2
-        return _mm_cmpgt_epi64(a, b);
-#else
-        const auto aa = _mm_xor_si128(a, _mm_srli_epi64(setmin_epi32(),32));
-        const auto bb = _mm_xor_si128(b, _mm_srli_epi64(setmin_epi32(),32));
-        const auto gt = _mm_cmpgt_epi32(aa, bb);
-        const auto eq = _mm_cmpeq_epi32(aa, bb);
-        // Algorithm:
-        // 1. if the high 32 bits of gt are true, make the full 64 bits true
-        // 2. if the high 32 bits of gt are false and the high 32 bits of eq are true,
-        //    duplicate the low 32 bits of gt to the high 32 bits (note that this requires
-        //    unsigned compare on the lower 32 bits, which is the reason for the xors
-        //    above)
-        // 3. else make the full 64 bits false
-
-        const auto gt2 =
-            _mm_shuffle_epi32(gt, 0xf5);  // dup the high 32 bits to the low 32 bits
-        const auto lo =
-            _mm_shuffle_epi32(_mm_and_si128(_mm_srli_epi64(eq, 32), gt), 0xa0);
-        return _mm_or_si128(gt2, lo);
-#endif
-    }
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu64(__m128i a, __m128i b)
     {
         return cmpgt_epi64(_mm_xor_si128(a, setmin_epi64()),
@@ -282,6 +285,11 @@ Vc_INTRINSIC Vc_CONST __m128 blendv_ps(__m128 a, __m128 b, __m128 c)
 }
 Vc_INTRINSIC Vc_CONST __m128i blendv_epi8(__m128i a, __m128i b, __m128i c)
 {
+#if defined Vc_GCC && defined __AVX512VL__
+    // With AVX-512VL enabled GCC (at least 12.2) folds an inverted mask (e.g. from
+    // operator>=, which is !(a < b)) into vpblendvb and then drops the inversion.
+    asm("" : "+x"(c));
+#endif
     return _mm_blendv_epi8(a, b, c);
 }
 template <int mask> Vc_INTRINSIC Vc_CONST __m128d blend_pd(__m128d a, __m128d b)
@@ -695,11 +703,22 @@ namespace SseIntrinsics
     static Vc_INTRINSIC Vc_PURE __m128i _mm_stream_load(const unsigned char *mem) {
         return _mm_stream_load(reinterpret_cast<const int *>(mem));
     }
+    static Vc_INTRINSIC Vc_PURE __m128i _mm_stream_load(const long long *mem) {
+        return _mm_stream_load(reinterpret_cast<const int *>(mem));
+    }
+    static Vc_INTRINSIC Vc_PURE __m128i _mm_stream_load(const unsigned long long *mem) {
+        return _mm_stream_load(reinterpret_cast<const int *>(mem));
+    }
 
 #ifndef __x86_64__
     Vc_INTRINSIC Vc_PURE __m128i _mm_cvtsi64_si128(int64_t x) {
         return _mm_castpd_si128(_mm_load_sd(reinterpret_cast<const double *>(&x)));
     }
+    Vc_INTRINSIC Vc_PURE int64_t _mm_cvtsi128_si64(__m128i x) {
+        int64_t r;
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(&r), x);
+        return r;
+    }
 #endif
 
 }  // namespace SseIntrinsics
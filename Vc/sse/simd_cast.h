@@ -73,31 +73,91 @@ Vc_SIMD_CAST_1(double_v,    int_v);
 Vc_SIMD_CAST_1(  uint_v,    int_v);
 Vc_SIMD_CAST_1( short_v,    int_v);
 Vc_SIMD_CAST_1(ushort_v,    int_v);
+Vc_SIMD_CAST_1( schar_v,    int_v);
+Vc_SIMD_CAST_1( uchar_v,    int_v);
+Vc_SIMD_CAST_1( llong_v,    int_v);
+Vc_SIMD_CAST_1(ullong_v,    int_v);
 Vc_SIMD_CAST_1( float_v,   uint_v);
 Vc_SIMD_CAST_1(double_v,   uint_v);
 Vc_SIMD_CAST_1(   int_v,   uint_v);
 Vc_SIMD_CAST_1( short_v,   uint_v);
 Vc_SIMD_CAST_1(ushort_v,   uint_v);
+Vc_SIMD_CAST_1( schar_v,   uint_v);
+Vc_SIMD_CAST_1( uchar_v,   uint_v);
+Vc_SIMD_CAST_1( llong_v,   uint_v);
+Vc_SIMD_CAST_1(ullong_v,   uint_v);
 Vc_SIMD_CAST_1(double_v,  float_v);
 Vc_SIMD_CAST_1(   int_v,  float_v);
 Vc_SIMD_CAST_1(  uint_v,  float_v);
 Vc_SIMD_CAST_1( short_v,  float_v);
 Vc_SIMD_CAST_1(ushort_v,  float_v);
+Vc_SIMD_CAST_1( schar_v,  float_v);
+Vc_SIMD_CAST_1( uchar_v,  float_v);
+Vc_SIMD_CAST_1( llong_v,  float_v);
+Vc_SIMD_CAST_1(ullong_v,  float_v);
 Vc_SIMD_CAST_1( float_v, double_v);
 Vc_SIMD_CAST_1(   int_v, double_v);
 Vc_SIMD_CAST_1(  uint_v, double_v);
 Vc_SIMD_CAST_1( short_v, double_v);
 Vc_SIMD_CAST_1(ushort_v, double_v);
+Vc_SIMD_CAST_1( schar_v, double_v);
+Vc_SIMD_CAST_1( uchar_v, double_v);
+Vc_SIMD_CAST_1( llong_v, double_v);
+Vc_SIMD_CAST_1(ullong_v, double_v);
 Vc_SIMD_CAST_1(   int_v,  short_v);
 Vc_SIMD_CAST_1(  uint_v,  short_v);
 Vc_SIMD_CAST_1( float_v,  short_v);
 Vc_SIMD_CAST_1(double_v,  short_v);
 Vc_SIMD_CAST_1(ushort_v,  short_v);
+Vc_SIMD_CAST_1( schar_v,  short_v);
+Vc_SIMD_CAST_1( uchar_v,  short_v);
+Vc_SIMD_CAST_1( llong_v,  short_v);
+Vc_SIMD_CAST_1(ullong_v,  short_v);
 Vc_SIMD_CAST_1(   int_v, ushort_v);
 Vc_SIMD_CAST_1(  uint_v, ushort_v);
 Vc_SIMD_CAST_1( float_v, ushort_v);
 Vc_SIMD_CAST_1(double_v, ushort_v);
 Vc_SIMD_CAST_1( short_v, ushort_v);
+Vc_SIMD_CAST_1( schar_v, ushort_v);
+Vc_SIMD_CAST_1( uchar_v, ushort_v);
+Vc_SIMD_CAST_1( llong_v, ushort_v);
+Vc_SIMD_CAST_1(ullong_v, ushort_v);
+Vc_SIMD_CAST_1(double_v,  schar_v);
+Vc_SIMD_CAST_1( float_v,  schar_v);
+Vc_SIMD_CAST_1(   int_v,  schar_v);
+Vc_SIMD_CAST_1(  uint_v,  schar_v);
+Vc_SIMD_CAST_1( short_v,  schar_v);
+Vc_SIMD_CAST_1(ushort_v,  schar_v);
+Vc_SIMD_CAST_1( uchar_v,  schar_v);
+Vc_SIMD_CAST_1( llong_v,  schar_v);
+Vc_SIMD_CAST_1(ullong_v,  schar_v);
+Vc_SIMD_CAST_1(double_v,  uchar_v);
+Vc_SIMD_CAST_1( float_v,  uchar_v);
+Vc_SIMD_CAST_1(   int_v,  uchar_v);
+Vc_SIMD_CAST_1(  uint_v,  uchar_v);
+Vc_SIMD_CAST_1( short_v,  uchar_v);
+Vc_SIMD_CAST_1(ushort_v,  uchar_v);
+Vc_SIMD_CAST_1( schar_v,  uchar_v);
+Vc_SIMD_CAST_1( llong_v,  uchar_v);
+Vc_SIMD_CAST_1(ullong_v,  uchar_v);
+Vc_SIMD_CAST_1(double_v,  llong_v);
+Vc_SIMD_CAST_1( float_v,  llong_v);
+Vc_SIMD_CAST_1(   int_v,  llong_v);
+Vc_SIMD_CAST_1(  uint_v,  llong_v);
+Vc_SIMD_CAST_1( short_v,  llong_v);
+Vc_SIMD_CAST_1(ushort_v,  llong_v);
+Vc_SIMD_CAST_1( schar_v,  llong_v);
+Vc_SIMD_CAST_1( uchar_v,  llong_v);
+Vc_SIMD_CAST_1(ullong_v,  llong_v);
+Vc_SIMD_CAST_1(double_v, ullong_v);
+Vc_SIMD_CAST_1( float_v, ullong_v);
+Vc_SIMD_CAST_1(   int_v, ullong_v);
+Vc_SIMD_CAST_1(  uint_v, ullong_v);
+Vc_SIMD_CAST_1( short_v, ullong_v);
+Vc_SIMD_CAST_1(ushort_v, ullong_v);
+Vc_SIMD_CAST_1( schar_v, ullong_v);
+Vc_SIMD_CAST_1( uchar_v, ullong_v);
+Vc_SIMD_CAST_1( llong_v, ullong_v);
 
 // 2 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_2(double_v,    int_v);
@@ -111,6 +171,22 @@ Vc_SIMD_CAST_2(   int_v, ushort_v);
 Vc_SIMD_CAST_2(  uint_v, ushort_v);
 Vc_SIMD_CAST_2( float_v, ushort_v);
 Vc_SIMD_CAST_2(double_v, ushort_v);
+Vc_SIMD_CAST_2( short_v,  schar_v);
+Vc_SIMD_CAST_2(ushort_v,  schar_v);
+Vc_SIMD_CAST_2( short_v,  uchar_v);
+Vc_SIMD_CAST_2(ushort_v,  uchar_v);
+Vc_SIMD_CAST_2( llong_v,    int_v);
+Vc_SIMD_CAST_2(ullong_v,    int_v);
+Vc_SIMD_CAST_2( llong_v,   uint_v);
+Vc_SIMD_CAST_2(ullong_v,   uint_v);
+Vc_SIMD_CAST_2(double_v,  schar_v);
+Vc_SIMD_CAST_2(double_v,  uchar_v);
+Vc_SIMD_CAST_2( float_v,  schar_v);
+Vc_SIMD_CAST_2( float_v,  uchar_v);
+Vc_SIMD_CAST_2(   int_v,  schar_v);
+Vc_SIMD_CAST_2(   int_v,  uchar_v);
+Vc_SIMD_CAST_2(  uint_v,  schar_v);
+Vc_SIMD_CAST_2(  uint_v,  uchar_v);
 
 // 3 SSE::Vector to 1 SSE::Vector {{{2
 #define Vc_CAST_(To_)                                                                    \
@@ -122,6 +198,18 @@ Vc_CAST_(ushort_v) simd_cast(double_v a, double_v b, double_v c);
 // 4 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_4(double_v,  short_v);
 Vc_SIMD_CAST_4(double_v, ushort_v);
+Vc_SIMD_CAST_4(   int_v,  schar_v);
+Vc_SIMD_CAST_4(  uint_v,  schar_v);
+Vc_SIMD_CAST_4(   int_v,  uchar_v);
+Vc_SIMD_CAST_4(  uint_v,  uchar_v);
+Vc_SIMD_CAST_4( float_v,  schar_v);
+Vc_SIMD_CAST_4( float_v,  uchar_v);
+Vc_SIMD_CAST_4(double_v,  schar_v);
+Vc_SIMD_CAST_4(double_v,  uchar_v);
+
+// 8 SSE::Vector to 1 SSE::Vector {{{2
+Vc_SIMD_CAST_8(double_v,  schar_v);
+Vc_SIMD_CAST_8(double_v,  uchar_v);
 //}}}2
 }  // namespace SSE
 using SSE::simd_cast;
@@ -151,6 +239,22 @@ template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x,
           enable_if<std::is_same<Return, SSE::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<std::is_same<Return, SSE::schar_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<std::is_same<Return, SSE::uchar_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<std::is_same<Return, SSE::llong_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<std::is_same<Return, SSE::ullong_v>::value> = nullarg);
 
 // 2 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -177,6 +281,22 @@ template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
           enable_if<std::is_same<Return, SSE::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<std::is_same<Return, SSE::schar_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<std::is_same<Return, SSE::uchar_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<std::is_same<Return, SSE::llong_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<std::is_same<Return, SSE::ullong_v>::value> = nullarg);
 
 // 3 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -226,6 +346,16 @@ Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
           Scalar::Vector<T> x3,
           enable_if<std::is_same<Return, SSE::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          Scalar::Vector<T> x3,
+          enable_if<std::is_same<Return, SSE::schar_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          Scalar::Vector<T> x3,
+          enable_if<std::is_same<Return, SSE::uchar_v>::value> = nullarg);
 
 // 5 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -329,24 +459,40 @@ Vc_SIMD_CAST_1(double_v,    int_v) { return convert<double, int>(x.data()); }
 Vc_SIMD_CAST_1(  uint_v,    int_v) { return convert<  uint, int>(x.data()); }
 Vc_SIMD_CAST_1( short_v,    int_v) { return convert< short, int>(x.data()); }
 Vc_SIMD_CAST_1(ushort_v,    int_v) { return convert<ushort, int>(x.data()); }
+Vc_SIMD_CAST_1( schar_v,    int_v) { return convert< schar, int>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,    int_v) { return convert< uchar, int>(x.data()); }
+Vc_SIMD_CAST_1( llong_v,    int_v) { return convert< llong, int>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v,    int_v) { return convert<ullong, int>(x.data()); }
 // to uint_v {{{3
 Vc_SIMD_CAST_1( float_v,   uint_v) { return convert< float, uint>(x.data()); }
 Vc_SIMD_CAST_1(double_v,   uint_v) { return convert<double, uint>(x.data()); }
 Vc_SIMD_CAST_1(   int_v,   uint_v) { return convert<   int, uint>(x.data()); }
 Vc_SIMD_CAST_1( short_v,   uint_v) { return convert< short, uint>(x.data()); }
 Vc_SIMD_CAST_1(ushort_v,   uint_v) { return convert<ushort, uint>(x.data()); }
+Vc_SIMD_CAST_1( schar_v,   uint_v) { return convert< schar, uint>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,   uint_v) { return convert< uchar, uint>(x.data()); }
+Vc_SIMD_CAST_1( llong_v,   uint_v) { return convert< llong, uint>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v,   uint_v) { return convert<ullong, uint>(x.data()); }
 // to float_v {{{3
 Vc_SIMD_CAST_1(double_v,  float_v) { return convert<double, float>(x.data()); }
 Vc_SIMD_CAST_1(   int_v,  float_v) { return convert<   int, float>(x.data()); }
 Vc_SIMD_CAST_1(  uint_v,  float_v) { return convert<  uint, float>(x.data()); }
 Vc_SIMD_CAST_1( short_v,  float_v) { return convert< short, float>(x.data()); }
 Vc_SIMD_CAST_1(ushort_v,  float_v) { return convert<ushort, float>(x.data()); }
+Vc_SIMD_CAST_1( schar_v,  float_v) { return convert< schar, float>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,  float_v) { return convert< uchar, float>(x.data()); }
+Vc_SIMD_CAST_1( llong_v,  float_v) { return convert< llong, float>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v,  float_v) { return convert<ullong, float>(x.data()); }
 // to double_v {{{3
 Vc_SIMD_CAST_1( float_v, double_v) { return convert< float, double>(x.data()); }
 Vc_SIMD_CAST_1(   int_v, double_v) { return convert<   int, double>(x.data()); }
 Vc_SIMD_CAST_1(  uint_v, double_v) { return convert<  uint, double>(x.data()); }
 Vc_SIMD_CAST_1( short_v, double_v) { return convert< short, double>(x.data()); }
 Vc_SIMD_CAST_1(ushort_v, double_v) { return convert<ushort, double>(x.data()); }
+Vc_SIMD_CAST_1( schar_v, double_v) { return convert< schar, double>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v, double_v) { return convert< uchar, double>(x.data()); }
+Vc_SIMD_CAST_1( llong_v, double_v) { return convert< llong, double>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v, double_v) { return convert<ullong, double>(x.data()); }
 // to short_v {{{3
 /*
  * §4.7 p3 (integral conversions)
@@ -366,12 +512,60 @@ Vc_SIMD_CAST_1(  uint_v,  short_v) { return SSE::convert_int32_to_int16(x.data()
 Vc_SIMD_CAST_1( float_v,  short_v) { return _mm_packs_epi32(simd_cast<SSE::int_v>(x).data(), _mm_setzero_si128()); }
 Vc_SIMD_CAST_1(double_v,  short_v) { return _mm_packs_epi32(simd_cast<SSE::int_v>(x).data(), _mm_setzero_si128()); }
 Vc_SIMD_CAST_1(ushort_v,  short_v) { return x.data(); }
+Vc_SIMD_CAST_1( schar_v,  short_v) { return convert< schar, short>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,  short_v) { return convert< uchar, short>(x.data()); }
+Vc_SIMD_CAST_1( llong_v,  short_v) { return convert< llong, short>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v,  short_v) { return convert<ullong, short>(x.data()); }
 // to ushort_v {{{3
 Vc_SIMD_CAST_1(   int_v, ushort_v) { return SSE::convert_int32_to_int16(x.data(), _mm_setzero_si128()); }
 Vc_SIMD_CAST_1(  uint_v, ushort_v) { return SSE::convert_int32_to_int16(x.data(), _mm_setzero_si128()); }
 Vc_SIMD_CAST_1( float_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x)); }
 Vc_SIMD_CAST_1(double_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x)); }
 Vc_SIMD_CAST_1( short_v, ushort_v) { return x.data(); }
+Vc_SIMD_CAST_1( schar_v, ushort_v) { return convert< schar, ushort>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v, ushort_v) { return convert< uchar, ushort>(x.data()); }
+Vc_SIMD_CAST_1( llong_v, ushort_v) { return convert< llong, ushort>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v, ushort_v) { return convert<ullong, ushort>(x.data()); }
+// to schar_v {{{3
+Vc_SIMD_CAST_1(double_v,  schar_v) { return convert<double, schar>(x.data()); }
+Vc_SIMD_CAST_1( float_v,  schar_v) { return convert< float, schar>(x.data()); }
+Vc_SIMD_CAST_1(   int_v,  schar_v) { return convert<   int, schar>(x.data()); }
+Vc_SIMD_CAST_1(  uint_v,  schar_v) { return convert<  uint, schar>(x.data()); }
+Vc_SIMD_CAST_1( short_v,  schar_v) { return convert< short, schar>(x.data()); }
+Vc_SIMD_CAST_1(ushort_v,  schar_v) { return convert<ushort, schar>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,  schar_v) { return convert< uchar, schar>(x.data()); }
+Vc_SIMD_CAST_1( llong_v,  schar_v) { return convert< llong, schar>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v,  schar_v) { return convert<ullong, schar>(x.data()); }
+// to uchar_v {{{3
+Vc_SIMD_CAST_1(double_v,  uchar_v) { return convert<double, uchar>(x.data()); }
+Vc_SIMD_CAST_1( float_v,  uchar_v) { return convert< float, uchar>(x.data()); }
+Vc_SIMD_CAST_1(   int_v,  uchar_v) { return convert<   int, uchar>(x.data()); }
+Vc_SIMD_CAST_1(  uint_v,  uchar_v) { return convert<  uint, uchar>(x.data()); }
+Vc_SIMD_CAST_1( short_v,  uchar_v) { return convert< short, uchar>(x.data()); }
+Vc_SIMD_CAST_1(ushort_v,  uchar_v) { return convert<ushort, uchar>(x.data()); }
+Vc_SIMD_CAST_1( schar_v,  uchar_v) { return convert< schar, uchar>(x.data()); }
+Vc_SIMD_CAST_1( llong_v,  uchar_v) { return convert< llong, uchar>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v,  uchar_v) { return convert<ullong, uchar>(x.data()); }
+// to llong_v {{{3
+Vc_SIMD_CAST_1(double_v,  llong_v) { return convert<double, llong>(x.data()); }
+Vc_SIMD_CAST_1( float_v,  llong_v) { return convert< float, llong>(x.data()); }
+Vc_SIMD_CAST_1(   int_v,  llong_v) { return convert<   int, llong>(x.data()); }
+Vc_SIMD_CAST_1(  uint_v,  llong_v) { return convert<  uint, llong>(x.data()); }
+Vc_SIMD_CAST_1( short_v,  llong_v) { return convert< short, llong>(x.data()); }
+Vc_SIMD_CAST_1(ushort_v,  llong_v) { return convert<ushort, llong>(x.data()); }
+Vc_SIMD_CAST_1( schar_v,  llong_v) { return convert< schar, llong>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,  llong_v) { return convert< uchar, llong>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v,  llong_v) { return convert<ullong, llong>(x.data()); }
+// to ullong_v {{{3
+Vc_SIMD_CAST_1(double_v, ullong_v) { return convert<double, ullong>(x.data()); }
+Vc_SIMD_CAST_1( float_v, ullong_v) { return convert< float, ullong>(x.data()); }
+Vc_SIMD_CAST_1(   int_v, ullong_v) { return convert<   int, ullong>(x.data()); }
+Vc_SIMD_CAST_1(  uint_v, ullong_v) { return convert<  uint, ullong>(x.data()); }
+Vc_SIMD_CAST_1( short_v, ullong_v) { return convert< short, ullong>(x.data()); }
+Vc_SIMD_CAST_1(ushort_v, ullong_v) { return convert<ushort, ullong>(x.data()); }
+Vc_SIMD_CAST_1( schar_v, ullong_v) { return convert< schar, ullong>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v, ullong_v) { return convert< uchar, ullong>(x.data()); }
+Vc_SIMD_CAST_1( llong_v, ullong_v) { return convert< llong, ullong>(x.data()); }
 // 2 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_2(double_v,    int_v) {
 #ifdef Vc_IMPL_AVX
@@ -404,6 +598,22 @@ Vc_SIMD_CAST_2(   int_v, ushort_v) { return SSE::convert_int32_to_int16(x0.data(
 Vc_SIMD_CAST_2(  uint_v, ushort_v) { return SSE::convert_int32_to_int16(x0.data(), x1.data()); }
 Vc_SIMD_CAST_2( float_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x0), simd_cast<SSE::int_v>(x1)); }
 Vc_SIMD_CAST_2(double_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x0, x1)); }
+Vc_SIMD_CAST_2( short_v,  schar_v) { return _mm_packus_epi16(_mm_and_si128(x0.data(), _mm_set1_epi16(0xff)), _mm_and_si128(x1.data(), _mm_set1_epi16(0xff))); }
+Vc_SIMD_CAST_2(ushort_v,  schar_v) { return _mm_packus_epi16(_mm_and_si128(x0.data(), _mm_set1_epi16(0xff)), _mm_and_si128(x1.data(), _mm_set1_epi16(0xff))); }
+Vc_SIMD_CAST_2( short_v,  uchar_v) { return _mm_packus_epi16(_mm_and_si128(x0.data(), _mm_set1_epi16(0xff)), _mm_and_si128(x1.data(), _mm_set1_epi16(0xff))); }
+Vc_SIMD_CAST_2(ushort_v,  uchar_v) { return _mm_packus_epi16(_mm_and_si128(x0.data(), _mm_set1_epi16(0xff)), _mm_and_si128(x1.data(), _mm_set1_epi16(0xff))); }
+Vc_SIMD_CAST_2( llong_v,    int_v) { return _mm_unpacklo_epi64(convert<llong, int>(x0.data()), convert<llong, int>(x1.data())); }
+Vc_SIMD_CAST_2(ullong_v,    int_v) { return _mm_unpacklo_epi64(convert<llong, int>(x0.data()), convert<llong, int>(x1.data())); }
+Vc_SIMD_CAST_2( llong_v,   uint_v) { return _mm_unpacklo_epi64(convert<llong, int>(x0.data()), convert<llong, int>(x1.data())); }
+Vc_SIMD_CAST_2(ullong_v,   uint_v) { return _mm_unpacklo_epi64(convert<llong, int>(x0.data()), convert<llong, int>(x1.data())); }
+Vc_SIMD_CAST_2(double_v,  schar_v) { return simd_cast<SSE::schar_v>(simd_cast<SSE::int_v>(x0, x1)); }
+Vc_SIMD_CAST_2(double_v,  uchar_v) { return simd_cast<SSE::uchar_v>(simd_cast<SSE::int_v>(x0, x1)); }
+Vc_SIMD_CAST_2( float_v,  schar_v) { return simd_cast<SSE::schar_v>(simd_cast<SSE::int_v>(x0), simd_cast<SSE::int_v>(x1)); }
+Vc_SIMD_CAST_2( float_v,  uchar_v) { return simd_cast<SSE::uchar_v>(simd_cast<SSE::int_v>(x0), simd_cast<SSE::int_v>(x1)); }
+Vc_SIMD_CAST_2(   int_v,  schar_v) { return simd_cast<SSE::schar_v>(x0, x1, SSE::int_v::Zero(), SSE::int_v::Zero()); }
+Vc_SIMD_CAST_2(   int_v,  uchar_v) { return simd_cast<SSE::uchar_v>(x0, x1, SSE::int_v::Zero(), SSE::int_v::Zero()); }
+Vc_SIMD_CAST_2(  uint_v,  schar_v) { return simd_cast<SSE::schar_v>(x0, x1, SSE::uint_v::Zero(), SSE::uint_v::Zero()); }
+Vc_SIMD_CAST_2(  uint_v,  uchar_v) { return simd_cast<SSE::uchar_v>(x0, x1, SSE::uint_v::Zero(), SSE::uint_v::Zero()); }
 
 // 3 SSE::Vector to 1 SSE::Vector {{{2
 Vc_CAST_(short_v) simd_cast(double_v a, double_v b, double_v c)
@@ -419,6 +629,24 @@ Vc_CAST_(ushort_v) simd_cast(double_v a, double_v b, double_v c)
 // 4 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_4(double_v,  short_v) { return _mm_packs_epi32(simd_cast<SSE::int_v>(x0, x1).data(), simd_cast<SSE::int_v>(x2, x3).data()); }
 Vc_SIMD_CAST_4(double_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2, x3)); }
+Vc_SIMD_CAST_4(   int_v,  schar_v)
+{
+    const auto m = _mm_set1_epi32(0xff);
+    return _mm_packus_epi16(
+        _mm_packs_epi32(_mm_and_si128(x0.data(), m), _mm_and_si128(x1.data(), m)),
+        _mm_packs_epi32(_mm_and_si128(x2.data(), m), _mm_and_si128(x3.data(), m)));
+}
+Vc_SIMD_CAST_4(  uint_v,  schar_v) { return simd_cast<SSE::schar_v>(SSE::int_v(x0.data()), SSE::int_v(x1.data()), SSE::int_v(x2.data()), SSE::int_v(x3.data())); }
+Vc_SIMD_CAST_4(   int_v,  uchar_v) { return simd_cast<SSE::schar_v>(x0, x1, x2, x3).data(); }
+Vc_SIMD_CAST_4(  uint_v,  uchar_v) { return simd_cast<SSE::schar_v>(SSE::int_v(x0.data()), SSE::int_v(x1.data()), SSE::int_v(x2.data()), SSE::int_v(x3.data())).data(); }
+Vc_SIMD_CAST_4( float_v,  schar_v) { return simd_cast<SSE::schar_v>(simd_cast<SSE::int_v>(x0), simd_cast<SSE::int_v>(x1), simd_cast<SSE::int_v>(x2), simd_cast<SSE::int_v>(x3)); }
+Vc_SIMD_CAST_4( float_v,  uchar_v) { return simd_cast<SSE::uchar_v>(simd_cast<SSE::int_v>(x0), simd_cast<SSE::int_v>(x1), simd_cast<SSE::int_v>(x2), simd_cast<SSE::int_v>(x3)); }
+Vc_SIMD_CAST_4(double_v,  schar_v) { return simd_cast<SSE::schar_v>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2, x3)); }
+Vc_SIMD_CAST_4(double_v,  uchar_v) { return simd_cast<SSE::uchar_v>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2, x3)); }
+
+// 8 SSE::Vector to 1 SSE::Vector {{{2
+Vc_SIMD_CAST_8(double_v,  schar_v) { return simd_cast<SSE::schar_v>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2, x3), simd_cast<SSE::int_v>(x4, x5), simd_cast<SSE::int_v>(x6, x7)); }
+Vc_SIMD_CAST_8(double_v,  uchar_v) { return simd_cast<SSE::uchar_v>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2, x3), simd_cast<SSE::int_v>(x4, x5), simd_cast<SSE::int_v>(x6, x7)); }
 }  // namespace SSE
 
 // 1 Scalar::Vector to 1 SSE::Vector {{{2
@@ -466,6 +694,34 @@ Vc_INTRINSIC Vc_CONST Return
     return _mm_setr_epi16(
         x.data(), 0, 0, 0, 0, 0, 0, 0);  // FIXME: use register-register mov
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x,
+              enable_if<std::is_same<Return, SSE::schar_v>::value> )
+{
+    return _mm_cvtsi32_si128(uchar(schar(x.data())));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x,
+              enable_if<std::is_same<Return, SSE::uchar_v>::value> )
+{
+    return _mm_cvtsi32_si128(uchar(x.data()));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x,
+              enable_if<std::is_same<Return, SSE::llong_v>::value> )
+{
+    return _mm_set_epi64x(0, llong(x.data()));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x,
+              enable_if<std::is_same<Return, SSE::ullong_v>::value> )
+{
+    return _mm_set_epi64x(0, ullong(x.data()));
+}
 
 // 2 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -519,6 +775,38 @@ Vc_INTRINSIC Vc_CONST Return
     return _mm_setr_epi16(
         x0.data(), x1.data(), 0, 0, 0, 0, 0, 0);  // FIXME: use register-register mov
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x0,
+              Scalar::Vector<T> x1,
+              enable_if<std::is_same<Return, SSE::schar_v>::value> )
+{
+    return _mm_cvtsi32_si128(uchar(schar(x0.data())) | uchar(schar(x1.data())) << 8);
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x0,
+              Scalar::Vector<T> x1,
+              enable_if<std::is_same<Return, SSE::uchar_v>::value> )
+{
+    return _mm_cvtsi32_si128(uchar(x0.data()) | uchar(x1.data()) << 8);
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x0,
+              Scalar::Vector<T> x1,
+              enable_if<std::is_same<Return, SSE::llong_v>::value> )
+{
+    return _mm_set_epi64x(llong(x1.data()), llong(x0.data()));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x0,
+              Scalar::Vector<T> x1,
+              enable_if<std::is_same<Return, SSE::ullong_v>::value> )
+{
+    return _mm_set_epi64x(ullong(x1.data()), ullong(x0.data()));
+}
 
 // 3 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -614,6 +902,29 @@ Vc_INTRINSIC Vc_CONST Return
     return _mm_setr_epi16(
         x0.data(), x1.data(), x2.data(), x3.data(), 0, 0, 0, 0);  // FIXME: use register-register mov
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x0,
+              Scalar::Vector<T> x1,
+              Scalar::Vector<T> x2,
+              Scalar::Vector<T> x3,
+              enable_if<std::is_same<Return, SSE::schar_v>::value> )
+{
+    return _mm_cvtsi32_si128(uchar(schar(x0.data())) | uchar(schar(x1.data())) << 8 |
+                             uchar(schar(x2.data())) << 16 |
+                             uint(uchar(schar(x3.data()))) << 24);
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x0,
+              Scalar::Vector<T> x1,
+              Scalar::Vector<T> x2,
+              Scalar::Vector<T> x3,
+              enable_if<std::is_same<Return, SSE::uchar_v>::value> )
+{
+    return _mm_cvtsi32_si128(uchar(x0.data()) | uchar(x1.data()) << 8 |
+                             uchar(x2.data()) << 16 | uint(uchar(x3.data())) << 24);
+}
 
 // 5 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -752,6 +1063,14 @@ Vc_INTRINSIC Vc_CONST Return simd_cast(
     return SSE::sse_cast<__m128>(
         _mm_packs_epi16(_mm_packs_epi16(x0.dataI(), x1.dataI()), _mm_setzero_si128()));
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return simd_cast(
+    SSE::Mask<T> x0,
+    SSE::Mask<T> x1,
+    enable_if<SSE::is_mask<Return>::value && Mask<T, VectorAbi::Sse>::Size * 8 == Return::Size> = nullarg)
+{
+    return simd_cast<Return>(simd_cast<SSE::short_m>(x0, x1));
+}
 // 4 SSE Masks to 1 SSE Mask {{{2
 template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return simd_cast(
@@ -764,6 +1083,32 @@ Vc_INTRINSIC Vc_CONST Return simd_cast(
     return SSE::sse_cast<__m128>(_mm_packs_epi16(_mm_packs_epi16(x0.dataI(), x1.dataI()),
                                                  _mm_packs_epi16(x2.dataI(), x3.dataI())));
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return simd_cast(
+    SSE::Mask<T> x0,
+    SSE::Mask<T> x1,
+    SSE::Mask<T> x2,
+    SSE::Mask<T> x3,
+    enable_if<SSE::is_mask<Return>::value && Mask<T, VectorAbi::Sse>::Size * 8 == Return::Size> = nullarg)
+{
+    return simd_cast<Return>(simd_cast<SSE::short_m>(x0, x1, x2, x3));
+}
+// 8 SSE Masks to 1 SSE Mask {{{2
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return simd_cast(
+    SSE::Mask<T> x0,
+    SSE::Mask<T> x1,
+    SSE::Mask<T> x2,
+    SSE::Mask<T> x3,
+    SSE::Mask<T> x4,
+    SSE::Mask<T> x5,
+    SSE::Mask<T> x6,
+    SSE::Mask<T> x7,
+    enable_if<SSE::is_mask<Return>::value && Mask<T, VectorAbi::Sse>::Size * 8 == Return::Size> = nullarg)
+{
+    return simd_cast<Return>(simd_cast<SSE::short_m>(x0, x1, x2, x3),
+                             simd_cast<SSE::short_m>(x4, x5, x6, x7));
+}
 
 // 1 Scalar Mask to 1 SSE Mask {{{2
 template <typename Return, typename T>
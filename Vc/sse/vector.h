@@ -264,6 +264,9 @@ template <typename T> class Vector<T, VectorAbi::Sse>
         Vc_INTRINSIC_L Vc_PURE_L Vector reversed() const Vc_INTRINSIC_R Vc_PURE_R;
         Vc_ALWAYS_INLINE_L Vc_PURE_L Vector sorted() const Vc_ALWAYS_INLINE_R Vc_PURE_R;
 
+        Vc_INTRINSIC_L Vector compress(MaskArg k) const Vc_INTRINSIC_R;
+        Vc_INTRINSIC_L Vector expand(MaskArg k) const Vc_INTRINSIC_R;
+
         template <typename F> void callWithValuesSorted(F &&f)
         {
             EntryType value = d.m(0);
@@ -337,17 +340,58 @@ static Vc_ALWAYS_INLINE Vc_PURE SSE::short_v  min(const SSE::short_v  &x, const
 static Vc_ALWAYS_INLINE Vc_PURE SSE::ushort_v min(const SSE::ushort_v &x, const SSE::ushort_v &y) { return SSE::min_epu16(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::float_v  min(const SSE::float_v  &x, const SSE::float_v  &y) { return _mm_min_ps(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::double_v min(const SSE::double_v &x, const SSE::double_v &y) { return _mm_min_pd(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::schar_v  min(const SSE::schar_v  &x, const SSE::schar_v  &y) { return SSE::min_epi8(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::uchar_v  min(const SSE::uchar_v  &x, const SSE::uchar_v  &y) { return _mm_min_epu8(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::llong_v  min(const SSE::llong_v  &x, const SSE::llong_v  &y) { return SSE::VectorHelper< llong>::min(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::ullong_v min(const SSE::ullong_v &x, const SSE::ullong_v &y) { return SSE::VectorHelper<ullong>::min(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::int_v    max(const SSE::int_v    &x, const SSE::int_v    &y) { return SSE::max_epi32(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::uint_v   max(const SSE::uint_v   &x, const SSE::uint_v   &y) { return SSE::max_epu32(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::short_v  max(const SSE::short_v  &x, const SSE::short_v  &y) { return _mm_max_epi16(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::ushort_v max(const SSE::ushort_v &x, const SSE::ushort_v &y) { return SSE::max_epu16(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::float_v  max(const SSE::float_v  &x, const SSE::float_v  &y) { return _mm_max_ps(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::double_v max(const SSE::double_v &x, const SSE::double_v &y) { return _mm_max_pd(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::schar_v  max(const SSE::schar_v  &x, const SSE::schar_v  &y) { return SSE::max_epi8(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::uchar_v  max(const SSE::uchar_v  &x, const SSE::uchar_v  &y) { return _mm_max_epu8(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::llong_v  max(const SSE::llong_v  &x, const SSE::llong_v  &y) { return SSE::VectorHelper< llong>::max(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::ullong_v max(const SSE::ullong_v &x, const SSE::ullong_v &y) { return SSE::VectorHelper<ullong>::max(x.data(), y.data()); }
+
+// saturating arithmetic {{{1
+static Vc_ALWAYS_INLINE Vc_PURE SSE::schar_v  add_sat(const SSE::schar_v  &x, const SSE::schar_v  &y) { return _mm_adds_epi8 (x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::uchar_v  add_sat(const SSE::uchar_v  &x, const SSE::uchar_v  &y) { return _mm_adds_epu8 (x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::short_v  add_sat(const SSE::short_v  &x, const SSE::short_v  &y) { return _mm_adds_epi16(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::ushort_v add_sat(const SSE::ushort_v &x, const SSE::ushort_v &y) { return _mm_adds_epu16(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::schar_v  sub_sat(const SSE::schar_v  &x, const SSE::schar_v  &y) { return _mm_subs_epi8 (x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::uchar_v  sub_sat(const SSE::uchar_v  &x, const SSE::uchar_v  &y) { return _mm_subs_epu8 (x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::short_v  sub_sat(const SSE::short_v  &x, const SSE::short_v  &y) { return _mm_subs_epi16(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::ushort_v sub_sat(const SSE::ushort_v &x, const SSE::ushort_v &y) { return _mm_subs_epu16(x.data(), y.data()); }
+
+// byte shuffle {{{1
+/**
+ * Returns a vector where entry \c i is \c x[indexes[i]], or 0 if \c indexes[i] is not
+ * smaller than \c x.size().
+ */
+static Vc_ALWAYS_INLINE Vc_PURE SSE::uchar_v shuffle(const SSE::uchar_v &x, const SSE::uchar_v &indexes)
+{
+#ifdef Vc_IMPL_SSSE3
+    // indexes >= 16 get their most significant bit set, which makes pshufb return 0
+    return _mm_shuffle_epi8(x.data(), _mm_adds_epu8(indexes.data(), _mm_set1_epi8(0x70)));
+#else
+    return SSE::uchar_v::generate([&](int i) {
+        const uchar j = indexes[i];
+        return j < SSE::uchar_v::Size ? x[j] : uchar(0);
+    });
+#endif
+}
+static Vc_ALWAYS_INLINE Vc_PURE SSE::schar_v shuffle(const SSE::schar_v &x, const SSE::uchar_v &indexes)
+{
+    return shuffle(SSE::uchar_v(x.data()), indexes).data();
+}
 
 template <typename T,
           typename = enable_if<std::is_same<T, double>::value || std::is_same<T, float>::value ||
                                std::is_same<T, short>::value ||
-                               std::is_same<T, int>::value>>
+                               std::is_same<T, int>::value || std::is_same<T, schar>::value ||
+                               std::is_same<T, llong>::value>>
 Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Sse> abs(Vector<T, VectorAbi::Sse> x)
 {
     return SSE::VectorHelper<T>::abs(x.data());
@@ -45,6 +45,10 @@ Vc_INTRINSIC SSE::   int_m operator==(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator==(SSE::  uint_v a, SSE::  uint_v b) { return _mm_cmpeq_epi32(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: short_m operator==(SSE:: short_v a, SSE:: short_v b) { return _mm_cmpeq_epi16(a.data(), b.data()); }
 Vc_INTRINSIC SSE::ushort_m operator==(SSE::ushort_v a, SSE::ushort_v b) { return _mm_cmpeq_epi16(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: schar_m operator==(SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator==(SSE:: uchar_v a, SSE:: uchar_v b) { return _mm_cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: llong_m operator==(SSE:: llong_v a, SSE:: llong_v b) { return SSE::cmpeq_epi64(a.data(), b.data()); }
+Vc_INTRINSIC SSE::ullong_m operator==(SSE::ullong_v a, SSE::ullong_v b) { return SSE::cmpeq_epi64(a.data(), b.data()); }
 
 Vc_INTRINSIC SSE::double_m operator!=(SSE::double_v a, SSE::double_v b) { return _mm_cmpneq_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator!=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmpneq_ps(a.data(), b.data()); }
@@ -52,6 +56,10 @@ Vc_INTRINSIC SSE::   int_m operator!=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator!=(SSE::  uint_v a, SSE::  uint_v b) { return not_(_mm_cmpeq_epi32(a.data(), b.data())); }
 Vc_INTRINSIC SSE:: short_m operator!=(SSE:: short_v a, SSE:: short_v b) { return not_(_mm_cmpeq_epi16(a.data(), b.data())); }
 Vc_INTRINSIC SSE::ushort_m operator!=(SSE::ushort_v a, SSE::ushort_v b) { return not_(_mm_cmpeq_epi16(a.data(), b.data())); }
+Vc_INTRINSIC SSE:: schar_m operator!=(SSE:: schar_v a, SSE:: schar_v b) { return not_(_mm_cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC SSE:: uchar_m operator!=(SSE:: uchar_v a, SSE:: uchar_v b) { return not_(_mm_cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC SSE:: llong_m operator!=(SSE:: llong_v a, SSE:: llong_v b) { return not_(SSE::cmpeq_epi64(a.data(), b.data())); }
+Vc_INTRINSIC SSE::ullong_m operator!=(SSE::ullong_v a, SSE::ullong_v b) { return not_(SSE::cmpeq_epi64(a.data(), b.data())); }
 
 Vc_INTRINSIC SSE::double_m operator> (SSE::double_v a, SSE::double_v b) { return _mm_cmpgt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator> (SSE:: float_v a, SSE:: float_v b) { return _mm_cmpgt_ps(a.data(), b.data()); }
@@ -71,6 +79,10 @@ Vc_INTRINSIC SSE::ushort_m operator> (SSE::ushort_v a, SSE::ushort_v b) {
     return _mm_cmpgt_epi16(a.data(), b.data());
 #endif
 }
+Vc_INTRINSIC SSE:: schar_m operator> (SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmpgt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator> (SSE:: uchar_v a, SSE:: uchar_v b) { return SSE::cmpgt_epu8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: llong_m operator> (SSE:: llong_v a, SSE:: llong_v b) { return SSE::cmpgt_epi64(a.data(), b.data()); }
+Vc_INTRINSIC SSE::ullong_m operator> (SSE::ullong_v a, SSE::ullong_v b) { return SSE::cmpgt_epu64(a.data(), b.data()); }
 
 Vc_INTRINSIC SSE::double_m operator< (SSE::double_v a, SSE::double_v b) { return _mm_cmplt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator< (SSE:: float_v a, SSE:: float_v b) { return _mm_cmplt_ps(a.data(), b.data()); }
@@ -90,6 +102,10 @@ Vc_INTRINSIC SSE::ushort_m operator< (SSE::ushort_v a, SSE::ushort_v b) {
     return _mm_cmplt_epi16(a.data(), b.data());
 #endif
 }
+Vc_INTRINSIC SSE:: schar_m operator< (SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmplt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator< (SSE:: uchar_v a, SSE:: uchar_v b) { return SSE::cmplt_epu8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: llong_m operator< (SSE:: llong_v a, SSE:: llong_v b) { return SSE::cmpgt_epi64(b.data(), a.data()); }
+Vc_INTRINSIC SSE::ullong_m operator< (SSE::ullong_v a, SSE::ullong_v b) { return SSE::cmpgt_epu64(b.data(), a.data()); }
 
 Vc_INTRINSIC SSE::double_m operator>=(SSE::double_v a, SSE::double_v b) { return _mm_cmpnlt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator>=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmpnlt_ps(a.data(), b.data()); }
@@ -97,6 +113,10 @@ Vc_INTRINSIC SSE::   int_m operator>=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator>=(SSE::  uint_v a, SSE::  uint_v b) { return !(a < b); }
 Vc_INTRINSIC SSE:: short_m operator>=(SSE:: short_v a, SSE:: short_v b) { return !(a < b); }
 Vc_INTRINSIC SSE::ushort_m operator>=(SSE::ushort_v a, SSE::ushort_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: schar_m operator>=(SSE:: schar_v a, SSE:: schar_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: uchar_m operator>=(SSE:: uchar_v a, SSE:: uchar_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: llong_m operator>=(SSE:: llong_v a, SSE:: llong_v b) { return !(a < b); }
+Vc_INTRINSIC SSE::ullong_m operator>=(SSE::ullong_v a, SSE::ullong_v b) { return !(a < b); }
 
 Vc_INTRINSIC SSE::double_m operator<=(SSE::double_v a, SSE::double_v b) { return _mm_cmple_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator<=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmple_ps(a.data(), b.data()); }
@@ -104,6 +124,10 @@ Vc_INTRINSIC SSE::   int_m operator<=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator<=(SSE::  uint_v a, SSE::  uint_v b) { return !(a > b); }
 Vc_INTRINSIC SSE:: short_m operator<=(SSE:: short_v a, SSE:: short_v b) { return !(a > b); }
 Vc_INTRINSIC SSE::ushort_m operator<=(SSE::ushort_v a, SSE::ushort_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: schar_m operator<=(SSE:: schar_v a, SSE:: schar_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: uchar_m operator<=(SSE:: uchar_v a, SSE:: uchar_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: llong_m operator<=(SSE:: llong_v a, SSE:: llong_v b) { return !(a > b); }
+Vc_INTRINSIC SSE::ullong_m operator<=(SSE::ullong_v a, SSE::ullong_v b) { return !(a > b); }
 
 // bitwise operators {{{1
 template <typename T>
@@ -144,8 +168,7 @@ Vc_INTRINSIC enable_if<std::is_floating_point<T>::value, SSE::Vector<T>> operato
     return div(a.data(), b.data(), T());
 }
 template <typename T>
-Vc_INTRINSIC
-    enable_if<std::is_same<int, T>::value || std::is_same<uint, T>::value, SSE::Vector<T>>
+Vc_INTRINSIC enable_if<std::is_integral<T>::value && sizeof(T) != 2, SSE::Vector<T>>
     operator/(SSE::Vector<T> a, SSE::Vector<T> b)
 {
     return SSE::Vector<T>::generate([&](int i) { return a[i] / b[i]; });
@@ -207,6 +230,18 @@ Vc_INTRINSIC Vector<double, VectorAbi::Sse>::Vector(VectorSpecialInitializerInde
 {
 }
 
+template <>
+Vc_INTRINSIC Vector<llong, VectorAbi::Sse>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm_slli_si128(_mm_cvtsi32_si128(1), 8))
+{
+}
+
+template <>
+Vc_INTRINSIC Vector<ullong, VectorAbi::Sse>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm_slli_si128(_mm_cvtsi32_si128(1), 8))
+{
+}
+
 // load member functions {{{1
 template <typename DstT>
 template <typename SrcT, typename Flags>
@@ -368,6 +403,40 @@ Vc_ALWAYS_INLINE void SSE::ushort_v::gatherImplementation(const MT *mem, const I
                     mem[indexes[4]], mem[indexes[5]], mem[indexes[6]], mem[indexes[7]]);
 }
 
+template <>
+template <typename MT, typename IT>
+Vc_ALWAYS_INLINE void SSE::schar_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm_setr_epi8(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]], mem[indexes[3]],
+                          mem[indexes[4]], mem[indexes[5]], mem[indexes[6]], mem[indexes[7]],
+                          mem[indexes[8]], mem[indexes[9]], mem[indexes[10]], mem[indexes[11]],
+                          mem[indexes[12]], mem[indexes[13]], mem[indexes[14]], mem[indexes[15]]);
+}
+
+template <>
+template <typename MT, typename IT>
+Vc_ALWAYS_INLINE void SSE::uchar_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm_setr_epi8(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]], mem[indexes[3]],
+                          mem[indexes[4]], mem[indexes[5]], mem[indexes[6]], mem[indexes[7]],
+                          mem[indexes[8]], mem[indexes[9]], mem[indexes[10]], mem[indexes[11]],
+                          mem[indexes[12]], mem[indexes[13]], mem[indexes[14]], mem[indexes[15]]);
+}
+
+template <>
+template <typename MT, typename IT>
+Vc_ALWAYS_INLINE void SSE::llong_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm_set_epi64x(mem[indexes[1]], mem[indexes[0]]);
+}
+
+template <>
+template <typename MT, typename IT>
+Vc_ALWAYS_INLINE void SSE::ullong_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm_set_epi64x(mem[indexes[1]], mem[indexes[0]]);
+}
+
 template <typename T>
 template <typename MT, typename IT>
 inline void Vector<T, VectorAbi::Sse>::gatherImplementation(const MT *mem,
@@ -506,12 +575,13 @@ static void _doRandomStep(SSE::uint_v &state0,
     using SSE::uint_v;
     using Detail::operator+;
     using Detail::operator*;
-    state0.load(&Common::RandomState[0]);
-    state1.load(&Common::RandomState[uint_v::Size]);
-    (state1 * uint_v(0xdeece66du) + uint_v(11)).store(&Common::RandomState[uint_v::Size]);
+    unsigned int *const randomState = Common::randomState();
+    state0.load(&randomState[0]);
+    state1.load(&randomState[uint_v::Size]);
+    (state1 * uint_v(0xdeece66du) + uint_v(11)).store(&randomState[uint_v::Size]);
     uint_v(_mm_xor_si128((state0 * uint_v(0xdeece66du) + uint_v(11)).data(),
                          _mm_srli_epi32(state1.data(), 16)))
-        .store(&Common::RandomState[0]);
+        .store(&randomState[0]);
 }
 
 template<typename T> Vc_ALWAYS_INLINE Vector<T, VectorAbi::Sse> Vector<T, VectorAbi::Sse>::Random()
@@ -531,11 +601,12 @@ template<> Vc_ALWAYS_INLINE SSE::float_v SSE::float_v::Random()
 template<> Vc_ALWAYS_INLINE SSE::double_v SSE::double_v::Random()
 {
     typedef unsigned long long uint64 Vc_MAY_ALIAS;
-    uint64 state0 = *reinterpret_cast<const uint64 *>(&Common::RandomState[8]);
-    uint64 state1 = *reinterpret_cast<const uint64 *>(&Common::RandomState[10]);
-    const __m128i state = _mm_load_si128(reinterpret_cast<const __m128i *>(&Common::RandomState[8]));
-    *reinterpret_cast<uint64 *>(&Common::RandomState[ 8]) = (state0 * 0x5deece66dull + 11);
-    *reinterpret_cast<uint64 *>(&Common::RandomState[10]) = (state1 * 0x5deece66dull + 11);
+    unsigned int *const randomState = Common::randomState();
+    uint64 state0 = *reinterpret_cast<const uint64 *>(&randomState[8]);
+    uint64 state1 = *reinterpret_cast<const uint64 *>(&randomState[10]);
+    const __m128i state = _mm_load_si128(reinterpret_cast<const __m128i *>(&randomState[8]));
+    *reinterpret_cast<uint64 *>(&randomState[ 8]) = (state0 * 0x5deece66dull + 11);
+    *reinterpret_cast<uint64 *>(&randomState[10]) = (state1 * 0x5deece66dull + 11);
     return _mm_sub_pd(_mm_or_pd(_mm_castsi128_pd(_mm_srli_epi64(state, 12)), HT::one()), HT::one());
 }
 // shifted / rotated {{{1
@@ -554,6 +625,13 @@ template<typename T> Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, Ve
     case  6: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 6 * EntryTypeSizeof));
     case  7: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 7 * EntryTypeSizeof));
     case  8: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 8 * EntryTypeSizeof));
+    case  9: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 9 * EntryTypeSizeof));
+    case 10: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 10 * EntryTypeSizeof));
+    case 11: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 11 * EntryTypeSizeof));
+    case 12: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 12 * EntryTypeSizeof));
+    case 13: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 13 * EntryTypeSizeof));
+    case 14: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 14 * EntryTypeSizeof));
+    case 15: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 15 * EntryTypeSizeof));
     case -1: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 1 * EntryTypeSizeof));
     case -2: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 2 * EntryTypeSizeof));
     case -3: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 3 * EntryTypeSizeof));
@@ -562,6 +640,13 @@ template<typename T> Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, Ve
     case -6: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 6 * EntryTypeSizeof));
     case -7: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 7 * EntryTypeSizeof));
     case -8: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 8 * EntryTypeSizeof));
+    case -9: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 9 * EntryTypeSizeof));
+    case-10: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 10 * EntryTypeSizeof));
+    case-11: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 11 * EntryTypeSizeof));
+    case-12: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 12 * EntryTypeSizeof));
+    case-13: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 13 * EntryTypeSizeof));
+    case-14: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 14 * EntryTypeSizeof));
+    case-15: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 15 * EntryTypeSizeof));
     }
     return Zero();
 }
@@ -607,6 +692,10 @@ template<typename T> Vc_INTRINSIC Vector<T, VectorAbi::Sse> Vector<T, VectorAbi:
         case 14: return fixup(SSE::alignr_epi8<14 * EntryTypeSizeof>(v1, v0));
         case 15: return fixup(SSE::alignr_epi8<15 * EntryTypeSizeof>(v1, v0));
         }
+        if (amount >= int(size())) {
+            // only reachable with 16 entries: [*this shiftIn] << 16 starts at shiftIn
+            return shiftIn.shifted(amount - int(size()));
+        }
     }
     return shiftIn.shifted(int(size()) + amount);
 }
@@ -628,6 +717,14 @@ template<typename T> Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, Ve
     case  5: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<5 * EntryTypeSizeof>(v, v));
     case  6: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<6 * EntryTypeSizeof>(v, v));
     case  7: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<7 * EntryTypeSizeof>(v, v));
+    case  8: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<8 * EntryTypeSizeof>(v, v));
+    case  9: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<9 * EntryTypeSizeof>(v, v));
+    case 10: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<10 * EntryTypeSizeof>(v, v));
+    case 11: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<11 * EntryTypeSizeof>(v, v));
+    case 12: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<12 * EntryTypeSizeof>(v, v));
+    case 13: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<13 * EntryTypeSizeof>(v, v));
+    case 14: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<14 * EntryTypeSizeof>(v, v));
+    case 15: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<15 * EntryTypeSizeof>(v, v));
     }
     return Zero();
 }
@@ -640,6 +737,23 @@ inline Vc_CONST SSE::double_v sorted(SSE::double_v x_)
     const __m128d y = _mm_shuffle_pd(x, x, _MM_SHUFFLE2(0, 1));
     return _mm_unpacklo_pd(_mm_min_sd(x, y), _mm_max_sd(x, y));
 }
+template <typename V> inline Vc_CONST V sorted64(V x)
+{
+    const V y = _mm_shuffle_epi32(x.data(), _MM_SHUFFLE(1, 0, 3, 2));
+    return _mm_unpacklo_epi64(min(x, y).data(), max(x, y).data());
+}
+inline Vc_CONST SSE:: llong_v sorted(SSE:: llong_v x) { return sorted64(x); }
+inline Vc_CONST SSE::ullong_v sorted(SSE::ullong_v x) { return sorted64(x); }
+template <typename V> inline V sorted8(V x)
+{
+    // there is no sorting network for 16 lanes (yet): sort in memory
+    alignas(16) typename V::EntryType mem[16];
+    x.store(mem, Vc::Aligned);
+    std::sort(mem, mem + 16);
+    return V(mem, Vc::Aligned);
+}
+inline SSE::schar_v sorted(SSE::schar_v x) { return sorted8(x); }
+inline SSE::uchar_v sorted(SSE::uchar_v x) { return sorted8(x); }
 }  // namespace Detail
 template <typename T>
 Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, VectorAbi::Sse>::sorted()
@@ -647,6 +761,19 @@ Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, VectorAbi::Sse>::so
 {
     return Detail::sorted(*this);
 }
+// compress / expand {{{1
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Sse> Vector<T, VectorAbi::Sse>::compress(MaskArg k) const
+{
+    return SSE::sse_cast<VectorType>(
+        Detail::compress<Size>(SSE::sse_cast<__m128i>(d.v()), k.toInt()));
+}
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Sse> Vector<T, VectorAbi::Sse>::expand(MaskArg k) const
+{
+    return SSE::sse_cast<VectorType>(
+        Detail::expand<Size>(SSE::sse_cast<__m128i>(d.v()), k.toInt()));
+}
 // interleaveLow/-High {{{1
 template <> Vc_INTRINSIC SSE::double_v SSE::double_v::interleaveLow (SSE::double_v x) const { return _mm_unpacklo_pd(data(), x.data()); }
 template <> Vc_INTRINSIC SSE::double_v SSE::double_v::interleaveHigh(SSE::double_v x) const { return _mm_unpackhi_pd(data(), x.data()); }
@@ -660,6 +787,14 @@ template <> Vc_INTRINSIC  SSE::short_v  SSE::short_v::interleaveLow ( SSE::short
 template <> Vc_INTRINSIC  SSE::short_v  SSE::short_v::interleaveHigh( SSE::short_v x) const { return _mm_unpackhi_epi16(data(), x.data()); }
 template <> Vc_INTRINSIC SSE::ushort_v SSE::ushort_v::interleaveLow (SSE::ushort_v x) const { return _mm_unpacklo_epi16(data(), x.data()); }
 template <> Vc_INTRINSIC SSE::ushort_v SSE::ushort_v::interleaveHigh(SSE::ushort_v x) const { return _mm_unpackhi_epi16(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::schar_v  SSE::schar_v::interleaveLow ( SSE::schar_v x) const { return _mm_unpacklo_epi8(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::schar_v  SSE::schar_v::interleaveHigh( SSE::schar_v x) const { return _mm_unpackhi_epi8(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::uchar_v  SSE::uchar_v::interleaveLow ( SSE::uchar_v x) const { return _mm_unpacklo_epi8(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::uchar_v  SSE::uchar_v::interleaveHigh( SSE::uchar_v x) const { return _mm_unpackhi_epi8(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::llong_v  SSE::llong_v::interleaveLow ( SSE::llong_v x) const { return _mm_unpacklo_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::llong_v  SSE::llong_v::interleaveHigh( SSE::llong_v x) const { return _mm_unpackhi_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC SSE::ullong_v SSE::ullong_v::interleaveLow (SSE::ullong_v x) const { return _mm_unpacklo_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC SSE::ullong_v SSE::ullong_v::interleaveHigh(SSE::ullong_v x) const { return _mm_unpackhi_epi64(data(), x.data()); }
 // }}}1
 // generate {{{1
 template <> template <typename G> Vc_INTRINSIC SSE::double_v SSE::double_v::generate(G gen)
@@ -716,6 +851,30 @@ template <> template <typename G> Vc_INTRINSIC SSE::ushort_v SSE::ushort_v::gene
     const auto tmp7 = gen(7);
     return _mm_setr_epi16(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7);
 }
+template <> template <typename G> Vc_INTRINSIC SSE::schar_v SSE::schar_v::generate(G gen)
+{
+    return _mm_setr_epi8(gen(0), gen(1), gen(2), gen(3), gen(4), gen(5), gen(6), gen(7),
+                         gen(8), gen(9), gen(10), gen(11), gen(12), gen(13), gen(14),
+                         gen(15));
+}
+template <> template <typename G> Vc_INTRINSIC SSE::uchar_v SSE::uchar_v::generate(G gen)
+{
+    return _mm_setr_epi8(gen(0), gen(1), gen(2), gen(3), gen(4), gen(5), gen(6), gen(7),
+                         gen(8), gen(9), gen(10), gen(11), gen(12), gen(13), gen(14),
+                         gen(15));
+}
+template <> template <typename G> Vc_INTRINSIC SSE::llong_v SSE::llong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    return _mm_set_epi64x(tmp1, tmp0);
+}
+template <> template <typename G> Vc_INTRINSIC SSE::ullong_v SSE::ullong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    return _mm_set_epi64x(tmp1, tmp0);
+}
 // }}}1
 // reversed {{{1
 template <> Vc_INTRINSIC Vc_PURE SSE::double_v SSE::double_v::reversed() const
@@ -746,6 +905,38 @@ template <> Vc_INTRINSIC Vc_PURE SSE::ushort_v SSE::ushort_v::reversed() const
         Mem::shuffle<X1, Y0>(sse_cast<__m128d>(Mem::permuteHi<X7, X6, X5, X4>(d.v())),
                              sse_cast<__m128d>(Mem::permuteLo<X3, X2, X1, X0>(d.v()))));
 }
+template <> Vc_INTRINSIC Vc_PURE SSE::schar_v SSE::schar_v::reversed() const
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_shuffle_epi8(d.v(), _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+#else
+    // swap the bytes within each 16-bit lane, then reverse the 16-bit lanes
+    const __m128i x = _mm_or_si128(_mm_slli_epi16(d.v(), 8), _mm_srli_epi16(d.v(), 8));
+    return sse_cast<__m128i>(
+        Mem::shuffle<X1, Y0>(sse_cast<__m128d>(Mem::permuteHi<X7, X6, X5, X4>(x)),
+                             sse_cast<__m128d>(Mem::permuteLo<X3, X2, X1, X0>(x))));
+#endif
+}
+template <> Vc_INTRINSIC Vc_PURE SSE::uchar_v SSE::uchar_v::reversed() const
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_shuffle_epi8(d.v(), _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+#else
+    // swap the bytes within each 16-bit lane, then reverse the 16-bit lanes
+    const __m128i x = _mm_or_si128(_mm_slli_epi16(d.v(), 8), _mm_srli_epi16(d.v(), 8));
+    return sse_cast<__m128i>(
+        Mem::shuffle<X1, Y0>(sse_cast<__m128d>(Mem::permuteHi<X7, X6, X5, X4>(x)),
+                             sse_cast<__m128d>(Mem::permuteLo<X3, X2, X1, X0>(x))));
+#endif
+}
+template <> Vc_INTRINSIC Vc_PURE SSE::llong_v SSE::llong_v::reversed() const
+{
+    return _mm_shuffle_epi32(d.v(), _MM_SHUFFLE(1, 0, 3, 2));
+}
+template <> Vc_INTRINSIC Vc_PURE SSE::ullong_v SSE::ullong_v::reversed() const
+{
+    return _mm_shuffle_epi32(d.v(), _MM_SHUFFLE(1, 0, 3, 2));
+}
 // }}}1
 // permutation via operator[] {{{1
 template <>
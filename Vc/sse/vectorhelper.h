@@ -29,6 +29,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define VC_SSE_VECTORHELPER_H_
 
 #include "types.h"
+#include "casts.h"
 #include "../common/loadstoreflags.h"
 #include <limits>
 #include "const_data.h"
@@ -57,7 +58,20 @@ namespace SSE
             template<typename Flags> static Vc_ALWAYS_INLINE void store(float *mem, VectorType x, typename Flags::EnableIfUnalignedAndStreaming = nullptr) { _mm_maskmoveu_si128(_mm_castps_si128(x), _mm_setallone_si128(), reinterpret_cast<char *>(mem)); }
 
             // before AVX there was only one maskstore. load -> blend -> store would break the C++ memory model (read/write of memory that is actually not touched by this thread)
+            // AVX-512 write-masking stores the selected lanes without the non-temporal hint of maskmovdqu
+#ifdef Vc_IMPL_AVX512VL
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(float *mem, VectorType x, VectorType m) { _mm_mask_storeu_ps(mem, _mm_movepi32_mask(_mm_castps_si128(m)), x); }
+#else
             template<typename Flags> static Vc_ALWAYS_INLINE void store(float *mem, VectorType x, VectorType m) { _mm_maskmoveu_si128(_mm_castps_si128(x), _mm_castps_si128(m), reinterpret_cast<char *>(mem)); }
+#endif
+
+            // float16/bfloat16 stores convert to 16 bits per entry and thus write 8 Bytes
+            template<typename Flags, typename H> static Vc_ALWAYS_INLINE enable_if<Traits::is_half_float<H>::value, void> store(H *mem, VectorType x) { _mm_storel_epi64(reinterpret_cast<__m128i *>(mem), convert(x, ConvertTag<float, H>())); }
+#ifdef Vc_IMPL_AVX512VL
+            template<typename Flags, typename H> static Vc_ALWAYS_INLINE enable_if<Traits::is_half_float<H>::value, void> store(H *mem, VectorType x, VectorType m) { _mm_mask_storeu_epi16(mem, _mm_movepi32_mask(_mm_castps_si128(m)), convert(x, ConvertTag<float, H>())); }
+#else
+            template<typename Flags, typename H> static Vc_ALWAYS_INLINE enable_if<Traits::is_half_float<H>::value, void> store(H *mem, VectorType x, VectorType m) { _mm_maskmoveu_si128(convert(x, ConvertTag<float, H>()), _mm_packs_epi32(_mm_castps_si128(m), _mm_setzero_si128()), reinterpret_cast<char *>(mem)); }
+#endif
 
             Vc_OP0(allone, _mm_setallone_ps())
             Vc_OP0(zero, _mm_setzero_ps())
@@ -79,7 +93,11 @@ namespace SSE
             template<typename Flags> static Vc_ALWAYS_INLINE void store(double *mem, VectorType x, typename Flags::EnableIfUnalignedAndStreaming = nullptr) { _mm_maskmoveu_si128(_mm_castpd_si128(x), _mm_setallone_si128(), reinterpret_cast<char *>(mem)); }
 
             // before AVX there was only one maskstore. load -> blend -> store would break the C++ memory model (read/write of memory that is actually not touched by this thread)
+#ifdef Vc_IMPL_AVX512VL
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(double *mem, VectorType x, VectorType m) { _mm_mask_storeu_pd(mem, _mm_movepi64_mask(_mm_castpd_si128(m)), x); }
+#else
             template<typename Flags> static Vc_ALWAYS_INLINE void store(double *mem, VectorType x, VectorType m) { _mm_maskmoveu_si128(_mm_castpd_si128(x), _mm_castpd_si128(m), reinterpret_cast<char *>(mem)); }
+#endif
 
             Vc_OP0(allone, _mm_setallone_pd())
             Vc_OP0(zero, _mm_setzero_pd())
@@ -100,7 +118,11 @@ namespace SSE
             template<typename Flags, typename T> static Vc_ALWAYS_INLINE void store(T *mem, VectorType x, typename Flags::EnableIfUnalignedAndStreaming = nullptr) { _mm_maskmoveu_si128(x, _mm_setallone_si128(), reinterpret_cast<char *>(mem)); }
 
             // before AVX there was only one maskstore. load -> blend -> store would break the C++ memory model (read/write of memory that is actually not touched by this thread)
+#ifdef Vc_IMPL_AVX512VL
+            template<typename Flags, typename T> static Vc_ALWAYS_INLINE void store(T *mem, VectorType x, VectorType m) { _mm_mask_storeu_epi8(mem, _mm_movepi8_mask(m), x); }
+#else
             template<typename Flags, typename T> static Vc_ALWAYS_INLINE void store(T *mem, VectorType x, VectorType m) { _mm_maskmoveu_si128(x, m, reinterpret_cast<char *>(mem)); }
+#endif
 
             Vc_OP0(allone, _mm_setallone_si128())
             Vc_OP0(zero, _mm_setzero_si128())
@@ -144,6 +166,10 @@ namespace SSE
             static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) {
                 v1 = _mm_macc_pd(v1, v2, v3);
             }
+#elif defined Vc_IMPL_FMA
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) {
+                v1 = _mm_fmadd_pd(v1, v2, v3);
+            }
 #else
             static inline void fma(VectorType &v1, VectorType v2, VectorType v3) {
                 VectorType h1 = _mm_and_pd(v1, _mm_load_pd(reinterpret_cast<const double *>(&c_general::highMaskDouble)));
@@ -233,6 +259,10 @@ namespace SSE
             static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) {
                 v1 = _mm_macc_ps(v1, v2, v3);
             }
+#elif defined Vc_IMPL_FMA
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) {
+                v1 = _mm_fmadd_ps(v1, v2, v3);
+            }
 #else
             static inline void fma(VectorType &v1, VectorType v2, VectorType v3) {
                 __m128d v1_0 = _mm_cvtps_pd(v1);
@@ -611,6 +641,244 @@ namespace SSE
 #undef Vc_SUFFIX
             static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
         };
+
+        template<> struct VectorHelper<signed char> {
+            typedef _M128I VectorType;
+            typedef signed char EntryType;
+#define Vc_SUFFIX si128
+
+            Vc_OP_(or_) Vc_OP_(and_) Vc_OP_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, _M128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi8
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return Vc_CAT2(_mm_setone_, Vc_SUFFIX)(); }
+
+            // there are no 8-bit shifts: shift 16-bit lanes and sign-extend/mask per byte
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return _mm_and_si128(_mm_slli_epi16(a, shift), _mm_set1_epi8(static_cast<char>(0xff << shift)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                const VectorType even = _mm_srai_epi16(_mm_slli_epi16(a, 8), shift + 8);
+                const VectorType odd = _mm_srai_epi16(a, shift);
+                return _mm_or_si128(_mm_and_si128(even, _mm_set1_epi16(0x00ff)),
+                                    _mm_andnot_si128(_mm_set1_epi16(0x00ff), odd));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return Vc_CAT2(_mm_set1_, Vc_SUFFIX)(a); }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) {
+                v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType abs(const VectorType a) { return abs_epi8(a); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(const VectorType a, const VectorType b) {
+                // multiply even and odd bytes separately in 16-bit lanes and merge the low bytes
+                const VectorType even = _mm_mullo_epi16(a, b);
+                const VectorType odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+                return _mm_or_si128(_mm_and_si128(even, _mm_set1_epi16(0x00ff)),
+                                    _mm_slli_epi16(odd, 8));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(const VectorType a, const VectorType b) { return min_epi8(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(const VectorType a, const VectorType b) { return max_epi8(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                a = min(a, _mm_srli_si128(a, 8));
+                a = min(a, _mm_srli_si128(a, 4));
+                a = min(a, _mm_srli_si128(a, 2));
+                a = min(a, _mm_srli_si128(a, 1));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                a = max(a, _mm_srli_si128(a, 8));
+                a = max(a, _mm_srli_si128(a, 4));
+                a = max(a, _mm_srli_si128(a, 2));
+                a = max(a, _mm_srli_si128(a, 1));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) {
+                a = mul(a, _mm_srli_si128(a, 8));
+                a = mul(a, _mm_srli_si128(a, 4));
+                a = mul(a, _mm_srli_si128(a, 2));
+                a = mul(a, _mm_srli_si128(a, 1));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) {
+                // psadbw against zero sums each half; the low byte of the sum is the
+                // result, irrespective of the signedness
+                a = _mm_sad_epu8(a, _mm_setzero_si128());
+                return _mm_cvtsi128_si32(_mm_add_epi32(a, _mm_srli_si128(a, 8))); // & 0xff is implicit
+            }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        template<> struct VectorHelper<unsigned char> {
+            typedef _M128I VectorType;
+            typedef unsigned char EntryType;
+#define Vc_SUFFIX si128
+
+            Vc_OP_(or_) Vc_OP_(and_) Vc_OP_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, _M128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epu8
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return Vc_CAT2(_mm_setone_, Vc_SUFFIX)(); }
+            Vc_MINMAX
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi8
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return _mm_and_si128(_mm_slli_epi16(a, shift), _mm_set1_epi8(static_cast<char>(0xff << shift)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                return _mm_and_si128(_mm_srli_epi16(a, shift), _mm_set1_epi8(static_cast<char>(0xff >> shift)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return Vc_CAT2(_mm_set1_, Vc_SUFFIX)(a); }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) {
+                v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(const VectorType a, const VectorType b) {
+                return VectorHelper<signed char>::mul(a, b);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                a = min(a, _mm_srli_si128(a, 8));
+                a = min(a, _mm_srli_si128(a, 4));
+                a = min(a, _mm_srli_si128(a, 2));
+                a = min(a, _mm_srli_si128(a, 1));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                a = max(a, _mm_srli_si128(a, 8));
+                a = max(a, _mm_srli_si128(a, 4));
+                a = max(a, _mm_srli_si128(a, 2));
+                a = max(a, _mm_srli_si128(a, 1));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) {
+                return VectorHelper<signed char>::mul(a);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) {
+                return VectorHelper<signed char>::add(a);
+            }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        template<> struct VectorHelper<long long> {
+            typedef _M128I VectorType;
+            typedef long long EntryType;
+#define Vc_SUFFIX si128
+
+            Vc_OP_(or_) Vc_OP_(and_) Vc_OP_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, _M128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi64
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return Vc_CAT2(_mm_setone_, Vc_SUFFIX)(); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return Vc_CAT2(_mm_slli_, Vc_SUFFIX)(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                // there is no psraq before AVX-512: ((a ^ s) >> shift) ^ s with s = a < 0 ? ~0 : 0
+                const VectorType sign = _mm_srai_epi32(_mm_shuffle_epi32(a, _MM_SHUFFLE(3, 3, 1, 1)), 31);
+                return _mm_xor_si128(_mm_srli_epi64(_mm_xor_si128(a, sign), shift), sign);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return _mm_set1_epi64x(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a, const EntryType b) {
+                return _mm_set_epi64x(a, b);
+            }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) {
+                v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType abs(const VectorType a) {
+                const VectorType sign = _mm_srai_epi32(_mm_shuffle_epi32(a, _MM_SHUFFLE(3, 3, 1, 1)), 31);
+                return _mm_sub_epi64(_mm_xor_si128(a, sign), sign);
+            }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(const VectorType a, const VectorType b) {
+                // a * b mod 2^64 = lo(a) * lo(b) + ((hi(a) * lo(b) + lo(a) * hi(b)) << 32)
+                const VectorType cross =
+                    _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b),
+                                  _mm_mul_epu32(a, _mm_srli_epi64(b, 32)));
+                return _mm_add_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(cross, 32));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(const VectorType a, const VectorType b) { return blendv_epi8(a, b, cmpgt_epi64(a, b)); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(const VectorType a, const VectorType b) { return blendv_epi8(b, a, cmpgt_epi64(a, b)); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                return _mm_cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                return _mm_cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) {
+                return _mm_cvtsi128_si64(mul(a, _mm_unpackhi_epi64(a, a)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) {
+                return _mm_cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a)));
+            }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        template<> struct VectorHelper<unsigned long long> {
+            typedef _M128I VectorType;
+            typedef unsigned long long EntryType;
+#define Vc_SUFFIX si128
+
+            Vc_OP_(or_) Vc_OP_(and_) Vc_OP_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, _M128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi64
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return Vc_CAT2(_mm_setone_, Vc_SUFFIX)(); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return Vc_CAT2(_mm_slli_, Vc_SUFFIX)(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                return Vc_CAT2(_mm_srli_, Vc_SUFFIX)(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return _mm_set1_epi64x(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a, const EntryType b) {
+                return _mm_set_epi64x(a, b);
+            }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) {
+                v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(const VectorType a, const VectorType b) {
+                return VectorHelper<long long>::mul(a, b);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(const VectorType a, const VectorType b) { return blendv_epi8(a, b, cmpgt_epu64(a, b)); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(const VectorType a, const VectorType b) { return blendv_epi8(b, a, cmpgt_epu64(a, b)); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                return _mm_cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                return _mm_cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) {
+                return VectorHelper<long long>::mul(a);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) {
+                return VectorHelper<long long>::add(a);
+            }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
 #undef Vc_OP1
 #undef Vc_OP
 #undef Vc_OP_
@@ -59,17 +59,17 @@ using uint_v = Vector<uint>;
 using short_v = Vector<short>;
 /// vector of unsigned short integers
 using ushort_v = Vector<ushort>;
-///\internal vector of signed long long integers
+/// vector of signed long long integers
 using llong_v = Vector<llong>;
-///\internal vector of unsigned long long integers
+/// vector of unsigned long long integers
 using ullong_v = Vector<ullong>;
 ///\internal vector of signed long integers
 using long_v = Vector<long>;
 ///\internal vector of unsigned long integers
 using ulong_v = Vector<ulong>;
-///\internal vector of signed char-sized integers
+/// vector of signed char-sized integers
 using schar_v = Vector<schar>;
-///\internal vector of unsigned char-sized integers
+/// vector of unsigned char-sized integers
 using uchar_v = Vector<uchar>;
 ///@}
 ///@}
@@ -86,9 +86,9 @@ using uchar_v = Vector<uchar>;
 using double_m = Mask<double>;
 /// mask type for float_v vectors
 using  float_m = Mask< float>;
-///\internal mask type for llong_v vectors
+/// mask type for llong_v vectors
 using  llong_m = Mask< llong>;
-///\internal mask type for ullong_v vectors
+/// mask type for ullong_v vectors
 using ullong_m = Mask<ullong>;
 ///\internal mask type for long_v vectors
 using   long_m = Mask<  long>;
@@ -102,9 +102,9 @@ using   uint_m = Mask<  uint>;
 using  short_m = Mask< short>;
 /// mask type for ushort_v vectors
 using ushort_m = Mask<ushort>;
-///\internal mask type for schar_v vectors
+/// mask type for schar_v vectors
 using  schar_m = Mask< schar>;
-///\internal mask type for uchar_v vectors
+/// mask type for uchar_v vectors
 using  uchar_m = Mask< uchar>;
 ///@}
 ///@}
@@ -177,6 +177,10 @@ using  uchar_m = Mask< uchar>;
     static_assert(uint_v::Size   == Vc_UINT_V_SIZE  , "Vc_UINT_V_SIZE macro defined to an incorrect value  ");
     static_assert(short_v::Size  == Vc_SHORT_V_SIZE , "Vc_SHORT_V_SIZE macro defined to an incorrect value ");
     static_assert(ushort_v::Size == Vc_USHORT_V_SIZE, "Vc_USHORT_V_SIZE macro defined to an incorrect value");
+    static_assert(schar_v::Size  == Vc_SCHAR_V_SIZE , "Vc_SCHAR_V_SIZE macro defined to an incorrect value ");
+    static_assert(uchar_v::Size  == Vc_UCHAR_V_SIZE , "Vc_UCHAR_V_SIZE macro defined to an incorrect value ");
+    static_assert(llong_v::Size  == Vc_LLONG_V_SIZE , "Vc_LLONG_V_SIZE macro defined to an incorrect value ");
+    static_assert(ullong_v::Size == Vc_ULLONG_V_SIZE, "Vc_ULLONG_V_SIZE macro defined to an incorrect value");
   }
 }
 
@@ -185,6 +189,7 @@ using  uchar_m = Mask< uchar>;
 #include "common/operators.h"
 
 #include "common/simdarray.h"
+#include "common/compress.h"
 // XXX See bottom of common/simdmaskarray.h:
 //#include "common/simd_cast_caller.tcc"
 
@@ -241,6 +246,7 @@ constexpr std::size_t MemoryAlignment = alignof(MemoryAlignedBase);
 
 #include "common/vectortuple.h"
 #include "common/algorithms.h"
+#include "common/sort.h"
 #include "common/where.h"
 #include "common/iif.h"
 
@@ -254,20 +260,30 @@ namespace std
   using Vc::asin;
   using Vc::atan;
   using Vc::atan2;
+  using Vc::cbrt;
   using Vc::ceil;
   using Vc::cos;
+  using Vc::cosh;
+  using Vc::erf;
+  using Vc::erfc;
   using Vc::exp;
+  using Vc::expm1;
   using Vc::fma;
   using Vc::trunc;
   using Vc::floor;
   using Vc::frexp;
   using Vc::ldexp;
+  using Vc::hypot;
   using Vc::log;
   using Vc::log10;
+  using Vc::log1p;
   using Vc::log2;
+  using Vc::pow;
   using Vc::round;
   using Vc::sin;
+  using Vc::sinh;
   using Vc::sqrt;
+  using Vc::tanh;
 
   using Vc::isfinite;
   using Vc::isnan;
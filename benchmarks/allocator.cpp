@@ -0,0 +1,107 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+#include <Vc/Memory>
+#include <Vc/vector>
+
+/*
+ * Short-lived scratch buffers: every "request" creates and destroys eight buffers of 64 to
+ * 8192 entries. The buffers are Vc::Memory objects (one vector is written to each) or
+ * vectors (only reserved, to measure the allocation alone), allocated from the heap
+ * (Vc::malloc, Vc::Allocator) or from the Vc::pmr resources. One element is one buffer.
+ */
+
+using namespace Benchmark;
+
+static const std::size_t sizes[8] = {64, 4096, 256, 8192, 1024, 100, 2000, 512};
+
+template <class V> void scratchMemory(Suite &suite)
+{
+    constexpr std::size_t Requests = 256;
+    const auto request = [](Vc::pmr::memory_resource *resource) {
+        for (std::size_t n : sizes) {
+            Vc::Memory<V> tmp = resource ? Vc::Memory<V>(n, resource) : Vc::Memory<V>(n);
+            tmp.vector(0) = V::One();
+            fakeModify(tmp[0]);
+        }
+    };
+
+    suite.run("Memory<V> Vc::malloc", typeName<V>(), Requests * 8, [&]() {
+        for (std::size_t r = 0; r < Requests; ++r) {
+            request(nullptr);
+        }
+    });
+    suite.run("Memory<V> thread_local_pool_resource", typeName<V>(), Requests * 8, [&]() {
+        for (std::size_t r = 0; r < Requests; ++r) {
+            request(Vc::pmr::thread_local_pool_resource());
+        }
+    });
+    alignas(64) static char buffer[128 * 1024];
+    suite.run("Memory<V> monotonic_buffer_resource", typeName<V>(), Requests * 8, [&]() {
+        for (std::size_t r = 0; r < Requests; ++r) {
+            Vc::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer));
+            request(&arena);
+        }
+    });
+}
+
+template <class V> void scratchVectors(Suite &suite)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t Requests = 256;
+    suite.run("vector Vc::Allocator", typeName<V>(), Requests * 8, [&]() {
+        for (std::size_t r = 0; r < Requests; ++r) {
+            for (std::size_t n : sizes) {
+                Vc::vector<T, Vc::Allocator<T>> tmp;
+                tmp.reserve(n);
+                fakeModify(tmp);
+            }
+        }
+    });
+    suite.run("pmr::vector thread_local_pool_resource", typeName<V>(), Requests * 8, [&]() {
+        for (std::size_t r = 0; r < Requests; ++r) {
+            for (std::size_t n : sizes) {
+                Vc::pmr::vector<T> tmp(Vc::pmr::thread_local_pool_resource());
+                tmp.reserve(n);
+                fakeModify(tmp);
+            }
+        }
+    });
+}
+
+// main {{{1
+int main(int argc, char **argv)
+{
+    Suite suite("allocator", argc, argv);
+    scratchMemory<Vc::float_v>(suite);
+    scratchMemory<Vc::double_v>(suite);
+    scratchVectors<Vc::float_v>(suite);
+    return suite.finish();
+}
+
+// vim: foldmethod=marker
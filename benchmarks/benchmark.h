@@ -0,0 +1,269 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_BENCHMARKS_BENCHMARK_H_
+#define VC_BENCHMARKS_BENCHMARK_H_
+
+#include <Vc/Vc>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "../examples/tsc.h"
+
+/*
+ * Minimal harness for the Vc micro-benchmarks.
+ *
+ * Every benchmark executable creates one Benchmark::Suite and calls Suite::run for each
+ * measurement. A measurement is a callable that processes a known number of elements
+ * (scalar values, not vectors) per call. The callable is invoked repeatedly; the fastest
+ * invocation determines the reported cycles per element (via the time stamp counter) and
+ * the throughput in elements per second (via std::chrono::steady_clock).
+ *
+ * Command line options understood by all benchmark executables:
+ *   --json <file>         additionally write the results as JSON to <file>. With "-"
+ *                         the JSON goes to stdout and the table to stderr.
+ *   --repetitions <n>     number of timed invocations per measurement (default: 200)
+ *   --filter <substring>  only run the measurements whose name contains <substring>
+ */
+
+namespace Benchmark
+{
+// keep the compiler from optimizing the benchmarked code away {{{1
+#ifdef _MSC_VER
+template <class T> inline void fakeRead(const T &x)
+{
+    volatile char sink = *reinterpret_cast<const volatile char *>(&x);
+    (void)sink;
+}
+template <class T> inline void fakeModify(T &x) { fakeRead(x); _ReadWriteBarrier(); }
+inline void clobberMemory() { _ReadWriteBarrier(); }
+#else
+template <class T> Vc_ALWAYS_INLINE void fakeRead(const T &x) { asm volatile("" ::"m"(x)); }
+template <class T> Vc_ALWAYS_INLINE void fakeModify(T &x) { asm volatile("" : "+m"(x)); }
+/// Forces all stores issued so far to be considered observable.
+Vc_ALWAYS_INLINE void clobberMemory() { asm volatile("" ::: "memory"); }
+#endif
+
+// implementationName {{{1
+inline const char *implementationName()
+{
+    switch (Vc::CurrentImplementation::current()) {
+    case Vc::ScalarImpl:  return "Scalar";
+    case Vc::SSE2Impl:    return "SSE2";
+    case Vc::SSE3Impl:    return "SSE3";
+    case Vc::SSSE3Impl:   return "SSSE3";
+    case Vc::SSE41Impl:   return "SSE4_1";
+    case Vc::SSE42Impl:   return "SSE4_2";
+    case Vc::AVXImpl:     return "AVX";
+#ifdef Vc_IMPL_AVX512VL
+    case Vc::AVX2Impl:    return "AVX2+AVX512VL";
+#else
+    case Vc::AVX2Impl:    return "AVX2";
+#endif
+    default:              return "unknown";
+    }
+}
+
+// typeName {{{1
+template <class V> struct TypeName;
+#define Vc_BENCHMARK_TYPENAME(V_)                                                        \
+    template <> struct TypeName<Vc::V_> {                                                \
+        static const char *get() { return #V_; }                                         \
+    }
+Vc_BENCHMARK_TYPENAME(double_v);
+Vc_BENCHMARK_TYPENAME(float_v);
+Vc_BENCHMARK_TYPENAME(int_v);
+Vc_BENCHMARK_TYPENAME(uint_v);
+Vc_BENCHMARK_TYPENAME(short_v);
+Vc_BENCHMARK_TYPENAME(ushort_v);
+#undef Vc_BENCHMARK_TYPENAME
+template <class V> const char *typeName() { return TypeName<V>::get(); }
+
+// randomValues {{{1
+/// Returns \p n uniformly distributed values in [min, max).
+template <class T>
+std::vector<T, Vc::Allocator<T>> randomValues(std::size_t n, T min, T max)
+{
+    std::default_random_engine rne;
+    using Dist = typename std::conditional<std::is_floating_point<T>::value,
+                                           std::uniform_real_distribution<T>,
+                                           std::uniform_int_distribution<long long>>::type;
+    Dist dist(min, max - (std::is_floating_point<T>::value ? 0 : 1));
+    std::vector<T, Vc::Allocator<T>> r(n);
+    for (auto &x : r) {
+        x = static_cast<T>(dist(rne));
+    }
+    return r;
+}
+
+// Result {{{1
+struct Result {
+    std::string name;
+    std::string type;
+    std::size_t elements;
+    double cyclesPerElement;
+    double elementsPerSecond;
+};
+
+// Suite {{{1
+class Suite
+{
+public:
+    Suite(const char *suiteName, int argc, char **argv) : m_suite(suiteName)
+    {
+        for (int i = 1; i < argc; ++i) {
+            if (0 == std::strcmp(argv[i], "--json") && i + 1 < argc) {
+                m_jsonFile = argv[++i];
+            } else if (0 == std::strcmp(argv[i], "--repetitions") && i + 1 < argc) {
+                m_repetitions = std::max(1, std::atoi(argv[++i]));
+            } else if (0 == std::strcmp(argv[i], "--filter") && i + 1 < argc) {
+                m_filter = argv[++i];
+            } else {
+                std::cerr << "usage: " << argv[0]
+                          << " [--json <file>] [--repetitions <n>] [--filter <substring>]\n";
+                std::exit(1);
+            }
+        }
+        // keep stdout parseable if the JSON is written there
+        if (m_jsonFile == "-") {
+            m_table = &std::cerr;
+        }
+        *m_table << m_suite << " (" << implementationName() << ")\n"
+                  << std::setw(48) << std::left << "benchmark" << std::setw(10) << "type"
+                  << std::right << std::setw(14) << "cycles/elem" << std::setw(14)
+                  << "Melem/s" << '\n';
+    }
+
+    /**
+     * Measures \p fun, which processes \p elements scalar values per invocation, and
+     * records the result under \p name and \p type.
+     */
+    template <class F>
+    void run(const std::string &name, const std::string &type, std::size_t elements,
+             F &&fun)
+    {
+        if (!m_filter.empty() && name.find(m_filter) == std::string::npos) {
+            return;
+        }
+        using Clock = std::chrono::steady_clock;
+        fun();  // warm up caches and branch predictors
+        TimeStampCounter tsc;
+        double bestCycles = std::numeric_limits<double>::max();
+        double bestSeconds = std::numeric_limits<double>::max();
+        for (int rep = 0; rep < m_repetitions; ++rep) {
+            const auto t0 = Clock::now();
+            tsc.start();
+            fun();
+            tsc.stop();
+            const auto t1 = Clock::now();
+            bestCycles = std::min(bestCycles, double(tsc.cycles()));
+            bestSeconds =
+                std::min(bestSeconds, std::chrono::duration<double>(t1 - t0).count());
+        }
+        const Result r = {name, type, elements, bestCycles / elements,
+                          bestSeconds > 0 ? elements / bestSeconds : 0.};
+        *m_table << std::setw(48) << std::left << r.name << std::setw(10) << r.type
+                  << std::right << std::fixed << std::setprecision(3) << std::setw(14)
+                  << r.cyclesPerElement << std::setprecision(1) << std::setw(14)
+                  << r.elementsPerSecond * 1e-6 << std::endl;
+        m_results.push_back(r);
+    }
+
+    /// Writes the JSON file, if requested. Returns the exit code for main.
+    int finish() const
+    {
+        if (m_jsonFile.empty()) {
+            return 0;
+        }
+        if (m_jsonFile == "-") {
+            writeJson(std::cout);
+            return 0;
+        }
+        std::ofstream file(m_jsonFile);
+        if (!file) {
+            std::cerr << "cannot open " << m_jsonFile << " for writing\n";
+            return 1;
+        }
+        writeJson(file);
+        return file ? 0 : 1;
+    }
+
+private:
+    static std::string escaped(const std::string &s)
+    {
+        std::string r;
+        for (char c : s) {
+            if (c == '"' || c == '\\') {
+                r += '\\';
+            }
+            r += c;
+        }
+        return r;
+    }
+
+    void writeJson(std::ostream &out) const
+    {
+        out << "{\n  \"suite\": \"" << escaped(m_suite) << "\",\n"
+            << "  \"implementation\": \"" << implementationName() << "\",\n"
+#ifdef __VERSION__
+            << "  \"compiler\": \"" << escaped(__VERSION__) << "\",\n"
+#endif
+            << "  \"repetitions\": " << m_repetitions << ",\n"
+            << "  \"results\": [";
+        out << std::setprecision(std::numeric_limits<double>::max_digits10);
+        const char *sep = "\n";
+        for (const auto &r : m_results) {
+            out << sep << "    {\"name\": \"" << escaped(r.name) << "\", \"type\": \""
+                << escaped(r.type) << "\", \"elements\": " << r.elements
+                << ", \"cycles_per_element\": " << r.cyclesPerElement
+                << ", \"elements_per_second\": " << r.elementsPerSecond << '}';
+            sep = ",\n";
+        }
+        out << "\n  ]\n}\n";
+    }
+
+    std::string m_suite;
+    std::string m_jsonFile;
+    std::string m_filter;
+    std::ostream *m_table = &std::cout;  // the human-readable results
+    int m_repetitions = 200;
+    std::vector<Result> m_results;
+};
+//}}}1
+}  // namespace Benchmark
+
+#endif  // VC_BENCHMARKS_BENCHMARK_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,214 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+
+/*
+ * Measures gathers and scatters with random indexes into a table that fits into the L1
+ * cache and into one that does not. Besides the default implementation, the masked
+ * variants are measured once per strategy in Vc/common/gatherimplementation.h and
+ * Vc/common/scatterimplementation.h (see also examples/gather_strategies). The Scalar
+ * implementation has no such strategies.
+ */
+
+using namespace Benchmark;
+
+static constexpr std::size_t Gathers = 4096;
+
+template <class V> using MaskVector =
+    std::vector<typename V::mask_type, Vc::Allocator<typename V::mask_type>>;
+template <class V> using IndexVector =
+    std::vector<typename V::IndexType, Vc::Allocator<typename V::IndexType>>;
+
+#ifndef Vc_IMPL_Scalar
+using namespace Vc::Common;
+
+// whether a strategy can handle the given types {{{1
+template <class S, class V, class IT> struct Applicable : public std::true_type {
+};
+template <class V, class IT>
+struct Applicable<SetIndexZeroT, V, IT>
+    : public std::integral_constant<bool, Vc::Traits::is_simd_vector<IT>::value> {
+};
+template <class V, class IT>
+struct Applicable<HardwareGatherT, V, IT>
+#ifdef Vc_IMPL_AVX2
+    : public Vc::Detail::is_hardware_gatherable<V, typename V::EntryType, IT> {
+#else
+    : public std::false_type {
+#endif
+};
+
+// masked gather/scatter per strategy {{{1
+template <class S, class V>
+void maskedGather(std::false_type, Suite &, const std::string &, typename V::EntryType *,
+                  const IndexVector<V> &, const MaskVector<V> &)
+{
+}
+
+template <class S, class V>
+void maskedGather(std::true_type, Suite &suite, const std::string &name,
+                  typename V::EntryType *mem, const IndexVector<V> &indexes,
+                  const MaskVector<V> &masks)
+{
+    suite.run(name, typeName<V>(), Gathers * V::Size, [&]() {
+        V sum = V::Zero();
+        for (std::size_t i = 0; i < Gathers; ++i) {
+            V v = V::Zero();
+            executeGather(S(), v, mem, indexes[i], masks[i]);
+            sum += v;
+        }
+        fakeRead(sum);
+    });
+}
+
+template <class S, class V>
+void maskedScatter(Suite &suite, const std::string &name, typename V::EntryType *mem,
+                   const IndexVector<V> &indexes, const MaskVector<V> &masks)
+{
+    suite.run(name, typeName<V>(), Gathers * V::Size, [&]() {
+        V v = V::IndexesFromZero();
+        fakeModify(v);
+        for (std::size_t i = 0; i < Gathers; ++i) {
+            executeScatter(S(), v, mem, indexes[i], masks[i]);
+        }
+        clobberMemory();
+    });
+}
+
+template <class V>
+void strategies(Suite &suite, const std::string &suffix, typename V::EntryType *mem,
+                const IndexVector<V> &indexes, const MaskVector<V> &masks)
+{
+    using IT = typename V::IndexType;
+    maskedGather<SimpleLoopT, V>(Applicable<SimpleLoopT, V, IT>(), suite,
+                                 "masked gather SimpleLoop" + suffix, mem, indexes, masks);
+    maskedGather<SetIndexZeroT, V>(Applicable<SetIndexZeroT, V, IT>(), suite,
+                                   "masked gather SetIndexZero" + suffix, mem, indexes,
+                                   masks);
+    maskedGather<BitScanLoopT, V>(Applicable<BitScanLoopT, V, IT>(), suite,
+                                  "masked gather BitScanLoop" + suffix, mem, indexes, masks);
+    maskedGather<PopcntSwitchT, V>(Applicable<PopcntSwitchT, V, IT>(), suite,
+                                   "masked gather PopcntSwitch" + suffix, mem, indexes,
+                                   masks);
+    maskedGather<HardwareGatherT, V>(Applicable<HardwareGatherT, V, IT>(), suite,
+                                     "masked gather HardwareGather" + suffix, mem, indexes,
+                                     masks);
+    maskedScatter<SimpleLoopT, V>(suite, "masked scatter SimpleLoop" + suffix, mem, indexes,
+                                  masks);
+    maskedScatter<BitScanLoopT, V>(suite, "masked scatter BitScanLoop" + suffix, mem,
+                                   indexes, masks);
+    maskedScatter<PopcntSwitchT, V>(suite, "masked scatter PopcntSwitch" + suffix, mem,
+                                    indexes, masks);
+}
+#else
+template <class V>
+void strategies(Suite &, const std::string &, typename V::EntryType *,
+                const IndexVector<V> &, const MaskVector<V> &)
+{
+}
+#endif  // Vc_IMPL_Scalar
+
+// benchmark {{{1
+template <class V> void benchmark(Suite &suite)
+{
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    // 16 KiB stays in the L1 cache, 256 MiB exceeds the last level cache
+    for (std::size_t tableSize : {16 * 1024 / sizeof(T), 256 * 1024 * 1024 / sizeof(T)}) {
+        const std::string where = tableSize * sizeof(T) <= 16 * 1024 ? " (L1)" : " (memory)";
+        auto table = randomValues<T>(tableSize, T(0), T(100));
+        std::default_random_engine rne;
+        std::uniform_int_distribution<int> dist(0, int(tableSize - 1));
+        IndexVector<V> indexes;
+        indexes.reserve(Gathers);
+        for (std::size_t i = 0; i < Gathers; ++i) {
+            indexes.push_back(IT([&](int) { return dist(rne); }));
+        }
+
+        suite.run("gather" + where, typeName<V>(), Gathers * V::Size, [&]() {
+            V sum = V::Zero();
+            for (std::size_t i = 0; i < Gathers; ++i) {
+                sum += V(table.data(), indexes[i]);
+            }
+            fakeRead(sum);
+        });
+        suite.run("scatter" + where, typeName<V>(), Gathers * V::Size, [&]() {
+            V v = V::IndexesFromZero();
+            fakeModify(v);
+            for (std::size_t i = 0; i < Gathers; ++i) {
+                v.scatter(table.data(), indexes[i]);
+            }
+            clobberMemory();
+        });
+
+        for (double density : {1., .5}) {
+            std::bernoulli_distribution active(density);
+            MaskVector<V> masks;
+            masks.reserve(Gathers);
+            for (std::size_t i = 0; i < Gathers; ++i) {
+                std::array<bool, V::Size> k;
+                for (auto &b : k) {
+                    b = active(rne);
+                }
+                masks.emplace_back(k.data());
+            }
+            const std::string suffix =
+                where.substr(0, where.size() - 1) + (density < 1 ? ", 50%)" : ", 100%)");
+            suite.run("masked gather" + suffix, typeName<V>(), Gathers * V::Size, [&]() {
+                V sum = V::Zero();
+                for (std::size_t i = 0; i < Gathers; ++i) {
+                    V v = V::Zero();
+                    v.gather(table.data(), indexes[i], masks[i]);
+                    sum += v;
+                }
+                fakeRead(sum);
+            });
+            suite.run("masked scatter" + suffix, typeName<V>(), Gathers * V::Size, [&]() {
+                V v = V::IndexesFromZero();
+                fakeModify(v);
+                for (std::size_t i = 0; i < Gathers; ++i) {
+                    v.scatter(table.data(), indexes[i], masks[i]);
+                }
+                clobberMemory();
+            });
+            strategies<V>(suite, suffix, table.data(), indexes, masks);
+        }
+    }
+}
+
+// main {{{1
+int Vc_CDECL main(int argc, char **argv)
+{
+    Suite suite("gatherscatter", argc, argv);
+    benchmark<Vc::float_v>(suite);
+    benchmark<Vc::double_v>(suite);
+    benchmark<Vc::int_v>(suite);
+    return suite.finish();
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,169 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+#include <Vc/Memory>
+#include <Vc/Allocator>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/*
+ * Random gathers from a 256 MiB table, which is far larger than the reach of the TLB with
+ * 4 KiB pages (a few MiB) but fits into the reach with 2 MiB pages. The table is allocated
+ * with normal pages (transparent huge pages explicitly disabled), with Vc::AlignOnHugePage
+ * and with Vc::HugePageAllocator. One element is one gathered value.
+ *
+ * On Linux the data TLB misses per gathered value are printed in addition, if the
+ * performance counters are accessible (see /proc/sys/kernel/perf_event_paranoid).
+ */
+
+using namespace Benchmark;
+
+// DtlbMisses {{{1
+class DtlbMisses
+{
+public:
+    DtlbMisses()
+    {
+#ifdef __linux__
+        perf_event_attr attr = {};
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        m_fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+    }
+    ~DtlbMisses()
+    {
+#ifdef __linux__
+        if (m_fd >= 0) {
+            close(m_fd);
+        }
+#endif
+    }
+
+    /// Returns the number of misses during a call to \p fun, or -1 if not available.
+    template <class F> long long count(F &&fun)
+    {
+#ifdef __linux__
+        if (m_fd >= 0) {
+            ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+            fun();
+            ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+            long long n = 0;
+            if (read(m_fd, &n, sizeof(n)) == sizeof(n)) {
+                return n;
+            }
+        }
+#endif
+        fun();
+        return -1;
+    }
+
+private:
+    int m_fd = -1;
+};
+
+// randomGathers {{{1
+template <class V>
+void randomGathers(Suite &suite, const std::string &name, const typename V::EntryType *table,
+                   std::size_t tableSize)
+{
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType::EntryType;
+    constexpr std::size_t N = 1 << 20;
+    static const auto indexes = randomValues<IT>(N, IT(0), IT(tableSize));
+
+    auto fun = [&]() {
+        const T *t = table;
+        fakeModify(t);
+        V acc = V::Zero();
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            acc += V(t, typename V::IndexType(&indexes[i], Vc::Aligned));
+        }
+        fakeRead(acc);
+    };
+    suite.run("random gather " + name, typeName<V>(), N, fun);
+
+    static DtlbMisses tlb;
+    const long long misses = tlb.count(fun);
+    if (misses >= 0) {
+        std::cout << std::setw(48) << std::left << ("  dTLB misses/elem " + name)
+                  << std::setw(10) << typeName<V>() << std::right << std::fixed
+                  << std::setprecision(3) << std::setw(14) << double(misses) / N
+                  << std::endl;
+    }
+}
+
+template <class V> void tables(Suite &suite)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t bytes = 256 << 20;
+    constexpr std::size_t n = bytes / sizeof(T);
+    {
+        Vc::Memory<V> table(n, Vc::AlignOnPage);
+#if defined __linux__ && defined MADV_NOHUGEPAGE
+        madvise(table.entries(), bytes, MADV_NOHUGEPAGE);
+#endif
+        std::fill_n(table.entries(), n, T(1));
+        randomGathers<V>(suite, "4K pages", table.entries(), n);
+    }
+    {
+        Vc::Memory<V> table(n, Vc::AlignOnHugePage);
+        std::fill_n(table.entries(), n, T(1));
+        randomGathers<V>(suite, "AlignOnHugePage", table.entries(), n);
+    }
+    {
+        std::vector<T, Vc::HugePageAllocator<T>> table(n, T(1));
+        randomGathers<V>(suite, "HugePageAllocator 2M", table.data(), n);
+    }
+    {
+        std::vector<T, Vc::HugePageAllocator<T, 1 << 30>> table(n, T(1));
+        randomGathers<V>(suite, "HugePageAllocator 1G", table.data(), n);
+    }
+}
+
+// main {{{1
+int main(int argc, char **argv)
+{
+    Suite suite("hugepages", argc, argv);
+    tables<Vc::float_v>(suite);
+    tables<Vc::double_v>(suite);
+    return suite.finish();
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,298 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+
+using namespace Benchmark;
+
+// loads {{{1
+template <class V, class M, class Flags>
+void benchmarkLoad(Suite &suite, const std::string &name, const M *mem, std::size_t n,
+                   Flags flags)
+{
+    suite.run(name, typeName<V>(), n, [&]() {
+        const M *p = mem;
+        fakeModify(p);
+        // independent accumulators, so that the add latency does not dominate
+        V a = V::Zero(), b = V::Zero(), c = V::Zero(), d = V::Zero();
+        for (std::size_t i = 0; i < n; i += 4 * V::Size) {
+            a += V(p + i, flags);
+            b += V(p + i + V::Size, flags);
+            c += V(p + i + 2 * V::Size, flags);
+            d += V(p + i + 3 * V::Size, flags);
+        }
+        a += b + c + d;
+        fakeRead(a);
+    });
+}
+
+// stores {{{1
+template <class V, class M, class Flags>
+void benchmarkStore(Suite &suite, const std::string &name, M *mem, std::size_t n,
+                    Flags flags)
+{
+    suite.run(name, typeName<V>(), n, [&]() {
+        M *p = mem;
+        fakeModify(p);
+        V v = V::IndexesFromZero();
+        fakeModify(v);
+        for (std::size_t i = 0; i < n; i += V::Size) {
+            v.store(p + i, flags);
+        }
+        clobberMemory();
+    });
+}
+
+// deinterleave / interleave {{{1
+template <class V> struct XYZ {
+    typename V::EntryType x, y, z;
+};
+
+template <class V, std::size_t... Ks>
+void benchmarkNWay(Suite &suite, std::size_t n, Vc::index_sequence<Ks...>)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t N = sizeof...(Ks);
+    const std::string ways = std::to_string(N);
+    std::vector<T> data(N * n);
+    suite.run("deinterleave " + ways + "-way", typeName<V>(), N * n, [&]() {
+        const T *p = data.data();
+        fakeModify(p);
+        V sum = V::Zero();
+        for (std::size_t i = 0; i + V::Size <= n; i += V::Size) {
+            V v[N];
+            Vc::deinterleave(p + N * i, v[Ks]...);
+            auto &&unused = {(sum += v[Ks], 0)...};
+            if (&unused == &unused) {}
+        }
+        fakeRead(sum);
+    });
+    suite.run("interleave " + ways + "-way", typeName<V>(), N * n, [&]() {
+        V x = V::IndexesFromZero();
+        fakeModify(x);
+        for (std::size_t i = 0; i + V::Size <= n; i += V::Size) {
+            Vc::interleave(data.data() + N * i, (void(Ks), x)...);
+        }
+        clobberMemory();
+    });
+    if (std::is_same<T, float>::value) {
+        std::vector<unsigned char> bytes(N * n);
+        suite.run("deinterleave " + ways + "-way from uchar", typeName<V>(), N * n, [&]() {
+            const unsigned char *p = bytes.data();
+            fakeModify(p);
+            V sum = V::Zero();
+            for (std::size_t i = 0; i + V::Size <= n; i += V::Size) {
+                V v[N];
+                Vc::deinterleave(p + N * i, v[Ks]...);
+                auto &&unused = {(sum += v[Ks], 0)...};
+                if (&unused == &unused) {}
+            }
+            fakeRead(sum);
+        });
+    }
+}
+
+template <class V> void benchmarkInterleaved(Suite &suite, std::size_t n)
+{
+    using T = typename V::EntryType;
+    std::vector<XYZ<V>> data(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        data[i] = {T(i), T(i + 1), T(i + 2)};
+    }
+    suite.run("deinterleave 3", typeName<V>(), 3 * n, [&]() {
+        Vc::InterleavedMemoryWrapper<XYZ<V>, V> wrapper(data.data());
+        V sum = V::Zero();
+        for (std::size_t i = 0; i + V::Size <= n; i += V::Size) {
+            V x, y, z;
+            Vc::tie(x, y, z) = wrapper[i];
+            sum += x * y + z;
+        }
+        fakeRead(sum);
+    });
+    suite.run("interleave 3", typeName<V>(), 3 * n, [&]() {
+        Vc::InterleavedMemoryWrapper<XYZ<V>, V> wrapper(data.data());
+        V x = V::IndexesFromZero();
+        fakeModify(x);
+        for (std::size_t i = 0; i + V::Size <= n; i += V::Size) {
+            wrapper[i] = Vc::tie(x, x, x);
+        }
+        clobberMemory();
+    });
+    std::vector<T, Vc::Allocator<T>> pairs(2 * n);
+    suite.run("deinterleave 2", typeName<V>(), 2 * n, [&]() {
+        const T *p = pairs.data();
+        fakeModify(p);
+        V sum = V::Zero();
+        for (std::size_t i = 0; i + 2 * V::Size <= 2 * n; i += 2 * V::Size) {
+            V a, b;
+            Vc::deinterleave(&a, &b, p + i, Vc::Aligned);
+            sum += a * b;
+        }
+        fakeRead(sum);
+    });
+    benchmarkNWay<V>(suite, n, Vc::make_index_sequence<3>());
+    benchmarkNWay<V>(suite, n, Vc::make_index_sequence<4>());
+    benchmarkNWay<V>(suite, n, Vc::make_index_sequence<8>());
+}
+
+// transform {{{1
+struct Twice {
+    template <typename V> Vc_INTRINSIC V operator()(const V &x) const { return x + x; }
+};
+
+/* simd_transform writes with regular stores, simd_transform_streaming switches to
+ * non-temporal stores once the output exceeds streaming_store_threshold(). One element is
+ * one read plus one write of T.
+ */
+template <class V>
+void benchmarkTransform(Suite &suite, std::size_t n, const std::string &where)
+{
+    using T = typename V::EntryType;
+    std::vector<T, Vc::Allocator<T>> in(n, T(1)), out(n);
+    suite.run("simd_transform" + where, typeName<V>(), n, [&]() {
+        const T *p = in.data();
+        fakeModify(p);
+        Vc::simd_transform(p, p + n, out.data(), Twice());
+        clobberMemory();
+    });
+    suite.run("simd_transform_streaming" + where, typeName<V>(), n, [&]() {
+        const T *p = in.data();
+        fakeModify(p);
+        Vc::simd_transform_streaming(p, p + n, out.data(), Twice());
+        clobberMemory();
+    });
+    // the caches of the machine may exceed the memory size used here
+    const std::size_t threshold = Vc::streaming_store_threshold();
+    Vc::set_streaming_store_threshold(0);
+    suite.run("simd_transform_streaming forced" + where, typeName<V>(), n, [&]() {
+        const T *p = in.data();
+        fakeModify(p);
+        Vc::simd_transform_streaming(p, p + n, out.data(), Twice());
+        clobberMemory();
+    });
+    Vc::set_streaming_store_threshold(threshold);
+}
+
+// prefetching Memory loops {{{1
+template <class V> struct Accumulate {
+    V *sum;
+    Vc_INTRINSIC void operator()(const V &x) const { *sum += x; }
+    // the Memory size is a multiple of V::Size, thus there is no scalar tail
+    template <class V1> Vc_INTRINSIC void operator()(const V1 &) const {}
+};
+
+template <class V, class Flags>
+void benchmarkSumRange(Suite &suite, const std::string &name, const Vc::Memory<V> &mem,
+                       Flags flags)
+{
+    suite.run(name, typeName<V>(), mem.entriesCount(), [&]() {
+        V sum = V::Zero();
+        for (V x : mem.range(0, mem.vectorsCount() - 1, flags)) {
+            sum += x;
+        }
+        fakeRead(sum);
+    });
+}
+
+/* Sums a Memory that does not fit into the caches, once without software prefetches,
+ * with the fixed Prefetch<> distances, with Prefetch<Auto>, and with the software
+ * pipelined simd_for_each(Memory), which prefetches once per cache line instead of once
+ * per vector.
+ */
+template <class V> void benchmarkPrefetch(Suite &suite, std::size_t n)
+{
+    Vc::Memory<V> mem(n);
+    mem.setZero();
+    benchmarkSumRange(suite, "sum Memory", mem, Vc::Aligned);
+    benchmarkSumRange(suite, "sum Memory Prefetch<>", mem, Vc::Prefetch<>());
+    benchmarkSumRange(suite, "sum Memory Prefetch<Auto>", mem, Vc::Prefetch<Vc::Auto>());
+    suite.run("sum Memory simd_for_each", typeName<V>(), n, [&]() {
+        V sum = V::Zero();
+        Vc::simd_for_each(mem, Accumulate<V>{&sum});
+        fakeRead(sum);
+    });
+}
+
+// benchmark {{{1
+template <class V> void benchmark(Suite &suite)
+{
+    using T = typename V::EntryType;
+    // 16 KiB per buffer stays in the L1 cache, 64 MiB exceeds the last level cache
+    const std::size_t l1 = 16 * 1024 / sizeof(T);
+    const std::size_t mem = 64 * 1024 * 1024 / sizeof(T);
+    for (std::size_t n : {l1, mem}) {
+        const std::string where = n == l1 ? " (L1)" : " (memory)";
+        std::vector<T, Vc::Allocator<T>> buffer(n + V::Size);
+        benchmarkLoad<V>(suite, "load aligned" + where, buffer.data(), n, Vc::Aligned);
+        benchmarkLoad<V>(suite, "load unaligned" + where, buffer.data() + 1, n,
+                         Vc::Unaligned);
+        benchmarkLoad<V>(suite, "load streaming" + where, buffer.data(), n,
+                         Vc::Streaming);
+        benchmarkStore<V>(suite, "store aligned" + where, buffer.data(), n, Vc::Aligned);
+        benchmarkStore<V>(suite, "store unaligned" + where, buffer.data() + 1, n,
+                          Vc::Unaligned);
+        benchmarkStore<V>(suite, "store streaming" + where, buffer.data(), n,
+                          Vc::Streaming);
+        benchmarkTransform<V>(suite, n, where);
+    }
+    benchmarkInterleaved<V>(suite, 1024);
+    benchmarkPrefetch<V>(suite, mem);
+}
+
+// half-precision storage {{{1
+// float_v loads/stores from/to float16 and bfloat16 memory move half the bytes of the
+// float variants above, which matters once the data does not fit into the caches.
+template <class H> void benchmarkHalf(Suite &suite, const std::string &type)
+{
+    using V = Vc::float_v;
+    const std::size_t l1 = 16 * 1024 / sizeof(float);
+    const std::size_t mem = 64 * 1024 * 1024 / sizeof(float);
+    for (std::size_t n : {l1, mem}) {
+        const std::string where = n == l1 ? " (L1)" : " (memory)";
+        std::vector<H, Vc::Allocator<H>> buffer(n + V::Size, H(1.f));
+        benchmarkLoad<V>(suite, "load " + type + where, buffer.data(), n, Vc::Aligned);
+        benchmarkStore<V>(suite, "store " + type + where, buffer.data(), n, Vc::Aligned);
+    }
+}
+
+// main {{{1
+int Vc_CDECL main(int argc, char **argv)
+{
+    Suite suite("loadstore", argc, argv);
+    const Vc::PrefetchDistances d = Vc::calibrate_prefetch_distances();
+    std::cout << "calibrated prefetch distances: L1 " << d.l1 << " Bytes, L2 " << d.l2
+              << " Bytes\n";
+    benchmark<Vc::float_v>(suite);
+    benchmarkHalf<Vc::float16>(suite, "float16");
+    benchmarkHalf<Vc::bfloat16>(suite, "bfloat16");
+    benchmark<Vc::double_v>(suite);
+    benchmark<Vc::int_v>(suite);
+    benchmark<Vc::short_v>(suite);
+    return suite.finish();
+}
+
+// vim: foldmethod=marker
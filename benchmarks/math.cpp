@@ -0,0 +1,134 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+
+/*
+ * Measures the throughput of the math functions on L1-resident input. Each input lies in
+ * a range where the function takes its main code path.
+ */
+
+using namespace Benchmark;
+
+static constexpr std::size_t N = 4096;
+
+// unary/binary {{{1
+template <class V, class F>
+void unary(Suite &suite, const char *name, typename V::EntryType min,
+           typename V::EntryType max, F &&f)
+{
+    using T = typename V::EntryType;
+    const auto in = randomValues<T>(N, min, max);
+    std::vector<T, Vc::Allocator<T>> out(N);
+    suite.run(name, typeName<V>(), N, [&]() {
+        const T *p = in.data();
+        fakeModify(p);
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            f(V(p + i, Vc::Aligned)).store(&out[i], Vc::Aligned);
+        }
+        clobberMemory();
+    });
+}
+
+template <class V, class F>
+void binary(Suite &suite, const char *name, typename V::EntryType min,
+            typename V::EntryType max, F &&f)
+{
+    using T = typename V::EntryType;
+    const auto in0 = randomValues<T>(N, min, max);
+    const auto in1 = randomValues<T>(N, min, max);
+    std::vector<T, Vc::Allocator<T>> out(N);
+    suite.run(name, typeName<V>(), N, [&]() {
+        const T *p = in0.data();
+        const T *q = in1.data();
+        fakeModify(p);
+        fakeModify(q);
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            f(V(p + i, Vc::Aligned), V(q + i, Vc::Aligned)).store(&out[i], Vc::Aligned);
+        }
+        clobberMemory();
+    });
+}
+
+// benchmark {{{1
+template <class V> V sincosSum(const V &x)
+{
+    V s, c;
+    Vc::sincos(x, &s, &c);
+    return s + c;
+}
+
+#define Vc_UNARY(name_, min_, max_, expr_)                                               \
+    unary<V>(suite, name_, T(min_), T(max_), [](const V &x) { return expr_; })
+#define Vc_BINARY(name_, min_, max_, expr_)                                              \
+    binary<V>(suite, name_, T(min_), T(max_), [](const V &x, const V &y) { return expr_; })
+
+template <class V> void benchmark(Suite &suite)
+{
+    using T = typename V::EntryType;
+    Vc_UNARY("sqrt", 0, 1000, Vc::sqrt(x));
+    Vc_UNARY("rsqrt", 0.001, 1000, Vc::rsqrt(x));
+    Vc_UNARY("reciprocal", 0.001, 1000, Vc::reciprocal(x));
+    Vc_UNARY("exp", -80, 80, Vc::exp(x));
+    Vc_UNARY("exp fast_math", -80, 80, Vc::exp(x, Vc::fast_math));
+    Vc_UNARY("expm1", -10, 10, Vc::expm1(x));
+    Vc_UNARY("log", 0.001, 1000, Vc::log(x));
+    Vc_UNARY("log fast_math", 0.001, 1000, Vc::log(x, Vc::fast_math));
+    Vc_UNARY("log2", 0.001, 1000, Vc::log2(x));
+    Vc_UNARY("log10", 0.001, 1000, Vc::log10(x));
+    Vc_UNARY("log1p", -0.5, 1000, Vc::log1p(x));
+    Vc_UNARY("sin", -100, 100, Vc::sin(x));
+    Vc_UNARY("sin fast_math", -100, 100, Vc::sin(x, Vc::fast_math));
+    Vc_UNARY("cos", -100, 100, Vc::cos(x));
+    Vc_UNARY("cos fast_math", -100, 100, Vc::cos(x, Vc::fast_math));
+    Vc_UNARY("sincos", -100, 100, sincosSum(x));
+    Vc_UNARY("asin", -1, 1, Vc::asin(x));
+    Vc_UNARY("atan", -100, 100, Vc::atan(x));
+    Vc_BINARY("atan2", -100, 100, Vc::atan2(x, y));
+    Vc_BINARY("atan2 fast_math", -100, 100, Vc::atan2(x, y, Vc::fast_math));
+    Vc_UNARY("sinh", -10, 10, Vc::sinh(x));
+    Vc_UNARY("cosh", -10, 10, Vc::cosh(x));
+    Vc_UNARY("tanh", -10, 10, Vc::tanh(x));
+    Vc_UNARY("erf", -4, 4, Vc::erf(x));
+    Vc_UNARY("erfc", -4, 4, Vc::erfc(x));
+    Vc_UNARY("cbrt", -1000, 1000, Vc::cbrt(x));
+    Vc_BINARY("hypot", -1000, 1000, Vc::hypot(x, y));
+    Vc_BINARY("pow", 0.001, 10, Vc::pow(x, y));
+}
+#undef Vc_UNARY
+#undef Vc_BINARY
+
+// main {{{1
+int Vc_CDECL main(int argc, char **argv)
+{
+    Suite suite("math", argc, argv);
+    benchmark<Vc::float_v>(suite);
+    benchmark<Vc::double_v>(suite);
+    return suite.finish();
+}
+
+// vim: foldmethod=marker
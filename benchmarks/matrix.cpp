@@ -0,0 +1,124 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+#include <Vc/matrix>
+
+/*
+ * Compares Vc::gemm and Vc::SmallMatrix against the naive triple loop of
+ * examples/matrix (scalar_mul). One element is one multiply-add, i.e. the benchmark
+ * processes N * N * N elements per multiplication of two N x N matrices.
+ */
+
+using namespace Benchmark;
+
+// naive {{{1
+template <typename T>
+void naiveMultiply(std::size_t n, const T *a, const T *b, T *c)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            T sum = a[i * n] * b[j];
+            for (std::size_t k = 1; k < n; ++k) {
+                sum += a[i * n + k] * b[k * n + j];
+            }
+            c[i * n + j] = sum;
+        }
+    }
+}
+
+// gemm {{{1
+template <class V> void gemm(Suite &suite, std::size_t n)
+{
+    using T = typename V::EntryType;
+    const auto a = randomValues<T>(n * n, T(-1), T(1));
+    const auto b = randomValues<T>(n * n, T(-1), T(1));
+    std::vector<T, Vc::Allocator<T>> c(n * n);
+    const std::string size = std::to_string(n) + 'x' + std::to_string(n);
+    suite.run("naive " + size, typeName<V>(), n * n * n, [&]() {
+        const T *pa = a.data();
+        fakeModify(pa);
+        naiveMultiply(n, pa, b.data(), c.data());
+        clobberMemory();
+    });
+    suite.run("gemm " + size, typeName<V>(), n * n * n, [&]() {
+        const T *pa = a.data();
+        fakeModify(pa);
+        Vc::gemm(n, n, n, T(1), pa, n, b.data(), n, T(0), c.data(), n);
+        clobberMemory();
+    });
+}
+
+// SmallMatrix {{{1
+template <class V, std::size_t N> void smallMatrix(Suite &suite)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t Count = 64;  // independent multiplications per invocation
+    const auto a = randomValues<T>(Count * N * N, T(-1), T(1));
+    const auto b = randomValues<T>(N * N, T(-1), T(1));
+    std::vector<T, Vc::Allocator<T>> c(Count * N * N);
+    const std::string size = std::to_string(N) + 'x' + std::to_string(N);
+    suite.run("naive " + size, typeName<V>(), Count * N * N * N, [&]() {
+        const T *pa = a.data();
+        fakeModify(pa);
+        for (std::size_t i = 0; i < Count; ++i) {
+            naiveMultiply(N, pa + i * N * N, b.data(), c.data() + i * N * N);
+        }
+        clobberMemory();
+    });
+    const Vc::SmallMatrix<T, N> mb(b.data());
+    suite.run("SmallMatrix " + size, typeName<V>(), Count * N * N * N, [&]() {
+        const T *pa = a.data();
+        fakeModify(pa);
+        for (std::size_t i = 0; i < Count; ++i) {
+            (Vc::SmallMatrix<T, N>(pa + i * N * N) * mb).store(c.data() + i * N * N);
+        }
+        clobberMemory();
+    });
+}
+
+// benchmark {{{1
+template <class V> void benchmark(Suite &suite)
+{
+    smallMatrix<V, 4>(suite);
+    smallMatrix<V, 8>(suite);
+    smallMatrix<V, 16>(suite);
+    for (std::size_t n : {32, 128, 256}) {
+        gemm<V>(suite, n);
+    }
+}
+
+// main {{{1
+int Vc_CDECL main(int argc, char **argv)
+{
+    Suite suite("matrix", argc, argv);
+    benchmark<Vc::float_v>(suite);
+    benchmark<Vc::double_v>(suite);
+    return suite.finish();
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,102 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+#include <numeric>
+
+/*
+ * Measures the horizontal reductions of a single vector and the reductions over
+ * L1-resident ranges.
+ */
+
+using namespace Benchmark;
+
+static constexpr std::size_t N = 4096;
+
+// horizontal {{{1
+template <class V, class F> void horizontal(Suite &suite, const char *name, F &&f)
+{
+    using T = typename V::EntryType;
+    const auto in = randomValues<T>(N, T(1), T(2));
+    std::vector<T, Vc::Allocator<T>> out(N / V::Size);
+    suite.run(name, typeName<V>(), N, [&]() {
+        const T *p = in.data();
+        fakeModify(p);
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            out[i / V::Size] = f(V(p + i, Vc::Aligned));
+        }
+        clobberMemory();
+    });
+}
+
+// benchmark {{{1
+template <class V> void benchmark(Suite &suite)
+{
+    using T = typename V::EntryType;
+    horizontal<V>(suite, "sum()", [](const V &x) { return x.sum(); });
+    horizontal<V>(suite, "product()", [](const V &x) { return x.product(); });
+    horizontal<V>(suite, "min()", [](const V &x) { return x.min(); });
+    horizontal<V>(suite, "max()", [](const V &x) { return x.max(); });
+    // the last lane depends on every input lane; the explicit return type copies the
+    // value out of the temporary
+    horizontal<V>(suite, "partialSum()",
+                  [](const V &x) -> T { return x.partialSum()[V::Size - 1]; });
+    horizontal<V>(suite, "sum(mask)",
+                  [](const V &x) { return x.sum(x > T(1.5)); });
+
+    const auto in = randomValues<T>(N, T(1), T(2));
+    T result = 0;
+    suite.run("std::accumulate", typeName<V>(), N, [&]() {
+        result = std::accumulate(in.begin(), in.end(), T());
+        fakeModify(result);
+    });
+    suite.run("simd_reduce plus", typeName<V>(), N, [&]() {
+        result = Vc::simd_reduce(in.begin(), in.end(), T());
+        fakeModify(result);
+    });
+    suite.run("simd_reduce maximum", typeName<V>(), N, [&]() {
+        result = Vc::simd_reduce(in.begin(), in.end(), in[0], Vc::maximum());
+        fakeModify(result);
+    });
+    suite.run("simd_transform_reduce dot", typeName<V>(), N, [&]() {
+        result = Vc::simd_transform_reduce(in.begin(), in.end(), in.begin(), T());
+        fakeModify(result);
+    });
+}
+
+// main {{{1
+int Vc_CDECL main(int argc, char **argv)
+{
+    Suite suite("reduction", argc, argv);
+    benchmark<Vc::float_v>(suite);
+    benchmark<Vc::double_v>(suite);
+    benchmark<Vc::int_v>(suite);
+    benchmark<Vc::short_v>(suite);
+    return suite.finish();
+}
+
+// vim: foldmethod=marker
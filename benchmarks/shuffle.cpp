@@ -0,0 +1,189 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+
+/*
+ * Measures the operations that permute or convert the entries of vectors: sorted(),
+ * rotated(), reversed(), simd_cast between entry types, simd_sort on an L1-resident
+ * range compared to std::sort, and stream compaction with compress_store compared to a
+ * scalar loop and to iterating where(mask).
+ */
+
+using namespace Benchmark;
+
+static constexpr std::size_t N = 4096;
+
+// permute {{{1
+template <class V, class F> void permute(Suite &suite, const char *name, F &&f)
+{
+    using T = typename V::EntryType;
+    const auto in = randomValues<T>(N, T(0), T(100));
+    std::vector<T, Vc::Allocator<T>> out(N);
+    suite.run(name, typeName<V>(), N, [&]() {
+        const T *p = in.data();
+        fakeModify(p);
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            f(V(p + i, Vc::Aligned)).store(&out[i], Vc::Aligned);
+        }
+        clobberMemory();
+    });
+}
+
+// cast {{{1
+template <class From, class To>
+void cast(Suite &suite, const std::string &name, const std::string &type)
+{
+    static_assert(From::Size == To::Size, "");
+    using T = typename From::EntryType;
+    using U = typename To::EntryType;
+    const auto in = randomValues<T>(N, T(0), T(100));
+    std::vector<U, Vc::Allocator<U>> out(N);
+    suite.run(name, type, N, [&]() {
+        const T *p = in.data();
+        fakeModify(p);
+        for (std::size_t i = 0; i < N; i += From::Size) {
+            Vc::simd_cast<To>(From(p + i, Vc::Aligned)).store(&out[i], Vc::Unaligned);
+        }
+        clobberMemory();
+    });
+}
+
+// sort {{{1
+template <class V> void sort(Suite &suite)
+{
+    using T = typename V::EntryType;
+    const auto in = randomValues<T>(N, T(0), T(10000));
+    std::vector<T, Vc::Allocator<T>> data(N);
+    suite.run("std::sort", typeName<V>(), N, [&]() {
+        std::copy(in.begin(), in.end(), data.begin());
+        std::sort(data.begin(), data.end());
+        clobberMemory();
+    });
+    suite.run("simd_sort", typeName<V>(), N, [&]() {
+        std::copy(in.begin(), in.end(), data.begin());
+        Vc::simd_sort(data.begin(), data.end());
+        clobberMemory();
+    });
+}
+
+// filter {{{1
+template <class V> void filter(Suite &suite)
+{
+    using T = typename V::EntryType;
+    const auto in = randomValues<T>(N, T(0), T(100));
+    std::vector<T, Vc::Allocator<T>> out(N + V::Size);
+    const T threshold = T(50);
+    suite.run("filter scalar", typeName<V>(), N, [&]() {
+        const T *p = in.data();
+        fakeModify(p);
+        T *o = out.data();
+        for (std::size_t i = 0; i < N; ++i) {
+            if (p[i] > threshold) {
+                *o++ = p[i];
+            }
+        }
+        clobberMemory();
+    });
+    permute<V>(suite, "compress()", [&](const V &x) { return x.compress(x > threshold); });
+    suite.run("filter where(mask)", typeName<V>(), N, [&]() {
+        const T *p = in.data();
+        fakeModify(p);
+        T *o = out.data();
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            const V x(p + i, Vc::Aligned);
+            const auto k = x > threshold;
+            for (std::size_t j : where(k)) {
+                *o++ = x[j];
+            }
+        }
+        clobberMemory();
+    });
+    suite.run("filter compress_store", typeName<V>(), N, [&]() {
+        const T *p = in.data();
+        fakeModify(p);
+        T *o = out.data();
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            const V x(p + i, Vc::Aligned);
+            o += Vc::compress_store(o, x > threshold, x);
+        }
+        clobberMemory();
+    });
+    // the output has V::Size entries of padding: store full vectors
+    suite.run("filter compress+store", typeName<V>(), N, [&]() {
+        const T *p = in.data();
+        fakeModify(p);
+        T *o = out.data();
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            const V x(p + i, Vc::Aligned);
+            const auto k = x > threshold;
+            x.compress(k).store(o, Vc::Unaligned);
+            o += k.count();
+        }
+        clobberMemory();
+    });
+}
+
+// benchmark {{{1
+template <class V> void benchmark(Suite &suite)
+{
+    permute<V>(suite, "sorted()", [](const V &x) { return x.sorted(); });
+    permute<V>(suite, "reversed()", [](const V &x) { return x.reversed(); });
+    permute<V>(suite, "rotated(1)", [](const V &x) { return x.rotated(1); });
+    sort<V>(suite);
+    filter<V>(suite);
+}
+
+// main {{{1
+int Vc_CDECL main(int argc, char **argv)
+{
+    using Vc::float_v;
+    using Vc::double_v;
+    using Vc::int_v;
+    using Vc::short_v;
+    Suite suite("shuffle", argc, argv);
+    benchmark<float_v>(suite);
+    benchmark<double_v>(suite);
+    benchmark<int_v>(suite);
+    benchmark<short_v>(suite);
+
+    cast<float_v, Vc::SimdArray<int, float_v::Size>>(suite, "simd_cast float -> int",
+                                                     "float_v");
+    cast<int_v, Vc::SimdArray<float, int_v::Size>>(suite, "simd_cast int -> float",
+                                                   "int_v");
+    cast<float_v, Vc::SimdArray<double, float_v::Size>>(
+        suite, "simd_cast float -> double", "float_v");
+    cast<double_v, Vc::SimdArray<float, double_v::Size>>(
+        suite, "simd_cast double -> float", "double_v");
+    cast<short_v, Vc::SimdArray<int, short_v::Size>>(suite, "simd_cast short -> int",
+                                                     "short_v");
+    cast<int_v, Vc::SimdArray<short, int_v::Size>>(suite, "simd_cast int -> short",
+                                                   "int_v");
+    return suite.finish();
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,146 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+#include <Vc/soa_vector>
+#include <Vc/aosoa_vector>
+
+/*
+ * Compares a structure of arrays (Vc::soa_vector) and a tiled array of structures of
+ * arrays (Vc::aosoa_vector) with an array of structures that is converted with
+ * deinterleave/interleave (Vc::InterleavedMemoryWrapper) or processed with scalar code.
+ */
+
+using namespace Benchmark;
+
+template <typename T> struct PointTemplate {
+    T x, y, z;
+
+    Vc_SIMDIZE_INTERFACE((x, y, z));
+};
+using Point = PointTemplate<float>;
+using PointV = Vc::simdize<Point>;
+using Vc::float_v;
+
+// benchmark {{{1
+void benchmark(Suite &suite, std::size_t n, const std::string &where)
+{
+    const auto values = randomValues<float>(3 * n, -1.f, 1.f);
+    std::vector<Point> aos(n);
+    Vc::soa_vector<Point> soa;
+    for (std::size_t i = 0; i < n; ++i) {
+        aos[i] = {values[3 * i], values[3 * i + 1], values[3 * i + 2]};
+        soa.push_back(aos[i]);
+    }
+    Vc::aosoa_vector<Point> aosoa(aos.data(), n);
+
+    // read only: sum of the distances to the origin
+    suite.run("sum |p| AoS scalar" + where, "float", n, [&]() {
+        float sum = 0.f;
+        for (const Point &p : aos) {
+            sum += std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+        }
+        fakeRead(sum);
+    });
+    suite.run("sum |p| AoS deinterleave" + where, "float_v", n, [&]() {
+        const Vc::InterleavedMemoryWrapper<Point, float_v> wrapper(aos.data());
+        float_v sum = 0.f;
+        for (std::size_t i = 0; i + float_v::Size <= n; i += float_v::Size) {
+            float_v x, y, z;
+            Vc::tie(x, y, z) = wrapper[i];
+            sum += Vc::sqrt(x * x + y * y + z * z);
+        }
+        fakeRead(sum);
+    });
+    suite.run("sum |p| soa_vector" + where, "float_v", n, [&]() {
+        float_v sum = 0.f;
+        for (const PointV &p : static_cast<const Vc::soa_vector<Point> &>(soa)) {
+            sum += Vc::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+        }
+        fakeRead(sum);
+    });
+    suite.run("sum |p| aosoa_vector" + where, "float_v", n, [&]() {
+        float_v sum = 0.f;
+        for (const PointV &p : static_cast<const Vc::aosoa_vector<Point> &>(aosoa)) {
+            sum += Vc::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+        }
+        fakeRead(sum);
+    });
+
+    // read-modify-write: p.x += p.y * p.z
+    suite.run("update AoS scalar" + where, "float", n, [&]() {
+        for (Point &p : aos) {
+            p.x += p.y * p.z;
+        }
+        clobberMemory();
+    });
+    suite.run("update AoS deinterleave" + where, "float_v", n, [&]() {
+        Vc::InterleavedMemoryWrapper<Point, float_v> wrapper(aos.data());
+        for (std::size_t i = 0; i + float_v::Size <= n; i += float_v::Size) {
+            float_v x, y, z;
+            Vc::tie(x, y, z) = wrapper[i];
+            x += y * z;
+            wrapper[i] = Vc::tie(x, y, z);
+        }
+        clobberMemory();
+    });
+    suite.run("update soa_vector" + where, "float_v", n, [&]() {
+        for (auto &&chunk : soa) {
+            PointV p = chunk;
+            p.x += p.y * p.z;
+            chunk = p;
+        }
+        clobberMemory();
+    });
+    suite.run("update aosoa_vector" + where, "float_v", n, [&]() {
+        for (PointV &p : aosoa) {
+            p.x += p.y * p.z;
+        }
+        clobberMemory();
+    });
+
+    // bulk conversion from and to the array of structures
+    suite.run("convert AoS -> aosoa_vector" + where, "float_v", n, [&]() {
+        aosoa.assign(aos.data(), n);
+        clobberMemory();
+    });
+    suite.run("convert aosoa_vector -> AoS" + where, "float_v", n, [&]() {
+        aosoa.copyTo(aos.data());
+        clobberMemory();
+    });
+}
+
+// main {{{1
+int Vc_CDECL main(int argc, char **argv)
+{
+    Suite suite("soa", argc, argv);
+    benchmark(suite, 1024, " (L1)");
+    benchmark(suite, 4 * 1024 * 1024, " (memory)");
+    return suite.finish();
+}
+
+// vim: foldmethod=marker
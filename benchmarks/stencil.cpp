@@ -0,0 +1,168 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+#include <Vc/stencil>
+
+/*
+ * Compares Vc::simd_stencil against the approach of examples/finitediff, which loads
+ * every tap with its own unaligned vector load. One element is one Byte of memory
+ * traffic (every output point reads one input and writes one output entry), thus the
+ * Melem/s column is the bandwidth in MB/s.
+ */
+
+using namespace Benchmark;
+
+// stencils {{{1
+template <typename T> struct Central3 {
+    static constexpr int radius = 1;
+    static constexpr T coefficient(int dx) { return dx == 0 ? T(-2) : T(1); }
+};
+template <typename T> struct Central9 {  // eighth order second derivative
+    static constexpr int radius = 4;
+    static constexpr T coefficient(int dx)
+    {
+        return dx == 0 ? T(-205) / 72
+                       : (dx < 0 ? -dx : dx) == 1 ? T(8) / 5
+                       : (dx < 0 ? -dx : dx) == 2 ? T(-1) / 5
+                       : (dx < 0 ? -dx : dx) == 3 ? T(8) / 315 : T(-1) / 560;
+    }
+};
+template <typename T> struct Laplace2D {
+    static constexpr int radius = 1;
+    static constexpr T coefficient(int dy, int dx)
+    {
+        return dy == 0 && dx == 0 ? T(-4) : dy == 0 || dx == 0 ? T(1) : T(0);
+    }
+};
+template <typename T> struct Laplace3D {
+    static constexpr int radius = 1;
+    static constexpr T coefficient(int dz, int dy, int dx)
+    {
+        return dz == 0 && dy == 0 && dx == 0
+                   ? T(-6)
+                   : (dz != 0) + (dy != 0) + (dx != 0) == 1 ? T(1) : T(0);
+    }
+};
+
+// unalignedLoads {{{1
+// the finitediff approach: one unaligned load per tap and output vector
+template <typename S, std::size_t Dim, typename T>
+void unalignedLoads(const Vc::Detail::StencilGrid<T> &g)
+{
+    typedef Vc::Vector<T> V;
+    typedef Vc::Detail::StencilTaps<S, Dim> Taps;
+    for (std::size_t r = 0; r < g.rows; ++r) {
+        const std::size_t z = r / g.ny, y = r % g.ny;
+        const T *lines[Taps::Lines];
+        for (std::size_t l = 0; l < Taps::Lines; ++l) {
+            lines[l] = g.in + (std::ptrdiff_t(z) + Taps::dz(l)) * std::ptrdiff_t(g.inSlicePitch) +
+                       (std::ptrdiff_t(y) + Taps::dy(l)) * std::ptrdiff_t(g.inPitch);
+        }
+        T *out = g.out + z * g.outSlicePitch + y * g.outPitch;
+        for (std::size_t x = 0; x < g.nx; x += V::Size) {
+            Vc::Detail::stencilVector<V, Taps>(lines, x).store(out + x, Vc::Unaligned);
+        }
+    }
+}
+
+// stencil {{{1
+/* Runs the stencil \p S on a grid of nx x ny x nz interior points. Every row has a halo of
+ * radius entries and is padded to full vectors, such that the rows are aligned and the
+ * unaligned-load variant needs no tail handling.
+ */
+template <class V, std::size_t Dim, template <typename> class S>
+void stencil(Suite &suite, const std::string &name, std::size_t nx, std::size_t ny,
+             std::size_t nz)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t R = S<T>::radius;
+    const std::size_t lead = (R + V::Size - 1) / V::Size * V::Size;
+    const std::size_t pitch = (lead + nx + R + V::Size - 1) / V::Size * V::Size;
+    const std::size_t yHalo = Dim >= 2 ? R : 0, zHalo = Dim == 3 ? R : 0;
+    const std::size_t slicePitch = pitch * (ny + 2 * yHalo);
+    const auto in = randomValues<T>(slicePitch * (nz + 2 * zHalo) + pitch, T(-1), T(1));
+    std::vector<T, Vc::Allocator<T>> out(slicePitch * nz);
+    // the first interior point is aligned, the halo starts R entries before it
+    const Vc::Detail::StencilGrid<T> g = {in.data() + zHalo * slicePitch + yHalo * pitch +
+                                              lead,
+                                          pitch,
+                                          slicePitch,
+                                          out.data(),
+                                          pitch,
+                                          slicePitch,
+                                          nx,
+                                          ny,
+                                          ny * nz};
+    const std::size_t bytes = 2 * sizeof(T) * nx * ny * nz;
+    const std::string size = std::to_string(nx) + (Dim >= 2 ? 'x' + std::to_string(ny) : "") +
+                             (Dim == 3 ? 'x' + std::to_string(nz) : "");
+    suite.run(name + " unaligned loads " + size, typeName<V>(), bytes, [&]() {
+        Vc::Detail::StencilGrid<T> g2 = g;
+        fakeModify(g2.in);
+        unalignedLoads<S<T>, Dim>(g2);
+        clobberMemory();
+    });
+    suite.run(name + " simd_stencil " + size, typeName<V>(), bytes, [&]() {
+        Vc::Detail::StencilGrid<T> g2 = g;
+        fakeModify(g2.in);
+        Vc::Detail::stencilRows<S<T>, Dim>(g2, 0, g2.rows);
+        clobberMemory();
+    });
+    if (Dim == 3) {
+        suite.run(name + " simd_stencil(par_simd) " + size, typeName<V>(), bytes, [&]() {
+            Vc::Detail::StencilGrid<T> g2 = g;
+            fakeModify(g2.in);
+            Vc::Detail::stencilParallel<S<T>, Dim>(Vc::execution::par_simd, g2);
+            clobberMemory();
+        });
+    }
+}
+
+// benchmark {{{1
+template <class V> void benchmark(Suite &suite)
+{
+    // 1D: in L1, in L2 and in memory
+    for (std::size_t n : {std::size_t(2048), std::size_t(32768), std::size_t(1) << 22}) {
+        stencil<V, 1, Central3>(suite, "3-point", n, 1, 1);
+        stencil<V, 1, Central9>(suite, "9-point", n, 1, 1);
+    }
+    stencil<V, 2, Laplace2D>(suite, "5-point", 512, 512, 1);
+    stencil<V, 3, Laplace3D>(suite, "7-point", 64, 64, 64);
+    stencil<V, 3, Laplace3D>(suite, "7-point", 256, 256, 64);
+}
+
+// main {{{1
+int Vc_CDECL main(int argc, char **argv)
+{
+    Suite suite("stencil", argc, argv);
+    benchmark<Vc::float_v>(suite);
+    benchmark<Vc::double_v>(suite);
+    return suite.finish();
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,161 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+#include <Vc/Memory>
+
+/*
+ * Row and column sweeps (row sums and column sums) and transpositions of an n x n matrix,
+ * once in a row-major array and once in a Vc::TiledMemory. The column sweep of the
+ * row-major array reads one vector per row, i.e. it strides over n entries per load. The
+ * tiled sweeps go tile by tile, thus row and column sweeps read the same contiguous
+ * blocks. One element is one matrix entry.
+ */
+
+using namespace Benchmark;
+
+// sweeps {{{1
+template <class V> void sweeps(Suite &suite, std::size_t n)
+{
+    using T = typename V::EntryType;
+    const auto a = randomValues<T>(n * n, T(-1), T(1));
+    Vc::TiledMemory<V> tiled(n, n);
+    tiled.copyFrom(a.data(), n);
+    Vc::Memory<V> sums(n);
+    const std::string size = std::to_string(n) + 'x' + std::to_string(n);
+
+    suite.run("row sweep row-major " + size, typeName<V>(), n * n, [&]() {
+        const T *pa = a.data();
+        fakeModify(pa);
+        for (std::size_t r = 0; r < n; ++r) {
+            V acc = V::Zero();
+            for (std::size_t c = 0; c < n; c += V::Size) {
+                acc += V(pa + r * n + c, Vc::Aligned);
+            }
+            sums[r] = acc.sum();
+        }
+        clobberMemory();
+    });
+    suite.run("column sweep row-major " + size, typeName<V>(), n * n, [&]() {
+        const T *pa = a.data();
+        fakeModify(pa);
+        for (std::size_t c = 0; c < n; c += V::Size) {
+            V acc = V::Zero();
+            for (std::size_t r = 0; r < n; ++r) {
+                acc += V(pa + r * n + c, Vc::Aligned);
+            }
+            acc.store(&sums[c], Vc::Aligned);
+        }
+        clobberMemory();
+    });
+    suite.run("row sweep tiled " + size, typeName<V>(), n * n, [&]() {
+        sums.setZero();
+        for (auto tile : tiled) {
+            for (std::size_t r = 0; r < tile.side(); ++r) {
+                V acc = tile.vector(r, 0);
+                for (std::size_t i = 1; i < tile.rowVectorsCount(); ++i) {
+                    acc += tile.vector(r, i);
+                }
+                sums[tile.firstRow() + r] += acc.sum();
+            }
+        }
+        clobberMemory();
+    });
+    suite.run("column sweep tiled " + size, typeName<V>(), n * n, [&]() {
+        sums.setZero();
+        for (auto tile : tiled) {
+            for (std::size_t i = 0; i < tile.rowVectorsCount(); ++i) {
+                V acc = tile.vector(0, i);
+                for (std::size_t r = 1; r < tile.side(); ++r) {
+                    acc += tile.vector(r, i);
+                }
+                sums.vectorAt(tile.firstColumn() + i * V::Size) += acc;
+            }
+        }
+        clobberMemory();
+    });
+}
+
+// transpositions {{{1
+template <class V> void transpositions(Suite &suite, std::size_t n)
+{
+    using T = typename V::EntryType;
+    const auto a = randomValues<T>(n * n, T(-1), T(1));
+    std::vector<T, Vc::Allocator<T>> b(n * n);
+    Vc::TiledMemory<V> tiledA(n, n), tiledB(n, n);
+    tiledA.copyFrom(a.data(), n);
+    const std::string size = std::to_string(n) + 'x' + std::to_string(n);
+
+    suite.run("transpose naive " + size, typeName<V>(), n * n, [&]() {
+        const T *pa = a.data();
+        fakeModify(pa);
+        for (std::size_t r = 0; r < n; ++r) {
+            for (std::size_t c = 0; c < n; ++c) {
+                b[c * n + r] = pa[r * n + c];
+            }
+        }
+        clobberMemory();
+    });
+    suite.run("simd_transpose row-major " + size, typeName<V>(), n * n, [&]() {
+        const T *pa = a.data();
+        fakeModify(pa);
+        Vc::simd_transpose(n, n, pa, n, b.data(), n);
+        clobberMemory();
+    });
+    suite.run("simd_transpose in-place " + size, typeName<V>(), n * n, [&]() {
+        Vc::simd_transpose(n, b.data(), n);
+        clobberMemory();
+    });
+    suite.run("simd_transpose tiled " + size, typeName<V>(), n * n, [&]() {
+        Vc::simd_transpose(tiledA, tiledB);
+        clobberMemory();
+    });
+    suite.run("simd_transpose tiled in-place " + size, typeName<V>(), n * n, [&]() {
+        Vc::simd_transpose(tiledB);
+        clobberMemory();
+    });
+}
+
+// benchmark {{{1
+template <class V> void benchmark(Suite &suite)
+{
+    for (std::size_t n : {512, 4096}) {
+        sweeps<V>(suite, n);
+        transpositions<V>(suite, n);
+    }
+}
+
+// main {{{1
+int Vc_CDECL main(int argc, char **argv)
+{
+    Suite suite("tiledmemory", argc, argv);
+    benchmark<Vc::float_v>(suite);
+    benchmark<Vc::double_v>(suite);
+    return suite.finish();
+}
+
+// vim: foldmethod=marker
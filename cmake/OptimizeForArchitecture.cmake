@@ -121,6 +121,14 @@ macro(AutodetectHostArchitecture)
          # 2E          | Xeon 7500, 6500 series
          # 25 2C       | Xeon 3600, 5600 series, Core i7, i5 and i3
          #
+         # Intel SDM Vol. 4 2-1 / May 2019 and later:
+         # 55          | Xeon Scalable 2nd/3rd gen. [Cascade Lake, Cooper Lake]
+         # 6A 6C       | Xeon Scalable 3rd gen.     [Ice Lake-SP]
+         # 7D 7E       | 10th gen. Core             [Ice Lake]
+         # 8C 8D       | 11th gen. Core             [Tiger Lake]
+         # 8F          | Xeon Scalable 4th gen.     [Sapphire Rapids]
+         # CF          | Xeon Scalable 5th gen.     [Emerald Rapids]
+         #
          # Values from the Intel SDE:
          # 5C | Goldmont
          # 5A | Silvermont
@@ -136,6 +144,14 @@ macro(AutodetectHostArchitecture)
             set(TARGET_ARCHITECTURE "goldmont")
          elseif(_cpu_model EQUAL 90 OR _cpu_model EQUAL 76)
             set(TARGET_ARCHITECTURE "silvermont")
+         elseif(_cpu_model EQUAL 143 OR _cpu_model EQUAL 207) # 8F, CF
+            set(TARGET_ARCHITECTURE "sapphire-rapids")
+         elseif(_cpu_model EQUAL 140 OR _cpu_model EQUAL 141) # 8C, 8D
+            set(TARGET_ARCHITECTURE "tiger-lake")
+         elseif(_cpu_model EQUAL 106 OR _cpu_model EQUAL 108) # 6A, 6C
+            set(TARGET_ARCHITECTURE "icelake-xeon")
+         elseif(_cpu_model EQUAL 125 OR _cpu_model EQUAL 126) # 7D, 7E
+            set(TARGET_ARCHITECTURE "icelake")
          elseif(_cpu_model EQUAL 102)
             set(TARGET_ARCHITECTURE "cannonlake")
          elseif(_cpu_model EQUAL 142 OR _cpu_model EQUAL 158) # 8E, 9E
@@ -219,7 +235,8 @@ Using an incorrect setting here can result in crashes of the resulting binary be
 Setting the value to \"auto\" will try to optimize for the architecture where cmake is called. \
 Other supported values are: \"none\", \"generic\", \"core\", \"merom\" (65nm Core2), \
 \"penryn\" (45nm Core2), \"nehalem\", \"westmere\", \"sandy-bridge\", \"ivy-bridge\", \
-\"haswell\", \"broadwell\", \"skylake\", \"skylake-xeon\", \"kaby-lake\", \"cannonlake\", \"silvermont\", \
+\"haswell\", \"broadwell\", \"skylake\", \"skylake-xeon\", \"kaby-lake\", \"cannonlake\", \
+\"icelake\", \"icelake-xeon\", \"tiger-lake\", \"sapphire-rapids\", \"silvermont\", \
 \"goldmont\", \"knl\" (Knights Landing), \"atom\", \"k8\", \"k8-sse3\", \"barcelona\", \
 \"istanbul\", \"magny-cours\", \"bulldozer\", \"interlagos\", \"piledriver\", \
 \"AMD 14h\", \"AMD 16h\", \"zen\".")
@@ -286,6 +303,22 @@ Other supported values are: \"none\", \"generic\", \"core\", \"merom\" (65nm Cor
       _skylake_avx512()
       list(APPEND _available_vector_units_list "avx512ifma" "avx512vbmi")
    endmacro()
+   macro(_icelake)
+      list(APPEND _march_flag_list "icelake-client")
+      _cannonlake()
+   endmacro()
+   macro(_icelake_avx512)
+      list(APPEND _march_flag_list "icelake-server")
+      _icelake()
+   endmacro()
+   macro(_tigerlake)
+      list(APPEND _march_flag_list "tigerlake")
+      _icelake()
+   endmacro()
+   macro(_sapphirerapids)
+      list(APPEND _march_flag_list "sapphirerapids")
+      _icelake_avx512()
+   endmacro()
    macro(_knightslanding)
       list(APPEND _march_flag_list "knl")
       _broadwell()
@@ -321,6 +354,14 @@ Other supported values are: \"none\", \"generic\", \"core\", \"merom\" (65nm Cor
       endif()
    elseif(TARGET_ARCHITECTURE STREQUAL "knl")
       _knightslanding()
+   elseif(TARGET_ARCHITECTURE STREQUAL "sapphire-rapids")
+      _sapphirerapids()
+   elseif(TARGET_ARCHITECTURE STREQUAL "tiger-lake")
+      _tigerlake()
+   elseif(TARGET_ARCHITECTURE STREQUAL "icelake-xeon" OR TARGET_ARCHITECTURE STREQUAL "icelake-avx512")
+      _icelake_avx512()
+   elseif(TARGET_ARCHITECTURE STREQUAL "icelake")
+      _icelake()
    elseif(TARGET_ARCHITECTURE STREQUAL "cannonlake")
       _cannonlake()
    elseif(TARGET_ARCHITECTURE STREQUAL "kaby-lake")
@@ -499,6 +540,10 @@ Other supported values are: \"none\", \"generic\", \"core\", \"merom\" (65nm Cor
          endforeach(_flag)
       elseif(CMAKE_CXX_COMPILER MATCHES "/(icpc|icc)$") # ICC (on Linux)
          set(OFA_map_knl "-xMIC-AVX512")
+         set(OFA_map_sapphirerapids "-xSAPPHIRERAPIDS")
+         set(OFA_map_tigerlake "-xTIGERLAKE")
+         set(OFA_map_icelake-server "-xICELAKE-SERVER")
+         set(OFA_map_icelake-client "-xICELAKE-CLIENT")
          set(OFA_map_cannonlake "-xCORE-AVX512")
          set(OFA_map_skylake-avx512 "-xCORE-AVX512")
          set(OFA_map_skylake "-xCORE-AVX2")
@@ -385,7 +385,7 @@ macro(_vc_compile_one_implementation _srcs _impl)
       endif()
       list(REMOVE_AT _disabled_targets ${_disabled_index})
       # skip the rest and return
-   elseif(NOT _only_targets OR ${_only_index} GREATER -1)
+   elseif(NOT _only_given OR ${_only_index} GREATER -1)
       if(${_only_index} GREATER -1)
          list(REMOVE_AT _only_targets ${_only_index})
       endif()
@@ -432,6 +432,7 @@ macro(_vc_compile_one_implementation _srcs _impl)
             COMPILE_FLAGS "${_flags} ${_extra_flags}"
          )
          list(APPEND ${_srcs} "${_out}")
+         list(APPEND Vc_COMPILED_IMPLEMENTATIONS "${_impl}")
       endif()
    endif()
 endmacro()
@@ -442,10 +443,14 @@ endmacro()
 # Example:
 #   vc_compile_for_all_implementations(_objs src/trigonometric.cpp FLAGS -DCOMPILE_BLAH EXCLUDE Scalar)
 #   add_executable(executable main.cpp ${_objs})
+# The implementations that were actually compiled (depending on compiler support) are listed in
+# Vc_COMPILED_IMPLEMENTATIONS afterwards. Together with Vc::ImplementationDispatcher
+# (Vc/dispatch.h) this allows selecting the best compiled kernel at runtime.
 macro(vc_compile_for_all_implementations _srcs _src)
    set(_flags)
    unset(_disabled_targets)
    unset(_only_targets)
+   set(_only_given FALSE)
    set(_state 0)
    foreach(_arg ${ARGN})
       if(_arg STREQUAL "FLAGS")
@@ -454,6 +459,7 @@ macro(vc_compile_for_all_implementations _srcs _src)
          set(_state 2)
       elseif(_arg STREQUAL "ONLY")
          set(_state 3)
+         set(_only_given TRUE)
       elseif(_state EQUAL 1)
          set(_flags "${_flags} ${_arg}")
       elseif(_state EQUAL 2)
@@ -466,6 +472,7 @@ macro(vc_compile_for_all_implementations _srcs _src)
    endforeach()
 
    set(_vc_compile_src "${_src}")
+   set(Vc_COMPILED_IMPLEMENTATIONS)
 
    _vc_compile_one_implementation(${_srcs} Scalar NO_FLAG)
    if(NOT Vc_SSE_INTRINSICS_BROKEN)
@@ -495,6 +502,7 @@ macro(vc_compile_for_all_implementations _srcs _src)
       #_vc_compile_one_implementation(${_srcs} AVX2+BMI2 "-mavx2 -mbmi2")
       _vc_compile_one_implementation(${_srcs} AVX2+FMA+BMI2 "-xCORE-AVX2" "-mavx2 -mfma -mbmi2" "/arch:AVX2")
       #_vc_compile_one_implementation(${_srcs} AVX2+FMA "-mavx2 -mfma")
+      _vc_compile_one_implementation(${_srcs} AVX2+FMA+BMI2+AVX512VL "-xCORE-AVX512" "-mavx2 -mfma -mbmi2 -mavx512f -mavx512cd -mavx512vl -mavx512bw -mavx512dq" "/arch:AVX512")
    endif()
    list(LENGTH _only_targets _len)
    if(_len GREATER 0)
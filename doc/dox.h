@@ -307,7 +307,7 @@ After you include a %Vc header, you will have the following macros available, wh
 
 \section vc_size Vector/Mask Sizes
 
-The macros \ref Vc_DOUBLE_V_SIZE, \ref Vc_FLOAT_V_SIZE, \ref Vc_INT_V_SIZE, \ref Vc_UINT_V_SIZE, \ref Vc_SHORT_V_SIZE, and \ref Vc_USHORT_V_SIZE make the default vector width accessible in the preprocessor.
+The macros \ref Vc_DOUBLE_V_SIZE, \ref Vc_FLOAT_V_SIZE, \ref Vc_INT_V_SIZE, \ref Vc_UINT_V_SIZE, \ref Vc_SHORT_V_SIZE, \ref Vc_USHORT_V_SIZE, \ref Vc_SCHAR_V_SIZE, \ref Vc_UCHAR_V_SIZE, \ref Vc_LLONG_V_SIZE, and \ref Vc_ULLONG_V_SIZE make the default vector width accessible in the preprocessor.
 In most cases you should prefer the Vector::size() function, though.
 Since this function is \c constexpr you can use it for compile-time decisions (e.g. as template argument).
 
@@ -339,7 +339,7 @@ You can define the following macros to enable/disable specific features:
 
 If you want to force compilation against a specific implementation of the vector classes you can set the macro Vc_IMPL to either
 \c Scalar, \c SSE, \c SSE2, \c SSE3, \c SSSE3, \c SSE4_1, \c SSE4_2, \c AVX, \c AVX2, or \c MIC.
-Additionally, you may (should) append \c +XOP, \c +FMA4, \c +FMA, \c +SSE4a, \c +F16C, \c +BMI2, and/or \c +POPCNT.
+Additionally, you may (should) append \c +XOP, \c +FMA4, \c +FMA, \c +SSE4a, \c +F16C, \c +BMI2, \c +AVX512VL, and/or \c +POPCNT.
 For example, `-D Vc_IMPL=SSE+XOP+FMA4` tells the Vc library to use the best SSE instructions available for the target (according to the information provided by the compiler) and additionally use XOP and FMA4 instructions (this might be a good choice for some AMD processors, which support AVX but may perform slightly better if only SSE widths are used).
 Setting \c Vc_IMPL to \c SSE forces the SSE instruction set, but lets the headers figure out the exact SSE revision to use, or, if that fails, uses SSE4.1.
 
@@ -624,6 +624,12 @@ namespace Vc
  * This macro is defined if the current translation unit is compiled with SSE4a instruction support.
  */
 #define Vc_IMPL_SSE4a
+/**
+ * This macro is defined if the current translation unit is compiled with AVX-512 F, CD, VL, BW,
+ * and DQ instruction support. The vector widths are unchanged; the instructions are only used
+ * on 128- and 256-bit registers.
+ */
+#define Vc_IMPL_AVX512VL
 /**
  * This macro is defined if the current translation unit is compiled without any SIMD support.
  */
@@ -700,6 +706,26 @@ namespace Vc
  * An integer (for use with the preprocessor) that gives the number of entries in a ushort_v.
  */
 #define Vc_USHORT_V_SIZE
+/**
+ * \ingroup Utilities
+ * An integer (for use with the preprocessor) that gives the number of entries in a schar_v.
+ */
+#define Vc_SCHAR_V_SIZE
+/**
+ * \ingroup Utilities
+ * An integer (for use with the preprocessor) that gives the number of entries in a uchar_v.
+ */
+#define Vc_UCHAR_V_SIZE
+/**
+ * \ingroup Utilities
+ * An integer (for use with the preprocessor) that gives the number of entries in a llong_v.
+ */
+#define Vc_LLONG_V_SIZE
+/**
+ * \ingroup Utilities
+ * An integer (for use with the preprocessor) that gives the number of entries in a ullong_v.
+ */
+#define Vc_ULLONG_V_SIZE
 //@}
 
 } // namespace Vc
@@ -206,7 +206,8 @@ int Vc_CDECL main()
         // Prefetches make sure the data which is going to be used in the next iterations is already
         // in the L1 cache. The Vc::Prefetch<>() flag provides some sensible default for loops where no
         // elements are skipped. You can use Vc::Prefetch<L1, L2, Shared/Exclusive>() instead to set the stride of
-        // L1 and L2 prefetches manually.
+        // L1 and L2 prefetches manually, or Vc::Prefetch<Vc::Auto>() to derive them from the cache
+        // sizes of the CPU at runtime.
         auto y = y_points.begin(Vc::Prefetch<>());
         float_v y0 = *y++;
         const auto y_it_last = y_points.end();
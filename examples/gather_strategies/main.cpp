@@ -0,0 +1,208 @@
+/*{{{
+    Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <array>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <Vc/Vc>
+#include "../tsc.h"
+
+/*
+ * This example measures the strategies Vc implements for masked gathers (see
+ * Vc/common/gatherimplementation.h) against each other. The strategy used by
+ * V::gather(mem, indexes, mask) is chosen at compile time:
+ *
+ *   SimpleLoop      -DVc_USE_LOOP_GATHERS (the default without AVX2)
+ *   SetIndexZero    -DVc_USE_SET_GATHERS (index vectors only)
+ *   BitScanLoop     -DVc_USE_BSF_GATHERS
+ *   PopcntSwitch    -DVc_USE_POPCNT_BSF_GATHERS
+ *   HardwareGather  default with AVX2 for float, double, int, and uint with int index
+ *                   vectors or arrays of 32-/64-bit indexes
+ *
+ * The throughput of the gather instructions differs a lot between microarchitectures
+ * (and microcode revisions), so run this on the target machine to pick the macro.
+ */
+
+using Vc::Common::GatherScatterImplementation;
+
+static constexpr std::size_t TableSize = 64 * 1024;  // fits into L2
+static constexpr std::size_t Gathers = 4096;
+static constexpr int Repetitions = 50;
+
+// whether a strategy can handle the given types {{{1
+template <class S, class V, class IT> struct Applicable : public std::true_type {
+};
+template <class V, class IT>
+struct Applicable<Vc::Common::SetIndexZeroT, V, IT>
+    : public std::integral_constant<bool, Vc::Traits::is_simd_vector<IT>::value> {
+};
+template <class V, class IT>
+struct Applicable<Vc::Common::HardwareGatherT, V, IT>
+#ifdef Vc_IMPL_AVX2
+    : public Vc::Detail::is_hardware_gatherable<V, typename V::EntryType, IT> {
+#else
+    : public std::false_type {
+#endif
+};
+
+// measure {{{1
+template <class V>
+using MaskVector = std::vector<typename V::mask_type, Vc::Allocator<typename V::mask_type>>;
+
+template <class S, class V, class Indexes>
+double measure(std::false_type, const typename V::EntryType *, const Indexes &,
+               const MaskVector<V> &)
+{
+    return -1;
+}
+
+template <class S, class V, class Indexes>
+double measure(std::true_type, const typename V::EntryType *mem, const Indexes &indexes,
+               const MaskVector<V> &masks)
+{
+    TimeStampCounter tsc;
+    double best = std::numeric_limits<double>::max();
+    V sum = 0;
+    for (int rep = 0; rep < Repetitions; ++rep) {
+        tsc.start();
+        for (std::size_t i = 0; i < Gathers; ++i) {
+            V v = 0;
+            Vc::Common::executeGather(S(), v, mem, indexes[i], masks[i]);
+            sum += v;
+        }
+        tsc.stop();
+        best = std::min(best, double(tsc.cycles()) / Gathers);
+    }
+    if (any_of(sum == V(-1))) {  // keep the gathers from being optimized away
+        std::cout << '\n';
+    }
+    return best;
+}
+
+// benchmark {{{1
+template <class V, class Indexes>
+void benchmark(const char *typeName, const char *indexName, const V *,
+               const Indexes &indexes)
+{
+    using T = typename V::EntryType;
+    using IT = typename Indexes::value_type;
+    std::vector<T> mem(TableSize);
+    for (std::size_t i = 0; i < TableSize; ++i) {
+        mem[i] = T(i);
+    }
+
+    std::default_random_engine rne;
+    for (double density : {1., .5, .125}) {
+        std::bernoulli_distribution active(density);
+        MaskVector<V> masks;
+        masks.reserve(Gathers);
+        for (std::size_t i = 0; i < Gathers; ++i) {
+            std::array<bool, V::Size> k;
+            for (auto &b : k) {
+                b = active(rne);
+            }
+            masks.emplace_back(k.data());
+        }
+
+        const double cycles[] = {
+            measure<Vc::Common::SimpleLoopT, V>(
+                Applicable<Vc::Common::SimpleLoopT, V, IT>(), mem.data(), indexes, masks),
+            measure<Vc::Common::SetIndexZeroT, V>(
+                Applicable<Vc::Common::SetIndexZeroT, V, IT>(), mem.data(), indexes, masks),
+            measure<Vc::Common::BitScanLoopT, V>(
+                Applicable<Vc::Common::BitScanLoopT, V, IT>(), mem.data(), indexes, masks),
+            measure<Vc::Common::PopcntSwitchT, V>(
+                Applicable<Vc::Common::PopcntSwitchT, V, IT>(), mem.data(), indexes, masks),
+            measure<Vc::Common::HardwareGatherT, V>(
+                Applicable<Vc::Common::HardwareGatherT, V, IT>(), mem.data(), indexes,
+                masks)};
+
+        int fastest = 0;
+        std::cout << std::setw(10) << typeName << std::setw(14) << indexName
+                  << std::setw(9) << density;
+        for (int i = 0; i < 5; ++i) {
+            if (cycles[i] < 0) {
+                std::cout << std::setw(15) << '-';
+            } else {
+                std::cout << std::setw(15) << std::setprecision(3) << cycles[i];
+                if (cycles[fastest] < 0 || cycles[i] < cycles[fastest]) {
+                    fastest = i;
+                }
+            }
+        }
+        static const char *const names[] = {"SimpleLoop", "SetIndexZero", "BitScanLoop",
+                                            "PopcntSwitch", "HardwareGather"};
+        std::cout << std::setw(16) << names[fastest] << std::endl;
+    }
+}
+
+template <class V> void benchmark(const char *typeName)
+{
+    using IT = typename V::IndexType;
+    std::default_random_engine rne;
+    std::uniform_int_distribution<int> dist(0, TableSize - 1);
+
+    std::vector<IT, Vc::Allocator<IT>> indexVectors;
+    std::vector<std::array<int, V::Size>> intArrays(Gathers);
+    std::vector<std::array<std::size_t, V::Size>> sizeArrays(Gathers);
+    indexVectors.reserve(Gathers);
+    for (std::size_t i = 0; i < Gathers; ++i) {
+        indexVectors.push_back(IT([&](int) { return dist(rne); }));
+        for (std::size_t j = 0; j < V::Size; ++j) {
+            intArrays[i][j] = indexVectors[i][j];
+            sizeArrays[i][j] = indexVectors[i][j];
+        }
+    }
+    // arrays of indexes are passed as pointers, as V::gather does for containers
+    std::vector<const int *> intPointers;
+    std::vector<const std::size_t *> sizePointers;
+    for (std::size_t i = 0; i < Gathers; ++i) {
+        intPointers.push_back(intArrays[i].data());
+        sizePointers.push_back(sizeArrays[i].data());
+    }
+
+    benchmark(typeName, "IndexType", static_cast<V *>(nullptr), indexVectors);
+    benchmark(typeName, "int[]", static_cast<V *>(nullptr), intPointers);
+    benchmark(typeName, "size_t[]", static_cast<V *>(nullptr), sizePointers);
+}
+
+// main {{{1
+int Vc_CDECL main()
+{
+    std::cout << "cycles per masked gather\n"
+              << std::setw(10) << "type" << std::setw(14) << "indexes" << std::setw(9)
+              << "density" << std::setw(15) << "SimpleLoop" << std::setw(15)
+              << "SetIndexZero" << std::setw(15) << "BitScanLoop" << std::setw(15)
+              << "PopcntSwitch" << std::setw(15) << "HardwareGather" << std::setw(16)
+              << "fastest" << '\n';
+    benchmark<Vc::float_v>("float_v");
+    benchmark<Vc::double_v>("double_v");
+    benchmark<Vc::int_v>("int_v");
+    return 0;
+}
+
+// vim: foldmethod=marker
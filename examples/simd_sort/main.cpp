@@ -0,0 +1,102 @@
+/*{{{
+    Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <array>
+#include <cstdint>
+#include <iomanip>
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <Vc/Vc>
+#include "../tsc.h"
+
+/*
+ * This example compares Vc::simd_sort against std::sort on uniformly distributed random
+ * data of 10^3 up to 10^N elements. N defaults to 7 and can be passed as the first
+ * argument (10^9 elements need several GB of memory).
+ */
+
+// measure {{{1
+// Every repetition sorts different data. Otherwise the branch predictor learns the
+// comparisons of std::sort on small inputs.
+template <class T, class F>
+double measure(std::size_t n, std::default_random_engine &rne, F &&sort)
+{
+    std::uniform_real_distribution<double> dist(0, std::numeric_limits<T>::max());
+    const int repetitions = std::max<int>(1, std::min<int>(20, int(10000000 / n)));
+    std::vector<T> data(n);
+    TimeStampCounter tsc;
+    double best = std::numeric_limits<double>::max();
+    for (int rep = 0; rep < repetitions; ++rep) {
+        for (auto &x : data) {
+            x = T(dist(rne));
+        }
+        tsc.start();
+        sort(data.begin(), data.end());
+        tsc.stop();
+        best = std::min(best, double(tsc.cycles()) / n);
+        if (!std::is_sorted(data.begin(), data.end())) {
+            std::cerr << "the data is not sorted\n";
+            std::exit(1);
+        }
+    }
+    return best;
+}
+
+// benchmark {{{1
+template <class T> void benchmark(const char *typeName, int maxExponent)
+{
+    using It = typename std::vector<T>::iterator;
+    std::size_t n = 1000;
+    for (int exponent = 3; exponent <= maxExponent; ++exponent, n *= 10) {
+        std::default_random_engine rne;
+        const double stdCycles =
+            measure<T>(n, rne, [](It first, It last) { std::sort(first, last); });
+        const double vcCycles =
+            measure<T>(n, rne, [](It first, It last) { Vc::simd_sort(first, last); });
+        std::cout << std::setw(8) << typeName << std::setw(6) << "1e" << exponent
+                  << std::setw(14) << std::setprecision(3) << stdCycles << std::setw(14)
+                  << vcCycles << std::setw(10) << stdCycles / vcCycles << std::endl;
+    }
+}
+
+// main {{{1
+int Vc_CDECL main(int argc, char **argv)
+{
+    const int maxExponent = argc > 1 ? std::atoi(argv[1]) : 7;
+    std::cout << "cycles per element\n"
+              << std::setw(8) << "type" << std::setw(7) << "size" << std::setw(14)
+              << "std::sort" << std::setw(14) << "simd_sort" << std::setw(10) << "speedup"
+              << '\n';
+    benchmark<float>("float", maxExponent);
+    benchmark<double>("double", maxExponent);
+    benchmark<int>("int", maxExponent);
+    benchmark<unsigned short>("ushort", maxExponent);
+    return 0;
+}
+
+// vim: foldmethod=marker
@@ -29,6 +29,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <Vc/sse/const_data.h>
 #include <Vc/version.h>
 
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -46,7 +47,7 @@ namespace AVX
     // cacheline 1
     alignas(64) extern const unsigned int   _IndexesFromZero32[ 8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
     alignas(16) extern const unsigned short _IndexesFromZero16[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
-    alignas(16) extern const unsigned char  _IndexesFromZero8 [32] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31 };
+    alignas(32) extern const unsigned char  _IndexesFromZero8 [32] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31 };
 
     template <>
     alignas(64) const double c_trig<double>::data[] = {
@@ -236,12 +237,33 @@ namespace Vc_VERSIONED_NAMESPACE
 {
 namespace Common
 {
-    alignas(64) unsigned int RandomState[16] = {
+    alignas(64) thread_local unsigned int RandomState[16] = {
         0x5a383a4fu, 0xc68bd45eu, 0x691d6d86u, 0xb367e14fu,
         0xd689dbaau, 0xfde442aau, 0x3d265423u, 0x1a77885cu,
         0x36ed2684u, 0xfb1f049du, 0x19e52f31u, 0x821e4dd7u,
         0x23996d25u, 0x5962725au, 0x6aced4ceu, 0xd4c610f3u
     };
+    thread_local bool RandomStateSeeded = false;
+
+    void Vc_CDECL seedRandomState()
+    {
+        static std::atomic<unsigned long long> threadCount{0};
+        const unsigned long long k = threadCount.fetch_add(1, std::memory_order_relaxed);
+        // the first thread keeps the historic sequence, the others get distinct states
+        // via splitmix64 of the thread number
+        if (k != 0) {
+            unsigned long long x = k * 0x9e3779b97f4a7c15ull;
+            for (int i = 0; i < 16; i += 2) {
+                unsigned long long z = (x += 0x9e3779b97f4a7c15ull);
+                z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+                z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+                z ^= z >> 31;
+                RandomState[i] ^= static_cast<unsigned int>(z);
+                RandomState[i + 1] ^= static_cast<unsigned int>(z >> 32);
+            }
+        }
+        RandomStateSeeded = true;
+    }
 
     alignas(32) const unsigned int AllBitsSet[8] = {
         0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU
@@ -289,6 +311,56 @@ namespace SSE
     alignas(16) const unsigned long long c_general::signMaskDouble[2] = { 0x8000000000000000ull, 0x8000000000000000ull };
     alignas(16) const unsigned long long c_general::frexpMask[2] = { 0xbfefffffffffffffull, 0xbfefffffffffffffull };
 
+    // compress/expand lookup tables
+    namespace
+    {
+    constexpr unsigned int popcount8(unsigned int bits)
+    {
+        return bits == 0 ? 0 : (bits & 1) + popcount8(bits >> 1);
+    }
+    // the index of the (n+1)-th set bit in bits, or 0xff
+    constexpr unsigned int nthSetBit(unsigned int bits, unsigned int n, unsigned int i = 0)
+    {
+        return i == 8 ? 0xff : (bits >> i) & 1
+                                   ? (n == 0 ? i : nthSetBit(bits, n - 1, i + 1))
+                                   : nthSetBit(bits, n, i + 1);
+    }
+    // the number of set bits below bit i if bit i is set, otherwise 0xff
+    constexpr unsigned int rankOfBit(unsigned int bits, unsigned int i)
+    {
+        return (bits >> i) & 1 ? popcount8(bits & ((1u << i) - 1)) : 0xff;
+    }
+    }  // unnamed namespace
+
+#define Vc_ROW(f_, bits_)                                                                \
+    {                                                                                    \
+        f_(bits_, 0), f_(bits_, 1), f_(bits_, 2), f_(bits_, 3), f_(bits_, 4),            \
+            f_(bits_, 5), f_(bits_, 6), f_(bits_, 7)                                     \
+    }
+#define Vc_16ROWS(f_, bits_)                                                             \
+    Vc_ROW(f_, bits_ + 0x0), Vc_ROW(f_, bits_ + 0x1), Vc_ROW(f_, bits_ + 0x2),           \
+        Vc_ROW(f_, bits_ + 0x3), Vc_ROW(f_, bits_ + 0x4), Vc_ROW(f_, bits_ + 0x5),       \
+        Vc_ROW(f_, bits_ + 0x6), Vc_ROW(f_, bits_ + 0x7), Vc_ROW(f_, bits_ + 0x8),       \
+        Vc_ROW(f_, bits_ + 0x9), Vc_ROW(f_, bits_ + 0xa), Vc_ROW(f_, bits_ + 0xb),       \
+        Vc_ROW(f_, bits_ + 0xc), Vc_ROW(f_, bits_ + 0xd), Vc_ROW(f_, bits_ + 0xe),       \
+        Vc_ROW(f_, bits_ + 0xf)
+#define Vc_256ROWS(f_)                                                                   \
+    Vc_16ROWS(f_, 0x00), Vc_16ROWS(f_, 0x10), Vc_16ROWS(f_, 0x20), Vc_16ROWS(f_, 0x30),  \
+        Vc_16ROWS(f_, 0x40), Vc_16ROWS(f_, 0x50), Vc_16ROWS(f_, 0x60),                   \
+        Vc_16ROWS(f_, 0x70), Vc_16ROWS(f_, 0x80), Vc_16ROWS(f_, 0x90),                   \
+        Vc_16ROWS(f_, 0xa0), Vc_16ROWS(f_, 0xb0), Vc_16ROWS(f_, 0xc0),                   \
+        Vc_16ROWS(f_, 0xd0), Vc_16ROWS(f_, 0xe0), Vc_16ROWS(f_, 0xf0)
+    alignas(64) const unsigned char c_compress::compress[256][8] = {Vc_256ROWS(nthSetBit)};
+    alignas(64) const unsigned char c_compress::expand[256][8] = {Vc_256ROWS(rankOfBit)};
+#undef Vc_256ROWS
+#undef Vc_16ROWS
+#undef Vc_ROW
+    alignas(16) const unsigned char c_compress::byteShift[48] = {
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80
+    };
+
 #define Vc_2(x) x, x
     template <>
     alignas(64) const double c_trig<double>::data[] = {
@@ -122,6 +122,12 @@ unsigned int extraInstructionsSupported()
     if (CpuId::hasFma ()) flags |= Vc::FmaInstructions;
     if (CpuId::hasBmi2()) flags |= Vc::Bmi2Instructions;
     if (CpuId::hasOsxsave() && CpuId::hasAvx() && xgetbvCheck(0x6)) flags |= Vc::VexInstructions;
+    // the opmask and upper ZMM state must be enabled by the OS as well (XCR0 bits 5-7)
+    if (CpuId::hasOsxsave() && CpuId::hasAvx512f() && CpuId::hasAvx512cd() &&
+        CpuId::hasAvx512vl() && CpuId::hasAvx512bw() && CpuId::hasAvx512dq() &&
+        xgetbvCheck(0xe6)) {
+        flags |= Vc::Avx512VlInstructions;
+    }
     //if (CpuId::hasPclmulqdq()) flags |= Vc::PclmulqdqInstructions;
     //if (CpuId::hasAes()) flags |= Vc::AesInstructions;
     //if (CpuId::hasRdrand()) flags |= Vc::RdrandInstructions;
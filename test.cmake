@@ -454,9 +454,9 @@ macro(go)
             if("${subset}" STREQUAL "sse")
                set(label_list other Scalar SSE)
             elseif("${subset}" STREQUAL "avx")
-               set(label_list AVX AVX2 MIC)
+               set(label_list AVX AVX2 AVX512VL MIC)
             else()
-               set(label_list other Scalar SSE AVX AVX2 MIC)
+               set(label_list other Scalar SSE AVX AVX2 AVX512VL MIC)
             endif()
             foreach(label ${label_list})
                set_property(GLOBAL PROPERTY Label ${label})
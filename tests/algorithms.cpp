@@ -0,0 +1,311 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+using namespace Vc;
+
+// Runs f on subranges of data that start at every offset within a vector and have every
+// length up to a few vectors, thus covering all combinations of prologue, body and
+// epilogue.
+template <typename V, typename F> void forAllSubranges(std::size_t total, F &&f)
+{
+    for (std::size_t offset = 0; offset <= V::Size; ++offset) {
+        for (std::size_t n = 0; offset + n <= total; n += (n < 3 * V::Size ? 1 : 7)) {
+            f(offset, n);
+        }
+    }
+}
+
+template <typename T> std::vector<T, Vc::Allocator<T>> makeData(std::size_t n)
+{
+    std::vector<T, Vc::Allocator<T>> data(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        data[i] = T((i * 5) % 7);
+    }
+    return data;
+}
+
+TEST_TYPES(V, simdTransform, AllVectors)
+{
+    typedef typename V::EntryType T;
+    const auto data = makeData<T>(20 * V::Size);
+    forAllSubranges<V>(data.size(), [&](std::size_t offset, std::size_t n) {
+        std::vector<T> out(n + 1, T(-1));
+        auto end = simd_transform(data.begin() + offset, data.begin() + offset + n,
+                                  out.begin(), [](auto v) { return v + v; });
+        COMPARE(end - out.begin(), std::ptrdiff_t(n));
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], T(2 * data[offset + i])) << "offset: " << offset << ", i: " << i;
+        }
+        COMPARE(out[n], T(-1));
+
+        end = simd_transform(data.begin() + offset, data.begin() + offset + n,
+                             data.begin() + 1, out.begin(),
+                             [](auto a, auto b) { return a * b; });
+        COMPARE(end - out.begin(), std::ptrdiff_t(n));
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], T(data[offset + i] * data[i + 1]))
+                << "offset: " << offset << ", i: " << i;
+        }
+    });
+
+    // in place
+    auto inplace = makeData<T>(3 * V::Size + 1);
+    const auto reference = inplace;
+    simd_transform(inplace.begin() + 1, inplace.end(), inplace.begin() + 1,
+                   [](auto v) { return v + 1; });
+    COMPARE(inplace[0], reference[0]);
+    for (std::size_t i = 1; i < inplace.size(); ++i) {
+        COMPARE(inplace[i], T(reference[i] + 1));
+    }
+}
+
+TEST_TYPES(V, simdTransformStreaming, AllVectors)
+{
+    typedef typename V::EntryType T;
+    const auto data = makeData<T>(20 * V::Size);
+    const std::size_t threshold = streaming_store_threshold();
+    for (std::size_t forced : {std::size_t(0), std::numeric_limits<std::size_t>::max()}) {
+        set_streaming_store_threshold(forced);
+        forAllSubranges<V>(data.size(), [&](std::size_t offset, std::size_t n) {
+            // the output starts at a different offset than the input
+            std::vector<T, Vc::Allocator<T>> out(n + 3, T(-1));
+            auto end = simd_transform_streaming(data.begin() + offset,
+                                                data.begin() + offset + n, out.begin() + 1,
+                                                [](auto v) { return v + v; });
+            COMPARE(end - out.begin(), std::ptrdiff_t(n + 1));
+            COMPARE(out[0], T(-1));
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(out[i + 1], T(2 * data[offset + i]))
+                    << "offset: " << offset << ", i: " << i;
+            }
+            COMPARE(out[n + 1], T(-1));
+
+            end = simd_transform_streaming(data.begin() + offset, data.begin() + offset + n,
+                                           data.begin() + 1, out.begin() + 2,
+                                           [](auto a, auto b) { return a * b; });
+            COMPARE(end - out.begin(), std::ptrdiff_t(n + 2));
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(out[i + 2], T(data[offset + i] * data[i + 1]))
+                    << "offset: " << offset << ", i: " << i;
+            }
+
+            auto inplace = data;
+            simd_for_each_streaming(inplace.begin() + offset, inplace.begin() + offset + n,
+                                    [](auto &v) { v += 1; });
+            for (std::size_t i = 0; i < inplace.size(); ++i) {
+                const bool inRange = i >= offset && i < offset + n;
+                COMPARE(inplace[i], inRange ? T(data[i] + 1) : data[i]) << "i: " << i;
+            }
+        });
+    }
+    set_streaming_store_threshold(threshold);
+    COMPARE(streaming_store_threshold(), threshold);
+}
+
+TEST_TYPES(V, simdReduce, AllVectors)
+{
+    typedef typename V::EntryType T;
+    const auto data = makeData<T>(20 * V::Size);
+    forAllSubranges<V>(data.size(), [&](std::size_t offset, std::size_t n) {
+        const auto first = data.begin() + offset;
+        const auto last = first + n;
+        COMPARE(simd_reduce(first, last, T(1)), std::accumulate(first, last, T(1)))
+            << "offset: " << offset << ", n: " << n;
+        COMPARE(simd_reduce(first, last, T(3), minimum()),
+                std::accumulate(first, last, T(3), minimum()));
+        COMPARE(simd_reduce(first, last, T(3), maximum()),
+                std::accumulate(first, last, T(3), maximum()));
+        // an unknown reduction operation is reduced entry by entry
+        COMPARE(simd_reduce(first, last, T(0), [](auto a, auto b) { return a + b + 1; }),
+                std::accumulate(first, last, T(0),
+                                [](T a, T b) { return T(a + b + 1); }))
+            << "offset: " << offset << ", n: " << n;
+        COMPARE(simd_transform_reduce(first, last, T(0), minimum(),
+                                      [](auto v) { return -v; }),
+                std::accumulate(first, last, T(0),
+                                [](T a, T b) { return std::min(a, T(-b)); }));
+        COMPARE(simd_transform_reduce(first, last, data.begin(), T(2)),
+                std::inner_product(first, last, data.begin(), T(2)))
+            << "offset: " << offset << ", n: " << n;
+        COMPARE(simd_transform_reduce(first, last, data.begin(), T(0), maximum(),
+                                      [](auto a, auto b) { return a - b; }),
+                std::inner_product(first, last, data.begin(), T(0), maximum(),
+                                   [](T a, T b) { return T(a - b); }));
+    });
+}
+
+TEST_TYPES(V, simdInclusiveScan, AllVectors)
+{
+    typedef typename V::EntryType T;
+    const auto data = makeData<T>(10 * V::Size);
+    forAllSubranges<V>(data.size(), [&](std::size_t offset, std::size_t n) {
+        const auto first = data.begin() + offset;
+        std::vector<T> out(n), reference(n);
+        std::partial_sum(first, first + n, reference.begin());
+        COMPARE(simd_inclusive_scan(first, first + n, out.begin()) - out.begin(),
+                std::ptrdiff_t(n));
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], reference[i]) << "offset: " << offset << ", i: " << i;
+        }
+
+        auto inplace = data;
+        simd_inclusive_scan(inplace.begin() + offset, inplace.begin() + offset + n,
+                            inplace.begin() + offset);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(inplace[offset + i], reference[i]) << "offset: " << offset << ", i: " << i;
+        }
+    });
+}
+
+TEST_TYPES(V, simdFind, AllVectors)
+{
+    typedef typename V::EntryType T;
+    const auto data = makeData<T>(10 * V::Size);
+    forAllSubranges<V>(data.size(), [&](std::size_t offset, std::size_t n) {
+        const auto first = data.begin() + offset;
+        for (T x = 0; x < 8; ++x) {
+            COMPARE(simd_find(first, first + n, x) - first,
+                    std::find(first, first + n, x) - first)
+                << "offset: " << offset << ", n: " << n << ", x: " << x;
+        }
+        COMPARE(simd_find_if(first, first + n, [](auto v) { return v > 4; }) - first,
+                std::find_if(first, first + n, [](T x) { return x > 4; }) - first)
+            << "offset: " << offset << ", n: " << n;
+    });
+
+    // a single match at every position, also inside the unrolled loop
+    std::vector<T, Vc::Allocator<T>> zeros(12 * V::Size + 3, T(0));
+    for (std::size_t offset = 0; offset <= V::Size; ++offset) {
+        const auto first = zeros.begin() + offset;
+        const auto last = zeros.end();
+        COMPARE(simd_find(first, last, T(1)) - first, last - first);
+        for (auto it = first; it != last; ++it) {
+            *it = T(1);
+            COMPARE(simd_find(first, last, T(1)) - first, it - first);
+            *it = T(0);
+        }
+    }
+}
+
+TEST_TYPES(V, simdCount, AllVectors)
+{
+    typedef typename V::EntryType T;
+    const auto data = makeData<T>(10 * V::Size);
+    forAllSubranges<V>(data.size(), [&](std::size_t offset, std::size_t n) {
+        const auto first = data.begin() + offset;
+        for (T x = 0; x < 8; ++x) {
+            COMPARE(simd_count(first, first + n, x), std::count(first, first + n, x))
+                << "offset: " << offset << ", n: " << n << ", x: " << x;
+        }
+        COMPARE(simd_count_if(first, first + n, [](auto v) { return v < 3; }),
+                std::count_if(first, first + n, [](T x) { return x < 3; }))
+            << "offset: " << offset << ", n: " << n;
+    });
+}
+
+TEST_TYPES(V, simdCopyIfRemoveIf, AllVectors)
+{
+    typedef typename V::EntryType T;
+    const auto data = makeData<T>(10 * V::Size);
+    forAllSubranges<V>(data.size(), [&](std::size_t offset, std::size_t n) {
+        const auto first = data.begin() + offset;
+        std::vector<T> out(n + 1, T(-1)), reference(n + 1, T(-1));
+        const auto end = simd_copy_if(first, first + n, out.begin() + 1,
+                                      [](auto v) { return v > 2; });
+        const auto refEnd = std::copy_if(first, first + n, reference.begin() + 1,
+                                         [](T x) { return x > 2; });
+        COMPARE(end - out.begin(), refEnd - reference.begin())
+            << "offset: " << offset << ", n: " << n;
+        for (std::size_t i = 0; i <= n; ++i) {
+            COMPARE(out[i], reference[i]) << "offset: " << offset << ", i: " << i;
+        }
+
+        auto inplace = data;
+        auto inplaceRef = data;
+        const auto newEnd =
+            simd_remove_if(inplace.begin() + offset, inplace.begin() + offset + n,
+                           [](auto v) { return v > 2; });
+        const auto refNewEnd =
+            std::remove_if(inplaceRef.begin() + offset, inplaceRef.begin() + offset + n,
+                           [](T x) { return x > 2; });
+        COMPARE(newEnd - inplace.begin(), refNewEnd - inplaceRef.begin())
+            << "offset: " << offset << ", n: " << n;
+        for (auto i = std::size_t(newEnd - inplace.begin()); i-- > 0;) {
+            COMPARE(inplace[i], inplaceRef[i]) << "offset: " << offset << ", n: " << n;
+        }
+        for (std::size_t i = offset + n; i < inplace.size(); ++i) {
+            COMPARE(inplace[i], data[i]) << "offset: " << offset << ", n: " << n;
+        }
+    });
+}
+
+TEST_TYPES(V, simdMinMaxElement, AllVectors)
+{
+    typedef typename V::EntryType T;
+    const auto data = makeData<T>(10 * V::Size);
+    forAllSubranges<V>(data.size(), [&](std::size_t offset, std::size_t n) {
+        const auto first = data.begin() + offset;
+        COMPARE(simd_min_element(first, first + n) - first,
+                std::min_element(first, first + n) - first)
+            << "offset: " << offset << ", n: " << n;
+        COMPARE(simd_max_element(first, first + n) - first,
+                std::max_element(first, first + n) - first)
+            << "offset: " << offset << ", n: " << n;
+    });
+}
+
+TEST_TYPES(V, simdAlgorithmsOnMemory, AllVectors)
+{
+    typedef typename V::EntryType T;
+    Memory<V, 5 * V::Size + 1> in;
+    Memory<V> out(in.entriesCount());
+    T sum = 0;
+    for (std::size_t i = 0; i < in.entriesCount(); ++i) {
+        in[i] = T(i % 5);
+        sum += in[i];
+    }
+    COMPARE(simd_reduce(in, T(0)), sum);
+    COMPARE(simd_reduce(in, T(0), maximum()), T(4));
+    COMPARE(simd_transform_reduce(in, T(0), [](auto a, auto b) { return a + b; },
+                                  [](auto v) { return v + v; }),
+            T(2 * sum));
+    simd_transform(in, out, [](auto v) { return v + 1; });
+    for (std::size_t i = 0; i < in.entriesCount(); ++i) {
+        COMPARE(out[i], T(in[i] + 1));
+    }
+    simd_inclusive_scan(in, out);
+    COMPARE(out[out.entriesCount() - 1], sum);
+    simd_inclusive_scan(out, out);
+    COMPARE(out[0], T(0));
+    COMPARE(out[2], T(0 + 1 + 3));
+}
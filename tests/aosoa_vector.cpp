@@ -0,0 +1,229 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/aosoa_vector>
+#include <tuple>
+
+template <typename T> struct PointTemplate {
+    T x, y, z;
+
+    Vc_SIMDIZE_INTERFACE((x, y, z));
+};
+using Point = PointTemplate<float>;
+
+template <typename T, typename U> struct Particle {
+    Particle(T p, T v, U id_) : pos(p), vel(v), id(id_) {}
+    T pos, vel;
+    U id;
+
+    Vc_SIMDIZE_INTERFACE((pos, vel, id));
+};
+
+static Point makePoint(int i) { return {float(i), float(2 * i), float(-i)}; }
+
+TEST(push_back_and_scalar_access) //{{{1
+{
+    Vc::aosoa_vector<Point> v;
+    constexpr std::size_t W = Vc::aosoa_vector<Point>::vectorSize();
+    COMPARE(W, Vc::float_v::size());
+    VERIFY(v.empty());
+    for (int i = 0; i < 3 * int(W) + 1; ++i) {
+        v.push_back(makePoint(i));
+        COMPARE(v.size(), std::size_t(i + 1));
+        COMPARE(v.vectorsCount(), (std::size_t(i) + W) / W);
+    }
+    for (int i = 0; i < int(v.size()); ++i) {
+        const Point p = static_cast<const Vc::aosoa_vector<Point> &>(v)[i];
+        COMPARE(p.x, float(i));
+        COMPARE(p.y, float(2 * i));
+        COMPARE(p.z, float(-i));
+        COMPARE(float(v[i].get<2>()), float(-i));
+    }
+    v[1] = Point{7.f, 8.f, 9.f};
+    v[2].get<0>() = 11.f;
+    COMPARE(static_cast<Point>(v[1]).y, 8.f);
+    COMPARE(static_cast<Point>(v[2]).x, 11.f);
+    swap(v[1], v[2]);
+    COMPARE(static_cast<Point>(v[2]).y, 8.f);
+    COMPARE(static_cast<Point>(v[1]).x, 11.f);
+
+    v.pop_back();
+    COMPARE(v.size(), 3 * W);
+    COMPARE(v.vectorsCount(), 3u);
+    v.clear();
+    VERIFY(v.empty());
+    COMPARE(v.vectorsCount(), 0u);
+}
+
+TEST(tile_access) //{{{1
+{
+    using V = Vc::simdize<Point>;
+    Vc::aosoa_vector<Point> v;
+    const std::size_t n = 5 * V::size() / 2 + 1;
+    for (std::size_t i = 0; i < n; ++i) {
+        v.push_back(makePoint(int(i)));
+    }
+    for (std::size_t i = 0; i < v.vectorsCount(); ++i) {
+        const V &tile = static_cast<const Vc::aosoa_vector<Point> &>(v).vector(i);
+        const auto ref = Vc::float_v::IndexesFromZero() + float(i * V::size());
+        const auto valid = ref < float(n);
+        VERIFY(all_of(!valid || tile.x == ref));
+        VERIFY(all_of(!valid || tile.y == 2 * ref));
+        VERIFY(all_of(!valid || tile.z == -ref));
+    }
+    std::size_t count = 0;
+    for (V &p : v) {
+        p.x += p.y;
+        ++count;
+    }
+    COMPARE(count, v.vectorsCount());
+    for (std::size_t i = 0; i < n; ++i) {
+        COMPARE(static_cast<Point>(v[i]).x, float(3 * i)) << i;
+        COMPARE(static_cast<Point>(v[i]).z, -float(i)) << i;
+    }
+    COMPARE(v.end() - v.begin(), std::ptrdiff_t(v.vectorsCount()));
+    v.setVector(1, V(Point{1.f, 2.f, 3.f}));
+    COMPARE(static_cast<Point>(v[V::size()]).z, 3.f);
+    const auto &cv = v;
+    COMPARE(cv.begin()[1].y[0], 2.f);
+}
+
+TEST(alignment) //{{{1
+{
+    Vc::aosoa_vector<Point> v;
+    for (int i = 0; i < 100; ++i) {
+        v.push_back(makePoint(i));
+    }
+    for (std::size_t i = 0; i < v.vectorsCount(); ++i) {
+        COMPARE(reinterpret_cast<std::uintptr_t>(&v.vector(i)) % 64, 0u) << i;
+    }
+    v.reserve(1000);
+    VERIFY(v.capacity() >= 1000u);
+    COMPARE(reinterpret_cast<std::uintptr_t>(&v.vector(0)) % 64, 0u);
+    COMPARE(v.size(), 100u);
+    COMPARE(static_cast<Point>(v[99]).y, 198.f);
+}
+
+TEST(resize_overwrites_padding) //{{{1
+{
+    using V = Vc::simdize<Point>;
+    Vc::aosoa_vector<Point> v;
+    v.resize(1);
+    COMPARE(static_cast<Point>(v[0]).x, 0.f);
+    // write the padding entries of the first tile
+    v.vector(0) = V(Point{5.f, 6.f, 7.f});
+    v.resize(2 * V::size() + 1);
+    COMPARE(static_cast<Point>(v[0]).x, 5.f);
+    for (std::size_t i = 1; i < v.size(); ++i) {
+        const Point p = v[i];
+        COMPARE(p.x, 0.f) << i;
+        COMPARE(p.y, 0.f) << i;
+        COMPARE(p.z, 0.f) << i;
+    }
+    v.resize(4 * V::size(), Point{1.f, 2.f, 3.f});
+    COMPARE(v.size(), 4 * V::size());
+    COMPARE(static_cast<Point>(v[2 * V::size()]).x, 0.f);
+    COMPARE(static_cast<Point>(v[2 * V::size() + 1]).z, 3.f);
+    COMPARE(static_cast<Point>(v[4 * V::size() - 1]).y, 2.f);
+
+    Vc::aosoa_vector<Point> w(3, Point{4.f, 4.f, 4.f});
+    COMPARE(w.size(), 3u);
+    COMPARE(static_cast<Point>(w[2]).z, 4.f);
+}
+
+TEST(bulk_conversion) //{{{1
+{
+    for (std::size_t n : {std::size_t(0), std::size_t(1), Vc::float_v::size(),
+                          3 * Vc::float_v::size() + 2}) {
+        std::vector<Point> aos;
+        for (int i = 0; i < int(n); ++i) {
+            aos.push_back(makePoint(i));
+        }
+        Vc::aosoa_vector<Point> v(aos.data(), aos.size());
+        COMPARE(v.size(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            const Point p = v[i];
+            COMPARE(p.x, aos[i].x) << i;
+            COMPARE(p.y, aos[i].y) << i;
+            COMPARE(p.z, aos[i].z) << i;
+        }
+        for (auto &p : v) {
+            p.z *= 2.f;
+        }
+        std::vector<Point> out(n, Point{-1.f, -1.f, -1.f});
+        v.copyTo(out.data());
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i].x, aos[i].x) << i;
+            COMPARE(out[i].y, aos[i].y) << i;
+            COMPARE(out[i].z, 2 * aos[i].z) << i;
+        }
+    }
+    const Vc::aosoa_vector<Point> w = {Point{1.f, 2.f, 3.f}, Point{4.f, 5.f, 6.f}};
+    COMPARE(w.size(), 2u);
+    COMPARE(w[1].y, 5.f);
+}
+
+TEST(mixed_member_types) //{{{1
+{
+    using P = Particle<float, int>;
+    std::vector<P> aos;
+    for (int i = 0; i < 50; ++i) {
+        aos.emplace_back(float(i), 0.5f, i);
+    }
+    Vc::aosoa_vector<P> v(aos.data(), aos.size());
+    for (auto &p : v) {
+        p.pos += p.vel;
+        p.id *= 2;
+    }
+    v.emplace_back(1.f, 2.f, 3);
+    v.copyTo(aos.data());
+    for (int i = 0; i < 50; ++i) {
+        COMPARE(aos[i].pos, i + 0.5f);
+        COMPARE(aos[i].id, 2 * i);
+    }
+    COMPARE(static_cast<P>(v[50]).id, 3);
+
+    using T = std::tuple<double, float, short>;
+    Vc::aosoa_vector<T> t;
+    for (int i = 0; i < 37; ++i) {
+        t.push_back(T(i, 2 * i, short(3 * i)));
+    }
+    for (auto &x : t) {
+        std::get<0>(x) += 1.;
+        std::get<2>(x) += 1;
+    }
+    for (int i = 0; i < 37; ++i) {
+        const T x = t[i];
+        COMPARE(std::get<0>(x), i + 1.);
+        COMPARE(std::get<1>(x), 2.f * i);
+        COMPARE(std::get<2>(x), short(3 * i + 1));
+    }
+}
+
+// vim: foldmethod=marker
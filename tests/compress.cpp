@@ -0,0 +1,125 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+
+using namespace Vc;
+
+using CompressTypes = vir::concat<
+    AllTypes, vir::Typelist<Vc::schar_v, Vc::uchar_v, Vc::llong_v, Vc::ullong_v>>;
+
+template <typename V> void testMask(const V &x, const typename V::Mask &k) //{{{1
+{
+    using T = typename V::EntryType;
+    const V c = x.compress(k);
+    const V e = c.expand(k);
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        if (k[i]) {
+            COMPARE(c[n], x[i]) << "k: " << k << " i: " << i;
+            ++n;
+            COMPARE(e[i], x[i]) << "k: " << k << " i: " << i;
+        } else {
+            COMPARE(e[i], T(0)) << "k: " << k << " i: " << i;
+        }
+    }
+    COMPARE(n, std::size_t(k.count()));
+    for (std::size_t i = n; i < V::Size; ++i) {
+        COMPARE(c[i], T(0)) << "k: " << k << " i: " << i;
+    }
+
+    // compress_store writes exactly k.count() entries, expand_load reads them back
+    T mem[V::Size + 2];
+    std::fill_n(mem, V::Size + 2, T(-1));
+    COMPARE(compress_store(&mem[1], k, x), n);
+    COMPARE(mem[0], T(-1));
+    for (std::size_t i = 0; i < n; ++i) {
+        COMPARE(mem[i + 1], c[i]) << "k: " << k << " i: " << i;
+    }
+    for (std::size_t i = n + 1; i < V::Size + 2; ++i) {
+        COMPARE(mem[i], T(-1)) << "k: " << k << " i: " << i;
+    }
+    COMPARE(expand_load<V>(&mem[1], k), e) << "k: " << k;
+}
+
+TEST_TYPES(V, compressExpand, CompressTypes) //{{{1
+{
+    const V x = V::IndexesFromZero() + 1;
+    testMask(x, typename V::Mask(true));
+    testMask(x, typename V::Mask(false));
+    if (V::Size <= 16) {
+        for (std::size_t i = 0; i < (std::size_t(1) << V::Size); ++i) {
+            testMask(x, allMasks<V>(i));
+        }
+    } else {
+        withRandomMask<V, 2000>([&](const typename V::Mask &k) { testMask(x, k); });
+    }
+}
+
+TEST_TYPES(V, streamCompaction, CompressTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t N = 8 * V::Size + 3;
+    T in[N];
+    for (std::size_t i = 0; i < N; ++i) {
+        in[i] = T(i % 7);
+    }
+    T out[N + V::Size];
+    T *end = &out[0];
+    std::size_t i = 0;
+    for (; i + V::Size <= N; i += V::Size) {
+        const V v(&in[i], Vc::Unaligned);
+        end += compress_store(end, v > T(2), v);
+    }
+    for (; i < N; ++i) {
+        if (in[i] > T(2)) {
+            *end++ = in[i];
+        }
+    }
+    T reference[N];
+    T *const refEnd = std::copy_if(std::begin(in), std::end(in), reference,
+                                   [](T x) { return x > T(2); });
+    COMPARE(end - &out[0], refEnd - &reference[0]);
+    for (std::size_t j = 0; j < std::size_t(refEnd - &reference[0]); ++j) {
+        COMPARE(out[j], reference[j]) << "j: " << j;
+    }
+}
+
+TEST(preservesBits) //{{{1
+{
+    // compress/expand must not alter the payload, e.g. the sign of zero or NaN bits
+    const float_v x = float_v::generate([](int i) { return i % 2 ? -0.f : 1.f; });
+    const float_m k = x == 0.f;
+    const float_v c = x.compress(k);
+    for (std::size_t i = 0; i < std::size_t(k.count()); ++i) {
+        VERIFY(std::signbit(c[i]));
+    }
+    const float_v e = c.expand(k);
+    for (std::size_t i = 0; i < float_v::Size; ++i) {
+        COMPARE(std::signbit(e[i]), bool(k[i]));
+    }
+}
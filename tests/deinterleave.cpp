@@ -85,3 +85,65 @@ TEST_TYPES(Pair, testDeinterleave,
         COMPARE(b, _0246 + i + 1);
     }
 }
+
+template <typename V, typename M, std::size_t... Ks>
+void testNWay(Vc::index_sequence<Ks...>)
+{
+    constexpr std::size_t N = sizeof...(Ks);
+    using T = typename V::EntryType;
+    // one extra struct on either side to detect out-of-bounds accesses
+    M memory[(V::Size + 2) * N];
+    for (std::size_t i = 0; i < (V::Size + 2) * N; ++i) {
+        memory[i] = static_cast<M>(i % 101);
+    }
+    V v[N];
+    Vc::deinterleave(&memory[N], v[Ks]...);
+    for (std::size_t k = 0; k < N; ++k) {
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(v[k][i], static_cast<T>(((i + 1) * N + k) % 101))
+                << "N: " << N << ", k: " << k << ", i: " << i;
+        }
+    }
+
+    for (std::size_t k = 0; k < N; ++k) {
+        v[k] = V([&](std::size_t i) { return static_cast<T>((i * 7 + k * 3) % 97); });
+    }
+    Vc::interleave(&memory[N], v[Ks]...);
+    for (std::size_t i = 0; i < (V::Size + 2) * N; ++i) {
+        const std::size_t structIndex = i / N;
+        const std::size_t k = i % N;
+        if (structIndex == 0 || structIndex == V::Size + 1) {
+            COMPARE(memory[i], static_cast<M>(i % 101)) << "N: " << N << ", i: " << i;
+        } else {
+            COMPARE(memory[i], static_cast<M>(((structIndex - 1) * 7 + k * 3) % 97))
+                << "N: " << N << ", i: " << i;
+        }
+    }
+}
+
+TEST_TYPES(Pair, testNWayDeinterleave,
+           vir::Typelist<vir::Typelist<float_v, float>,
+                         vir::Typelist<float_v, unsigned char>,
+                         vir::Typelist<float_v, short>,
+                         vir::Typelist<double_v, double>,
+                         vir::Typelist<double_v, float>,
+                         vir::Typelist<int_v, int>,
+                         vir::Typelist<int_v, unsigned char>,
+                         vir::Typelist<uint_v, unsigned int>,
+                         vir::Typelist<short_v, short>,
+                         vir::Typelist<short_v, unsigned char>,
+                         vir::Typelist<ushort_v, unsigned short>,
+                         vir::Typelist<Vc::SimdArray<float, 16>, unsigned char>,
+                         vir::Typelist<Vc::SimdArray<double, 4>, double>,
+                         vir::Typelist<Vc::SimdArray<int, 3>, int>>)
+{
+    typedef typename Pair::template at<0> V;
+    typedef typename Pair::template at<1> M;
+    testNWay<V, M>(Vc::make_index_sequence<2>());
+    testNWay<V, M>(Vc::make_index_sequence<3>());
+    testNWay<V, M>(Vc::make_index_sequence<4>());
+    testNWay<V, M>(Vc::make_index_sequence<5>());
+    testNWay<V, M>(Vc::make_index_sequence<6>());
+    testNWay<V, M>(Vc::make_index_sequence<7>());
+    testNWay<V, M>(Vc::make_index_sequence<8>());
+}
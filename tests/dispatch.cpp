@@ -0,0 +1,163 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <vector>
+#include <Vc/dispatch.h>
+#include "dispatch_kernel.h"
+
+// Vc_DISPATCH_TEST_IMPLEMENTATIONS is the list of Vc::ImplementationT types
+// dispatch_kernel.cpp was compiled for (see CMakeLists.txt)
+using SaxpyDispatcher = Vc::ImplementationDispatcher<Saxpy, Vc_DISPATCH_TEST_IMPLEMENTATIONS>;
+
+template <typename Impl>
+static constexpr unsigned int featuresOf = Vc::Detail::ImplementationFeatures<Impl>::value;
+
+// calls f(Impl()) for every compiled implementation
+template <typename... Impls> struct ImplementationList {
+    template <typename F> static void forEach(F &&f)
+    {
+        const auto unused = {(f(Impls()), 0)...};
+        (void)unused;
+    }
+};
+using CompiledImplementations = ImplementationList<Vc_DISPATCH_TEST_IMPLEMENTATIONS>;
+
+static unsigned int implementationPart(unsigned int features)
+{
+    return features & Vc::ImplementationMask;
+}
+
+static bool isSubset(unsigned int a, unsigned int b) { return (a & b) == a; }
+
+static void saxpyReference(float a, const float *x, float *y, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        y[i] = a * x[i] + y[i];
+    }
+}
+
+static void compareToReference(const std::vector<float> &y, const std::vector<float> &ref)
+{
+    for (std::size_t i = 0; i < y.size(); ++i) {
+        COMPARE(y[i], ref[i]) << "i = " << i << ", n = " << y.size();
+    }
+}
+
+static void fill(float *x, float *y, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        // small integers keep a * x + y exact, with or without FMA contraction
+        x[i] = static_cast<float>(i % 17);
+        y[i] = static_cast<float>(i % 5) - 2.f;
+    }
+}
+
+// the features of the kernel call() dispatches to
+static unsigned int selectedFeatures()
+{
+    float x = 1.f, y = 1.f;
+    return SaxpyDispatcher::call(1.f, &x, &y, 1);
+}
+
+TEST(selectsBestSupported)
+{
+    const unsigned int selected = selectedFeatures();
+    COMPARE(implementationPart(selected), unsigned(SaxpyDispatcher::implementation()));
+    bool selectedIsCompiled = false;
+    CompiledImplementations::forEach([&](auto impl) {
+        using Impl = decltype(impl);
+        const unsigned int features = featuresOf<Impl>;
+        if (features == selected) {
+            selectedIsCompiled = true;
+            // the extra instructions must be supported as well, not only the
+            // Vc::Implementation
+            VERIFY(Vc::isImplementationSupported<Impl>());
+        } else if (Vc::isImplementationSupported<Impl>()) {
+            VERIFY(implementationPart(features) <= implementationPart(selected))
+                << std::hex << features << " is supported but " << selected
+                << " was selected";
+            if (implementationPart(features) == implementationPart(selected)) {
+                VERIFY(!isSubset(selected, features))
+                    << std::hex << features << " is supported and a superset of the "
+                    << selected << " that was selected";
+            }
+        }
+    });
+    VERIFY(selectedIsCompiled);
+}
+
+TEST(skipsUnsupportedExtraInstructions)
+{
+    // a kernel compiled with extra instructions the system lacks is never selected, even
+    // if its Vc::Implementation is supported
+    const unsigned int selected = selectedFeatures();
+    const unsigned int extra = Vc::extraInstructionsSupported();
+    VERIFY(isSubset(selected & Vc::ExtraInstructionsMask, extra))
+        << std::hex << selected << " requires instructions missing from " << extra;
+}
+
+TEST(callsSelectedKernel)
+{
+    const unsigned int selected = selectedFeatures();
+    // odd sizes exercise the scalar epilogue of the kernel
+    for (std::size_t n : {0u, 1u, 7u, 64u, 101u}) {
+        std::vector<float> x(n), y(n), ref(n);
+        fill(x.data(), y.data(), n);
+        ref = y;
+        saxpyReference(3.f, x.data(), ref.data(), n);
+        // the first call resolves, the second uses the cached pointer
+        const unsigned int called =
+            Vc::dispatch<Saxpy, Vc_DISPATCH_TEST_IMPLEMENTATIONS>(3.f, x.data(), y.data(), n);
+        COMPARE(called, selected);
+        compareToReference(y, ref);
+        fill(x.data(), y.data(), n);
+        const unsigned int calledAgain = SaxpyDispatcher::call(3.f, x.data(), y.data(), n);
+        COMPARE(calledAgain, selected);
+        compareToReference(y, ref);
+    }
+}
+
+TEST(allSupportedKernelsAgree)
+{
+    constexpr std::size_t n = 99;
+    std::vector<float> x(n), y(n), ref(n);
+    fill(x.data(), ref.data(), n);
+    saxpyReference(-2.f, x.data(), ref.data(), n);
+    CompiledImplementations::forEach([&](auto impl) {
+        using Impl = decltype(impl);
+        const auto f = SaxpyDispatcher::function<Impl>();
+        VERIFY(f != nullptr);
+        if (Vc::isImplementationSupported<Impl>()) {
+            fill(x.data(), y.data(), n);
+            const unsigned int called = f(-2.f, x.data(), y.data(), n);
+            COMPARE(called, featuresOf<Impl>);
+            compareToReference(y, ref);
+        }
+    });
+    VERIFY(SaxpyDispatcher::function<Vc::ImplementationT<Vc::MICImpl>>() == nullptr);
+}
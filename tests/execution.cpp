@@ -0,0 +1,185 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/execution>
+#include <Vc/Memory>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace Vc;
+
+TEST(threadPoolCoversAllIterations)
+{
+    Common::ThreadPool pool(3);
+    COMPARE(pool.concurrency(), 4u);
+    for (std::size_t n : {0u, 1u, 2u, 5u, 1000u}) {
+        std::vector<std::atomic<int>> counts(n);
+        for (auto &c : counts) {
+            c = 0;
+        }
+        pool.parallel_for(n, [&](std::size_t i) { ++counts[i]; });
+        for (std::size_t i = 0; i < n; ++i) {
+            const int c = counts[i];
+            COMPARE(c, 1) << "i = " << i << ", n = " << n;
+        }
+    }
+}
+
+TEST(threadPoolNested)
+{
+    Common::ThreadPool pool(2);
+    std::atomic<int> count(0);
+    pool.parallel_for(10, [&](std::size_t) {
+        // runs sequentially on the thread executing the outer iteration
+        pool.parallel_for(10, [&](std::size_t) { ++count; });
+    });
+    const int c = count;
+    COMPARE(c, 100);
+}
+
+TEST(threadPoolException)
+{
+    Common::ThreadPool pool(2);
+    bool thrown = false;
+    try {
+        pool.parallel_for(100, [](std::size_t i) {
+            if (i == 17) {
+                throw std::runtime_error("17");
+            }
+        });
+    } catch (const std::runtime_error &e) {
+        thrown = true;
+        COMPARE(std::string(e.what()), "17");
+    }
+    VERIFY(thrown);
+
+    // the pool remains usable
+    std::atomic<int> count(0);
+    pool.parallel_for(100, [&](std::size_t) { ++count; });
+    const int c = count;
+    COMPARE(c, 100);
+}
+
+struct TwicePlusOne {
+    template <typename W> void operator()(W &x) const { x = x + x + W(1); }
+};
+
+template <typename T> struct SumEntries {
+    std::atomic<std::size_t> *count;
+    std::atomic<std::size_t> *sum;
+    template <typename W> void operator()(W x) const
+    {
+        *count += W::Size;
+        for (std::size_t i = 0; i < W::Size; ++i) {
+            *sum += static_cast<std::size_t>(x[i]);
+        }
+    }
+};
+
+TEST_TYPES(V, parallelSimdForEach, AllVectors)
+{
+    using T = typename V::EntryType;
+    Common::ThreadPool pool(3);
+    // small chunks to get many of them and thus aligned and unaligned boundaries
+    const auto policy = execution::par_simd.chunk_size(3 * sizeof(V)).on(pool);
+
+    std::vector<T, Vc::Allocator<T>> data(1021 + V::Size);
+    for (std::size_t offset = 0; offset <= V::Size; ++offset) {
+        for (std::size_t n : {std::size_t(0), std::size_t(1), std::size_t(V::Size + 1),
+                              std::size_t(1021)}) {
+            for (int variant = 0; variant < 2; ++variant) {
+                std::size_t expectedSum = 0;
+                for (std::size_t i = 0; i < data.size(); ++i) {
+                    data[i] = T(i % 7);
+                    if (i >= offset && i < offset + n) {
+                        expectedSum += i % 7;
+                    }
+                }
+                std::atomic<std::size_t> count(0), sum(0);
+                const auto first = data.begin() + offset;
+                if (variant == 0) {
+                    simd_for_each(policy, first, first + n, SumEntries<T>{&count, &sum});
+                    simd_for_each(policy, first, first + n, TwicePlusOne());
+                } else {
+                    simd_for_each_n(policy, first, n, SumEntries<T>{&count, &sum});
+                    simd_for_each_n(policy, first, n, TwicePlusOne());
+                }
+                const std::size_t c = count, s = sum;
+                COMPARE(c, n) << "offset = " << offset;
+                COMPARE(s, expectedSum) << "offset = " << offset << ", n = " << n;
+                for (std::size_t i = 0; i < data.size(); ++i) {
+                    const T expected =
+                        i >= offset && i < offset + n ? T(2 * (i % 7) + 1) : T(i % 7);
+                    COMPARE(data[i], expected) << "i = " << i << ", offset = " << offset
+                                               << ", n = " << n;
+                }
+            }
+        }
+    }
+}
+
+TEST(parallelSimdForEachGlobalPool)
+{
+    std::vector<float> data(100000, 1.f);
+    simd_for_each(execution::par_simd, data.begin(), data.end(), TwicePlusOne());
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        COMPARE(data[i], 3.f) << "i = " << i;
+    }
+}
+
+TEST_TYPES(V, firstTouch, AllVectors)
+{
+    using T = typename V::EntryType;
+    Common::ThreadPool pool(3);
+    const auto policy = execution::par_simd.chunk_size(4096).on(pool);
+
+    std::vector<T, Vc::Allocator<T>> data(5 * 4096 + 3 * V::Size, T(1));
+    for (std::size_t offset : {std::size_t(0), std::size_t(1), V::Size + 1}) {
+        for (std::size_t n : {std::size_t(0), std::size_t(7), std::size_t(4096 / sizeof(T)),
+                              std::size_t(4 * 4096 + 1)}) {
+            std::fill(data.begin(), data.end(), T(1));
+            first_touch(policy, &data[offset], n, T(5));
+            for (std::size_t i = 0; i < data.size(); ++i) {
+                const T expected = i >= offset && i < offset + n ? T(5) : T(1);
+                COMPARE(data[i], expected) << "i = " << i << ", offset = " << offset
+                                           << ", n = " << n;
+            }
+        }
+    }
+
+    Memory<V> mem(3 * 4096 + 1, Vc::AlignOnHugePage);
+    VERIFY(reinterpret_cast<std::uintptr_t>(mem.entries()) % (2 * 1024 * 1024) == 0);
+    first_touch(policy, mem, T(3));
+    for (std::size_t i = 0; i < mem.entriesCount(); ++i) {
+        COMPARE(mem[i], T(3)) << "i = " << i;
+    }
+    for (std::size_t i = mem.entriesCount(); i < mem.vectorsCount() * V::Size; ++i) {
+        COMPARE(mem[i], T(0)) << "i = " << i;
+    }
+}
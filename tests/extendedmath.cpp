@@ -0,0 +1,257 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+/*includes {{{*/
+#include "unittest.h"
+#include <cmath>
+#include <limits>
+/*}}}*/
+using namespace Vc;
+
+// fix isfinite and isnan {{{1
+#ifdef isfinite
+#undef isfinite
+#endif
+#ifdef isnan
+#undef isnan
+#endif
+
+// The reference values are computed with the long double functions of the standard
+// library, which are sufficiently more precise than the float and double results under
+// test.
+
+// testUnary {{{1
+template <typename V, typename F, typename R>
+void testUnary(F &&fun, R &&reference, typename V::EntryType lo, typename V::EntryType hi)
+{
+    using T = typename V::EntryType;
+    for (size_t i = 0; i < 20000 / V::Size; ++i) {
+        const V x = lo + V::Random() * (hi - lo);
+        const V ref = x.apply([&](T _x) { return T(reference(static_cast<long double>(_x))); });
+        FUZZY_COMPARE(fun(x), ref) << ", x = " << x << ", i = " << i;
+    }
+}
+
+// testSpecialValues {{{1
+template <typename V, typename F, typename R> void testSpecialValues(F &&fun, R &&reference)
+{
+    using T = typename V::EntryType;
+    using limits = std::numeric_limits<T>;
+    const T values[] = {T(0),          T(-0.),         T(1),           T(-1),
+                        limits::infinity(), -limits::infinity(), limits::min(),
+                        -limits::min(), limits::denorm_min(),  limits::max(),
+                        -limits::max()};
+    for (T v : values) {
+        const T ref = reference(v);
+        const V r = fun(V(v));
+        if (std::isnan(ref)) {
+            VERIFY(all_of(isnan(r))) << "x = " << v << ", r = " << r;
+        } else {
+            FUZZY_COMPARE(r, V(ref)) << ", x = " << v;
+            COMPARE(isnegative(r), isnegative(V(ref))) << ", x = " << v << ", r = " << r;
+        }
+    }
+    VERIFY(all_of(isnan(fun(V(limits::quiet_NaN())))));
+}
+
+TEST_TYPES(V, testExpm1, RealTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    const auto f = [](const V &x) { return Vc::expm1(x); };
+    const auto ref = [](long double x) { return std::expm1(x); };
+    testUnary<V>(f, ref, T(-1e-3), T(1e-3));
+    testUnary<V>(f, ref, T(-2), T(2));
+    testUnary<V>(f, ref, T(-50), T(50));
+    testSpecialValues<V>(f, ref);
+}
+
+TEST_TYPES(V, testLog1p, RealTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(1);
+    const auto f = [](const V &x) { return Vc::log1p(x); };
+    const auto ref = [](long double x) { return std::log1p(x); };
+    testUnary<V>(f, ref, T(-1e-3), T(1e-3));
+    testUnary<V>(f, ref, T(-1), T(2));
+    testUnary<V>(f, ref, T(0), T(1e6));
+    testSpecialValues<V>(f, ref);
+}
+
+TEST_TYPES(V, testSinh, RealTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    const auto f = [](const V &x) { return Vc::sinh(x); };
+    const auto ref = [](long double x) { return std::sinh(x); };
+    testUnary<V>(f, ref, T(-1e-3), T(1e-3));
+    testUnary<V>(f, ref, T(-2), T(2));
+    testUnary<V>(f, ref, T(-80), T(80));
+    testSpecialValues<V>(f, ref);
+    // beyond ln(max) the result must not overflow prematurely
+    const T big = sizeof(T) == 8 ? T(710) : T(89);
+    FUZZY_COMPARE(Vc::sinh(V(big)), V(T(std::sinh(static_cast<long double>(big)))));
+}
+
+TEST_TYPES(V, testCosh, RealTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    const auto f = [](const V &x) { return Vc::cosh(x); };
+    const auto ref = [](long double x) { return std::cosh(x); };
+    testUnary<V>(f, ref, T(-1e-3), T(1e-3));
+    testUnary<V>(f, ref, T(-2), T(2));
+    testUnary<V>(f, ref, T(-80), T(80));
+    testSpecialValues<V>(f, ref);
+    const T big = sizeof(T) == 8 ? T(710) : T(89);
+    FUZZY_COMPARE(Vc::cosh(V(-big)), V(T(std::cosh(static_cast<long double>(big)))));
+}
+
+TEST_TYPES(V, testTanh, RealTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    setFuzzyness<float>(3);
+    setFuzzyness<double>(3);
+    const auto f = [](const V &x) { return Vc::tanh(x); };
+    const auto ref = [](long double x) { return std::tanh(x); };
+    testUnary<V>(f, ref, T(-1e-3), T(1e-3));
+    testUnary<V>(f, ref, T(-2), T(2));
+    testUnary<V>(f, ref, T(-30), T(30));
+    testSpecialValues<V>(f, ref);
+}
+
+TEST_TYPES(V, testErf, RealTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(1);
+    const auto f = [](const V &x) { return Vc::erf(x); };
+    const auto ref = [](long double x) { return std::erf(x); };
+    testUnary<V>(f, ref, T(-1e-3), T(1e-3));
+    testUnary<V>(f, ref, T(-2), T(2));
+    testUnary<V>(f, ref, T(-7), T(7));
+    testSpecialValues<V>(f, ref);
+}
+
+TEST_TYPES(V, testErfc, RealTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    setFuzzyness<float>(3);
+    setFuzzyness<double>(4);
+    const auto f = [](const V &x) { return Vc::erfc(x); };
+    const auto ref = [](long double x) { return std::erfc(x); };
+    testUnary<V>(f, ref, T(-1e-3), T(1e-3));
+    testUnary<V>(f, ref, T(-2), T(2));
+    // erfc(x) is denormal for x > 26.5 (double) and x > 9.1 (float)
+    testUnary<V>(f, ref, T(-6), sizeof(T) == 8 ? T(26) : T(9));
+    testSpecialValues<V>(f, ref);
+}
+
+TEST_TYPES(V, testCbrt, RealTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(4);  // glibc's std::cbrt (used by Scalar) is off by up to 3.4 ulp
+    const auto f = [](const V &x) { return Vc::cbrt(x); };
+    const auto ref = [](long double x) { return std::cbrt(x); };
+    testUnary<V>(f, ref, T(-1e-3), T(1e-3));
+    testUnary<V>(f, ref, T(-10), T(10));
+    testUnary<V>(f, ref, T(-1e30), T(1e30));
+    testSpecialValues<V>(f, ref);
+}
+
+TEST_TYPES(V, testHypot, RealTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    using limits = std::numeric_limits<T>;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(1);
+    for (size_t i = 0; i < 20000 / V::Size; ++i) {
+        const V x = (V::Random() - T(0.5)) * T(200);
+        const V y = (V::Random() - T(0.5)) * T(2);
+        const V ref = V::generate([&](size_t j) {
+            return T(std::hypot(static_cast<long double>(x[j]),
+                                static_cast<long double>(y[j])));
+        });
+        FUZZY_COMPARE(Vc::hypot(x, y), ref) << ", x = " << x << ", y = " << y;
+        FUZZY_COMPARE(Vc::hypot(y, x), ref) << ", x = " << x << ", y = " << y;
+    }
+    const V big = limits::max() * T(0.5);
+    FUZZY_COMPARE(Vc::hypot(big, big), V(T(std::hypot(static_cast<long double>(big[0]),
+                                                      static_cast<long double>(big[0])))));
+    const V tiny = limits::denorm_min() * T(4);
+    FUZZY_COMPARE(Vc::hypot(tiny, tiny * T(0.75)), tiny * T(1.25));
+    COMPARE(Vc::hypot(V::Zero(), V::Zero()), V::Zero());
+    COMPARE(Vc::hypot(V(limits::infinity()), V(limits::quiet_NaN())), V(limits::infinity()));
+    COMPARE(Vc::hypot(V(limits::quiet_NaN()), V(-limits::infinity())), V(limits::infinity()));
+    VERIFY(all_of(isnan(Vc::hypot(V(limits::quiet_NaN()), V(T(1))))));
+}
+
+TEST_TYPES(V, testPow, RealTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(3);
+    const auto test = [](const V &x, const V &y) {
+        const V ref = V::generate([&](size_t j) {
+            return T(std::pow(static_cast<long double>(x[j]), static_cast<long double>(y[j])));
+        });
+        FUZZY_COMPARE(Vc::pow(x, y), ref) << ", x = " << x << ", y = " << y;
+    };
+    for (size_t i = 0; i < 20000 / V::Size; ++i) {
+        test(V::Random() * T(10), (V::Random() - T(0.5)) * T(20));
+        test(V::Random() + T(0.5), (V::Random() - T(0.5)) * T(200));
+        test(V::Random() * T(1e-3), (V::Random() - T(0.5)) * T(10));
+        // negative bases with integral exponents
+        test(-V::Random() * T(10), round((V::Random() - T(0.5)) * T(20)));
+    }
+
+    // the special cases of std::pow
+    using limits = std::numeric_limits<T>;
+    const T inf = limits::infinity();
+    const T nan = limits::quiet_NaN();
+    const T values[] = {T(0), T(-0.), T(0.5), T(-0.5), T(1), T(-1), T(2), T(-2), T(3),
+                        T(-3), T(2.5), T(-2.5), inf, -inf, limits::denorm_min(), nan};
+    for (T x : values) {
+        for (T y : values) {
+            const T ref = std::pow(x, y);
+            const V r = Vc::pow(V(x), V(y));
+            if (std::isnan(ref)) {
+                VERIFY(all_of(isnan(r))) << "x = " << x << ", y = " << y << ", r = " << r;
+            } else {
+                FUZZY_COMPARE(r, V(ref)) << ", x = " << x << ", y = " << y;
+                COMPARE(isnegative(r), isnegative(V(ref)))
+                    << ", x = " << x << ", y = " << y << ", r = " << r;
+            }
+        }
+    }
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,176 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+/*includes {{{*/
+#include "unittest.h"
+#include <cmath>
+#include <limits>
+/*}}}*/
+using namespace Vc;
+
+// fix isfinite and isnan {{{1
+#ifdef isfinite
+#undef isfinite
+#endif
+#ifdef isnan
+#undef isnan
+#endif
+
+// The fuzzyness values below are the documented precision of the Vc::fast_math overloads.
+// The Scalar implementation and the scalar parts of odd-sized SimdArray types use <cmath>
+// and thus pass with the same bounds.
+
+// testUnary {{{1
+template <typename V, typename F, typename R>
+void testUnary(F &&fun, R &&reference, typename V::EntryType lo, typename V::EntryType hi)
+{
+    using T = typename V::EntryType;
+    for (size_t i = 0; i < 20000 / V::Size; ++i) {
+        const V x = lo + V::Random() * (hi - lo);
+        const V ref = x.apply([&](T _x) { return T(reference(static_cast<long double>(_x))); });
+        FUZZY_COMPARE(fun(x), ref) << ", x = " << x << ", i = " << i;
+    }
+}
+
+// testAbsolute {{{1
+// Checks |fun(x) - reference(x)| ≤ maxUlp · ulp(1), for functions with a result range of
+// [-1, 1] where the relative error close to the zeros is not meaningful.
+template <typename V, typename F, typename R>
+void testAbsolute(F &&fun, R &&reference, typename V::EntryType lo,
+                  typename V::EntryType hi, typename V::EntryType maxUlp)
+{
+    using T = typename V::EntryType;
+    const T bound = maxUlp * std::numeric_limits<T>::epsilon();
+    for (size_t i = 0; i < 20000 / V::Size; ++i) {
+        const V x = lo + V::Random() * (hi - lo);
+        const V ref = x.apply([&](T _x) { return T(reference(static_cast<long double>(_x))); });
+        const V r = fun(x);
+        VERIFY(all_of(abs(r - ref) <= bound))
+            << "x = " << x << ", r = " << r << ", ref = " << ref << ", i = " << i;
+    }
+}
+
+TEST_TYPES(V, testExp, RealTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    using limits = std::numeric_limits<T>;
+    setFuzzyness<float>(3);
+    setFuzzyness<double>(2);
+    const auto f = [](const V &x) { return Vc::exp(x, Vc::fast_math); };
+    const auto ref = [](long double x) { return std::exp(x); };
+    testUnary<V>(f, ref, T(-1), T(1));
+    testUnary<V>(f, ref, T(-80), T(80));
+    // the double overload uses exp(x), which overflows slightly before log(max)
+    testUnary<V>(f, ref, std::log(limits::min()), std::log(limits::max()) - T(2));
+
+    COMPARE(Vc::exp(V(T(0)), Vc::fast_math), V(T(1)));
+    COMPARE(Vc::exp(V(limits::infinity()), Vc::fast_math), V(limits::infinity()));
+    COMPARE(Vc::exp(V(-limits::infinity()), Vc::fast_math), V(T(0)));
+    COMPARE(Vc::exp(V(limits::max()), Vc::fast_math), V(limits::infinity()));
+    COMPARE(Vc::exp(V(-limits::max()), Vc::fast_math), V(T(0)));
+}
+
+TEST_TYPES(V, testLog, RealTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    using limits = std::numeric_limits<T>;
+    setFuzzyness<float>(5);
+    setFuzzyness<double>(1);
+    const auto f = [](const V &x) { return Vc::log(x, Vc::fast_math); };
+    const auto ref = [](long double x) { return std::log(x); };
+    testUnary<V>(f, ref, T(0.5), T(2));
+    testUnary<V>(f, ref, limits::min(), T(1));
+    testUnary<V>(f, ref, T(1), limits::max());
+
+    COMPARE(Vc::log(V(T(1)), Vc::fast_math), V(T(0)));
+    COMPARE(Vc::log(V(T(0)), Vc::fast_math), V(-limits::infinity()));
+    VERIFY(all_of(isnan(Vc::log(V(T(-1)), Vc::fast_math))));
+    FUZZY_COMPARE(Vc::log(V(limits::min()), Vc::fast_math),
+                  V(T(std::log(static_cast<long double>(limits::min())))));
+    FUZZY_COMPARE(Vc::log(V(limits::max()), Vc::fast_math),
+                  V(T(std::log(static_cast<long double>(limits::max())))));
+}
+
+TEST_TYPES(V, testSinCos, RealTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    setFuzzyness<float>(3);
+    setFuzzyness<double>(2);
+    const auto fsin = [](const V &x) { return Vc::sin(x, Vc::fast_math); };
+    const auto fcos = [](const V &x) { return Vc::cos(x, Vc::fast_math); };
+    const auto rsin = [](long double x) { return std::sin(x); };
+    const auto rcos = [](long double x) { return std::cos(x); };
+    constexpr T pi_4 = T(0.785398163397448309616L);
+    testUnary<V>(fsin, rsin, -pi_4, pi_4);
+    testUnary<V>(fcos, rcos, -pi_4, pi_4);
+
+    // absolute error for the rest of the domain
+    const T maxUlp = sizeof(T) == 8 ? T(1) : T(1.5);
+    testAbsolute<V>(fsin, rsin, T(-10), T(10), maxUlp);
+    testAbsolute<V>(fcos, rcos, T(-10), T(10), maxUlp);
+    testAbsolute<V>(fsin, rsin, T(-3200), T(3200), maxUlp);
+    testAbsolute<V>(fcos, rcos, T(-3200), T(3200), maxUlp);
+
+    for (size_t i = 0; i < 1000; ++i) {
+        const V x = (V::Random() - T(0.5)) * T(200);
+        V s, c;
+        Vc::sincos(x, &s, &c, Vc::fast_math);
+        COMPARE(s, fsin(x)) << ", x = " << x;
+        COMPARE(c, fcos(x)) << ", x = " << x;
+    }
+    COMPARE(fsin(V(T(0))), V(T(0)));
+    COMPARE(fcos(V(T(0))), V(T(1)));
+}
+
+TEST_TYPES(V, testAtan2, RealTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    setFuzzyness<float>(4);
+    setFuzzyness<double>(2);
+    for (size_t i = 0; i < 20000 / V::Size; ++i) {
+        const V y = (V::Random() - T(0.5)) * T(20);
+        const V x = (V::Random() - T(0.5)) * T(20);
+        const V ref = V::generate([&](size_t j) {
+            return T(std::atan2(static_cast<long double>(y[j]),
+                                static_cast<long double>(x[j])));
+        });
+        FUZZY_COMPARE(Vc::atan2(y, x, Vc::fast_math), ref) << ", y = " << y << ", x = " << x;
+    }
+
+    // signed zeros and the axes
+    const T values[] = {T(0), T(-0.), T(1), T(-1), T(1e-30), T(-1e30)};
+    for (T y : values) {
+        for (T x : values) {
+            const T ref = std::atan2(y, x);
+            const V r = Vc::atan2(V(y), V(x), Vc::fast_math);
+            FUZZY_COMPARE(r, V(ref)) << ", y = " << y << ", x = " << x;
+            COMPARE(isnegative(r), isnegative(V(ref)))
+                << ", y = " << y << ", x = " << x << ", r = " << r;
+        }
+    }
+}
+
+// vim: foldmethod=marker
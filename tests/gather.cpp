@@ -75,6 +75,29 @@ TEST_TYPES(Vec, maskedGatherArray, ALL_TYPES)
     }
 }
 
+TEST_TYPES(Vec, maskedGather64BitIndexes, ALL_TYPES)
+{
+    typedef typename Vec::EntryType T;
+
+    T mem[3 * Vec::Size];
+    for (size_t i = 0; i < 3 * Vec::Size; ++i) {
+        mem[i] = i + 1;
+    }
+
+    std::array<std::size_t, Vec::Size> indexArray;
+    for (size_t i = 0; i < Vec::Size; ++i) {
+        indexArray[i] = 3 * Vec::Size - 1 - 2 * i;
+    }
+    for_all_masks(Vec, m) {
+        T x = 3 * Vec::Size + 1;
+        Vec b = x;
+        b.gather(mem, indexArray, m);
+        for (size_t i = 0; i < Vec::Size; ++i) {
+            COMPARE(b[i], m[i] ? mem[indexArray[i]] : x) << " i = " << i << ", m = " << m;
+        }
+    }
+}
+
 template <typename Vec>
 Vec incrementIndex(
     const typename Vec::IndexType &i,
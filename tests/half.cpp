@@ -0,0 +1,208 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/Memory>
+#include <cmath>
+#include <cstring>
+
+using namespace Vc;
+
+using HalfTypes = vir::Typelist<Vc::float16, Vc::bfloat16>;
+
+// helpers {{{1
+static unsigned int bitsOf(float x)
+{
+    unsigned int r;
+    std::memcpy(&r, &x, sizeof(r));
+    return r;
+}
+
+// Compares including the sign of zero; NaNs compare equal to NaNs.
+static bool sameFloat(float a, float b)
+{
+    return (std::isnan(a) && std::isnan(b)) || bitsOf(a) == bitsOf(b);
+}
+
+// Decodes IEEE binary16 without relying on the library.
+static float referenceFloat16(unsigned short h)
+{
+    const int e = (h >> 10) & 31;
+    const int m = h & 1023;
+    const float sign = (h & 0x8000) ? -1.f : 1.f;
+    if (e == 31) {
+        return m ? std::nanf("") : sign * std::numeric_limits<float>::infinity();
+    } else if (e == 0) {
+        return sign * std::ldexp(float(m), -24);
+    }
+    return sign * std::ldexp(float(1024 + m), e - 25);
+}
+
+template <typename H> float referenceFloat(unsigned short h);
+template <> float referenceFloat<float16>(unsigned short h) { return referenceFloat16(h); }
+template <> float referenceFloat<bfloat16>(unsigned short h)
+{
+    const unsigned int x = static_cast<unsigned int>(h) << 16;
+    float r;
+    std::memcpy(&r, &x, sizeof(r));
+    return r;
+}
+
+TEST(scalarConversion) //{{{1
+{
+    COMPARE(float16(1.f).bits, 0x3c00);
+    COMPARE(float16(-2.f).bits, 0xc000);
+    COMPARE(float16(65504.f).bits, 0x7bff);
+    COMPARE(float16(65520.f).bits, 0x7c00);  // rounds up to Inf
+    COMPARE(float16(65519.f).bits, 0x7bff);
+    COMPARE(float16(std::ldexp(1.f, -24)).bits, 0x0001);
+    COMPARE(float16(std::ldexp(1.f, -25)).bits, 0x0000);  // tie to even
+    COMPARE(float16(std::ldexp(3.f, -25)).bits, 0x0002);  // tie to even
+    COMPARE(float16(-0.f).bits, 0x8000);
+    COMPARE(float16(1.f + std::ldexp(1.f, -11)).bits, 0x3c00);  // tie to even
+    COMPARE(float16(1.f + std::ldexp(3.f, -11)).bits, 0x3c02);  // tie to even
+    VERIFY(std::isnan(float(float16(std::nanf("")))));
+
+    COMPARE(bfloat16(1.f).bits, 0x3f80);
+    COMPARE(bfloat16(1.f + std::ldexp(1.f, -8)).bits, 0x3f80);  // tie to even
+    COMPARE(bfloat16(1.f + std::ldexp(3.f, -8)).bits, 0x3f82);  // tie to even
+    COMPARE(bfloat16(std::numeric_limits<float>::max()).bits, 0x7f80);
+    VERIFY(std::isnan(float(bfloat16(std::nanf("")))));
+
+    for (unsigned int i = 0; i < 0x10000; ++i) {
+        const unsigned short h = static_cast<unsigned short>(i);
+        VERIFY(sameFloat(float16::fromBits(h), referenceFloat16(h))) << i;
+    }
+}
+
+TEST_TYPES(H, load, HalfTypes) //{{{1
+{
+    // every 16-bit pattern once
+    Vc::Memory<ushort_v, 0x10000> bits;
+    for (unsigned int i = 0; i < 0x10000; ++i) {
+        bits[i] = static_cast<ushort>(i);
+    }
+    const H *mem = reinterpret_cast<const H *>(&bits[0]);
+    for (unsigned int i = 0; i < 0x10000; i += float_v::Size) {
+        const float_v aligned(&mem[i], Vc::Aligned);
+        const float_v unaligned(&mem[i], Vc::Unaligned);
+        float_v loaded;
+        loaded.load(&mem[i], Vc::Streaming);
+        for (size_t j = 0; j < float_v::Size; ++j) {
+            const float ref = referenceFloat<H>(static_cast<unsigned short>(i + j));
+            VERIFY(sameFloat(aligned[j], ref)) << i + j << ": " << aligned[j] << " vs. " << ref;
+            VERIFY(sameFloat(unaligned[j], ref)) << i + j;
+            VERIFY(sameFloat(loaded[j], ref)) << i + j;
+        }
+    }
+    const float_v offset(&mem[0x3c00 + 1], Vc::Unaligned);
+    COMPARE(offset[0], float(H::fromBits(0x3c01)));
+}
+
+TEST_TYPES(H, store, HalfTypes) //{{{1
+{
+    // round trip of every non-NaN value is exact
+    Vc::Memory<ushort_v, 0x10000> in, out;
+    for (unsigned int i = 0; i < 0x10000; ++i) {
+        in[i] = static_cast<ushort>(i);
+    }
+    const H *inMem = reinterpret_cast<const H *>(&in[0]);
+    H *outMem = reinterpret_cast<H *>(&out[0]);
+    for (unsigned int i = 0; i < 0x10000; i += float_v::Size) {
+        float_v(&inMem[i], Vc::Aligned).store(&outMem[i], Vc::Aligned);
+    }
+    for (unsigned int i = 0; i < 0x10000; ++i) {
+        if (std::isnan(float(inMem[i]))) {
+            VERIFY(std::isnan(float(outMem[i]))) << i;
+        } else {
+            COMPARE(out[i], in[i]);
+        }
+    }
+
+    // arbitrary floats round like the scalar conversion
+    withRandomMask<float_v>([&](float_m) {
+        const float_v x = float_v::Random() * 1.e5f - 5.e4f;
+        const float_v small = float_v::Random() * 1.e-4f;
+        H mem[float_v::Size + 1] = {};
+        for (const float_v &v : {x, small, x * small}) {
+            v.store(&mem[1], Vc::Unaligned);
+            for (size_t j = 0; j < float_v::Size; ++j) {
+                COMPARE(mem[j + 1].bits, H(v[j]).bits) << v;
+            }
+        }
+    });
+}
+
+TEST_TYPES(H, maskedStore, HalfTypes) //{{{1
+{
+    withRandomMask<float_v>([&](float_m k) {
+        alignas(static_cast<size_t>(float_v::MemoryAlignment)) H mem[2 * float_v::Size];
+        for (auto &x : mem) {
+            x = H::fromBits(0x1234);
+        }
+        const float_v v = float_v::IndexesFromZero() + 1.f;
+        v.store(&mem[0], k, Vc::Aligned);
+        for (size_t j = 0; j < float_v::Size; ++j) {
+            COMPARE(mem[j].bits, k[j] ? H(v[j]).bits : 0x1234) << k;
+        }
+        for (size_t j = float_v::Size; j < 2 * float_v::Size; ++j) {
+            COMPARE(mem[j].bits, 0x1234);
+        }
+    });
+}
+
+TEST_TYPES(H, halfMemory, HalfTypes) //{{{1
+{
+    HalfMemory<float_v, 37, H> m = {1.f, 2.f, 3.f};
+    const HalfMemory<float_v, 37, H> &cm = m;
+    COMPARE(m.entriesCount(), 37u);
+    COMPARE(m.vectorsCount(), (37 + float_v::Size - 1) / float_v::Size);
+    VERIFY(reinterpret_cast<std::uintptr_t>(m.data()) % float_v::MemoryAlignment == 0);
+    for (size_t i = 3; i < m.entriesCount(); ++i) {
+        m[i] = float(i);
+    }
+    for (size_t i = 0; i < m.vectorsCount(); ++i) {
+        m.vector(i) *= float_v(2.f);
+    }
+    for (size_t i = 0; i < m.entriesCount(); ++i) {
+        COMPARE(float(m[i]), 2.f * (i < 3 ? i + 1 : i));
+    }
+    // the padding stays zero
+    const float_v last = cm.vector(m.vectorsCount() - 1);
+    for (size_t j = 37 % float_v::Size; j > 0 && j < float_v::Size; ++j) {
+        COMPARE(last[j], 0.f);
+    }
+    COMPARE(m.vectorAt(1), float_v::generate([&](int j) { return float(m[j + 1]); }));
+
+    m = float_v(0.5f);
+    COMPARE(float(m[36]), 0.5f);
+    m.setZero();
+    COMPARE(cm.vector(0), float_v::Zero());
+    COMPARE(sizeof(HalfMemory<float_v, 64, H>), 64 * sizeof(H));
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,315 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <algorithm>
+#include <limits>
+
+using namespace Vc;
+
+using SmallAndWideIntVectors =
+    vir::Typelist<Vc::schar_v, Vc::uchar_v, Vc::llong_v, Vc::ullong_v>;
+using SaturatingVectors =
+    vir::Typelist<Vc::schar_v, Vc::uchar_v, Vc::short_v, Vc::ushort_v>;
+
+// referenceValues {{{1
+// Returns a vector of values that covers the extremes of T and wraps around on
+// multiplication and addition.
+template <typename V> V referenceValues(int offset)
+{
+    using T = typename V::EntryType;
+    using limits = std::numeric_limits<T>;
+    return V::generate([&](int i) {
+        switch ((i + offset) % 5) {
+        case 0: return limits::min();
+        case 1: return limits::max();
+        case 2: return T(i * 0x9e3779b97f4a7c15ull + offset);
+        case 3: return T(i + offset);
+        default: return T(-(i + offset));
+        }
+    });
+}
+
+TEST_TYPES(V, arithmetics, SmallAndWideIntVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    for (int offset = 0; offset < 20; ++offset) {
+        const V a = referenceValues<V>(offset);
+        const V b = referenceValues<V>(offset * 3 + 1);
+        // avoid division by zero and the overflow of min / -1
+        const V divisor = iif(b == V::Zero() || b == V(T(-1)), V::One(), b);
+        for (size_t i = 0; i < V::Size; ++i) {
+            COMPARE((a + b)[i], T(a[i] + b[i])) << a << " + " << b;
+            COMPARE((a - b)[i], T(a[i] - b[i])) << a << " - " << b;
+            COMPARE((a * b)[i], T(ullong(a[i]) * ullong(b[i]))) << a << " * " << b;
+            COMPARE((-a)[i], T(-a[i])) << a;
+            COMPARE((a / divisor)[i], T(a[i] / divisor[i])) << a << " / " << divisor;
+            COMPARE((a % divisor)[i], T(a[i] % divisor[i])) << a << " % " << divisor;
+        }
+        COMPARE(min(a, b), V::generate([&](int i) { return std::min(a[i], b[i]); }));
+        COMPARE(max(a, b), V::generate([&](int i) { return std::max(a[i], b[i]); }));
+    }
+}
+
+TEST_TYPES(V, compares, SmallAndWideIntVectors) //{{{1
+{
+    for (int offset = 0; offset < 20; ++offset) {
+        const V a = referenceValues<V>(offset);
+        const V b = referenceValues<V>(offset + 2);
+        for (size_t i = 0; i < V::Size; ++i) {
+            COMPARE((a < b)[i], a[i] < b[i]) << a << " < " << b;
+            COMPARE((a <= b)[i], a[i] <= b[i]) << a << " <= " << b;
+            COMPARE((a > b)[i], a[i] > b[i]) << a << " > " << b;
+            COMPARE((a >= b)[i], a[i] >= b[i]) << a << " >= " << b;
+            COMPARE((a == b)[i], a[i] == b[i]) << a << " == " << b;
+            COMPARE((a != b)[i], a[i] != b[i]) << a << " != " << b;
+        }
+    }
+}
+
+TEST_TYPES(V, shifts, SmallAndWideIntVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    const V a = referenceValues<V>(3);
+    for (int shift = 0; shift < int(sizeof(T) * 8); ++shift) {
+        COMPARE(a << shift, V::generate([&](int i) { return T(a[i] << shift); }))
+            << "shift = " << shift;
+        COMPARE(a >> shift, V::generate([&](int i) { return T(a[i] >> shift); }))
+            << "shift = " << shift;
+    }
+    const V shifts = V::generate([](int i) { return T(i % (sizeof(T) * 8)); });
+    COMPARE(a << shifts, V::generate([&](int i) { return T(a[i] << shifts[i]); }));
+    COMPARE(a >> shifts, V::generate([&](int i) { return T(a[i] >> shifts[i]); }));
+}
+
+TEST_TYPES(V, reductions, SmallAndWideIntVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    const V a = referenceValues<V>(7);
+    T sum = 0, product = 1, min = a[0], max = a[0];
+    for (size_t i = 0; i < V::Size; ++i) {
+        sum += a[i];
+        product *= a[i];
+        min = std::min(min, T(a[i]));
+        max = std::max(max, T(a[i]));
+    }
+    COMPARE(a.sum(), sum);
+    COMPARE(a.product(), product);
+    COMPARE(a.min(), min);
+    COMPARE(a.max(), max);
+    COMPARE(V::IndexesFromZero().partialSum(),
+            V::generate([](int i) { return T(i * (i + 1) / 2); }));
+}
+
+TEST_TYPES(V, permutations, SmallAndWideIntVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    constexpr int N = V::Size;
+    const V a = V::IndexesFromZero();
+    const V reversed = a.reversed();
+    COMPARE(reversed, V::generate([](int i) { return T(N - 1 - i); }));
+    COMPARE(reversed.sorted(), a);
+    for (int k = 0; k < N; ++k) {
+        COMPARE(a.rotated(k), V::generate([&](int i) { return T((i + k) % N); }));
+    }
+    for (int k = -N; k <= N; ++k) {
+        COMPARE(a.shifted(k), V::generate([&](int i) {
+            return i + k >= 0 && i + k < N ? T(i + k) : T(0);
+        })) << "k = " << k;
+    }
+    // shifting by a full vector must return shiftIn, also for the 16 lanes of
+    // schar_v and uchar_v with SSE
+    const V b = a + N;
+    for (int k = -N; k <= N; ++k) {
+        COMPARE(a.shifted(k, b), V::generate([&](int i) {
+            return i + k >= 0 ? T(i + k) : T(2 * N + i + k);
+        })) << "k = " << k;
+    }
+    COMPARE(a.interleaveLow(reversed), V::generate([](int i) {
+        return i % 2 ? T(N - 1 - i / 2) : T(i / 2);
+    }));
+    COMPARE(a.interleaveHigh(reversed), V::generate([](int i) {
+        return i % 2 ? T(N - 1 - (i + N) / 2) : T((i + N) / 2);
+    }));
+}
+
+TEST_TYPES(V, gatherScatter, SmallAndWideIntVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    constexpr int N = V::Size;
+    alignas(64) T data[2 * N] = {};
+    for (int i = 0; i < 2 * N; ++i) {
+        data[i] = T(i * 3);
+    }
+    const typename V::IndexType indexes = V::IndexType::IndexesFromZero() * 2;
+    V x(data, indexes);
+    COMPARE(x, V::generate([](int i) { return T(i * 6); }));
+
+    const V a = V::IndexesFromZero();
+    x.setZero();
+    x.gather(data, indexes, a > 1);
+    COMPARE(x, V::generate([](int i) { return i > 1 ? T(i * 6) : T(0); }));
+
+    T out[2 * N] = {};
+    a.scatter(out, indexes);
+    for (int i = 0; i < N; ++i) {
+        COMPARE(out[2 * i], T(i));
+        COMPARE(out[2 * i + 1], T(0));
+    }
+}
+
+TEST_TYPES(V, casts, SmallAndWideIntVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    const V a = V::IndexesFromZero() + T(1);
+    const auto toInt = simd_cast<int_v>(a);
+    const auto toFloat = simd_cast<float_v>(a);
+    const auto toDouble = simd_cast<double_v>(a);
+    const auto toShort = simd_cast<short_v>(a);
+    for (size_t i = 0; i < int_v::Size; ++i) {
+        COMPARE(toInt[i], i < V::Size ? int(i + 1) : 0);
+    }
+    for (size_t i = 0; i < float_v::Size; ++i) {
+        COMPARE(toFloat[i], i < V::Size ? float(i + 1) : 0.f);
+    }
+    for (size_t i = 0; i < double_v::Size; ++i) {
+        COMPARE(toDouble[i], i < V::Size ? double(i + 1) : 0.);
+    }
+    for (size_t i = 0; i < short_v::Size; ++i) {
+        COMPARE(toShort[i], i < V::Size ? short(i + 1) : short(0));
+    }
+
+    const V fromInt = simd_cast<V>(int_v::IndexesFromZero() - 3);
+    const V fromFloat = simd_cast<V>(float_v::IndexesFromZero() + 1);
+    const V fromDouble = simd_cast<V>(double_v::IndexesFromZero() + 1);
+    const V fromUShort = simd_cast<V>(ushort_v::IndexesFromZero() + 1);
+    for (size_t i = 0; i < V::Size; ++i) {
+        COMPARE(fromInt[i], i < int_v::Size ? T(int(i) - 3) : T(0));
+        COMPARE(fromFloat[i], i < float_v::Size ? T(i + 1) : T(0));
+        COMPARE(fromDouble[i], i < double_v::Size ? T(i + 1) : T(0));
+        COMPARE(fromUShort[i], i < ushort_v::Size ? T(i + 1) : T(0));
+    }
+
+    const auto mask = simd_cast<int_m>(a > 2);
+    for (size_t i = 0; i < int_m::Size; ++i) {
+        COMPARE(mask[i], i < V::Size && i > 1);
+    }
+}
+
+TEST_TYPES(V, maskCasts, SmallAndWideIntVectors) //{{{1
+{
+    using M = typename V::MaskType;
+    const M k = V::IndexesFromZero() > 1;
+    const auto toFloat = simd_cast<float_m>(k);
+    const auto toDouble = simd_cast<double_m>(k);
+    for (size_t i = 0; i < float_m::Size; ++i) {
+        COMPARE(toFloat[i], i < V::Size && i > 1) << k;
+    }
+    for (size_t i = 0; i < double_m::Size; ++i) {
+        COMPARE(toDouble[i], i < V::Size && i > 1) << k;
+    }
+
+    const M fromFloat = simd_cast<M>(float_v::IndexesFromZero() > 1);
+    const M fromDouble = simd_cast<M>(double_v::IndexesFromZero() > 1);
+    for (size_t i = 0; i < V::Size; ++i) {
+        COMPARE(fromFloat[i], i < float_v::Size && i > 1);
+        COMPARE(fromDouble[i], i < double_v::Size && i > 1);
+    }
+}
+
+TEST_TYPES(V, simdArrayCasts, SmallAndWideIntVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    const V a = V::IndexesFromZero() + T(1);
+    const auto toFloat4 = simd_cast<SimdArray<float, 4>>(a);
+    const auto toDouble8 = simd_cast<SimdArray<double, 8>>(a);
+    const auto toInt32 = simd_cast<SimdArray<int, 32>>(a);
+    for (size_t i = 0; i < 4; ++i) {
+        COMPARE(toFloat4[i], i < V::Size ? float(i + 1) : 0.f);
+    }
+    for (size_t i = 0; i < 8; ++i) {
+        COMPARE(toDouble8[i], i < V::Size ? double(i + 1) : 0.);
+    }
+    for (size_t i = 0; i < 32; ++i) {
+        COMPARE(toInt32[i], i < V::Size ? int(i + 1) : 0);
+    }
+
+    const V fromFloat = simd_cast<V>(SimdArray<float, 8>::IndexesFromZero() + 1);
+    const V fromDouble = simd_cast<V>(SimdArray<double, 32>::IndexesFromZero() + 1);
+    const V fromShort = simd_cast<V>(SimdArray<short, 32>::IndexesFromZero() + 1);
+    const V fromShort4 = simd_cast<V>(SimdArray<short, 4>::IndexesFromZero() + 1);
+    for (size_t i = 0; i < V::Size; ++i) {
+        COMPARE(fromFloat[i], i < 8 ? T(i + 1) : T(0));
+        COMPARE(fromDouble[i], T(i + 1));
+        COMPARE(fromShort[i], T(i + 1));
+        COMPARE(fromShort4[i], i < 4 ? T(i + 1) : T(0));
+    }
+
+    const auto mask = simd_cast<SimdMaskArray<float, 8>>(a > 2);
+    for (size_t i = 0; i < 8; ++i) {
+        COMPARE(mask[i], i < V::Size && i > 1);
+    }
+    using M = typename V::MaskType;
+    const M fromDoubleMask = simd_cast<M>(SimdArray<double, 32>::IndexesFromZero() > 1);
+    const M fromIntMask = simd_cast<M>(SimdArray<int, 32>::IndexesFromZero() > 1);
+    for (size_t i = 0; i < V::Size; ++i) {
+        COMPARE(fromDoubleMask[i], i > 1);
+        COMPARE(fromIntMask[i], i > 1);
+    }
+}
+
+TEST_TYPES(V, saturatingArithmetic, SaturatingVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    using limits = std::numeric_limits<T>;
+    const auto saturate = [](int x) {
+        return T(std::min<int>(limits::max(), std::max<int>(limits::min(), x)));
+    };
+    for (int offset = 0; offset < 20; ++offset) {
+        const V a = referenceValues<V>(offset);
+        const V b = referenceValues<V>(offset * 7 + 2);
+        COMPARE(add_sat(a, b), V::generate([&](int i) { return saturate(a[i] + b[i]); }))
+            << a << " + " << b;
+        COMPARE(sub_sat(a, b), V::generate([&](int i) { return saturate(a[i] - b[i]); }))
+            << a << " - " << b;
+    }
+}
+
+TEST_TYPES(V, byteShuffle, vir::Typelist<Vc::schar_v, Vc::uchar_v>) //{{{1
+{
+    using T = typename V::EntryType;
+    const V a = V::generate([](int i) { return T(i * 7 + 3); });
+    for (int offset = 0; offset < 256; offset += 5) {
+        const uchar_v indexes =
+            uchar_v::generate([&](int i) { return uchar(i * 13 + offset); });
+        COMPARE(shuffle(a, indexes), V::generate([&](int i) {
+            return indexes[i] < V::Size ? a[indexes[i]] : T(0);
+        })) << "indexes: " << indexes;
+    }
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,162 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/matrix>
+#include <limits>
+#include <vector>
+
+using namespace Vc;
+
+// small integers keep all products and sums exact
+template <typename T> std::vector<T> makeMatrix(std::size_t rows, std::size_t cols, int seed)
+{
+    std::vector<T> m(rows * cols);
+    for (std::size_t i = 0; i < m.size(); ++i) {
+        m[i] = T(int((i * 7 + seed) % 11) - 5);
+    }
+    return m;
+}
+
+template <typename T>
+void referenceGemm(std::size_t m, std::size_t n, std::size_t k, T alpha, const T *a,
+                   std::size_t lda, const T *b, std::size_t ldb, T beta, T *c,
+                   std::size_t ldc)
+{
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            T sum = 0;
+            for (std::size_t p = 0; p < k; ++p) {
+                sum += a[i * lda + p] * b[p * ldb + j];
+            }
+            c[i * ldc + j] = alpha * sum + (beta == T() ? T() : beta * c[i * ldc + j]);
+        }
+    }
+}
+
+TEST_TYPES(V, gemm, RealVectors) //{{{1
+{
+    typedef typename V::EntryType T;
+    struct {
+        std::size_t m, n, k;
+    } const sizes[] = {{1, 1, 1},     {2, 3, 4},   {5, 7, 3},     {6, 2 * V::Size, 1},
+                       {13, 17, 19},  {31, 9, 64}, {100, 33, 300}, {7, 1030, 5}};
+    for (const auto s : sizes) {
+        for (T beta : {T(0), T(1), T(-2)}) {
+            const std::size_t lda = s.k + 1, ldb = s.n + 3, ldc = s.n + 2;
+            const auto a = makeMatrix<T>(s.m, lda, 1);
+            const auto b = makeMatrix<T>(s.k, ldb, 2);
+            auto c = makeMatrix<T>(s.m, ldc, 3);
+            auto reference = c;
+            if (beta == T()) {
+                // C must not be read if beta is zero
+                std::fill(c.begin(), c.end(), std::numeric_limits<T>::quiet_NaN());
+                for (std::size_t i = 0; i < s.m; ++i) {
+                    for (std::size_t j = s.n; j < ldc; ++j) {
+                        c[i * ldc + j] = reference[i * ldc + j];
+                    }
+                }
+            }
+            Vc::gemm(s.m, s.n, s.k, T(2), a.data(), lda, b.data(), ldb, beta, c.data(),
+                     ldc);
+            referenceGemm(s.m, s.n, s.k, T(2), a.data(), lda, b.data(), ldb, beta,
+                          reference.data(), ldc);
+            for (std::size_t i = 0; i < c.size(); ++i) {
+                COMPARE(c[i], reference[i]) << "m: " << s.m << ", n: " << s.n
+                                            << ", k: " << s.k << ", beta: " << beta
+                                            << ", i: " << i;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, gemv, RealVectors) //{{{1
+{
+    typedef typename V::EntryType T;
+    for (std::size_t m : {1, 3, 4, 9, 33}) {
+        for (std::size_t n = 0; n < 4 * V::Size + 3; ++n) {
+            const std::size_t lda = n + 1;
+            const auto a = makeMatrix<T>(m, lda, 1);
+            const auto x = makeMatrix<T>(1, n, 2);
+            for (T beta : {T(0), T(3)}) {
+                auto y = makeMatrix<T>(1, m, 3);
+                auto reference = y;
+                if (beta == T()) {
+                    std::fill(y.begin(), y.end(), std::numeric_limits<T>::quiet_NaN());
+                }
+                Vc::gemv(m, n, T(-1), a.data(), lda, x.data(), beta, y.data());
+                referenceGemm(m, 1, n, T(-1), a.data(), lda, x.data(), 1, beta,
+                              reference.data(), 1);
+                for (std::size_t i = 0; i < m; ++i) {
+                    COMPARE(y[i], reference[i]) << "m: " << m << ", n: " << n
+                                                << ", beta: " << beta << ", i: " << i;
+                }
+            }
+        }
+    }
+}
+
+template <typename T, std::size_t R, std::size_t K, std::size_t C> void testSmallMatrix()
+{
+    const auto a = makeMatrix<T>(R, K, 1);
+    const auto b = makeMatrix<T>(K, C, 2);
+    std::vector<T> c(R * C), reference(R * C);
+    const SmallMatrix<T, R, K> ma(a.data());
+    const SmallMatrix<T, K, C> mb(b.data());
+    const SmallMatrix<T, R, C> mc = ma * mb;
+    mc.store(c.data());
+    referenceGemm(R, C, K, T(1), a.data(), K, b.data(), C, T(), reference.data(), C);
+    for (std::size_t i = 0; i < R; ++i) {
+        for (std::size_t j = 0; j < C; ++j) {
+            COMPARE(mc(i, j), reference[i * C + j]) << R << 'x' << K << 'x' << C;
+            COMPARE(c[i * C + j], reference[i * C + j]) << R << 'x' << K << 'x' << C;
+        }
+    }
+    const SmallMatrix<T, R, K> same = ma * SmallMatrix<T, K, K>::identity();
+    for (std::size_t i = 0; i < R; ++i) {
+        for (std::size_t j = 0; j < K; ++j) {
+            COMPARE(same(i, j), a[i * K + j]);
+        }
+    }
+}
+
+TEST_TYPES(V, smallMatrix, RealVectors) //{{{1
+{
+    typedef typename V::EntryType T;
+    testSmallMatrix<T, 1, 1, 1>();
+    testSmallMatrix<T, 3, 3, 3>();
+    testSmallMatrix<T, 4, 4, 4>();
+    testSmallMatrix<T, 5, 5, 5>();
+    testSmallMatrix<T, 7, 7, 7>();
+    testSmallMatrix<T, 8, 8, 8>();
+    testSmallMatrix<T, 12, 12, 12>();
+    testSmallMatrix<T, 16, 16, 16>();
+    testSmallMatrix<T, 3, 5, 7>();
+    testSmallMatrix<T, 9, 2, 16>();
+}
+
+// vim: foldmethod=marker
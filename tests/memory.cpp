@@ -26,6 +26,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 }}}*/
 
 #include "unittest.h"
+#include <limits>
 
 using namespace Vc;
 
@@ -319,3 +320,330 @@ TEST_TYPES(V, testCopyAssignment, AllVectors)
         COMPARE(m1[i], T(1));
     }
 }
+
+TEST_TYPES(V, streamingStore, AllVectors)
+{
+    using T = typename V::EntryType;
+    const std::size_t threshold = streaming_store_threshold();
+    for (std::size_t forced : {std::size_t(0), std::numeric_limits<std::size_t>::max()}) {
+        set_streaming_store_threshold(forced);
+        Memory<V, 99> m1;
+        m1.streamingStore(V(T(3)));
+        for (size_t i = 0; i < m1.entriesCount(); ++i) {
+            COMPARE(m1[i], T(3));
+        }
+
+        Memory<V> m2(99);
+        for (size_t i = 0; i < m2.entriesCount(); ++i) {
+            m2[i] = T(i % 50);
+        }
+        m1.streamingStore(m2);
+        for (size_t i = 0; i < m1.entriesCount(); ++i) {
+            COMPARE(m1[i], T(i % 50));
+        }
+
+        Memory<V, 8, 9> m3;
+        m3.streamingStore(V(T(1)));
+        for (size_t i = 0; i < m3.rowsCount(); ++i) {
+            for (size_t j = 0; j < m3[i].entriesCount(); ++j) {
+                COMPARE(m3[i][j], T(1));
+            }
+        }
+
+        Memory<V> out(99);
+        simd_transform_streaming(m2, out, [](auto x) { return x + x; });
+        for (size_t i = 0; i < out.entriesCount(); ++i) {
+            COMPARE(out[i], T(2 * (i % 50)));
+        }
+    }
+    set_streaming_store_threshold(threshold);
+}
+
+TEST_TYPES(V, prefetchAuto, AllVectors)
+{
+    using T = typename V::EntryType;
+    Memory<V> m(1000);
+    for (size_t i = 0; i < m.entriesCount(); ++i) {
+        m[i] = T(i % 100);
+    }
+    for (size_t i = 0; i < m.vectorsCount(); ++i) {
+        COMPARE(V(&m[i * V::Size], Vc::Prefetch<Vc::Auto>()), V(m.vector(i)));
+        COMPARE(V(&m[i * V::Size], Vc::Prefetch<0, Vc::Auto>()), V(m.vector(i)));
+    }
+    size_t i = 0;
+    for (V x : m.range(0, m.vectorsCount() - 1)) {
+        COMPARE(x, V(m.vector(i)));
+        ++i;
+    }
+    COMPARE(i, m.vectorsCount());
+    i = 1;
+    const Memory<V> &cm = m;
+    for (V x : cm.range(1, 3)) {
+        COMPARE(x, V(m.vector(i)));
+        ++i;
+    }
+    COMPARE(i, 4u);
+
+    for (auto &&x : m.range(0, m.vectorsCount() - 1, Vc::Prefetch<Vc::Auto, 0>())) {
+        x += V(T(1));
+    }
+    auto it = m.begin(Vc::Prefetch<Vc::Auto>());
+    COMPARE(m.end(Vc::Prefetch<Vc::Auto>()) - it, std::ptrdiff_t(m.vectorsCount()));
+    for (i = 0; it != m.end(); ++it, ++i) {
+        COMPARE(V(*it), V(m.vector(i)));
+        COMPARE(m[i * V::Size], T((i * V::Size) % 100 + 1));
+    }
+}
+
+TEST_TYPES(V, simdForEachMemory, AllVectors)
+{
+    using T = typename V::EntryType;
+    const PrefetchDistances distances = prefetch_distances();
+    for (PrefetchDistances d : {distances, PrefetchDistances{0, 0},
+                                PrefetchDistances{64, 4096}}) {
+        set_prefetch_distances(d);
+        for (size_t n : {size_t(1), V::Size + 1, size_t(1000), size_t(20000)}) {
+            Memory<V> m(n);
+            m.setZero();
+            simd_for_each(m, [](auto &x) { x += 1; });
+            for (size_t i = 0; i < n; ++i) {
+                COMPARE(m[i], T(1)) << "n: " << n << ", i: " << i;
+            }
+            size_t count = 0;
+            const Memory<V> &cm = m;
+            simd_for_each(cm, [&](auto x) {
+                count += (x == T(1)).count();
+            });
+            COMPARE(count, n);
+        }
+    }
+    set_prefetch_distances(distances);
+#ifdef Vc_IMPL_SSE
+    VERIFY(distances.l1 > 0);
+    VERIFY(distances.l2 > distances.l1);
+#endif
+}
+
+TEST(calibratePrefetchDistances)
+{
+    const PrefetchDistances d = calibrate_prefetch_distances();
+    COMPARE(prefetch_distances().l1, d.l1);
+    COMPARE(prefetch_distances().l2, d.l2);
+#ifdef Vc_IMPL_SSE
+    COMPARE(d.l1 % 64, 0u);
+    COMPARE(d.l2 % 64, 0u);
+#endif
+}
+
+TEST_TYPES(V, moveDynamicMemory, AllVectors)
+{
+    using T = typename V::EntryType;
+    Memory<V> a(3 * V::Size + 1);
+    for (size_t i = 0; i < a.vectorsCount(); ++i) {
+        a.vector(i) = V::One();
+    }
+    const T *data = a.entries();
+    Memory<V> b(std::move(a));
+    COMPARE(b.entries(), data);
+    COMPARE(b.entriesCount(), 3 * V::Size + 1);
+    COMPARE(a.entriesCount(), 0u);
+    COMPARE(a.vectorsCount(), 0u);
+
+    Memory<V> c(1);
+    c = std::move(b);
+    COMPARE(c.entries(), data);
+    COMPARE(c.entriesCount(), 3 * V::Size + 1);
+    for (size_t i = 0; i < c.entriesCount(); ++i) {
+        COMPARE(c[i], T(1));
+    }
+}
+
+TEST_TYPES(V, dynamicMemory2D, AllVectors)
+{
+    using T = typename V::EntryType;
+    for (size_t width : {size_t(1), V::Size, 2 * V::Size + 3}) {
+        const size_t height = 7;
+        DynamicMemory<V, 2> m(height, width);
+        const size_t rowVectors = (width + V::Size - 1) / V::Size;
+        COMPARE(m.extent(0), height);
+        COMPARE(m.extent(1), width);
+        COMPARE(m.rowsCount(), height);
+        COMPARE(m.columnsCount(), width);
+        COMPARE(m.rowVectorsCount(), rowVectors);
+        COMPARE(m.vectorsCount(), height * rowVectors);
+        COMPARE(m.entriesCount(), height * width);
+        for (size_t y = 0; y < height; ++y) {
+            COMPARE(m[y].entriesCount(), width);
+            COMPARE(m[y].vectorsCount(), rowVectors);
+            COMPARE(m[y].entries(), m.entries() + y * rowVectors * V::Size);
+            VERIFY(reinterpret_cast<std::uintptr_t>(m[y].entries()) % V::MemoryAlignment == 0);
+            // the padding is zero-initialized
+            for (size_t x = width; x < rowVectors * V::Size; ++x) {
+                COMPARE(m[y][x], T(0));
+            }
+            for (size_t i = 0; i < m.rowVectorsCount(); ++i) {
+                m[y].vector(i) = V::IndexesFromZero() + T(i * V::Size + y);
+            }
+        }
+        for (size_t y = 0; y < height; ++y) {
+            for (size_t x = 0; x < width; ++x) {
+                COMPARE(m[y][x], T(x + y));
+                COMPARE(m.row(y)[x], T(x + y));
+            }
+        }
+
+        size_t count = 0;
+        for (auto x : m[3].range(0, rowVectors - 1)) {
+            COMPARE(V(x), V::IndexesFromZero() + T(count * V::Size + 3));
+            ++count;
+        }
+        COMPARE(count, rowVectors);
+        count = 0;
+        for (auto x : m.range(0, m.vectorsCount() - 1, Prefetch<>())) {
+            COMPARE(V(x), m.vector(count).value());
+            ++count;
+        }
+        COMPARE(count, m.vectorsCount());
+        COMPARE(std::size_t(m.end() - m.begin()), m.vectorsCount());
+
+        m[1] = m[2];
+        m[0] = V::One();
+        for (size_t x = 0; x < width; ++x) {
+            COMPARE(m[0][x], T(1));
+            COMPARE(m[1][x], T(x + 2));
+        }
+
+        m = V::Zero();
+        simd_for_each(m, [](auto &x) { x += 1; });
+        const DynamicMemory<V, 2> &cm = m;
+        count = 0;
+        simd_for_each(cm, [&](auto x) { count += (x == T(1)).count(); });
+        COMPARE(count, height * width);
+        for (size_t y = 0; y < height; ++y) {
+            for (size_t x = width; x < rowVectors * V::Size; ++x) {
+                COMPARE(cm[y][x], T(0));
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, dynamicMemory3D, AllVectors)
+{
+    using T = typename V::EntryType;
+    const size_t nz = 3, ny = 4, nx = V::Size + 2;
+    DynamicMemory<V, 3> m(nz, ny, nx);
+    COMPARE(m.rowsCount(), nz * ny);
+    COMPARE(m[1].rowsCount(), ny);
+    COMPARE(m[1].columnsCount(), nx);
+    for (size_t z = 0; z < nz; ++z) {
+        for (size_t y = 0; y < ny; ++y) {
+            for (size_t x = 0; x < nx; ++x) {
+                m[z][y][x] = T(100 * z + 10 * y + x);
+            }
+        }
+    }
+    for (size_t r = 0; r < m.rowsCount(); ++r) {
+        for (size_t x = 0; x < nx; ++x) {
+            COMPARE(m.row(r)[x], T(100 * (r / ny) + 10 * (r % ny) + x));
+        }
+    }
+    m[0] = m[2];
+    COMPARE(m[0][3][1], T(231));
+    m[1] = V::Zero();
+    COMPARE(m[1][3][nx - 1], T(0));
+
+    const T *data = m.entries();
+    DynamicMemory<V, 3> copy(m);
+    VERIFY(copy.entries() != data);
+    DynamicMemory<V, 3> moved(std::move(m));
+    COMPARE(moved.entries(), data);
+    COMPARE(m.rowsCount(), 0u);
+    VERIFY(m.entries() == nullptr);
+    DynamicMemory<V, 3> other(1, 1, 1);
+    other = std::move(moved);
+    COMPARE(other.entries(), data);
+    COMPARE(other.extent(0), nz);
+    for (size_t z = 0; z < nz; ++z) {
+        for (size_t y = 0; y < ny; ++y) {
+            for (size_t x = 0; x < nx; ++x) {
+                COMPARE(other[z][y][x], copy[z][y][x]);
+            }
+        }
+    }
+
+    const DynamicMemory<V, 3> &cother = other;
+    static_assert(std::is_same<decltype(cother[0]), MemorySlice<const V, 2>>::value,
+                  "operator[] const must return a read-only view");
+    static_assert(std::is_same<decltype(cother[0][0].entries()), const T *>::value,
+                  "a read-only row must not expose mutable entries");
+    static_assert(std::is_same<decltype(cother.row(0)), MemorySlice<const V, 1>>::value,
+                  "row() const must return a read-only view");
+    for (size_t r = 0; r < cother.rowsCount(); ++r) {
+        const V first = cother.row(r).vector(0);
+        COMPARE(first, V(copy.row(r).vector(0)));
+        COMPARE(cother[r / ny][r % ny][nx - 1], copy.row(r)[nx - 1]);
+    }
+}
+
+TEST_TYPES(V, hugePageMalloc, AllVectors)
+{
+    using T = typename V::EntryType;
+    const std::size_t hugePage = 2 * 1024 * 1024;
+    for (std::size_t n : {std::size_t(1), hugePage / sizeof(T) + 1}) {
+        T *p = Vc::malloc<T, Vc::AlignOnHugePage>(n);
+        VERIFY(p != nullptr);
+        VERIFY(reinterpret_cast<std::uintptr_t>(p) % hugePage == 0);
+        // the padding allows access up to the next huge page boundary
+        const std::size_t padded = (n * sizeof(T) + hugePage - 1) / hugePage * hugePage;
+        p[padded / sizeof(T) - 1] = T(1);
+        p[0] = T(2);
+        COMPARE(p[0], T(2));
+        Vc::free(p);
+    }
+
+    for (auto alignment : {Vc::AlignOnVector, Vc::AlignOnCacheline, Vc::AlignOnPage,
+                           Vc::AlignOnHugePage}) {
+        const std::size_t expected = alignment == Vc::AlignOnHugePage
+                                         ? hugePage
+                                         : alignment == Vc::AlignOnPage
+                                               ? 4096
+                                               : alignment == Vc::AlignOnCacheline
+                                                     ? 64
+                                                     : std::size_t(V::MemoryAlignment);
+        Memory<V> m(3 * V::Size + 1, alignment);
+        VERIFY(reinterpret_cast<std::uintptr_t>(m.entries()) % expected == 0);
+        COMPARE(m.entriesCount(), 3 * V::Size + 1);
+        COMPARE(m.vectorsCount(), 4u);
+        COMPARE(m.lastVector().value(), V::Zero());
+    }
+}
+
+TEST(hugePageAllocator)
+{
+    const std::size_t hugePage = 2 * 1024 * 1024;
+    std::vector<float, Vc::HugePageAllocator<float>> a(hugePage / sizeof(float) + 5, 1.f);
+    VERIFY(reinterpret_cast<std::uintptr_t>(a.data()) % hugePage == 0);
+    a.push_back(2.f);
+    COMPARE(a.back(), 2.f);
+    COMPARE(a.front(), 1.f);
+
+    // binding to node 0 is valid on all Linux systems, but may be denied (e.g. in
+    // containers) or unsupported
+    Vc::HugePageAllocator<double> onNode0(0);
+    COMPARE(onNode0.numaNode(), 0);
+    Vc::HugePageAllocator<float> rebound(onNode0);
+    COMPARE(rebound.numaNode(), 0);
+    VERIFY(rebound != Vc::HugePageAllocator<float>());
+    std::vector<double, Vc::HugePageAllocator<double>> b(1000, 3., onNode0);
+    COMPARE(b[999], 3.);
+    const int node = Vc::numa_node_of(b.data());
+    VERIFY(node == 0 || node == -1) << node;
+
+    float *p = Vc::malloc<float, Vc::AlignOnPage>(2048);
+    if (Vc::bind_to_numa_node(p, 2048 * sizeof(float), 0)) {
+        p[0] = 1.f;
+        COMPARE(Vc::numa_node_of(p), 0);
+    }
+    Vc::free(p);
+    VERIFY(!Vc::bind_to_numa_node(p, 16, -1));
+}
@@ -0,0 +1,255 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/Memory>
+#include <Vc/vector>
+#include <thread>
+
+using namespace Vc;
+
+// counts the allocations that reach the upstream resource
+class CountingResource : public pmr::memory_resource
+{
+public:
+    std::size_t allocations = 0;
+    std::size_t deallocations = 0;
+    std::size_t bytes = 0;
+
+private:
+    void *do_allocate(std::size_t n, std::size_t alignment) override
+    {
+        ++allocations;
+        bytes += n;
+        return pmr::malloc_resource()->allocate(n, alignment);
+    }
+    void do_deallocate(void *p, std::size_t n, std::size_t alignment) override
+    {
+        ++deallocations;
+        bytes -= n;
+        pmr::malloc_resource()->deallocate(p, n, alignment);
+    }
+    bool do_is_equal(const pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+static bool isAligned(const void *p, std::size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+TEST(defaultResource)
+{
+    COMPARE(pmr::get_default_resource(), pmr::malloc_resource());
+    CountingResource counting;
+    COMPARE(pmr::set_default_resource(&counting), pmr::malloc_resource());
+    {
+        pmr::vector<float> v(100);
+        COMPARE(v.get_allocator().resource(), static_cast<pmr::memory_resource *>(&counting));
+        COMPARE(counting.allocations, 1u);
+    }
+    COMPARE(counting.deallocations, 1u);
+    COMPARE(pmr::set_default_resource(nullptr), static_cast<pmr::memory_resource *>(&counting));
+    COMPARE(pmr::get_default_resource(), pmr::malloc_resource());
+
+    void *p = pmr::malloc_resource()->allocate(100, 256);
+    VERIFY(isAligned(p, 256));
+    pmr::malloc_resource()->deallocate(p, 100, 256);
+}
+
+TEST(monotonicBufferResource)
+{
+    CountingResource upstream;
+    alignas(64) char buffer[1024];
+    {
+        pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), &upstream);
+        COMPARE(arena.upstream_resource(), static_cast<pmr::memory_resource *>(&upstream));
+        char *prev = nullptr;
+        for (int i = 0; i < 10; ++i) {
+            char *p = static_cast<char *>(arena.allocate(40));
+            VERIFY(isAligned(p, VectorAlignment));
+            VERIFY(p >= buffer && p + 40 <= buffer + sizeof(buffer));
+            VERIFY(p > prev);
+            prev = p;
+            arena.deallocate(p, 40);  // no effect
+        }
+        COMPARE(upstream.allocations, 0u);
+
+        // exhaust the buffer: the following come from growing upstream chunks
+        for (int i = 0; i < 100; ++i) {
+            void *p = arena.allocate(100, 128);
+            VERIFY(isAligned(p, 128));
+            std::memset(p, i, 100);
+        }
+        VERIFY(upstream.allocations > 0u);
+        VERIFY(upstream.allocations < 10u) << upstream.allocations;
+        void *big = arena.allocate(1 << 20);
+        std::memset(big, 0, 1 << 20);
+
+        arena.release();
+        COMPARE(upstream.allocations, upstream.deallocations);
+        COMPARE(upstream.bytes, 0u);
+        COMPARE(static_cast<char *>(arena.allocate(1, 1)), &buffer[0]);
+
+        arena.allocate(5000);
+    }
+    COMPARE(upstream.allocations, upstream.deallocations);
+}
+
+TEST(unsynchronizedPoolResource)
+{
+    CountingResource upstream;
+    {
+        pmr::pool_options opts;
+        opts.largest_required_pool_block = 5000;
+        pmr::unsynchronized_pool_resource pool(opts, &upstream);
+        COMPARE(pool.options().largest_required_pool_block, 8192u);
+        VERIFY(pool.options().max_blocks_per_chunk > 0u);
+
+        std::vector<void *> blocks;
+        for (std::size_t size : {1, 64, 65, 100, 1000, 4000, 8192}) {
+            for (int i = 0; i < 20; ++i) {
+                void *p = pool.allocate(size);
+                VERIFY(isAligned(p, 64));
+                std::memset(p, i, size);
+                blocks.push_back(p);
+            }
+        }
+        // all blocks are distinct
+        std::vector<void *> sorted = blocks;
+        std::sort(sorted.begin(), sorted.end());
+        VERIFY(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+
+        const std::size_t chunks = upstream.allocations;
+        VERIFY(chunks > 0u);
+        // freed blocks are reused without going to upstream
+        void *p = blocks.back();
+        pool.deallocate(p, 8192);
+        COMPARE(pool.allocate(8000), p);
+        void *q = blocks.front();
+        pool.deallocate(q, 1);
+        COMPARE(pool.allocate(64), q);
+        COMPARE(upstream.allocations, chunks);
+
+        // larger blocks and larger alignments are forwarded to upstream
+        void *large = pool.allocate(10000);
+        COMPARE(upstream.allocations, chunks + 1);
+        pool.deallocate(large, 10000);
+        COMPARE(upstream.deallocations, 1u);
+        void *overaligned = pool.allocate(64, 128);
+        VERIFY(isAligned(overaligned, 128));
+        pool.deallocate(overaligned, 64, 128);
+
+        for (int i = 0; i < 1000; ++i) {
+            pool.deallocate(pool.allocate(2000), 2000);
+        }
+        COMPARE(upstream.allocations, chunks + 2);
+
+        pool.release();
+        COMPARE(upstream.bytes, 0u);
+        std::memset(pool.allocate(100), 0, 100);
+    }
+    COMPARE(upstream.allocations, upstream.deallocations);
+}
+
+TEST(threadLocalPoolResource)
+{
+    pmr::unsynchronized_pool_resource *mine = pmr::thread_local_pool_resource();
+    COMPARE(pmr::thread_local_pool_resource(), mine);
+    pmr::unsynchronized_pool_resource *other = nullptr;
+    std::thread t([&]() {
+        other = pmr::thread_local_pool_resource();
+        pmr::vector<int> v(1000, 1, other);
+    });
+    t.join();
+    VERIFY(other != mine);
+    VERIFY(*other != *mine);
+
+    void *p = mine->allocate(256);
+    mine->deallocate(p, 256);
+    COMPARE(mine->allocate(256), p);
+    mine->deallocate(p, 256);
+}
+
+TEST_TYPES(V, polymorphicAllocator, AllVectors)
+{
+    using T = typename V::EntryType;
+    pmr::monotonic_buffer_resource arena;
+    pmr::polymorphic_allocator<T> alloc(&arena);
+    pmr::polymorphic_allocator<double> rebound(alloc);
+    COMPARE(rebound.resource(), alloc.resource());
+    VERIFY(alloc == rebound);
+    VERIFY(alloc != pmr::polymorphic_allocator<T>());
+
+    pmr::vector<T> v(3 * V::Size + 1, T(2), &arena);
+    VERIFY(isAligned(v.data(), V::MemoryAlignment));
+    COMPARE(v.get_allocator().resource(), static_cast<pmr::memory_resource *>(&arena));
+    for (std::size_t i = 0; i < 3 * V::Size; i += V::Size) {
+        COMPARE(V(&v[i], Vc::Aligned), V(T(2)));
+    }
+    v.push_back(T(3));
+    COMPARE(v.back(), T(3));
+    // a copy uses the default resource
+    pmr::vector<T> copy(v);
+    COMPARE(copy.get_allocator().resource(), pmr::get_default_resource());
+    COMPARE(copy.size(), v.size());
+
+    std::vector<V, pmr::polymorphic_allocator<V>> vectors(5, V(T(1)), &arena);
+    VERIFY(isAligned(vectors.data(), alignof(V)));
+    COMPARE(vectors[4], V(T(1)));
+}
+
+TEST_TYPES(V, memoryFromResource, AllVectors)
+{
+    using T = typename V::EntryType;
+    CountingResource upstream;
+    {
+        pmr::unsynchronized_pool_resource pool(&upstream);
+        for (int round = 0; round < 3; ++round) {
+            Memory<V> m(5 * V::Size + 1, &pool);
+            VERIFY(isAligned(m.entries(), V::MemoryAlignment));
+            COMPARE(m.vectorsCount(), 6u);
+            COMPARE(m.lastVector().value(), V::Zero());
+            for (std::size_t i = 0; i < m.vectorsCount(); ++i) {
+                m.vector(i) = V(T(i));
+            }
+            Memory<V> moved(std::move(m));
+            COMPARE(moved.vector(5).value(), V(T(5)));
+            Memory<V> other(V::Size);
+            other = std::move(moved);  // swaps, both are released to their resources
+            COMPARE(other.vectorsCount(), 6u);
+        }
+        // the buffers were recycled by the pool
+        COMPARE(upstream.allocations, 1u);
+
+        Memory<V> copy(Memory<V>(V::Size, &pool));
+        COMPARE(copy.vectorsCount(), 1u);
+    }
+    COMPARE(upstream.allocations, upstream.deallocations);
+}
@@ -26,6 +26,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 }}}*/
 
 #include "unittest.h"
+#include <Vc/random>
+#include <algorithm>
+#include <array>
+#include <thread>
+#include <vector>
 
 #ifdef _WIN32
 void bzero(void *p, size_t n) { memset(p, 0, n); }
@@ -133,4 +138,298 @@ template <> void Random_<double_v>::run()
 }
 }  // namespace Tests
 
+// xoshiro128pp_engine {{{1
+// the scalar reference implementation by Blackman & Vigna
+struct Xoshiro128ppReference {
+    unsigned int s[4];
+
+    explicit Xoshiro128ppReference(std::uint64_t seed)
+    {
+        const std::uint64_t a = Vc::Detail::splitmix64(seed);
+        const std::uint64_t b = Vc::Detail::splitmix64(seed);
+        s[0] = static_cast<unsigned int>(a);
+        s[1] = static_cast<unsigned int>(a >> 32);
+        s[2] = static_cast<unsigned int>(b);
+        s[3] = static_cast<unsigned int>(b >> 32);
+    }
+
+    static unsigned int rotl(unsigned int x, int k) { return (x << k) | (x >> (32 - k)); }
+
+    unsigned int operator()()
+    {
+        const unsigned int result = rotl(s[0] + s[3], 7) + s[0];
+        const unsigned int t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 11);
+        return result;
+    }
+
+    void jump(const unsigned int (&poly)[4])
+    {
+        unsigned int t[4] = {0, 0, 0, 0};
+        for (int i = 0; i < 4; ++i) {
+            for (int b = 0; b < 32; ++b) {
+                if (poly[i] & (1u << b)) {
+                    for (int j = 0; j < 4; ++j) {
+                        t[j] ^= s[j];
+                    }
+                }
+                (*this)();
+            }
+        }
+        std::copy(t, t + 4, s);
+    }
+    void jump(int times = 1)
+    {
+        static constexpr unsigned int poly[4] = {0x8764000b, 0xf542d2d3, 0x6fa035c3,
+                                                 0x77f2db5b};
+        for (; times > 0; --times) {
+            jump(poly);
+        }
+    }
+    void long_jump()
+    {
+        static constexpr unsigned int poly[4] = {0xb523952e, 0x0b6f099f, 0xccf5a0ef,
+                                                 0x1c580662};
+        jump(poly);
+    }
+};
+
+template <std::size_t N> static void compareLanes(Vc::xoshiro128pp_engine<N> engine,
+                                                  std::uint64_t seed, int lanesBefore,
+                                                  bool longJump = false)
+{
+    std::vector<std::array<unsigned int, N>> drawn(64);
+    for (auto &d : drawn) {
+        const auto r = engine();
+        for (std::size_t k = 0; k < N; ++k) {
+            d[k] = r[k];
+        }
+    }
+    for (std::size_t k = 0; k < N; ++k) {
+        Xoshiro128ppReference ref(seed);
+        ref.jump(lanesBefore + int(k));
+        if (longJump) {
+            ref.long_jump();
+        }
+        for (std::size_t i = 0; i < drawn.size(); ++i) {
+            const unsigned int expected = ref();
+            COMPARE(drawn[i][k], expected) << "lane " << k << ", draw " << i << ", N = " << N;
+        }
+    }
+}
+
+template <std::size_t N> static void testXoshiroEngine()
+{
+    const std::uint64_t seed = 0x1234567890abcdefull;
+    Vc::xoshiro128pp_engine<N> engine(seed);
+    // lane k starts k * 2^64 steps after lane 0
+    compareLanes<N>(engine, seed, 0);
+
+    Vc::xoshiro128pp_engine<N> jumped = engine;
+    jumped.jump();
+    compareLanes<N>(jumped, seed, N);
+
+    Vc::xoshiro128pp_engine<N> longJumped = engine;
+    longJumped.long_jump();
+    compareLanes<N>(longJumped, seed, 0, true);
+
+    Vc::xoshiro128pp_engine<N> discarded = engine;
+    VERIFY(discarded == engine);
+    engine();
+    engine();
+    VERIFY(discarded != engine);
+    discarded.discard(2);
+    VERIFY(discarded == engine);
+
+    VERIFY(Vc::xoshiro128pp_engine<N>() == Vc::xoshiro128pp_engine<N>());
+    VERIFY(Vc::xoshiro128pp_engine<N>(1) != Vc::xoshiro128pp_engine<N>(2));
+}
+
+TEST(xoshiro128ppEngine)
+{
+    testXoshiroEngine<1>();
+    testXoshiroEngine<3>();
+    testXoshiroEngine<Vc::float_v::size()>();
+    testXoshiroEngine<Vc::double_v::size()>();
+    testXoshiroEngine<17>();
+}
+
+TEST(threadEngine)
+{
+    auto &engine = Vc::thread_engine<Vc::float_v::size()>();
+    VERIFY(&engine == &Vc::thread_engine<Vc::float_v::size()>());
+}
+
+// threads {{{1
+constexpr int NThreads = 4;
+
+// Returns the values draw(t) returns in thread t, for NThreads concurrently running
+// threads. The checks run after join() in the calling thread.
+template <typename T, typename F> static std::vector<std::vector<T>> drawInThreads(F &&draw)
+{
+    std::vector<std::vector<T>> streams(NThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NThreads; ++t) {
+        threads.emplace_back([&streams, &draw, t] { streams[t] = draw(t); });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    return streams;
+}
+
+template <typename V, typename Engine>
+static std::vector<unsigned int> drawFromEngine(Engine &engine, std::size_t count = 64)
+{
+    std::vector<unsigned int> stream;
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto r = engine();
+        for (std::size_t k = 0; k < V::Size; ++k) {
+            stream.push_back(r[k]);
+        }
+    }
+    return stream;
+}
+
+TEST_TYPES(V, randomInThreads, AllVectors)
+{
+    using T = typename V::EntryType;
+    const auto streams = drawInThreads<T>([](int) {
+        std::vector<T> stream;
+        for (int i = 0; i < 64; ++i) {
+            const V r = V::Random();
+            for (std::size_t k = 0; k < V::Size; ++k) {
+                stream.push_back(r[k]);
+            }
+        }
+        return stream;
+    });
+    for (int a = 0; a < NThreads; ++a) {
+        for (int b = a + 1; b < NThreads; ++b) {
+            VERIFY(streams[a] != streams[b])
+                << "threads " << a << " and " << b << " drew the same sequence";
+        }
+    }
+}
+
+TEST(seededEnginesInThreads)
+{
+    using V = Vc::float_v;
+    using Engine = Vc::xoshiro128pp_engine<V::Size>;
+    const auto streamFor = [](std::uint64_t seed) {
+        Engine engine(seed);
+        return drawFromEngine<V>(engine);
+    };
+
+    // the same seed yields the same stream in every thread
+    const auto reference = streamFor(42);
+    for (const auto &stream :
+         drawInThreads<unsigned int>([&](int) { return streamFor(42); })) {
+        VERIFY(stream == reference);
+    }
+
+    // different seeds yield different streams
+    const auto seeded =
+        drawInThreads<unsigned int>([&](int t) { return streamFor(1000 + t); });
+    for (int a = 0; a < NThreads; ++a) {
+        VERIFY(seeded[a] == streamFor(1000 + a)) << "thread " << a;
+        for (int b = a + 1; b < NThreads; ++b) {
+            VERIFY(seeded[a] != seeded[b]) << "seeds " << a << " and " << b;
+        }
+    }
+}
+
+TEST(threadEngineInThreads)
+{
+    using V = Vc::float_v;
+    using Engine = Vc::xoshiro128pp_engine<V::Size>;
+    const auto streams = drawInThreads<unsigned int>(
+        [](int) { return drawFromEngine<V>(Vc::thread_engine<V::Size>()); });
+
+    // every thread draws from the default engine advanced by k long jumps, with a
+    // different k per thread. Previous tests may already have used thread_engine, thus
+    // the k are not known exactly.
+    constexpr int MaxLongJumps = 4 * NThreads;
+    std::vector<std::vector<unsigned int>> candidates;
+    Engine engine;
+    for (int k = 0; k < MaxLongJumps; ++k) {
+        Engine copy = engine;
+        candidates.push_back(drawFromEngine<V>(copy));
+        engine.long_jump();
+    }
+    std::vector<int> jumps;
+    for (const auto &stream : streams) {
+        const auto it = std::find(candidates.begin(), candidates.end(), stream);
+        VERIFY(it != candidates.end()) << "not a long-jumped default stream";
+        const int k = int(it - candidates.begin());
+        VERIFY(std::find(jumps.begin(), jumps.end(), k) == jumps.end())
+            << "two threads got the stream of " << k << " long jumps";
+        jumps.push_back(k);
+    }
+}
+
+// distributions {{{1
+using DistributionTypes =
+    vir::concat<RealVectors, RealSimdArrays<3>, RealSimdArrays<8>, RealSimdArrays<19>>;
+
+template <typename V, typename Distribution, typename F>
+static void sampleMoments(Distribution &&dist, double &mean, double &variance, F &&check)
+{
+    Vc::xoshiro128pp_engine<V::Size> engine;
+    constexpr int Samples = 200000;
+    double sum = 0, sum2 = 0;
+    for (int i = 0; i < Samples / int(V::Size); ++i) {
+        const V x = dist(engine);
+        check(x);
+        for (std::size_t k = 0; k < V::Size; ++k) {
+            sum += x[k];
+            sum2 += double(x[k]) * x[k];
+        }
+    }
+    const double n = Samples / int(V::Size) * int(V::Size);
+    mean = sum / n;
+    variance = sum2 / n - mean * mean;
+}
+
+TEST_TYPES(V, uniformRealDistribution, DistributionTypes)
+{
+    using T = typename V::EntryType;
+    double mean, variance;
+    sampleMoments<V>(Vc::uniform_real_distribution<V>(T(-1), T(3)), mean, variance,
+                     [](const V &x) {
+                         VERIFY(all_of(x >= T(-1))) << x;
+                         VERIFY(all_of(x < T(3))) << x;
+                     });
+    VERIFY(std::abs(mean - 1.) < 0.02) << mean;
+    VERIFY(std::abs(variance - 16. / 12.) < 0.02) << variance;
+}
+
+TEST_TYPES(V, normalDistribution, DistributionTypes)
+{
+    using T = typename V::EntryType;
+    double mean, variance;
+    sampleMoments<V>(Vc::normal_distribution<V>(T(2), T(3)), mean, variance,
+                     [](const V &x) { VERIFY(all_of(isfinite(x))) << x; });
+    VERIFY(std::abs(mean - 2.) < 0.05) << mean;
+    VERIFY(std::abs(variance - 9.) < 0.15) << variance;
+}
+
+TEST_TYPES(V, exponentialDistribution, DistributionTypes)
+{
+    using T = typename V::EntryType;
+    double mean, variance;
+    sampleMoments<V>(Vc::exponential_distribution<V>(T(4)), mean, variance,
+                     [](const V &x) {
+                         VERIFY(all_of(x >= T(0))) << x;
+                         VERIFY(all_of(isfinite(x))) << x;
+                     });
+    VERIFY(std::abs(mean - 0.25) < 0.005) << mean;
+    VERIFY(std::abs(variance - 0.0625) < 0.003) << variance;
+}
+
 // vim: foldmethod=marker
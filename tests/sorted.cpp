@@ -26,6 +26,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 }}}*/
 
 #include "unittest.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <type_traits>
+#include <vector>
 
 TEST_TYPES(Vec, testSort, concat<AllVectors, SimdArrays<15>, SimdArrays<8>, SimdArrays<3>, SimdArrays<1>>)
 {
@@ -89,4 +94,119 @@ TEST_TYPES(Vec, testSort, concat<AllVectors, SimdArrays<15>, SimdArrays<8>, Simd
     }
 }
 
+TEST_TYPES(V, simdSort, AllVectors)
+{
+    typedef typename V::EntryType T;
+    std::default_random_engine rne;
+    std::uniform_int_distribution<int> values(0, 30000);
+    std::uniform_int_distribution<int> fewValues(0, 3);
+    for (std::size_t n : {0u, 1u, 2u, 7u, 64u, 100u, 1001u, 5000u, 100000u}) {
+        for (int pattern = 0; pattern < 5; ++pattern) {
+            std::vector<T> data(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                switch (pattern) {
+                case 0: data[i] = T(values(rne)); break;
+                case 1: data[i] = T(fewValues(rne)); break;
+                case 2: data[i] = T(i % 30000); break;
+                case 3: data[i] = T((n - i) % 30000); break;
+                case 4: data[i] = T(5); break;
+                }
+            }
+            // the range [1, n) starts at an unaligned address
+            std::vector<T> reference = data;
+            if (n > 0) {
+                std::sort(reference.begin() + 1, reference.end());
+                Vc::simd_sort(data.begin() + 1, data.end());
+                for (std::size_t i = 0; i < n; ++i) {
+                    COMPARE(data[i], reference[i])
+                        << "n: " << n << ", pattern: " << pattern << ", i: " << i;
+                }
+            }
+            std::sort(reference.begin(), reference.end());
+            Vc::simd_sort(data.begin(), data.end());
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(data[i], reference[i])
+                    << "n: " << n << ", pattern: " << pattern << ", i: " << i;
+            }
+        }
+    }
+}
+
+// simdSortMixed {{{1
+using SortVectors = concat<AllVectors, Vc::schar_v, Vc::uchar_v, Vc::llong_v, Vc::ullong_v>;
+
+// patterns 0-2 of random values, with negative values, fractions, and both zeros where T
+// allows them
+template <typename T>
+static T randomSortValue(std::default_random_engine &rne, int pattern, std::true_type)
+{
+    using limits = std::numeric_limits<T>;
+    switch (pattern) {
+    case 0:
+        return std::uniform_real_distribution<T>(-1000, 1000)(rne);
+    case 1: {
+        static const T few[] = {T(-0.), T(0.), T(-1.5), T(0.25), T(3), T(-1000.125)};
+        return few[std::uniform_int_distribution<int>(0, 5)(rne)];
+    }
+    default: {
+        const int r = std::uniform_int_distribution<int>(0, 15)(rne);
+        return r == 0 ? T(-0.) : r == 1 ? T(0.) : r == 2 ? -limits::infinity()
+             : r == 3 ? limits::infinity() : r == 4 ? limits::denorm_min()
+             : r == 5 ? limits::lowest() : r == 6 ? limits::max()
+             : std::uniform_real_distribution<T>(-1, 1)(rne) * T(1e-30);
+    }
+    }
+}
+
+template <typename T>
+static T randomSortValue(std::default_random_engine &rne, int pattern, std::false_type)
+{
+    using limits = std::numeric_limits<T>;
+    // uniform_int_distribution is not defined for char and short
+    using D = typename std::conditional<(sizeof(T) < sizeof(int)), int, T>::type;
+    switch (pattern) {
+    case 0:
+        return T(std::uniform_int_distribution<D>(limits::min(), limits::max())(rne));
+    case 1: {
+        const T few[] = {limits::min(), T(limits::min() + 1), T(-1), T(0), T(1),
+                         limits::max()};
+        return few[std::uniform_int_distribution<int>(0, 5)(rne)];
+    }
+    default:
+        return T(std::uniform_int_distribution<int>(-3, 3)(rne));
+    }
+}
+
+TEST_TYPES(V, simdSortMixed, SortVectors)
+{
+    using T = typename V::EntryType;
+    std::default_random_engine rne;
+    const std::size_t N = V::Size;
+    // the lengths are not multiples of V::Size (for V::Size > 1) and the larger ones
+    // exceed the quicksort threshold of simd_sort
+    for (std::size_t n : {std::size_t(3), 2 * N - 1, 2 * N + 1, 5 * N + 3, 16 * N - 1,
+                          std::size_t(1001), std::size_t(40013), std::size_t(100003)}) {
+        for (int pattern = 0; pattern < 3; ++pattern) {
+            std::vector<T> data(n);
+            for (auto &x : data) {
+                x = randomSortValue<T>(rne, pattern, std::is_floating_point<T>());
+            }
+            std::vector<T> reference = data;
+            std::sort(reference.begin(), reference.end());
+            Vc::simd_sort(data.begin(), data.end());
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(data[i], reference[i])
+                    << "n: " << n << ", pattern: " << pattern << ", i: " << i;
+            }
+            if (std::is_floating_point<T>::value) {
+                // -0 and +0 compare equal, but both must be kept
+                const auto negativeZero = [](T x) { return x == 0 && std::signbit(x); };
+                COMPARE(std::count_if(data.begin(), data.end(), negativeZero),
+                        std::count_if(reference.begin(), reference.end(), negativeZero))
+                    << "n: " << n << ", pattern: " << pattern;
+            }
+        }
+    }
+}
+
 // vim: foldmethod=marker
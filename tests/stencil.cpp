@@ -0,0 +1,306 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/stencil>
+#include <vector>
+
+using namespace Vc;
+
+using StencilTypes = vir::Typelist<double_v, float_v, int_v, short_v>;
+
+struct SecondDerivative {
+    static constexpr int radius = 1;
+    static constexpr int coefficient(int dx) { return dx == 0 ? -2 : 1; }
+};
+// wider than one vector for small vector sizes, with a zero tap
+struct Asymmetric {
+    static constexpr int radius = 3;
+    static constexpr int coefficient(int dx) { return dx == 1 ? 0 : dx + 4; }
+};
+struct Laplace2D {
+    static constexpr int radius = 1;
+    static constexpr int coefficient(int dy, int dx)
+    {
+        return dy == 0 && dx == 0 ? -4 : dy == 0 || dx == 0 ? 1 : 0;
+    }
+};
+struct Dense2D {
+    static constexpr int radius = 2;
+    static constexpr int coefficient(int dy, int dx) { return 3 * dy - dx + 1; }
+};
+struct Laplace3D {
+    static constexpr int radius = 1;
+    static constexpr int coefficient(int dz, int dy, int dx)
+    {
+        return dz == 0 && dy == 0 && dx == 0
+                   ? -6
+                   : (dz != 0) + (dy != 0) + (dx != 0) == 1 ? 1 : 0;
+    }
+};
+struct Dense3D {
+    static constexpr int radius = 1;
+    static constexpr int coefficient(int dz, int dy, int dx) { return 2 * dz + dy - dx; }
+};
+
+/* A grid with a halo of R entries on every side and some padding at the end of every row,
+ * initialized with small integers, such that all results are exact.
+ */
+template <typename T> struct Grid {
+    std::size_t nx, ny, nz, r, pitch, slicePitch;
+    std::vector<T, Vc::Allocator<T>> data;
+    Grid(std::size_t nx_, std::size_t ny_, std::size_t nz_, std::size_t r_,
+         std::size_t offset, int seed)
+        : nx(nx_)
+        , ny(ny_)
+        , nz(nz_)
+        , r(r_)
+        , pitch(nx + 2 * r + offset + 3)
+        , slicePitch(pitch * (ny + 2 * r) + offset)
+        , data(slicePitch * (nz + 2 * r) + pitch + offset)
+    {
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            data[i] = T(int((i * 7 + seed) % 11) - 5);
+        }
+        origin = offset + r * (slicePitch + pitch + 1);
+    }
+    std::size_t origin;
+    T *get() { return data.data() + origin; }
+    T &operator()(int z, int y, int x)
+    {
+        return data[origin + z * std::ptrdiff_t(slicePitch) + y * std::ptrdiff_t(pitch) + x];
+    }
+};
+
+// the lengths of the rows to test: scalar only, head and tail only, and window loops
+template <typename V> std::vector<std::size_t> lengths()
+{
+    return {1, V::Size - 1, V::Size, V::Size + 1, 2 * V::Size + 3, 5 * V::Size + 1, 67};
+}
+
+TEST_TYPES(V, stencil1D, StencilTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    for (std::size_t n : lengths<V>()) {
+        for (std::size_t offset = 0; offset < V::Size; ++offset) {
+            Grid<T> in(n, 1, 1, 3, offset, 1);
+            Grid<T> out(n, 1, 1, 0, (offset + 1) % V::Size, 2);
+            simd_stencil<SecondDerivative>(in.get(), out.get(), n);
+            for (int x = 0; x < int(n); ++x) {
+                COMPARE(out(0, 0, x), T(in(0, 0, x - 1) - 2 * in(0, 0, x) + in(0, 0, x + 1)))
+                    << "n: " << n << " x: " << x << " offset: " << offset;
+            }
+            simd_stencil<Asymmetric>(in.get(), out.get(), n);
+            for (int x = 0; x < int(n); ++x) {
+                T reference = 0;
+                for (int dx = -3; dx <= 3; ++dx) {
+                    reference += T(Asymmetric::coefficient(dx)) * in(0, 0, x + dx);
+                }
+                COMPARE(out(0, 0, x), reference)
+                    << "n: " << n << " x: " << x << " offset: " << offset;
+            }
+        }
+    }
+}
+
+template <typename S, typename T> void compare2D(Grid<T> &in, Grid<T> &out)
+{
+    const int r = S::radius;
+    for (int y = 0; y < int(in.ny); ++y) {
+        for (int x = 0; x < int(in.nx); ++x) {
+            T reference = 0;
+            for (int dy = -r; dy <= r; ++dy) {
+                for (int dx = -r; dx <= r; ++dx) {
+                    reference += T(S::coefficient(dy, dx)) * in(0, y + dy, x + dx);
+                }
+            }
+            COMPARE(out(0, y, x), reference) << "nx: " << in.nx << " x: " << x
+                                              << " y: " << y;
+        }
+    }
+}
+
+TEST_TYPES(V, stencil2D, StencilTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    for (std::size_t nx : lengths<V>()) {
+        for (std::size_t offset : {std::size_t(0), std::size_t(1)}) {
+            Grid<T> in(nx, 5, 1, 2, offset, 1);
+            Grid<T> out(nx, 5, 1, 0, 0, 2);
+            simd_stencil<Laplace2D>(in.get(), in.pitch, out.get(), out.pitch, nx, 5);
+            compare2D<Laplace2D>(in, out);
+            simd_stencil<Dense2D>(in.get(), in.pitch, out.get(), out.pitch, nx, 5);
+            compare2D<Dense2D>(in, out);
+        }
+    }
+}
+
+template <typename S, typename T> void compare3D(Grid<T> &in, Grid<T> &out)
+{
+    const int r = S::radius;
+    for (int z = 0; z < int(in.nz); ++z) {
+        for (int y = 0; y < int(in.ny); ++y) {
+            for (int x = 0; x < int(in.nx); ++x) {
+                T reference = 0;
+                for (int dz = -r; dz <= r; ++dz) {
+                    for (int dy = -r; dy <= r; ++dy) {
+                        for (int dx = -r; dx <= r; ++dx) {
+                            reference += T(S::coefficient(dz, dy, dx)) *
+                                         in(z + dz, y + dy, x + dx);
+                        }
+                    }
+                }
+                COMPARE(out(z, y, x), reference) << "nx: " << in.nx << " x: " << x
+                                                  << " y: " << y << " z: " << z;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, stencil3D, StencilTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    for (std::size_t nx : lengths<V>()) {
+        Grid<T> in(nx, 3, 4, 1, 1, 1);
+        Grid<T> out(nx, 3, 4, 0, 0, 2);
+        simd_stencil<Laplace3D>(in.get(), in.pitch, in.slicePitch, out.get(), out.pitch,
+                                out.slicePitch, nx, 3, 4);
+        compare3D<Laplace3D>(in, out);
+        simd_stencil<Dense3D>(in.get(), in.pitch, in.slicePitch, out.get(), out.pitch,
+                              out.slicePitch, nx, 3, 4);
+        compare3D<Dense3D>(in, out);
+    }
+}
+
+TEST_TYPES(V, stencilParallel, StencilTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    Common::ThreadPool pool(3);
+    // small chunks to get many of them and thus aligned and unaligned boundaries
+    const auto policy = execution::par_simd.chunk_size(3 * sizeof(V)).on(pool);
+    for (std::size_t nx : {std::size_t(1), std::size_t(V::Size + 1), std::size_t(67)}) {
+        Grid<T> in(nx, 9, 7, 2, 1, 1);
+        Grid<T> out(nx, 9, 7, 0, 0, 2);
+        simd_stencil<Asymmetric>(policy, in.get() - 1, out.get(), nx);
+        for (int x = 0; x < int(nx); ++x) {
+            T reference = 0;
+            for (int dx = -3; dx <= 3; ++dx) {
+                reference += T(Asymmetric::coefficient(dx)) * in(0, 0, x - 1 + dx);
+            }
+            COMPARE(out(0, 0, x), reference) << "nx: " << nx << " x: " << x;
+        }
+
+        Grid<T> in2(nx, 9, 1, 2, 0, 3);
+        Grid<T> out2(nx, 9, 1, 0, 0, 4);
+        simd_stencil<Dense2D>(policy, in2.get(), in2.pitch, out2.get(), out2.pitch, nx, 9);
+        compare2D<Dense2D>(in2, out2);
+
+        simd_stencil<Dense3D>(policy, in.get(), in.pitch, in.slicePitch, out.get(),
+                              out.pitch, out.slicePitch, nx, 9, 7);
+        compare3D<Dense3D>(in, out);
+    }
+}
+
+// fillHalo {{{1
+int haloIndex(int i, int n, Boundary b)
+{
+    switch (b) {
+    case Boundary::Clamp:
+        return i < 0 ? 0 : i >= n ? n - 1 : i;
+    case Boundary::Periodic:
+        return (i % n + n) % n;
+    default:
+        return i < 0 || i >= n ? -1 : i;
+    }
+}
+
+TEST(fillHalo)
+{
+    for (Boundary b : {Boundary::Zeros, Boundary::Clamp, Boundary::Periodic}) {
+        for (int n : {1, 2, 5}) {
+            // 1D
+            Grid<int> g1(n, 1, 1, 3, 0, 1);
+            Grid<int> copy1 = g1;
+            fill_halo(g1.get(), n, 3, b);
+            for (int x = -3; x < n + 3; ++x) {
+                const int i = haloIndex(x, n, b);
+                COMPARE(g1(0, 0, x), i < 0 ? 0 : copy1(0, 0, i)) << "x: " << x;
+            }
+            // 2D
+            Grid<int> g2(n, n + 1, 1, 2, 0, 1);
+            Grid<int> copy2 = g2;
+            fill_halo(g2.get(), g2.pitch, n, n + 1, 2, b);
+            for (int y = -2; y < n + 3; ++y) {
+                for (int x = -2; x < n + 2; ++x) {
+                    const int i = haloIndex(x, n, b), j = haloIndex(y, n + 1, b);
+                    COMPARE(g2(0, y, x), i < 0 || j < 0 ? 0 : copy2(0, j, i))
+                        << "x: " << x << " y: " << y;
+                }
+            }
+            // 3D
+            Grid<int> g3(n, 2, n + 2, 2, 0, 1);
+            Grid<int> copy3 = g3;
+            fill_halo(g3.get(), g3.pitch, g3.slicePitch, n, 2, n + 2, 2, b);
+            for (int z = -2; z < n + 4; ++z) {
+                for (int y = -2; y < 4; ++y) {
+                    for (int x = -2; x < n + 2; ++x) {
+                        const int i = haloIndex(x, n, b), j = haloIndex(y, 2, b),
+                                  k = haloIndex(z, n + 2, b);
+                        COMPARE(g3(z, y, x),
+                                i < 0 || j < 0 || k < 0 ? 0 : copy3(k, j, i))
+                            << "x: " << x << " y: " << y << " z: " << z;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, stencilPeriodic, StencilTypes) //{{{1
+{
+    // a periodic halo turns the stencil into a cyclic convolution
+    typedef typename V::EntryType T;
+    const std::size_t nx = 3 * V::Size + 2, ny = 4;
+    Grid<T> in(nx, ny, 1, 2, 0, 1);
+    Grid<T> out(nx, ny, 1, 0, 0, 2);
+    fill_halo(in.get(), in.pitch, nx, ny, 2, Boundary::Periodic);
+    simd_stencil<Dense2D>(in.get(), in.pitch, out.get(), out.pitch, nx, ny);
+    for (int y = 0; y < int(ny); ++y) {
+        for (int x = 0; x < int(nx); ++x) {
+            T reference = 0;
+            for (int dy = -2; dy <= 2; ++dy) {
+                for (int dx = -2; dx <= 2; ++dx) {
+                    reference += T(Dense2D::coefficient(dy, dx)) *
+                                 in(0, (y + dy + ny) % ny, (x + dx + nx) % nx);
+                }
+            }
+            COMPARE(out(0, y, x), reference) << "x: " << x << " y: " << y;
+        }
+    }
+}
+
+// vim: foldmethod=marker
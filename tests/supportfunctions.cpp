@@ -61,6 +61,11 @@ TEST(testExtraInstructions)
     COMPARE(!(extra & Vc::Sse4aInstructions), !CpuId::hasSse4a());
     COMPARE(!(extra & Vc::FmaInstructions), !CpuId::hasFma());
     COMPARE(!(extra & Vc::Bmi2Instructions), !CpuId::hasBmi2());
+    if (extra & Vc::Avx512VlInstructions) {
+        VERIFY(Vc::isImplementationSupported(Vc::AVX2Impl));
+        VERIFY(CpuId::hasAvx512f() && CpuId::hasAvx512cd() && CpuId::hasAvx512vl() &&
+               CpuId::hasAvx512bw() && CpuId::hasAvx512dq());
+    }
 }
 
 // vim: foldmethod=marker
@@ -0,0 +1,256 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/Memory>
+#include <vector>
+
+using namespace Vc;
+
+template <typename T> T entry(std::size_t r, std::size_t c)
+{
+    return T((r * 131 + c * 7) % 127);
+}
+
+TEST_TYPES(V, tiledAccess, AllVectors) //{{{1
+{
+    typedef typename V::EntryType T;
+    TiledMemory<V, 37, 70> m;
+    constexpr std::size_t Side = TiledMemory<V, 37, 70>::tileSide();
+    COMPARE(m.rowsCount(), 37u);
+    COMPARE(m.columnsCount(), 70u);
+    COMPARE(m.tileRowsCount(), (37 + Side - 1) / Side);
+    COMPARE(m.tileColumnsCount(), (70 + Side - 1) / Side);
+    COMPARE(m.rowVectorsCount(), m.tileColumnsCount() * Side / V::Size);
+    for (std::size_t r = 0; r < m.rowsCount(); ++r) {
+        for (std::size_t c = 0; c < m.columnsCount(); ++c) {
+            m(r, c) = entry<T>(r, c);
+        }
+    }
+    for (std::size_t r = 0; r < m.rowsCount(); ++r) {
+        for (std::size_t i = 0; i < m.rowVectorsCount(); ++i) {
+            const V x = m.vector(r, i);
+            for (std::size_t k = 0; k < V::Size; ++k) {
+                const std::size_t c = i * V::Size + k;
+                COMPARE(x[k], c < m.columnsCount() ? entry<T>(r, c) : T(0))
+                    << "r: " << r << ", c: " << c;
+            }
+        }
+    }
+
+    std::size_t tiles = 0;
+    for (auto tile : m) {
+        COMPARE(tile.firstRow(), tiles / m.tileColumnsCount() * Side);
+        COMPARE(tile.firstColumn(), tiles % m.tileColumnsCount() * Side);
+        COMPARE(tile.entries(), m.tile(tiles / m.tileColumnsCount(),
+                                       tiles % m.tileColumnsCount()).entries());
+        for (std::size_t r = 0; r < tile.side(); ++r) {
+            for (std::size_t i = 0; i < tile.rowVectorsCount(); ++i) {
+                tile.vector(r, i) += V::One();
+            }
+        }
+        ++tiles;
+    }
+    COMPARE(tiles, m.tilesCount());
+    COMPARE(std::size_t(m.end() - m.begin()), m.tilesCount());
+    const auto &cm = m;
+    for (std::size_t r = 0; r < Side * m.tileRowsCount(); ++r) {
+        for (std::size_t c = 0; c < Side * m.tileColumnsCount(); ++c) {
+            const bool inside = r < m.rowsCount() && c < m.columnsCount();
+            COMPARE(cm(r, c), T((inside ? entry<T>(r, c) : T(0)) + T(1)))
+                << "r: " << r << ", c: " << c;
+        }
+    }
+}
+
+TEST_TYPES(V, tiledCopy, AllVectors) //{{{1
+{
+    typedef typename V::EntryType T;
+    const std::size_t rows = 45, cols = 3 * V::Size + 5, ld = cols + 3;
+    std::vector<T> data(rows * ld);
+    for (std::size_t r = 0; r < rows; ++r) {
+        for (std::size_t c = 0; c < cols; ++c) {
+            data[r * ld + c] = entry<T>(r, c);
+        }
+    }
+    TiledMemory<V> m(rows, cols);
+    m.copyFrom(data.data(), ld);
+    for (std::size_t r = 0; r < rows; ++r) {
+        for (std::size_t c = 0; c < cols; ++c) {
+            COMPARE(m(r, c), entry<T>(r, c)) << "r: " << r << ", c: " << c;
+        }
+    }
+    std::vector<T> back(rows * ld, T(1));
+    m.copyTo(back.data(), ld);
+    for (std::size_t r = 0; r < rows; ++r) {
+        for (std::size_t c = 0; c < ld; ++c) {
+            COMPARE(back[r * ld + c], c < cols ? entry<T>(r, c) : T(1));
+        }
+    }
+
+    Memory<V, 9, 2 * V::Size + 1> mem;
+    for (std::size_t r = 0; r < mem.rowsCount(); ++r) {
+        for (std::size_t c = 0; c < mem[r].entriesCount(); ++c) {
+            mem[r][c] = entry<T>(r, c);
+        }
+    }
+    TiledMemory<V, 9, 2 * V::Size + 1> fixed;
+    fixed.copyFrom(mem);
+    mem.setZero();
+    fixed.copyTo(mem);
+    for (std::size_t r = 0; r < mem.rowsCount(); ++r) {
+        for (std::size_t c = 0; c < mem[r].entriesCount(); ++c) {
+            COMPARE(mem[r][c], entry<T>(r, c));
+        }
+    }
+
+    TiledMemory<V> copy(m);
+    TiledMemory<V> moved(std::move(m));
+    COMPARE(m.rowsCount(), 0u);
+    COMPARE(moved.rowsCount(), rows);
+    COMPARE(moved.columnsCount(), cols);
+    for (std::size_t r = 0; r < rows; ++r) {
+        for (std::size_t c = 0; c < cols; ++c) {
+            COMPARE(copy(r, c), entry<T>(r, c));
+            COMPARE(moved(r, c), entry<T>(r, c));
+        }
+    }
+}
+
+TEST_TYPES(V, transposeRowMajor, AllVectors) //{{{1
+{
+    typedef typename V::EntryType T;
+    for (std::size_t rows : {1, 3, 8, 33, 70, 130}) {
+        for (std::size_t cols : {1, 4, 17, 64, 101}) {
+            const std::size_t ldIn = cols + 1, ldOut = rows + 2;
+            std::vector<T> in(rows * ldIn), out(cols * ldOut, T(1));
+            for (std::size_t r = 0; r < rows; ++r) {
+                for (std::size_t c = 0; c < cols; ++c) {
+                    in[r * ldIn + c] = entry<T>(r, c);
+                }
+            }
+            simd_transpose(rows, cols, in.data(), ldIn, out.data(), ldOut);
+            for (std::size_t c = 0; c < cols; ++c) {
+                for (std::size_t r = 0; r < ldOut; ++r) {
+                    COMPARE(out[c * ldOut + r], r < rows ? entry<T>(r, c) : T(1))
+                        << "rows: " << rows << ", cols: " << cols;
+                }
+            }
+        }
+    }
+    for (std::size_t n : {1, 5, 16, 31, 100, 129}) {
+        const std::size_t ld = n + 3;
+        std::vector<T> a(n * ld, T(1));
+        for (std::size_t r = 0; r < n; ++r) {
+            for (std::size_t c = 0; c < n; ++c) {
+                a[r * ld + c] = entry<T>(r, c);
+            }
+        }
+        simd_transpose(n, a.data(), ld);
+        for (std::size_t r = 0; r < n; ++r) {
+            for (std::size_t c = 0; c < ld; ++c) {
+                COMPARE(a[r * ld + c], c < n ? entry<T>(c, r) : T(1)) << "n: " << n;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, transposeMemory, AllVectors) //{{{1
+{
+    typedef typename V::EntryType T;
+    Memory<V, 11, 3 * V::Size + 2> in;
+    Memory<V, 3 * V::Size + 2, 11> out;
+    Memory<V, 19, 19> square;
+    for (std::size_t r = 0; r < in.rowsCount(); ++r) {
+        for (std::size_t c = 0; c < in[r].entriesCount(); ++c) {
+            in[r][c] = entry<T>(r, c);
+        }
+    }
+    for (std::size_t r = 0; r < square.rowsCount(); ++r) {
+        for (std::size_t c = 0; c < square[r].entriesCount(); ++c) {
+            square[r][c] = entry<T>(r, c);
+        }
+    }
+    simd_transpose(in, out);
+    simd_transpose(square);
+    for (std::size_t r = 0; r < out.rowsCount(); ++r) {
+        for (std::size_t c = 0; c < out[r].entriesCount(); ++c) {
+            COMPARE(out[r][c], entry<T>(c, r));
+        }
+    }
+    for (std::size_t r = 0; r < square.rowsCount(); ++r) {
+        for (std::size_t c = 0; c < square[r].entriesCount(); ++c) {
+            COMPARE(square[r][c], entry<T>(c, r));
+        }
+    }
+}
+
+TEST_TYPES(V, transposeTiled, AllVectors) //{{{1
+{
+    typedef typename V::EntryType T;
+    constexpr std::size_t Side = TiledMemory<V>::tileSide();
+    const std::size_t rows = 2 * Side + 3, cols = 3 * Side + 1;
+
+    TiledMemory<V> in(rows, cols), out(cols, rows);
+    for (std::size_t r = 0; r < rows; ++r) {
+        for (std::size_t c = 0; c < cols; ++c) {
+            in(r, c) = entry<T>(r, c);
+        }
+    }
+    simd_transpose(in, out);
+    for (std::size_t r = 0; r < cols; ++r) {
+        for (std::size_t c = 0; c < rows; ++c) {
+            COMPARE(out(r, c), entry<T>(c, r)) << "r: " << r << ", c: " << c;
+        }
+    }
+
+    // rectangular tile grid: tiles are permuted in place
+    simd_transpose(in);
+    COMPARE(in.rowsCount(), cols);
+    COMPARE(in.columnsCount(), rows);
+    for (std::size_t r = 0; r < Side * in.tileRowsCount(); ++r) {
+        for (std::size_t c = 0; c < Side * in.tileColumnsCount(); ++c) {
+            COMPARE(in(r, c), r < cols && c < rows ? entry<T>(c, r) : T(0))
+                << "r: " << r << ", c: " << c;
+        }
+    }
+
+    TiledMemory<V, 2 * Side + 5, 2 * Side + 5> square;
+    for (std::size_t r = 0; r < square.rowsCount(); ++r) {
+        for (std::size_t c = 0; c < square.columnsCount(); ++c) {
+            square(r, c) = entry<T>(r, c);
+        }
+    }
+    simd_transpose(square);
+    for (std::size_t r = 0; r < square.rowsCount(); ++r) {
+        for (std::size_t c = 0; c < square.columnsCount(); ++c) {
+            COMPARE(square(r, c), entry<T>(c, r));
+        }
+    }
+}
+
+// vim: foldmethod=marker